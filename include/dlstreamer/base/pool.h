@@ -1,5 +1,5 @@
 /*******************************************************************************
- * Copyright (C) 2022-2024 Intel Corporation
+ * Copyright (C) 2022-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  ******************************************************************************/
@@ -7,50 +7,110 @@
 #pragma once
 
 #include <chrono>
+#include <condition_variable>
+#include <deque>
 #include <functional>
 #include <memory>
 #include <mutex>
-#include <thread>
-#include <vector>
 
 namespace dlstreamer {
 
+struct PoolStats {
+    size_t hits = 0;                       // requests served by a previously released object
+    size_t allocations = 0;                // objects created by allocator
+    size_t waits = 0;                      // requests blocked because pool was at max size
+    std::chrono::nanoseconds wait_time{0}; // total time requests were blocked
+};
+
+/**
+ * @brief Pool of reusable objects held by std::shared_ptr (T is std::shared_ptr<...>).
+ *
+ * get_or_create() returns a handle sharing the pooled object. When the last copy of the handle is dropped, the object
+ * is put back to the free list and a thread waiting in get_or_create() is woken up. The is_available callback is
+ * checked before an object is reused, as parts of the object (e.g. tensors of a frame) may outlive the handle. Such
+ * objects are re-checked periodically while a request waits.
+ */
 template <typename T>
 class Pool {
+    using element_type = typename T::element_type;
+
+    // Shared with handles, so handles released after the pool is destroyed stay valid
+    struct State {
+        std::mutex mutex;
+        std::condition_variable released;
+        std::deque<T> free; // objects not referenced by any handle, oldest released first
+        size_t size = 0;
+        PoolStats stats;
+    };
+
   public:
     Pool(std::function<T()> allocator, std::function<bool(T &)> is_available, size_t max_pool_size = 0)
-        : _allocator(allocator), _is_available(is_available), _max_pool_size(max_pool_size) {
+        : _state(std::make_shared<State>()), _allocator(allocator), _is_available(is_available),
+          _max_pool_size(max_pool_size) {
     }
 
     T get_or_create() {
+        std::unique_lock<std::mutex> lock(_state->mutex);
+        PoolStats &stats = _state->stats;
+        bool waited = false;
+        auto wait_start = std::chrono::steady_clock::time_point();
 
         for (;;) {
-            {
-                std::lock_guard<std::mutex> lock(_mutex);
-                for (T &object : _pool) {
-                    if (_is_available(object))
-                        return object;
-                }
-                if (!_max_pool_size || _pool.size() < _max_pool_size) { // allocate new object
-                    T object = _allocator();
-                    _pool.push_back(object);
-                    return object;
-                }
+            for (auto it = _state->free.begin(); it != _state->free.end(); ++it) {
+                if (!_is_available(*it))
+                    continue;
+                T object = std::move(*it);
+                _state->free.erase(it);
+                stats.hits++;
+                if (waited)
+                    stats.wait_time += std::chrono::steady_clock::now() - wait_start;
+                return make_handle(std::move(object));
+            }
+            if (!_max_pool_size || _state->size < _max_pool_size) { // allocate new object
+                T object = _allocator();
+                _state->size++;
+                stats.allocations++;
+                if (waited)
+                    stats.wait_time += std::chrono::steady_clock::now() - wait_start;
+                return make_handle(std::move(object));
+            }
+            if (!waited) {
+                waited = true;
+                wait_start = std::chrono::steady_clock::now();
+                stats.waits++;
             }
-            std::this_thread::sleep_for(std::chrono::milliseconds(1)); // TODO optimize
+            _state->released.wait_for(lock, RECHECK_INTERVAL);
         }
     }
 
     size_t size() {
-        std::lock_guard<std::mutex> lock(_mutex);
-        return _pool.size();
+        std::lock_guard<std::mutex> lock(_state->mutex);
+        return _state->size;
+    }
+
+    PoolStats stats() {
+        std::lock_guard<std::mutex> lock(_state->mutex);
+        return _state->stats;
     }
 
   private:
+    // Wake-up period for objects released as handle but still not available (see is_available)
+    static constexpr std::chrono::milliseconds RECHECK_INTERVAL{1};
+
+    T make_handle(T object) {
+        element_type *ptr = object.get();
+        return T(ptr, [state = _state, object = std::move(object)](element_type *) mutable {
+            {
+                std::lock_guard<std::mutex> lock(state->mutex);
+                state->free.push_back(std::move(object));
+            }
+            state->released.notify_one();
+        });
+    }
+
+    std::shared_ptr<State> _state;
     std::function<T()> _allocator;
     std::function<bool(T &)> _is_available;
-    std::vector<T> _pool;
-    std::mutex _mutex;
     size_t _max_pool_size = 0;
 };
 
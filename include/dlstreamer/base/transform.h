@@ -66,6 +66,10 @@ class BaseTransform : public BaseElement<Transform> {
         return _pool ? _pool->size() : 0;
     }
 
+    PoolStats pool_stats() {
+        return _pool ? _pool->stats() : PoolStats();
+    }
+
   protected:
     ContextPtr _app_context;
     FrameInfo _input_info;
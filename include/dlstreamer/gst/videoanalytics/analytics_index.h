@@ -0,0 +1,263 @@
+/*******************************************************************************
+ * Copyright (C) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+/**
+ * @file analytics_index.h
+ * @brief This file contains GVA::AnalyticsIndex class - index of GstAnalyticsRelationMeta entries attached to a
+ * video frame, built in a single pass over the metadata.
+ */
+
+#pragma once
+
+#include <gst/analytics/analytics.h>
+
+#include <cstring>
+#include <limits>
+#include <vector>
+
+namespace GVA {
+
+/**
+ * @brief This class indexes analytics metadata of a frame: object detections (GstAnalyticsODMtd), entries related to
+ * each detection, frame-level entries not related to any detection, and class descriptors. Consumers iterate
+ * metadata ids through IdRange objects without allocations. Use gst_analytics_relation_meta_get_mtd() to access the
+ * entry with a given id. The index is a snapshot: it has to be rebuilt after the relation meta is modified, which
+ * GVA::VideoFrame::analytics_index() does automatically for changes made through GVA::VideoFrame and
+ * GVA::RegionOfInterest.
+ */
+class AnalyticsIndex {
+  public:
+    /**
+     * @brief Non-owning range of analytics metadata ids, valid until the index is rebuilt
+     */
+    class IdRange {
+      public:
+        IdRange() = default;
+        IdRange(const guint *begin, const guint *end) : _begin(begin), _end(end) {
+        }
+        const guint *begin() const {
+            return _begin;
+        }
+        const guint *end() const {
+            return _end;
+        }
+        size_t size() const {
+            return static_cast<size_t>(_end - _begin);
+        }
+        bool empty() const {
+            return _begin == _end;
+        }
+
+      private:
+        const guint *_begin = nullptr;
+        const guint *_end = nullptr;
+    };
+
+    AnalyticsIndex() = default;
+
+    /**
+     * @brief Construct index of relation meta
+     * @param relation_meta GstAnalyticsRelationMeta to index, nullptr produces an empty index
+     */
+    explicit AnalyticsIndex(GstAnalyticsRelationMeta *relation_meta) {
+        build(relation_meta);
+    }
+
+    /**
+     * @brief Rebuild index for relation meta. Memory of the previous index is reused.
+     * @param relation_meta GstAnalyticsRelationMeta to index, nullptr produces an empty index
+     */
+    void build(GstAnalyticsRelationMeta *relation_meta) {
+        clear();
+        _relation_meta = relation_meta;
+        _built = true;
+        if (!relation_meta)
+            return;
+        _length = gst_analytics_relation_get_length(relation_meta);
+        _od_slot.assign(_length, NO_SLOT);
+        _attached.assign(_length, false);
+
+        const GstAnalyticsMtdType od_type = gst_analytics_od_mtd_get_mtd_type();
+        const GstAnalyticsMtdType cls_type = gst_analytics_cls_mtd_get_mtd_type();
+        const GstAnalyticsMtdType tracking_type = gst_analytics_tracking_mtd_get_mtd_type();
+        const GstAnalyticsMtdType keypoint_type = gst_analytics_keypoint_mtd_get_mtd_type();
+
+        gpointer state = NULL;
+        GstAnalyticsMtd mtd;
+        while (gst_analytics_relation_meta_iterate(relation_meta, &state, GST_ANALYTICS_MTD_TYPE_ANY, &mtd)) {
+            if (mtd.id >= _length)
+                continue;
+            GstAnalyticsMtdType type = gst_analytics_mtd_get_mtd_type(&mtd);
+            if (type == od_type) {
+                _od_slot[mtd.id] = static_cast<guint>(_objects.size());
+                _objects.push_back(mtd.id);
+            } else if (type == cls_type) {
+                if (is_class_descriptor(&mtd))
+                    _class_descriptors.push_back(mtd.id);
+                else if (!is_transcription_marker(reinterpret_cast<GstAnalyticsClsMtd *>(&mtd)))
+                    _frame_entries.push_back(mtd.id);
+            } else if (type != tracking_type && type != keypoint_type) {
+                _frame_entries.push_back(mtd.id);
+            }
+        }
+
+        // Entries related to a detection by CONTAIN or RELATE_TO from the detection side
+        const auto child_relation =
+            static_cast<GstAnalyticsRelTypes>(GST_ANALYTICS_REL_TYPE_CONTAIN | GST_ANALYTICS_REL_TYPE_RELATE_TO);
+        _children_offsets.push_back(0);
+        for (guint od_id : _objects) {
+            gpointer rel_state = NULL;
+            GstAnalyticsMtd handle;
+            while (gst_analytics_relation_meta_get_direct_related(relation_meta, od_id, child_relation,
+                                                                  GST_ANALYTICS_MTD_TYPE_ANY, &rel_state, &handle)) {
+                _children.push_back(handle.id);
+                if (handle.id < _length)
+                    _attached[handle.id] = true;
+            }
+            _children_offsets.push_back(static_cast<guint>(_children.size()));
+        }
+
+        // Frame-level entries are the ones not attached to any detection in either direction
+        size_t kept = 0;
+        for (guint id : _frame_entries) {
+            if (_attached[id])
+                continue;
+            GstAnalyticsODMtd parent_od;
+            if (gst_analytics_relation_meta_get_direct_related(relation_meta, id, GST_ANALYTICS_REL_TYPE_IS_PART_OF,
+                                                               od_type, nullptr, &parent_od))
+                continue;
+            _frame_entries[kept++] = id;
+        }
+        _frame_entries.resize(kept);
+    }
+
+    /**
+     * @brief Drop the indexed content, so that the next is_valid_for() check fails
+     */
+    void invalidate() {
+        _built = false;
+    }
+
+    /**
+     * @brief Check whether the index still describes relation meta. The check compares the meta and its number of
+     * entries only: relations set between existing entries leave the number unchanged, so code changing relations has
+     * to call invalidate(). GVA::VideoFrame and GVA::RegionOfInterest do so; relations changed by external code
+     * through the C API are not detected until an entry is added.
+     * @param relation_meta current GstAnalyticsRelationMeta of the buffer, may be nullptr
+     * @return true if the index can be used for relation_meta
+     */
+    bool is_valid_for(GstAnalyticsRelationMeta *relation_meta) const {
+        if (!_built || relation_meta != _relation_meta)
+            return false;
+        return !relation_meta || gst_analytics_relation_get_length(relation_meta) == _length;
+    }
+
+    /**
+     * @brief Get indexed relation meta
+     * @return GstAnalyticsRelationMeta the index was built for, nullptr if there is none
+     */
+    GstAnalyticsRelationMeta *relation_meta() const {
+        return _relation_meta;
+    }
+
+    /**
+     * @brief Get number of entries in the indexed relation meta. Metadata ids are in range [0, length).
+     * @return number of analytics metadata entries
+     */
+    gsize length() const {
+        return _length;
+    }
+
+    /**
+     * @brief Get ids of object detection entries in metadata order
+     * @return range of GstAnalyticsODMtd ids
+     */
+    IdRange objects() const {
+        return range(_objects, 0, _objects.size());
+    }
+
+    /**
+     * @brief Get ids of entries the object detection CONTAINs or RELATEs_TO
+     * @param od_id id of GstAnalyticsODMtd
+     * @return range of related entry ids, empty if od_id is not an object detection
+     */
+    IdRange children(guint od_id) const {
+        if (od_id >= _od_slot.size() || _od_slot[od_id] == NO_SLOT)
+            return {};
+        const guint slot = _od_slot[od_id];
+        return range(_children, _children_offsets[slot], _children_offsets[slot + 1]);
+    }
+
+    /**
+     * @brief Get ids of frame-level entries: entries which are not related to any object detection, excluding
+     * object detections themselves, tracking, keypoints, class descriptors and transcription markers
+     * @return range of frame-level entry ids
+     */
+    IdRange frame_entries() const {
+        return range(_frame_entries, 0, _frame_entries.size());
+    }
+
+    /**
+     * @brief Get ids of classification entries with "class_descriptor" semantic tag, used for label_id lookup
+     * @return range of class descriptor ids
+     */
+    IdRange class_descriptors() const {
+        return range(_class_descriptors, 0, _class_descriptors.size());
+    }
+
+  private:
+    static constexpr guint NO_SLOT = std::numeric_limits<guint>::max();
+
+    static IdRange range(const std::vector<guint> &ids, size_t first, size_t last) {
+        return IdRange(ids.data() + first, ids.data() + last);
+    }
+
+    static bool is_class_descriptor(GstAnalyticsMtd *mtd) {
+        gchar *tag = gst_analytics_mtd_get_semantic_tag(mtd);
+        bool is_descriptor = tag && strcmp(tag, "class_descriptor") == 0;
+        g_free(tag);
+        return is_descriptor;
+    }
+
+    // Transcription descriptor cls mtd (label="transcription") added by gvaaudiotranscribe is an internal marker, not
+    // a frame-level result.
+    // TODO: remove this once transcription is emitted as a single cls mtd carrying a "<model_name>/transcription"
+    // semantic tag instead of a separate descriptor.
+    static bool is_transcription_marker(GstAnalyticsClsMtd *cls_mtd) {
+        const gsize cls_len = gst_analytics_cls_mtd_get_length(cls_mtd);
+        for (gsize i = 0; i < cls_len; ++i) {
+            GQuark q = gst_analytics_cls_mtd_get_quark(cls_mtd, i);
+            const gchar *lbl = q ? g_quark_to_string(q) : nullptr;
+            if (lbl && strcmp(lbl, "transcription") == 0)
+                return true;
+        }
+        return false;
+    }
+
+    void clear() {
+        _relation_meta = nullptr;
+        _length = 0;
+        _objects.clear();
+        _od_slot.clear();
+        _children.clear();
+        _children_offsets.clear();
+        _frame_entries.clear();
+        _class_descriptors.clear();
+    }
+
+    GstAnalyticsRelationMeta *_relation_meta = nullptr;
+    gsize _length = 0;
+    bool _built = false;
+    std::vector<guint> _objects;
+    std::vector<guint> _od_slot;          // position in _objects by metadata id, NO_SLOT for other entries
+    std::vector<guint> _children;         // related entries of all detections, grouped by detection
+    std::vector<guint> _children_offsets; // start of each detection's group in _children, plus the end
+    std::vector<guint> _frame_entries;
+    std::vector<guint> _class_descriptors;
+    std::vector<bool> _attached; // entry is related from a detection
+};
+
+} // namespace GVA
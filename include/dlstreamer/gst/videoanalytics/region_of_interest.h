@@ -15,6 +15,7 @@
 #include "../metadata/gva_dwelltime_meta.h"
 #include "../metadata/gva_tripwire_meta.h"
 #include "../metadata/gva_zone_meta.h"
+#include "analytics_index.h"
 #include "tensor.h"
 
 #include <gst/analytics/gstanalyticskeypointmtd.h>
@@ -259,6 +260,7 @@ class RegionOfInterest {
                 throw std::runtime_error(
                     "Failed to set relation between tensor metadata and object detection metadata");
             }
+            invalidate_frame_index();
         }
 
         _tensors.emplace_back(tensor);
@@ -320,9 +322,12 @@ class RegionOfInterest {
      * @brief Construct RegionOfInterest from analytics metadata and video metadata
      * @param od_meta Object detection analytics metadata
      * @param meta Video region of interest metadata containing additional parameters
+     * @param frame_index AnalyticsIndex of the VideoFrame this region was obtained from, invalidated when relations of
+     * the region change
      */
-    RegionOfInterest(GstAnalyticsODMtd od_meta, GstVideoRegionOfInterestMeta *meta)
-        : _gst_meta(meta), _detection(nullptr), _od_meta(od_meta) {
+    RegionOfInterest(GstAnalyticsODMtd od_meta, GstVideoRegionOfInterestMeta *meta,
+                     std::weak_ptr<AnalyticsIndex> frame_index = {})
+        : _gst_meta(meta), _detection(nullptr), _od_meta(od_meta), _frame_index(std::move(frame_index)) {
 
         if (not _gst_meta)
             throw std::invalid_argument("GVA::RegionOfInterest: meta is nullptr");
@@ -406,6 +411,7 @@ class RegionOfInterest {
                                                           trk_mtd.id)) {
                 throw std::runtime_error("Failed to remove relation between od meta and tracking meta");
             }
+            invalidate_frame_index();
         }
 
         if (!gst_analytics_relation_meta_add_tracking_mtd(_od_meta.meta, id, 0, &trk_mtd)) {
@@ -416,6 +422,7 @@ class RegionOfInterest {
                                                       trk_mtd.id)) {
             throw std::runtime_error("Failed to set relation between od meta and tracking meta");
         }
+        invalidate_frame_index();
     }
 
     /**
@@ -458,6 +465,7 @@ class RegionOfInterest {
                 throw std::runtime_error(
                     "Failed to set relation between tensor metadata and object detection metadata");
             }
+            invalidate_frame_index();
         }
     }
 
@@ -498,6 +506,21 @@ class RegionOfInterest {
      * to that region of interest.
      */
     GstAnalyticsODMtd _od_meta;
+
+    /**
+     * @brief AnalyticsIndex of the VideoFrame this region was obtained from, empty if the region was constructed
+     * directly
+     */
+    std::weak_ptr<AnalyticsIndex> _frame_index;
+
+    /**
+     * @brief Invalidate AnalyticsIndex of the VideoFrame after relations of this region changed, which doesn't always
+     * change the number of analytics metadata entries
+     */
+    void invalidate_frame_index() {
+        if (auto index = _frame_index.lock())
+            index->invalidate();
+    }
 };
 
 } // namespace GVA
@@ -12,6 +12,7 @@
 
 #pragma once
 
+#include "analytics_index.h"
 #include "region_of_interest.h"
 
 #include "../metadata/gva_json_meta.h"
@@ -60,6 +61,12 @@ class VideoFrame {
      */
     mutable std::vector<std::shared_ptr<GstStructure>> _converted_tensor_structures;
 
+    /**
+     * @brief Cached index of analytics metadata, rebuilt on access when the metadata has changed. Shared with
+     * RegionOfInterest objects of this VideoFrame, which invalidate it when they change relations.
+     */
+    std::shared_ptr<AnalyticsIndex> _analytics_index = std::make_shared<AnalyticsIndex>();
+
   public:
     /**
      * @brief Construct VideoFrame instance from GstBuffer and GstVideoInfo. This is preferred way of creating
@@ -169,6 +176,19 @@ class VideoFrame {
         return get_tensors();
     }
 
+    /**
+     * @brief Get index of analytics metadata attached to VideoFrame: object detections with their related entries,
+     * frame-level entries and class descriptors. The index is built in a single pass, cached and rebuilt on the next
+     * call after analytics metadata is added.
+     * @return AnalyticsIndex valid until analytics metadata of this VideoFrame is modified
+     */
+    const AnalyticsIndex &analytics_index() const {
+        GstAnalyticsRelationMeta *relation_meta = gst_buffer_get_analytics_relation_meta(buffer);
+        if (!_analytics_index->is_valid_for(relation_meta))
+            _analytics_index->build(relation_meta);
+        return *_analytics_index;
+    }
+
     /**
      * @brief Get messages attached to this VideoFrame
      * @return messages attached to this VideoFrame
@@ -239,6 +259,7 @@ class VideoFrame {
                                                     double_to_int(_h), confidence, &od_mtd)) {
             throw std::runtime_error("Failed to add detection data to meta");
         }
+        _analytics_index->invalidate();
 
         GstVideoRegionOfInterestMeta *meta = gst_buffer_add_video_region_of_interest_meta(
             buffer, label.c_str(), double_to_uint(_x), double_to_uint(_y), double_to_uint(_w), double_to_uint(_h));
@@ -246,7 +267,7 @@ class VideoFrame {
 
         gst_video_region_of_interest_meta_add_param(meta, detection);
 
-        return RegionOfInterest(od_mtd, meta);
+        return RegionOfInterest(od_mtd, meta, _analytics_index);
     }
 
     /**
@@ -286,6 +307,7 @@ class VideoFrame {
             const gint frame_w = static_cast<gint>(GST_VIDEO_INFO_WIDTH(info.get()));
             const gint frame_h = static_cast<gint>(GST_VIDEO_INFO_HEIGHT(info.get()));
             tensor.convert_to_meta(&tensor_mtd, relation_meta, 0, 0, frame_w, frame_h);
+            _analytics_index->invalidate();
         }
     }
 
@@ -362,30 +384,30 @@ class VideoFrame {
     }
 
     std::vector<RegionOfInterest> get_regions() const {
-        GstAnalyticsRelationMeta *relation_meta = gst_buffer_get_analytics_relation_meta(buffer);
-
-        if (!relation_meta) {
+        const AnalyticsIndex &index = analytics_index();
+        GstAnalyticsRelationMeta *relation_meta = index.relation_meta();
+        if (!relation_meta || index.objects().empty()) {
             return {};
         }
 
-        // Count regions to pre-allocate vector capacity
+        // Match GstVideoRegionOfInterestMeta to detections in one pass over buffer metadata
+        std::vector<GstVideoRegionOfInterestMeta *> roi_metas(index.length(), nullptr);
         gpointer state = NULL;
-        GstAnalyticsODMtd od_mtd;
-        size_t count = 0;
-        while (
-            gst_analytics_relation_meta_iterate(relation_meta, &state, gst_analytics_od_mtd_get_mtd_type(), &od_mtd)) {
-            ++count;
+        GstMeta *meta;
+        while ((meta = gst_buffer_iterate_meta_filtered(buffer, &state, GST_VIDEO_REGION_OF_INTEREST_META_API_TYPE))) {
+            auto *roi_meta = reinterpret_cast<GstVideoRegionOfInterestMeta *>(meta);
+            if (roi_meta->id >= 0 && static_cast<gsize>(roi_meta->id) < roi_metas.size() && !roi_metas[roi_meta->id])
+                roi_metas[roi_meta->id] = roi_meta;
         }
 
-        // Pre-allocate vector to avoid reallocation during emplace_back
         std::vector<RegionOfInterest> regions;
-        regions.reserve(count);
+        regions.reserve(index.objects().size());
 
-        // Construct RegionOfInterest objects
-        state = NULL;
-        while (
-            gst_analytics_relation_meta_iterate(relation_meta, &state, gst_analytics_od_mtd_get_mtd_type(), &od_mtd)) {
-            GstVideoRegionOfInterestMeta *roi_meta = gst_buffer_get_video_region_of_interest_meta_id(buffer, od_mtd.id);
+        GstAnalyticsODMtd od_mtd;
+        for (guint od_id : index.objects()) {
+            if (!gst_analytics_relation_meta_get_od_mtd(relation_meta, od_id, &od_mtd))
+                continue;
+            GstVideoRegionOfInterestMeta *roi_meta = roi_metas[od_id];
 
             // GstVideoRegionOfInterestMeta should match GstAnalyticsODMtd until transition to GstAnalytics is complete
             // a mismatch can occur if external code adds GstAnalytics metadata only
@@ -412,14 +434,10 @@ class VideoFrame {
                     gst_video_region_of_interest_meta_add_param(roi_meta, detection);
 
                     // convert related analytics metadata to GstStructure and add to roi params
-                    gpointer rel_state = NULL;
                     GstAnalyticsMtd handle;
-                    while (gst_analytics_relation_meta_get_direct_related(
-                        od_mtd.meta, od_mtd.id, GST_ANALYTICS_REL_TYPE_ANY, GST_ANALYTICS_MTD_TYPE_ANY, &rel_state,
-                        &handle)) {
-                        GstAnalyticsRelTypes rel =
-                            gst_analytics_relation_meta_get_relation(od_mtd.meta, od_mtd.id, handle.id);
-                        if (!(rel & (GST_ANALYTICS_REL_TYPE_CONTAIN | GST_ANALYTICS_REL_TYPE_RELATE_TO)))
+                    for (guint child_id : index.children(od_id)) {
+                        if (!gst_analytics_relation_meta_get_mtd(relation_meta, child_id, GST_ANALYTICS_MTD_TYPE_ANY,
+                                                                 &handle))
                             continue;
                         GstStructure *s = GVA::Tensor::convert_to_tensor(handle);
                         if (s != nullptr) {
@@ -429,7 +447,7 @@ class VideoFrame {
                 }
             }
 
-            regions.emplace_back(od_mtd, roi_meta);
+            regions.emplace_back(od_mtd, roi_meta, _analytics_index);
         }
 
         return regions;
@@ -440,69 +458,14 @@ class VideoFrame {
         _converted_tensor_structures.clear();
 
         // Prefer GStreamer Analytics frame-level metadata when available
-        GstAnalyticsRelationMeta *relation_meta = gst_buffer_get_analytics_relation_meta(buffer);
+        const AnalyticsIndex &index = analytics_index();
+        GstAnalyticsRelationMeta *relation_meta = index.relation_meta();
         if (relation_meta) {
-            // Helper: check if an entry is associated with any OD (in either direction)
-            auto is_attached_to_od = [&](guint entry_id) -> bool {
-                // Check outgoing IS_PART_OF from entry to OD (our dual-write sets this)
-                GstAnalyticsODMtd parent_od;
-                if (gst_analytics_relation_meta_get_direct_related(
-                        relation_meta, entry_id, GST_ANALYTICS_REL_TYPE_IS_PART_OF, gst_analytics_od_mtd_get_mtd_type(),
-                        nullptr, &parent_od)) {
-                    return true;
-                }
-                // Also check if any OD has CONTAIN relation TO this entry
-                gpointer od_state = NULL;
-                GstAnalyticsODMtd od;
-                while (gst_analytics_relation_meta_iterate(relation_meta, &od_state,
-                                                           gst_analytics_od_mtd_get_mtd_type(), &od)) {
-                    GstAnalyticsRelTypes rel = gst_analytics_relation_meta_get_relation(relation_meta, od.id, entry_id);
-                    if (rel & (GST_ANALYTICS_REL_TYPE_CONTAIN | GST_ANALYTICS_REL_TYPE_RELATE_TO)) {
-                        return true;
-                    }
-                }
-                return false;
-            };
-
-            // Collect frame-level analytics entries not associated with any OD
-            gpointer mtd_state = NULL;
             GstAnalyticsMtd mtd;
             gint frame_w = static_cast<gint>(GST_VIDEO_INFO_WIDTH(info.get()));
             gint frame_h = static_cast<gint>(GST_VIDEO_INFO_HEIGHT(info.get()));
-            while (gst_analytics_relation_meta_iterate(relation_meta, &mtd_state, GST_ANALYTICS_MTD_TYPE_ANY, &mtd)) {
-                GstAnalyticsMtdType mt = gst_analytics_mtd_get_mtd_type(&mtd);
-                if (mt == gst_analytics_od_mtd_get_mtd_type() || mt == gst_analytics_tracking_mtd_get_mtd_type() ||
-                    mt == gst_analytics_keypoint_mtd_get_mtd_type())
-                    continue;
-
-                if (mt == gst_analytics_cls_mtd_get_mtd_type()) {
-                    // Skip class descriptor metadata (used internally for label_id lookup)
-                    gchar *tag = gst_analytics_mtd_get_semantic_tag(&mtd);
-                    if (tag) {
-                        bool is_descriptor = (strcmp(tag, "class_descriptor") == 0);
-                        g_free(tag);
-                        if (is_descriptor)
-                            continue;
-                    }
-                    // Skip the transcription descriptor cls mtd (label="transcription") added by
-                    // gvaaudiotranscribe; it is an internal marker, not a frame-level tensor result.
-                    // TODO: remove this once transcription is emitted as a single cls mtd carrying a
-                    // "<model_name>/transcription" semantic tag instead of a separate descriptor.
-                    GstAnalyticsClsMtd *cls_mtd = reinterpret_cast<GstAnalyticsClsMtd *>(&mtd);
-                    const gsize cls_len = gst_analytics_cls_mtd_get_length(cls_mtd);
-                    bool is_transcription = false;
-                    for (gsize i = 0; i < cls_len; ++i) {
-                        GQuark q = gst_analytics_cls_mtd_get_quark(cls_mtd, i);
-                        const gchar *lbl = q ? g_quark_to_string(q) : nullptr;
-                        if (lbl && strcmp(lbl, "transcription") == 0) {
-                            is_transcription = true;
-                            break;
-                        }
-                    }
-                    if (is_transcription)
-                        continue;
-                }
-                if (is_attached_to_od(mtd.id))
+            for (guint id : index.frame_entries()) {
+                if (!gst_analytics_relation_meta_get_mtd(relation_meta, id, GST_ANALYTICS_MTD_TYPE_ANY, &mtd))
                     continue;
                 GstStructure *s = Tensor::convert_to_tensor(mtd, frame_w, frame_h);
                 if (s) {
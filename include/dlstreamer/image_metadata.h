@@ -345,6 +345,39 @@ class SourceIdentifierMetadata : public DictionaryProxy {
     }
 };
 
+// Attached by batch_create to every batch, describes how the batch was formed
+class BatchMetadata : public DictionaryProxy {
+  public:
+    static constexpr auto name = "BatchMetadata";
+    struct key {
+        static constexpr auto size = "size";             // int, frames in the batch
+        static constexpr auto batch_size = "batch_size"; // int, frames in a complete batch
+        static constexpr auto wait_time = "wait_time";   // intptr_t (nanoseconds), since first frame of the batch
+    };
+    using DictionaryProxy::DictionaryProxy;
+
+    static std::shared_ptr<BatchMetadata> try_cast(DictionaryPtr dict) {
+        if (!dict || dict->name() != name)
+            return nullptr;
+        return std::make_shared<BatchMetadata>(dict);
+    }
+
+    inline int size() const {
+        return _dict->get<int>(key::size);
+    }
+    inline int batch_size() const {
+        return _dict->get<int>(key::batch_size);
+    }
+    inline int64_t wait_time() const {
+        return _dict->get<intptr_t>(key::wait_time);
+    }
+    // ratio of frames in the batch to frames in a complete batch, below 1 if the batch was sent partial
+    inline double fill() const {
+        int complete = batch_size();
+        return complete > 0 ? static_cast<double>(size()) / complete : 1.0;
+    }
+};
+
 class ModelInfoMetadata : public DictionaryProxy {
   public:
     static constexpr auto name = "model_info";
@@ -29,10 +29,14 @@ gi.require_version("Gst", "1.0")
 gi.require_version("GstAnalytics", "1.0")
 gi.require_version("GObject", "2.0")
 from gi.repository import Gst, GLib, GObject, GstAnalytics  # pylint: disable=no-name-in-module, wrong-import-position
+from gstgva import VideoFrame  # pylint: disable=wrong-import-position
 
 sys.path.insert(0, str(Path(__file__).resolve().parents[3]))
 from shared_utils import download_https  # pylint: disable=wrong-import-position
 
+# GQuarks are never freed, so overlay texts (which embed free-form VLM answers) are interned at most this many times
+MAX_OVERLAY_LABELS = 1024
+
 class GenaiSignalBridge(GObject.Object):
     """
     Cross-branch signal bridge: stores latest frame-selection and VLM results.
@@ -41,29 +45,40 @@ class GenaiSignalBridge(GObject.Object):
 
     def __init__(self):
         super().__init__()
-        self._frame_selection_quark = None
+        self._overlay_quarks = {}
+        self._frame_selection_objects = None
         self._frame_selection_confidence = 0.0
         self._frame_selection_pts = 0
         self._frame_selection_time = 0
-        self._vlm_quark = None
+        self._vlm_label = None
         self._vlm_confidence = 0.0
         self._vlm_pts = 0
         self._vlm_time = 0
 
-    @GObject.Signal(arg_types=(GObject.TYPE_UINT, GObject.TYPE_DOUBLE, GObject.TYPE_UINT64, GObject.TYPE_UINT64))
-    def vlm_result(self, label_quark: int, confidence: float, pts: int, system_time_ns: int):
-        self._vlm_quark = label_quark
+    @GObject.Signal(arg_types=(GObject.TYPE_STRING, GObject.TYPE_DOUBLE, GObject.TYPE_UINT64, GObject.TYPE_UINT64))
+    def vlm_result(self, label: str, confidence: float, pts: int, system_time_ns: int):
+        self._vlm_label = label
         self._vlm_confidence = confidence
         self._vlm_pts = pts
         self._vlm_time = system_time_ns
 
-    @GObject.Signal(arg_types=(GObject.TYPE_UINT, GObject.TYPE_DOUBLE, GObject.TYPE_UINT64, GObject.TYPE_UINT64))
-    def frame_selection(self, objects_quark: int, confidence: float, pts: int, system_time_ns: int):
-        self._frame_selection_quark = objects_quark
+    @GObject.Signal(arg_types=(GObject.TYPE_STRING, GObject.TYPE_DOUBLE, GObject.TYPE_UINT64, GObject.TYPE_UINT64))
+    def frame_selection(self, objects: str, confidence: float, pts: int, system_time_ns: int):
+        self._frame_selection_objects = objects
         self._frame_selection_confidence = confidence
         self._frame_selection_pts = pts
         self._frame_selection_time = system_time_ns
 
+    def overlay_quark(self, text: str, fallback: str) -> int:
+        """Return the quark for an overlay text, or for `fallback` once MAX_OVERLAY_LABELS texts were interned."""
+        quark = self._overlay_quarks.get(text)
+        if quark is None:
+            if len(self._overlay_quarks) >= MAX_OVERLAY_LABELS:
+                return GLib.quark_from_string(fallback)
+            quark = GLib.quark_from_string(text)
+            self._overlay_quarks[text] = quark
+        return quark
+
 def _post_selection_cb(pad, info, bridge):
     """
     Probe on gvaframeselection_py src pad: extract detected objects and emit frame-selection signal.
@@ -89,8 +104,7 @@ def _post_selection_cb(pad, info, bridge):
             confidence = max(confidence, confidence_lvl)
 
     if labels:
-        objects_quark = GLib.quark_from_string(", ".join(labels))
-        bridge.emit("frame-selection", objects_quark, confidence, int(buf.pts), int(time.time_ns()))
+        bridge.emit("frame-selection", ", ".join(labels), confidence, int(buf.pts), int(time.time_ns()))
 
     return Gst.PadProbeReturn.OK
 
@@ -103,14 +117,11 @@ def _post_vlm_cb(pad, info, bridge):
     if buf is None:
         return Gst.PadProbeReturn.OK
 
-    rmeta = GstAnalytics.buffer_get_analytics_relation_meta(buf)
-    if not rmeta:
-        return Gst.PadProbeReturn.OK
-
     # retrieve analysis result from VLM model and emit it via the bridge
-    for mtd in rmeta:
-        if isinstance(mtd, GstAnalytics.ClsMtd) and mtd.get_quark(0):
-            bridge.emit("vlm-result", int(mtd.get_quark(0)), float(mtd.get_level(0)), int(buf.pts), int(time.time_ns()))
+    for tensor in VideoFrame(buf).tensors():
+        if tensor.name() == "genai_result" and tensor.label():
+            confidence = tensor.confidence() or 0.0
+            bridge.emit("vlm-result", tensor.label(), float(confidence), int(buf.pts), int(time.time_ns()))
             break
 
     return Gst.PadProbeReturn.OK
@@ -135,16 +146,18 @@ def _pre_watermark_cb(pad, info, bridge):
             return Gst.PadProbeReturn.OK
 
     # display frame selection output for max 4 seconds
-    if bridge._frame_selection_quark is not None and (buf.pts - bridge._frame_selection_pts) < 4 * Gst.SECOND:
+    if bridge._frame_selection_objects is not None and (buf.pts - bridge._frame_selection_pts) < 4 * Gst.SECOND:
         frame_time = bridge._frame_selection_pts / Gst.SECOND
-        text = f"[{frame_time:.2f} s] Frame selection, detected objects: {GLib.quark_to_string(bridge._frame_selection_quark)} "
-        rmeta.add_od_mtd(GLib.quark_from_string(text), 10, 50, 0, 0, bridge._frame_selection_confidence)
+        text = f"[{frame_time:.2f} s] Frame selection, detected objects: {bridge._frame_selection_objects} "
+        label = bridge.overlay_quark(text, "Frame selection ")
+        rmeta.add_od_mtd(label, 10, 50, 0, 0, bridge._frame_selection_confidence)
 
         # display VLM classification output for most recently selected frame
-        if (bridge._vlm_quark is not None) and (bridge._vlm_pts >= bridge._frame_selection_pts):
+        if (bridge._vlm_label is not None) and (bridge._vlm_pts >= bridge._frame_selection_pts):
             vlm_time = frame_time + (bridge._vlm_time - bridge._frame_selection_time) / 1e9
-            text = f"[{vlm_time:.2f} s] VLM classification: {GLib.quark_to_string(bridge._vlm_quark)}, confidence:"
-            rmeta.add_od_mtd(GLib.quark_from_string(text), 10, 100, 0, 0, bridge._vlm_confidence)
+            text = f"[{vlm_time:.2f} s] VLM classification: {bridge._vlm_label}, confidence:"
+            label = bridge.overlay_quark(text, "VLM classification, confidence:")
+            rmeta.add_od_mtd(label, 10, 100, 0, 0, bridge._vlm_confidence)
 
     return Gst.PadProbeReturn.OK
 
@@ -1,5 +1,5 @@
 /*******************************************************************************
- * Copyright (C) 2022-2025 Intel Corporation
+ * Copyright (C) 2022-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  ******************************************************************************/
@@ -9,10 +9,13 @@
 #include "dlstreamer/cpu/frame_alloc.h"
 #include "dlstreamer/memory_mapper_factory.h"
 
-#include <deque>
+#include <cstring>
+#include <vector>
 
 namespace dlstreamer {
 
+// Keeps the last window_size input tensors in a preallocated ring, so every input is copied once on arrival and
+// every output is assembled from at most two contiguous segments (oldest to newest).
 class TensorSlidingWindow : public BaseTransform {
   public:
     TensorSlidingWindow(DictionaryCPtr /*params*/, const ContextPtr &app_context) : BaseTransform(app_context) {
@@ -21,38 +24,50 @@ class TensorSlidingWindow : public BaseTransform {
     std::function<FramePtr()> get_output_allocator() override {
         DLS_CHECK(_input_info.tensors.size() && _input_info.tensors[0].size())
         DLS_CHECK(_output_info.tensors.size() && _output_info.tensors[0].size())
-        _aggregate_size = _output_info.tensors[0].size() / _input_info.tensors[0].size();
+        _window_size = _output_info.tensors[0].size() / _input_info.tensors[0].size();
+        DLS_CHECK(_window_size)
 
         return [this]() { return std::make_shared<CPUFrameAlloc>(_output_info); };
     }
 
     bool process(TensorPtr src, TensorPtr dst) override {
         auto src_tensor = src.map(AccessMode::Read);
-        float *src_data = src_tensor->data<float>();
-        const auto data_size = src_tensor->info().size();
+        const auto *src_data = static_cast<const uint8_t *>(src_tensor->data());
+        const size_t item_size = src_tensor->info().nbytes();
 
-        _aggregate_tensors.push_back(std::vector<float>(src_data, src_data + data_size));
+        if (_ring.empty()) {
+            _item_size = item_size;
+            _ring.resize(_item_size * _window_size);
+        }
+        DLS_CHECK(item_size == _item_size)
 
-        // TODO: uncomment below condition once the bug that it is freezing when return false
-        // if (_aggregate_tensors.size() < _aggregate_size)
-        //    return false;
+        // overwrite the oldest item
+        memcpy(_ring.data() + _next * _item_size, src_data, _item_size);
+        _next = (_next + 1) % _window_size;
+        if (_filled < _window_size)
+            _filled++;
 
-        auto dst_tensor = dst.map(AccessMode::Write);
-        float *dst_data = dst_tensor->data<float>();
-        for (auto tensor : _aggregate_tensors) {
-            std::copy(tensor.begin(), tensor.end(), dst_data);
-            dst_data += tensor.size();
-        }
+        // nothing is output until the window is full
+        if (_filled < _window_size)
+            return false;
 
-        while (_aggregate_tensors.size() >= _aggregate_size)
-            _aggregate_tensors.pop_front();
+        auto dst_tensor = dst.map(AccessMode::Write);
+        DLS_CHECK(dst_tensor->info().nbytes() >= _ring.size())
+        auto *dst_data = static_cast<uint8_t *>(dst_tensor->data());
+        // _next points to the oldest item once the window is full
+        const size_t head_bytes = (_window_size - _next) * _item_size;
+        memcpy(dst_data, _ring.data() + _next * _item_size, head_bytes);
+        memcpy(dst_data + head_bytes, _ring.data(), _ring.size() - head_bytes);
 
         return true;
     }
 
   private:
-    std::deque<std::vector<float>> _aggregate_tensors;
-    size_t _aggregate_size = 0;
+    std::vector<uint8_t> _ring; // _window_size items of _item_size bytes
+    size_t _window_size = 0;
+    size_t _item_size = 0;
+    size_t _next = 0;   // ring slot the next input is written to
+    size_t _filled = 0; // number of valid items in the ring
 };
 
 extern "C" {
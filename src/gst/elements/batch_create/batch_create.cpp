@@ -1,5 +1,5 @@
 /*******************************************************************************
- * Copyright (C) 2022-2025 Intel Corporation
+ * Copyright (C) 2022-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  ******************************************************************************/
@@ -15,11 +15,18 @@
 #include "multi_value_storage.h"
 #include "shared_instance.h"
 
-enum { PROP_0, PROP_BATCH_SIZE };
+#include <condition_variable>
+#include <thread>
+
+GST_DEBUG_CATEGORY_STATIC(batch_create_debug_category);
+#define GST_CAT_DEFAULT batch_create_debug_category
+
+enum { PROP_0, PROP_BATCH_SIZE, PROP_MAX_LATENCY };
 
 constexpr gint MIN_BATCH_SIZE = 0;
 constexpr gint MAX_BATCH_SIZE = 1024;
 constexpr gint DEFAULT_BATCH_SIZE = 1;
+constexpr guint64 DEFAULT_MAX_LATENCY = 0;
 
 using namespace dlstreamer;
 
@@ -28,24 +35,42 @@ MultiValueStorage<Element *, GstBaseTransform *> g_gst_base_element_storage;
 
 class BatchCreateImpl : public BaseTransform {
   public:
-    BatchCreateImpl(gint batch_size) : BaseTransform(nullptr), _batch_size(batch_size) {
+    BatchCreateImpl(gint batch_size, GstClockTime max_latency)
+        : BaseTransform(nullptr), _batch_size(batch_size), _max_latency(max_latency) {
         _buffer_list = gst_buffer_list_new();
         _stream_id_quark = g_quark_from_string(SourceIdentifierMetadata::key::stream_id);
+        _batch_meta_quark = g_quark_from_string(BatchMetadata::name);
+        if (_max_latency)
+            _deadline_thread = std::thread(&BatchCreateImpl::run_deadline, this);
     }
 
     ~BatchCreateImpl() {
+        {
+            std::lock_guard<std::mutex> guard(_mutex);
+            _stop = true;
+            if (_clock_id)
+                gst_clock_id_unschedule(_clock_id);
+        }
+        _wake.notify_one();
+        if (_deadline_thread.joinable())
+            _deadline_thread.join();
+
+        reset_batch();
         if (_buffer_list) {
             gst_buffer_list_unref(_buffer_list);
         }
     }
 
-    GstFlowReturn generate_output(GstBuffer *src, intptr_t stream_id, GstPad *pad) {
-        GstBufferList *output_list = nullptr;
+    GstFlowReturn generate_output(GstBuffer *src, intptr_t stream_id, GstBaseTransform *first_transform) {
+        Batch batch;
+        GstFlowReturn deadline_ret;
 
         { // if shared instance across multiple streams, this function called from multiple threads
             std::lock_guard<std::mutex> guard(_mutex);
 
             if (src) {
+                if (gst_buffer_list_length(_buffer_list) == 0)
+                    start_batch(first_transform);
                 // Attach stream_id info (transform_wrapper.cpp reads stream_id from qdata to avoid
                 // gst_buffer_make_writable)
                 gst_mini_object_set_qdata(&src->mini_object, _stream_id_quark, (void *)stream_id, NULL);
@@ -54,16 +79,55 @@ class BatchCreateImpl : public BaseTransform {
             }
 
             // If reached batch_size or in flushing mode, push buffer list downstream and start new buffer list
-            if (gst_buffer_list_length(_buffer_list) >= static_cast<guint>(_batch_size) || !src) {
-                output_list = _buffer_list;
-                _buffer_list = gst_buffer_list_new();
-            }
+            guint length = gst_buffer_list_length(_buffer_list);
+            if (length && (length >= static_cast<guint>(_batch_size) || !src))
+                batch = take_batch();
+
+            // report failure of batch pushed on deadline to upstream of any stream
+            deadline_ret = _deadline_ret;
+            _deadline_ret = GST_FLOW_OK;
         }
 
-        if (output_list)
-            return gst_pad_push_list(pad, output_list);
-        else
-            return GST_BASE_TRANSFORM_FLOW_DROPPED;
+        GstFlowReturn ret = batch.list ? push(batch) : GST_BASE_TRANSFORM_FLOW_DROPPED;
+        return deadline_ret != GST_FLOW_OK ? deadline_ret : ret;
+    }
+
+    // Push frames collected so far, e.g. before end of stream or caps change
+    GstFlowReturn push_partial() {
+        Batch batch;
+        {
+            std::lock_guard<std::mutex> guard(_mutex);
+            if (gst_buffer_list_length(_buffer_list))
+                batch = take_batch();
+        }
+        return batch.list ? push(batch) : GST_FLOW_OK;
+    }
+
+    // Wait until every batch taken so far is pushed, so that serialized events don't overtake batches pushed by
+    // another thread
+    void wait_pushed() {
+        uint64_t taken;
+        {
+            std::lock_guard<std::mutex> guard(_mutex);
+            taken = _taken;
+        }
+        std::unique_lock<std::mutex> lock(_push_mutex);
+        _push_turn.wait(lock, [&] { return _pushed >= taken; });
+    }
+
+    // Drop frames of flushed stream, frames of other streams sharing the instance stay in the batch
+    void drop_stream(intptr_t stream_id) {
+        std::lock_guard<std::mutex> guard(_mutex);
+        guint i = 0;
+        while (i < gst_buffer_list_length(_buffer_list)) {
+            GstBuffer *buffer = gst_buffer_list_get(_buffer_list, i);
+            if ((intptr_t)gst_mini_object_get_qdata(&buffer->mini_object, _stream_id_quark) == stream_id)
+                gst_buffer_list_remove(_buffer_list, i, 1);
+            else
+                i++;
+        }
+        if (gst_buffer_list_length(_buffer_list) == 0)
+            reset_batch();
     }
 
     std::function<FramePtr()> get_output_allocator() override {
@@ -71,10 +135,134 @@ class BatchCreateImpl : public BaseTransform {
     }
 
   private:
+    struct Batch {
+        GstBufferList *list = nullptr;
+        GstPad *pad = nullptr;
+        uint64_t seq = 0;
+    };
+
+    // Called with _mutex held on first frame of the batch
+    void start_batch(GstBaseTransform *first_transform) {
+        // wait time is measured by pipeline clock, so that deadline follows the clock the pipeline runs on
+        _clock = gst_element_get_clock(GST_ELEMENT(first_transform));
+        if (!_clock)
+            _clock = gst_system_clock_obtain();
+        _batch_start = gst_clock_get_time(_clock);
+        _pad = GST_PAD(gst_object_ref(first_transform->srcpad));
+        _generation++;
+        _wake.notify_one();
+    }
+
+    // Called with _mutex held, takes current batch and attaches BatchMetadata to it
+    Batch take_batch() {
+        Batch batch;
+        batch.list = _buffer_list;
+        batch.pad = _pad;
+        batch.seq = _taken++;
+        _buffer_list = gst_buffer_list_new();
+        _pad = nullptr;
+
+        GstClockTime wait_time = gst_clock_get_time(_clock) - _batch_start;
+        GstStructure *meta = gst_structure_new(
+            BatchMetadata::name, BatchMetadata::key::size, G_TYPE_INT,
+            static_cast<int>(gst_buffer_list_length(batch.list)), BatchMetadata::key::batch_size, G_TYPE_INT,
+            _batch_size, BatchMetadata::key::wait_time, G_TYPE_POINTER, static_cast<intptr_t>(wait_time), NULL);
+        gst_mini_object_set_qdata(&batch.list->mini_object, _batch_meta_quark, meta,
+                                  (GDestroyNotify)gst_structure_free);
+
+        reset_batch();
+        return batch;
+    }
+
+    // Called with _mutex held when batch is taken or emptied, cancels its deadline
+    void reset_batch() {
+        if (_clock_id)
+            gst_clock_id_unschedule(_clock_id);
+        if (_clock) {
+            gst_object_unref(_clock);
+            _clock = nullptr;
+        }
+        if (_pad) {
+            gst_object_unref(_pad);
+            _pad = nullptr;
+        }
+    }
+
+    // Batches are pushed in the order they were taken, whether by streaming threads or by deadline thread
+    GstFlowReturn push(Batch &batch) {
+        std::unique_lock<std::mutex> lock(_push_mutex);
+        _push_turn.wait(lock, [&] { return _pushed == batch.seq; });
+        GstFlowReturn ret = gst_pad_push_list(batch.pad, batch.list);
+        _pushed++;
+        lock.unlock();
+        _push_turn.notify_all();
+
+        gst_object_unref(batch.pad);
+        return ret;
+    }
+
+    // Pushes batch which isn't complete max_latency after its first frame
+    void run_deadline() {
+        std::unique_lock<std::mutex> lock(_mutex);
+        while (!_stop) {
+            if (!_clock) {
+                _wake.wait(lock);
+                continue;
+            }
+
+            uint64_t generation = _generation;
+            // max-latency near G_MAXUINT64 would wrap the deadline into the past, clamp it to the latest clock time
+            GstClockTime deadline = _max_latency < static_cast<GstClockTime>(G_MAXINT64) - _batch_start
+                                        ? _batch_start + _max_latency
+                                        : static_cast<GstClockTime>(G_MAXINT64);
+            GstClockID id = gst_clock_new_single_shot_id(_clock, deadline);
+            _clock_id = id;
+            lock.unlock();
+            GstClockReturn clock_ret = gst_clock_id_wait(id, nullptr);
+            lock.lock();
+            _clock_id = nullptr;
+            gst_clock_id_unref(id);
+
+            // batch was taken, dropped or replaced while waiting
+            if (_stop || generation != _generation || !_clock)
+                continue;
+            if (clock_ret != GST_CLOCK_OK && clock_ret != GST_CLOCK_EARLY)
+                continue;
+
+            Batch batch = take_batch();
+            GST_DEBUG_OBJECT(batch.pad, "Batch deadline expired, pushing %u of %d frames",
+                             gst_buffer_list_length(batch.list), _batch_size);
+            lock.unlock();
+            GstFlowReturn ret = push(batch);
+            lock.lock();
+            if (ret < GST_FLOW_OK && ret != GST_FLOW_FLUSHING)
+                _deadline_ret = ret;
+        }
+    }
+
     std::mutex _mutex;
     GstBufferList *_buffer_list = nullptr;
     gint _batch_size = 0;
     GQuark _stream_id_quark;
+    GQuark _batch_meta_quark;
+
+    // current batch, set while it has frames
+    GstClock *_clock = nullptr;
+    GstClockTime _batch_start = 0;
+    GstPad *_pad = nullptr;
+    uint64_t _generation = 0; // incremented on each batch start
+
+    GstClockTime _max_latency = 0;
+    std::thread _deadline_thread;
+    std::condition_variable _wake;
+    GstClockID _clock_id = nullptr;
+    GstFlowReturn _deadline_ret = GST_FLOW_OK;
+    bool _stop = false;
+
+    std::mutex _push_mutex;
+    std::condition_variable _push_turn;
+    uint64_t _taken = 0;
+    uint64_t _pushed = 0;
 };
 
 struct BatchCreateClass {
@@ -86,6 +274,7 @@ struct BatchCreate {
     BatchCreateImpl *impl;
     ElementPtr element; // for ref-counting only
     gint batch_size;
+    GstClockTime max_latency;
     intptr_t stream_id;
 };
 
@@ -98,6 +287,7 @@ G_DEFINE_TYPE(BatchCreate, batch_create, GST_TYPE_BASE_TRANSFORM);
 static void batch_create_init(BatchCreate *self) {
     self->impl = nullptr;
     self->batch_size = DEFAULT_BATCH_SIZE;
+    self->max_latency = DEFAULT_MAX_LATENCY;
     self->stream_id = 0;
 }
 
@@ -113,7 +303,7 @@ static gboolean batch_create_start(GstBaseTransform *base) {
     FrameInfo input_info;
     FrameInfo output_info;
     SharedInstance::InstanceId id = {name, shared_instance_id, params, input_info, output_info};
-    auto impl = std::make_shared<BatchCreateImpl>(self->batch_size);
+    auto impl = std::make_shared<BatchCreateImpl>(self->batch_size, self->max_latency);
     auto element = SharedInstance::global()->init_or_reuse(id, impl, nullptr);
     self->impl = ptr_cast<BatchCreateImpl>(element).get();
     self->element = element;
@@ -128,17 +318,57 @@ static gboolean batch_create_start(GstBaseTransform *base) {
     return TRUE;
 }
 
+static gboolean batch_create_sink_event(GstBaseTransform *base, GstEvent *event) {
+    auto self = BATCH_CREATE(base);
+    if (self->impl) {
+        switch (GST_EVENT_TYPE(event)) {
+        case GST_EVENT_EOS:
+            // don't keep frames of unfinished batch past end of stream
+            self->impl->push_partial();
+            self->impl->wait_pushed();
+            break;
+        case GST_EVENT_CAPS: {
+            // frames of unfinished batch are pushed before new caps reach downstream
+            GstCaps *caps = nullptr;
+            gst_event_parse_caps(event, &caps);
+            GstCaps *current_caps = gst_pad_get_current_caps(base->sinkpad);
+            if (current_caps) {
+                if (!gst_caps_is_equal(current_caps, caps))
+                    self->impl->push_partial();
+                gst_caps_unref(current_caps);
+            }
+            self->impl->wait_pushed();
+            break;
+        }
+        case GST_EVENT_FLUSH_STOP:
+            // FLUSH_START isn't held back, as it is what unblocks a push waiting downstream
+            self->impl->drop_stream(self->stream_id);
+            self->impl->wait_pushed();
+            break;
+        default:
+            break;
+        }
+    }
+    return GST_BASE_TRANSFORM_CLASS(batch_create_parent_class)->sink_event(base, event);
+}
+
 static void batch_create_class_init(BatchCreateClass *klass) {
+    GST_DEBUG_CATEGORY_INIT(batch_create_debug_category, "batch_create", 0, "debug category for batch_create element");
+
     auto gobject_class = G_OBJECT_CLASS(klass);
     gobject_class->set_property = [](GObject *object, guint prop_id, const GValue *value, GParamSpec * /*pspec*/) {
         auto self = BATCH_CREATE(object);
         if (prop_id == PROP_BATCH_SIZE)
             self->batch_size = g_value_get_int(value);
+        else if (prop_id == PROP_MAX_LATENCY)
+            self->max_latency = g_value_get_uint64(value);
     };
     gobject_class->get_property = [](GObject *object, guint prop_id, GValue *value, GParamSpec * /*pspec*/) {
         auto self = BATCH_CREATE(object);
         if (prop_id == PROP_BATCH_SIZE)
             g_value_set_int(value, self->batch_size);
+        else if (prop_id == PROP_MAX_LATENCY)
+            g_value_set_uint64(value, self->max_latency);
     };
     gobject_class->finalize = [](GObject *object) {
         auto self = BATCH_CREATE(object);
@@ -149,11 +379,12 @@ static void batch_create_class_init(BatchCreateClass *klass) {
 
     auto base_transform_class = GST_BASE_TRANSFORM_CLASS(klass);
     base_transform_class->start = batch_create_start;
+    base_transform_class->sink_event = batch_create_sink_event;
     base_transform_class->generate_output = [](GstBaseTransform *base, GstBuffer ** /*outbuf*/) {
         auto self = BATCH_CREATE(base);
         // if shared instance across multiple streams, all streams push to first stream/transform to keep frame order
         GstBaseTransform *first_transform = g_gst_base_element_storage.get_first(self->impl);
-        auto ret = self->impl->generate_output(base->queued_buf, self->stream_id, first_transform->srcpad);
+        auto ret = self->impl->generate_output(base->queued_buf, self->stream_id, first_transform);
         base->queued_buf = NULL;
         return ret;
     };
@@ -171,4 +402,12 @@ static void batch_create_class_init(BatchCreateClass *klass) {
                                     g_param_spec_int("batch-size", "Batch Size", "Number of frames to batch together",
                                                      MIN_BATCH_SIZE, MAX_BATCH_SIZE, DEFAULT_BATCH_SIZE,
                                                      (GParamFlags)(G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS)));
+    g_object_class_install_property(
+        gobject_class, PROP_MAX_LATENCY,
+        g_param_spec_uint64("max-latency", "Max Latency",
+                            "Maximum time in nanoseconds, measured by pipeline clock, from the first frame of a batch "
+                            "until the batch is pushed downstream. Incomplete batch is pushed when it expires. "
+                            "0 waits for complete batch",
+                            0, G_MAXUINT64, DEFAULT_MAX_LATENCY,
+                            (GParamFlags)(G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS)));
 }
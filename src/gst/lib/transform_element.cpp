@@ -126,8 +126,13 @@ class GstDlsTransform {
 
     ~GstDlsTransform() {
         BaseTransform *base_tran = dynamic_cast<BaseTransform *>(_transform);
-        if (base_tran)
+        if (base_tran) {
             GST_WARNING("%s: frame pool size on deletion = %ld", _base->element.object.name, base_tran->pool_size());
+            PoolStats stats = base_tran->pool_stats();
+            GST_INFO("%s: frame pool hits = %zu, allocations = %zu, waits = %zu, wait time = %" GST_TIME_FORMAT,
+                     _base->element.object.name, stats.hits, stats.allocations, stats.waits,
+                     GST_TIME_ARGS(stats.wait_time.count()));
+        }
         SharedInstance::global()->clean_up();
     }
 
@@ -433,6 +438,23 @@ static GstFramePtr gst_buffer_to_frame(GstBuffer *buffer, const FrameInfo &info,
         return std::make_shared<GSTFrame>(buffer, info, take_ownership, context);
 }
 
+// Tells downstream that no buffer is output for the timestamp of dropped input buffer
+static bool push_gap_event(GstBaseTransform *base, GstBuffer *buf, Frame &frame) {
+    GST_DEBUG_OBJECT(base, "Push GAP event: ts=%" GST_TIME_FORMAT, GST_TIME_ARGS(GST_BUFFER_PTS(buf)));
+    GstEvent *gap_event = gst_event_new_gap(GST_BUFFER_PTS(buf), GST_BUFFER_DURATION(buf));
+    // If SourceIdentifierMetadata attached, copy all fields to GAP event
+    auto source_id_meta = find_metadata(frame, SourceIdentifierMetadata::name);
+    if (source_id_meta) {
+        GSTDictionary event_dict(gst_event_writable_structure(gap_event));
+        copy_dictionary(*source_id_meta, event_dict);
+    }
+    if (!gst_pad_push_event(base->srcpad, gap_event)) {
+        GST_ERROR_OBJECT(base, "Failed to push GAP event buf: %p pts: %ld", buf, GST_BUFFER_PTS(buf));
+        return false;
+    }
+    return true;
+}
+
 GstFlowReturn GstDlsTransform::generate_output(GstBuffer **outbuf) {
     if (!_transform || (_class_data->desc->flags & ELEMENT_FLAG_EXTERNAL_MEMORY)) {
         return _class_data->default_generate_output(_base, outbuf);
@@ -452,10 +474,10 @@ GstFlowReturn GstDlsTransform::generate_output(GstBuffer **outbuf) {
 
         FramePtr out = _transform->process(in);
 
-        if (!out) { // send gap event?
-            // auto gap_event = gst_event_new_gap(GST_BUFFER_PTS(input), GST_BUFFER_DURATION(input));
-            // if (!gst_pad_push_event(_base->srcpad, gap_event))
-            //     return GST_FLOW_ERROR;
+        if (!out) {
+            // Without GAP event, elements waiting for every timestamp (e.g. meta_aggregate) would stall
+            if (!push_gap_event(_base, input, *in))
+                return GST_FLOW_ERROR;
             return GST_BASE_TRANSFORM_FLOW_DROPPED;
         } else if (out == in) {
             *outbuf = gst_buffer_ref(input);
@@ -511,19 +533,8 @@ GstFlowReturn GstDlsTransform::transform_ip(GstBuffer *buf) {
         bool accepted = _transform_inplace->process(transformed_frame);
 
         if (!accepted) {
-            GST_DEBUG_OBJECT(_base, "Push GAP event: ts=%" GST_TIME_FORMAT, GST_TIME_ARGS(GST_BUFFER_PTS(buf)));
-            GstEvent *gap_event = gst_event_new_gap(GST_BUFFER_PTS(buf), GST_BUFFER_DURATION(buf));
-            // If SourceIdentifierMetadata attached, copy all fields to GAP event
-            auto source_id_meta = find_metadata(*transformed_frame, SourceIdentifierMetadata::name);
-            if (source_id_meta) {
-                GSTDictionary event_dict(gst_event_writable_structure(gap_event));
-                copy_dictionary(*source_id_meta, event_dict);
-            }
-            // Push GAP event
-            if (!gst_pad_push_event(_base->srcpad, gap_event)) {
-                GST_ERROR_OBJECT(_base, "Failed to push GAP event buf: %p pts: %ld", buf, GST_BUFFER_PTS(buf));
+            if (!push_gap_event(_base, buf, *transformed_frame))
                 return GST_FLOW_ERROR;
-            }
             return GST_BASE_TRANSFORM_FLOW_DROPPED;
         }
         return GST_FLOW_OK;
@@ -576,6 +587,15 @@ GstFlowReturn GstDlsTransform::transform_list(GstBufferList *list) {
                               static_cast<intptr_t>(GST_BUFFER_PTS(src)), NULL);
         }
 
+        // Batch fill level and wait time, attached by batch_create
+        auto batch_meta = static_cast<GstStructure *>(
+            gst_mini_object_get_qdata(&list->mini_object, g_quark_from_string(BatchMetadata::name)));
+        if (batch_meta) {
+            auto dst_meta = GST_GVA_TENSOR_META_ADD(outbuf);
+            gst_structure_free(dst_meta->data);
+            dst_meta->data = gst_structure_copy(batch_meta);
+        }
+
         // Push downstream
         return gst_pad_push(_base->srcpad, outbuf);
     } catch (const std::exception &e) {
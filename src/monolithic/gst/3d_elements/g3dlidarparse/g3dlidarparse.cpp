@@ -5,6 +5,9 @@
  ******************************************************************************/
 
 #include "g3dlidarparse.h"
+#include "pcd_parser.h"
+#include "point_cloud_filter.h"
+#include <algorithm>
 #include <dlstreamer/gst/metadata/g3d_lidar_meta.h>
 #include <fstream>
 #include <gst/gstinfo.h>
@@ -16,7 +19,9 @@
 GST_DEBUG_CATEGORY_STATIC(gst_g3d_lidar_parse_debug);
 #define GST_CAT_DEFAULT gst_g3d_lidar_parse_debug
 
-enum { PROP_0, PROP_STRIDE, PROP_FRAME_RATE };
+enum { PROP_0, PROP_STRIDE, PROP_FRAME_RATE, PROP_ROI, PROP_VOXEL_SIZE, PROP_GROUND_THRESHOLD };
+
+#define ROI_FORMAT_STRING "x_min,y_min,z_min,x_max,y_max,z_max"
 
 static GstStaticPadTemplate sink_template =
     GST_STATIC_PAD_TEMPLATE("sink", GST_PAD_SINK, GST_PAD_ALWAYS, GST_STATIC_CAPS("application/octet-stream"));
@@ -36,6 +41,7 @@ static GstCaps *gst_g3d_lidar_parse_transform_caps(GstBaseTransform *trans, GstP
                                                    GstCaps *filter);
 static gboolean gst_g3d_lidar_parse_set_caps(GstBaseTransform *trans, GstCaps *incaps, GstCaps *outcaps);
 static gboolean gst_g3d_lidar_parse_find_upstream_location(GstBaseTransform *trans, gchar **location_out);
+static gboolean gst_g3d_lidar_parse_parse_roi(const gchar *roi, gfloat *box);
 
 static void gst_g3d_lidar_parse_class_init(GstG3DLidarParseClass *klass);
 static void gst_g3d_lidar_parse_init(GstG3DLidarParse *filter);
@@ -75,6 +81,27 @@ static void gst_g3d_lidar_parse_class_init(GstG3DLidarParseClass *klass) {
                            "Desired output frame rate in frames per second. A value of 0 means no frame rate control.",
                            0.0, G_MAXFLOAT, 0.0, (GParamFlags)(G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS)));
 
+    g_object_class_install_property(
+        gobject_class, PROP_ROI,
+        g_param_spec_string("roi", "Region of Interest",
+                            "Axis-aligned box in meters, points outside of it are dropped. Format: " ROI_FORMAT_STRING
+                            ". Empty string disables cropping.",
+                            NULL, (GParamFlags)(G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS)));
+
+    g_object_class_install_property(
+        gobject_class, PROP_VOXEL_SIZE,
+        g_param_spec_float("voxel-size", "Voxel Size",
+                           "Edge of the voxel grid in meters, points in the same voxel are replaced by their centroid. "
+                           "0 disables downsampling.",
+                           0.0, G_MAXFLOAT, 0.0, (GParamFlags)(G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS)));
+
+    g_object_class_install_property(
+        gobject_class, PROP_GROUND_THRESHOLD,
+        g_param_spec_float("ground-threshold", "Ground Threshold",
+                           "Points closer than this distance in meters to the dominant near-horizontal plane are "
+                           "removed as ground. 0 disables ground removal.",
+                           0.0, G_MAXFLOAT, 0.0, (GParamFlags)(G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS)));
+
     gst_element_class_set_static_metadata(
         gstelement_class, "G3D Lidar Parser", "Filter/Converter",
         "Parses binary lidar data to vector float format with stride and frame rate control (g3dlidarparse)",
@@ -95,6 +122,10 @@ static void gst_g3d_lidar_parse_class_init(GstG3DLidarParseClass *klass) {
 static void gst_g3d_lidar_parse_init(GstG3DLidarParse *filter) {
     filter->stride = 1;
     filter->frame_rate = 0.0;
+    filter->roi = NULL;
+    filter->voxel_size = 0.0;
+    filter->ground_threshold = 0.0;
+    filter->point_filter = NULL;
     g_mutex_init(&filter->mutex);
 
     filter->current_index = 0;
@@ -111,6 +142,11 @@ static void gst_g3d_lidar_parse_finalize(GObject *object) {
 
     g_mutex_clear(&filter->mutex);
 
+    g_free(filter->roi);
+    filter->roi = NULL;
+    delete filter->point_filter;
+    filter->point_filter = NULL;
+
     filter->current_index = 0;
 
     G_OBJECT_CLASS(gst_g3d_lidar_parse_parent_class)->finalize(object);
@@ -126,6 +162,16 @@ static void gst_g3d_lidar_parse_set_property(GObject *object, guint prop_id, con
     case PROP_FRAME_RATE:
         filter->frame_rate = g_value_get_float(value);
         break;
+    case PROP_ROI:
+        g_free(filter->roi);
+        filter->roi = g_value_dup_string(value);
+        break;
+    case PROP_VOXEL_SIZE:
+        filter->voxel_size = g_value_get_float(value);
+        break;
+    case PROP_GROUND_THRESHOLD:
+        filter->ground_threshold = g_value_get_float(value);
+        break;
     default:
         G_OBJECT_WARN_INVALID_PROPERTY_ID(object, prop_id, pspec);
         break;
@@ -142,6 +188,15 @@ static void gst_g3d_lidar_parse_get_property(GObject *object, guint prop_id, GVa
     case PROP_FRAME_RATE:
         g_value_set_float(value, filter->frame_rate);
         break;
+    case PROP_ROI:
+        g_value_set_string(value, filter->roi);
+        break;
+    case PROP_VOXEL_SIZE:
+        g_value_set_float(value, filter->voxel_size);
+        break;
+    case PROP_GROUND_THRESHOLD:
+        g_value_set_float(value, filter->ground_threshold);
+        break;
     default:
         G_OBJECT_WARN_INVALID_PROPERTY_ID(object, prop_id, pspec);
         break;
@@ -182,9 +237,42 @@ static gboolean gst_g3d_lidar_parse_start(GstBaseTransform *trans) {
 
     g_free(upstream_location);
 
+    PointCloudFilterParams params;
+    if (filter->roi && *filter->roi) {
+        if (!gst_g3d_lidar_parse_parse_roi(filter->roi, params.roi)) {
+            GST_ERROR_OBJECT(filter, "Invalid roi '%s', expected format: " ROI_FORMAT_STRING, filter->roi);
+            return FALSE;
+        }
+        params.crop = true;
+    }
+    params.voxel_size = filter->voxel_size;
+    params.ground_threshold = filter->ground_threshold;
+
+    delete filter->point_filter;
+    filter->point_filter = new PointCloudFilter(params);
+    if (!filter->point_filter->enabled()) {
+        delete filter->point_filter;
+        filter->point_filter = NULL;
+    } else {
+        GST_INFO_OBJECT(filter, "Point cloud filter: roi=%s voxel-size=%f ground-threshold=%f",
+                        params.crop ? filter->roi : "none", params.voxel_size, params.ground_threshold);
+    }
+
     return TRUE;
 }
 
+static gboolean gst_g3d_lidar_parse_parse_roi(const gchar *roi, gfloat *box) {
+    gchar **values = g_strsplit(roi, ",", -1);
+    gboolean valid = g_strv_length(values) == 6;
+    for (guint i = 0; valid && i < 6; ++i) {
+        gchar *end = NULL;
+        box[i] = static_cast<gfloat>(g_ascii_strtod(g_strstrip(values[i]), &end));
+        valid = end != values[i] && *end == '\0';
+    }
+    g_strfreev(values);
+    return valid && box[0] <= box[3] && box[1] <= box[4] && box[2] <= box[5];
+}
+
 static gboolean gst_g3d_lidar_parse_find_upstream_location(GstBaseTransform *trans, gchar **location_out) {
     if (!location_out) {
         return FALSE;
@@ -238,6 +326,8 @@ static gboolean gst_g3d_lidar_parse_stop(GstBaseTransform *trans) {
     filter->current_index = 0;
     filter->stream_id = 0;
     filter->next_pts = 0;
+    delete filter->point_filter;
+    filter->point_filter = NULL;
     GST_INFO_OBJECT(filter, "[STOP] Data cleared");
 
     return TRUE;
@@ -330,18 +420,20 @@ static GstFlowReturn gst_g3d_lidar_parse_transform(GstBaseTransform *trans, GstB
     filter->current_index++;
 
     GstMapInfo in_map;
-    size_t num_floats = 0;
+    if (!gst_buffer_map(inbuf, &in_map, GST_MAP_READ)) {
+        GST_ERROR_OBJECT(filter, "Failed to map input buffer for reading");
+        g_mutex_unlock(&filter->mutex);
+        return GST_FLOW_ERROR;
+    }
+
+    // Points already stored as xyzi float32 are shared with the input buffer (payload_offset, payload_size),
+    // other layouts are converted into payload_mem
     size_t point_count = 0;
-    std::vector<float> float_data;
+    gsize payload_offset = 0;
+    gsize payload_size = 0;
+    GstMemory *payload_mem = NULL;
 
     if (filter->file_type == FILE_TYPE_BIN) {
-        // Process BIN file
-        if (!gst_buffer_map(inbuf, &in_map, GST_MAP_READ)) {
-            GST_ERROR_OBJECT(filter, "Failed to map input buffer for reading");
-            g_mutex_unlock(&filter->mutex);
-            return GST_FLOW_ERROR;
-        }
-
         if (in_map.size % sizeof(float) != 0) {
             GST_ERROR_OBJECT(filter, "Buffer size (%lu) is not a multiple of float size (%lu)", in_map.size,
                              sizeof(float));
@@ -350,73 +442,118 @@ static GstFlowReturn gst_g3d_lidar_parse_transform(GstBaseTransform *trans, GstB
             return GST_FLOW_ERROR;
         }
 
-        num_floats = in_map.size / sizeof(float);
-        point_count = num_floats / 4;
-        const float *data = reinterpret_cast<const float *>(in_map.data);
-        float_data.assign(data, data + num_floats);
-        gst_buffer_unmap(inbuf, &in_map);
+        payload_size = in_map.size;
+        point_count = in_map.size / pcd::XYZI_POINT_SIZE;
     } else if (filter->file_type == FILE_TYPE_PCD) {
-        // Map input for PCD parsing
-        GstMapInfo in_map;
-        if (!gst_buffer_map(inbuf, &in_map, GST_MAP_READ)) {
-            GST_ERROR_OBJECT(filter, "Failed to map input buffer for reading (PCD)");
+        pcd::Header header;
+        std::string error;
+        if (!pcd::parse_header(reinterpret_cast<const char *>(in_map.data), in_map.size, header, error)) {
+            GST_ERROR_OBJECT(filter, "Failed to parse PCD header: %s", error.c_str());
+            gst_buffer_unmap(inbuf, &in_map);
             g_mutex_unlock(&filter->mutex);
             return GST_FLOW_ERROR;
         }
 
-        // Detect PCD format (ASCII or binary) using the header
-        const size_t header_len = std::min(in_map.size, static_cast<size_t>(4096));
-        std::string header(reinterpret_cast<const char *>(in_map.data), header_len);
-        bool is_ascii = header.find("DATA ascii") != std::string::npos;
-
-        if (is_ascii) {
-            GST_INFO_OBJECT(filter, "Detected ASCII PCD format.");
-            std::istringstream iss(std::string(reinterpret_cast<const char *>(in_map.data), in_map.size));
-            std::string line;
-            while (std::getline(iss, line)) {
-                if (line.empty() || line[0] == '#')
-                    continue;
-                float x, y, z, i;
-                if (std::istringstream(line) >> x >> y >> z >> i) {
-                    float_data.insert(float_data.end(), {x, y, z, i});
-                }
+        const size_t max_points = pcd::max_points(in_map.data, in_map.size, header);
+        GST_DEBUG_OBJECT(filter, "PCD header: %zu fields, %zu points, point size %zu, data %d", header.fields.size(),
+                         header.points, header.point_size, static_cast<int>(header.data));
+
+        if (header.data == pcd::DataFormat::BINARY && pcd::is_xyzi_float32(header)) {
+            point_count = max_points;
+            payload_offset = header.data_offset;
+            payload_size = point_count * pcd::XYZI_POINT_SIZE;
+        } else if (max_points > 0) {
+            payload_mem = gst_allocator_alloc(NULL, max_points * pcd::XYZI_POINT_SIZE, NULL);
+            if (!payload_mem) {
+                GST_ERROR_OBJECT(filter, "Failed to allocate output buffer payload (points=%zu)", max_points);
+                gst_buffer_unmap(inbuf, &in_map);
+                g_mutex_unlock(&filter->mutex);
+                return GST_FLOW_ERROR;
             }
-        } else {
-            GST_INFO_OBJECT(filter, "Detected binary PCD format.");
-            const size_t token_pos = header.find("DATA binary");
-            if (token_pos == std::string::npos) {
-                GST_ERROR_OBJECT(filter, "Failed to locate binary data section in PCD file.");
+
+            GstMapInfo out_map;
+            if (!gst_memory_map(payload_mem, &out_map, GST_MAP_WRITE)) {
+                GST_ERROR_OBJECT(filter, "Failed to map output buffer payload for writing");
+                gst_memory_unref(payload_mem);
                 gst_buffer_unmap(inbuf, &in_map);
                 g_mutex_unlock(&filter->mutex);
                 return GST_FLOW_ERROR;
             }
 
-            size_t newline_pos = header.find('\n', token_pos);
-            if (newline_pos == std::string::npos) {
-                GST_ERROR_OBJECT(filter, "Binary PCD header missing newline after DATA binary");
+            const bool ok = pcd::read_points(in_map.data, in_map.size, header,
+                                             reinterpret_cast<float *>(out_map.data), point_count, error);
+            gst_memory_unmap(payload_mem, &out_map);
+            if (!ok) {
+                GST_ERROR_OBJECT(filter, "Failed to read PCD points: %s", error.c_str());
+                gst_memory_unref(payload_mem);
                 gst_buffer_unmap(inbuf, &in_map);
                 g_mutex_unlock(&filter->mutex);
                 return GST_FLOW_ERROR;
             }
 
-            const size_t payload_offset = newline_pos + 1;
-            if (payload_offset >= in_map.size) {
-                GST_ERROR_OBJECT(filter, "Binary PCD payload offset out of range");
+            payload_size = point_count * pcd::XYZI_POINT_SIZE;
+            gst_memory_resize(payload_mem, 0, payload_size);
+        }
+    }
+
+    // Consumers read the payload as floats, so a payload which isn't float-aligned in the input is copied, not shared
+    if (!payload_mem && payload_size > 0 &&
+        reinterpret_cast<uintptr_t>(in_map.data + payload_offset) % alignof(float) != 0) {
+        GST_DEBUG_OBJECT(filter, "Input payload at offset %zu is not float-aligned, copying it", payload_offset);
+        payload_mem = gst_allocator_alloc(NULL, payload_size, NULL);
+        if (!payload_mem) {
+            GST_ERROR_OBJECT(filter, "Failed to allocate output buffer payload (points=%zu)", point_count);
+            gst_buffer_unmap(inbuf, &in_map);
+            g_mutex_unlock(&filter->mutex);
+            return GST_FLOW_ERROR;
+        }
+        GstMapInfo out_map;
+        if (!gst_memory_map(payload_mem, &out_map, GST_MAP_WRITE)) {
+            GST_ERROR_OBJECT(filter, "Failed to map output buffer payload for writing");
+            gst_memory_unref(payload_mem);
+            gst_buffer_unmap(inbuf, &in_map);
+            g_mutex_unlock(&filter->mutex);
+            return GST_FLOW_ERROR;
+        }
+        memcpy(out_map.data, in_map.data + payload_offset, payload_size);
+        gst_memory_unmap(payload_mem, &out_map);
+    }
+
+    if (filter->point_filter && point_count > 0) {
+        // Shared input payloads are filtered into new memory, converted points are filtered in place
+        const bool shared = payload_mem == NULL;
+        if (shared) {
+            payload_mem = gst_allocator_alloc(NULL, point_count * pcd::XYZI_POINT_SIZE, NULL);
+            if (!payload_mem) {
+                GST_ERROR_OBJECT(filter, "Failed to allocate output buffer payload (points=%zu)", point_count);
                 gst_buffer_unmap(inbuf, &in_map);
                 g_mutex_unlock(&filter->mutex);
                 return GST_FLOW_ERROR;
             }
+        }
 
-            const size_t num_points = (in_map.size - payload_offset) / (4 * sizeof(float));
-            const float *data = reinterpret_cast<const float *>(in_map.data + payload_offset);
-            float_data.assign(data, data + num_points * 4);
+        GstMapInfo out_map;
+        if (!gst_memory_map(payload_mem, &out_map, GST_MAP_READWRITE)) {
+            GST_ERROR_OBJECT(filter, "Failed to map output buffer payload for filtering");
+            gst_memory_unref(payload_mem);
+            gst_buffer_unmap(inbuf, &in_map);
+            g_mutex_unlock(&filter->mutex);
+            return GST_FLOW_ERROR;
         }
 
-        gst_buffer_unmap(inbuf, &in_map);
-        num_floats = float_data.size();
-        point_count = num_floats / 4;
+        float *points = reinterpret_cast<float *>(out_map.data);
+        const float *input = shared ? reinterpret_cast<const float *>(in_map.data + payload_offset) : points;
+        const size_t input_count = point_count;
+        point_count = filter->point_filter->apply(input, input_count, points);
+        gst_memory_unmap(payload_mem, &out_map);
+
+        payload_size = point_count * pcd::XYZI_POINT_SIZE;
+        gst_memory_resize(payload_mem, 0, payload_size);
+        GST_DEBUG_OBJECT(filter, "Point cloud filter kept %zu of %zu points", point_count, input_count);
     }
 
+    gst_buffer_unmap(inbuf, &in_map);
+
     gst_buffer_remove_all_memory(outbuf);
     GstClockTime exit_source_timestamp = GST_CLOCK_TIME_NONE;
     if (GstClock *clock = gst_element_get_clock(GST_ELEMENT(filter))) {
@@ -432,70 +569,50 @@ static GstFlowReturn gst_g3d_lidar_parse_transform(GstBaseTransform *trans, GstB
     GST_DEBUG_OBJECT(filter, "Add meta frame_id=%zu stream_id=%u exit_ts=%" GST_TIME_FORMAT " n_points=%zu stride=%d",
                      frame_id, filter->stream_id, GST_TIME_ARGS(exit_source_timestamp), point_count, filter->stride);
 
-    if (!float_data.empty()) {
-        const gsize payload_size = float_data.size() * sizeof(float);
-        GstMemory *payload_mem = gst_allocator_alloc(NULL, payload_size, NULL);
-        if (!payload_mem) {
-            GST_ERROR_OBJECT(filter, "Failed to allocate output buffer payload (size=%zu)", payload_size);
+    if (payload_mem && payload_size == 0) {
+        gst_memory_unref(payload_mem);
+    } else if (payload_mem) {
+        gst_buffer_append_memory(outbuf, payload_mem);
+    } else if (payload_size > 0) {
+        // sub-memory of the input, no copy unless the input memory cannot be shared
+        if (!gst_buffer_copy_into(outbuf, inbuf, GST_BUFFER_COPY_MEMORY, payload_offset, payload_size)) {
+            GST_ERROR_OBJECT(filter, "Failed to share input payload (offset=%zu size=%zu)", payload_offset,
+                             payload_size);
             g_mutex_unlock(&filter->mutex);
             return GST_FLOW_ERROR;
         }
+    }
 
-        GstMapInfo out_map;
-        if (!gst_memory_map(payload_mem, &out_map, GST_MAP_WRITE)) {
-            GST_ERROR_OBJECT(filter, "Failed to map output buffer payload for writing");
-            gst_memory_unref(payload_mem);
+    if (payload_size > 0 && gst_debug_category_get_threshold(gst_g3d_lidar_parse_debug) >= GST_LEVEL_DEBUG) {
+        GstMapInfo verify_map;
+        if (!gst_buffer_map(outbuf, &verify_map, GST_MAP_READ)) {
+            GST_ERROR_OBJECT(filter, "Failed to map output buffer payload for verification");
             g_mutex_unlock(&filter->mutex);
             return GST_FLOW_ERROR;
         }
 
-        memcpy(out_map.data, float_data.data(), payload_size);
-        gst_memory_unmap(payload_mem, &out_map);
-        gst_buffer_append_memory(outbuf, payload_mem);
-
-        if (gst_debug_category_get_threshold(gst_g3d_lidar_parse_debug) >= GST_LEVEL_DEBUG) {
-            GstMapInfo verify_map;
-            if (!gst_buffer_map(outbuf, &verify_map, GST_MAP_READ)) {
-                GST_ERROR_OBJECT(filter, "Failed to map output buffer payload for verification");
-                g_mutex_unlock(&filter->mutex);
-                return GST_FLOW_ERROR;
-            }
-
-            if (verify_map.size != payload_size) {
-                GST_ERROR_OBJECT(filter, "Payload size mismatch: expected=%zu actual=%zu", payload_size,
-                                 verify_map.size);
-                gst_buffer_unmap(outbuf, &verify_map);
-                g_mutex_unlock(&filter->mutex);
-                return GST_FLOW_ERROR;
-            }
-
-            const gsize float_count = float_data.size();
-            const float *verify_floats = reinterpret_cast<const float *>(verify_map.data);
-            const gsize check_count = std::min<gsize>(float_count, 8);
-
-            for (gsize i = 0; i < check_count; ++i) {
-                if (verify_floats[i] != float_data[i]) {
-                    GST_ERROR_OBJECT(filter, "Payload verification failed at head index %zu", i);
-                    gst_buffer_unmap(outbuf, &verify_map);
-                    g_mutex_unlock(&filter->mutex);
-                    return GST_FLOW_ERROR;
-                }
-            }
-
+        if (verify_map.size != payload_size) {
+            GST_ERROR_OBJECT(filter, "Payload size mismatch: expected=%zu actual=%zu", payload_size, verify_map.size);
             gst_buffer_unmap(outbuf, &verify_map);
+            g_mutex_unlock(&filter->mutex);
+            return GST_FLOW_ERROR;
+        }
 
-            const gsize count = float_data.size();
-            const gsize preview_len = std::min<gsize>(count, 5);
-            std::ostringstream oss;
-            oss << "lidar_point_count=" << point_count << " frame_id=" << frame_id << " stream_id=" << filter->stream_id
-                << " exit_ts=" << exit_source_timestamp << "ns" << " preview(" << preview_len << "/" << count << "):";
-
-            for (gsize i = 0; i < preview_len; ++i) {
-                oss << " " << std::fixed << std::setprecision(6) << float_data[i];
-            }
-
-            GST_INFO_OBJECT(filter, "%s", oss.str().c_str());
+        const float *floats = reinterpret_cast<const float *>(verify_map.data);
+        const gsize count = verify_map.size / sizeof(float);
+        const gsize preview_len = std::min<gsize>(count, 5);
+        std::ostringstream oss;
+        oss << "lidar_point_count=" << point_count << " frame_id=" << frame_id << " stream_id=" << filter->stream_id
+            << " exit_ts=" << exit_source_timestamp << "ns" << " preview(" << preview_len << "/" << count << "):";
+
+        for (gsize i = 0; i < preview_len; ++i) {
+            float value;
+            memcpy(&value, floats + i, sizeof(value));
+            oss << " " << std::fixed << std::setprecision(6) << value;
         }
+
+        gst_buffer_unmap(outbuf, &verify_map);
+        GST_INFO_OBJECT(filter, "%s", oss.str().c_str());
     }
 
     LidarMeta *lidar_meta = add_lidar_meta(outbuf, point_count, frame_id, exit_source_timestamp, filter->stream_id);
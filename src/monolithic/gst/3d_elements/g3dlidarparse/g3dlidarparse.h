@@ -11,6 +11,8 @@
 #include <gst/gst.h>
 #include <vector>
 
+class PointCloudFilter;
+
 G_BEGIN_DECLS
 
 #define GST_TYPE_G3D_LIDAR_PARSE (gst_g3d_lidar_parse_get_type())
@@ -31,6 +33,10 @@ struct _GstG3DLidarParse {
     FileType file_type;
     gint stride;
     gfloat frame_rate;
+    gchar *roi;
+    gfloat voxel_size;
+    gfloat ground_threshold;
+    PointCloudFilter *point_filter; // created at start if any of roi, voxel-size or ground-threshold is set
     GMutex mutex;
 
     size_t current_index;
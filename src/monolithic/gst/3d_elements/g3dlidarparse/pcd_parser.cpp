@@ -0,0 +1,464 @@
+/*******************************************************************************
+ * Copyright (C) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+#include "pcd_parser.h"
+
+#include <algorithm>
+#include <array>
+#include <charconv>
+#include <cstring>
+#include <string_view>
+
+namespace pcd {
+
+namespace {
+
+constexpr int NO_FIELD = -1;
+
+bool is_space(char c) {
+    return c == ' ' || c == '\t' || c == '\r';
+}
+
+// Returns the next line without its terminator and moves pos past it
+std::string_view next_line(const char *data, size_t size, size_t &pos) {
+    const char *begin = data + pos;
+    const void *eol = memchr(begin, '\n', size - pos);
+    const size_t length = eol ? static_cast<const char *>(eol) - begin : size - pos;
+    pos += eol ? length + 1 : length;
+    std::string_view line(begin, length);
+    while (!line.empty() && is_space(line.back()))
+        line.remove_suffix(1);
+    return line;
+}
+
+std::vector<std::string_view> split(std::string_view line) {
+    std::vector<std::string_view> tokens;
+    size_t pos = 0;
+    while (pos < line.size()) {
+        while (pos < line.size() && is_space(line[pos]))
+            ++pos;
+        const size_t start = pos;
+        while (pos < line.size() && !is_space(line[pos]))
+            ++pos;
+        if (pos > start)
+            tokens.push_back(line.substr(start, pos - start));
+    }
+    return tokens;
+}
+
+template <typename T>
+bool parse_number(std::string_view token, T &value) {
+    if (!token.empty() && token.front() == '+')
+        token.remove_prefix(1);
+    const auto [ptr, ec] = std::from_chars(token.data(), token.data() + token.size(), value);
+    return ec == std::errc() && ptr == token.data() + token.size();
+}
+
+bool is_valid_type(char type, uint32_t size) {
+    if (type == 'F')
+        return size == 4 || size == 8;
+    if (type == 'I' || type == 'U')
+        return size == 1 || size == 2 || size == 4 || size == 8;
+    return false;
+}
+
+// Index of the field providing each of x, y, z, intensity, NO_FIELD if there is none
+std::array<int, XYZI_FLOATS> find_xyzi_fields(const Header &header) {
+    std::array<int, XYZI_FLOATS> channels;
+    channels.fill(NO_FIELD);
+    for (size_t f = 0; f < header.fields.size(); ++f) {
+        const std::string &name = header.fields[f].name;
+        int channel = NO_FIELD;
+        if (name == "x")
+            channel = 0;
+        else if (name == "y")
+            channel = 1;
+        else if (name == "z")
+            channel = 2;
+        else if (name == "intensity" || name == "i")
+            channel = 3;
+        if (channel != NO_FIELD && channels[channel] == NO_FIELD)
+            channels[channel] = static_cast<int>(f);
+    }
+    return channels;
+}
+
+template <typename T>
+float load(const uint8_t *p) {
+    T value;
+    memcpy(&value, p, sizeof(T));
+    return static_cast<float>(value);
+}
+
+float read_value(const uint8_t *p, const Field &field) {
+    switch (field.type) {
+    case 'F':
+        return field.size == 4 ? load<float>(p) : load<double>(p);
+    case 'I':
+        switch (field.size) {
+        case 1:
+            return load<int8_t>(p);
+        case 2:
+            return load<int16_t>(p);
+        case 4:
+            return load<int32_t>(p);
+        default:
+            return load<int64_t>(p);
+        }
+    default:
+        switch (field.size) {
+        case 1:
+            return load<uint8_t>(p);
+        case 2:
+            return load<uint16_t>(p);
+        case 4:
+            return load<uint32_t>(p);
+        default:
+            return load<uint64_t>(p);
+        }
+    }
+}
+
+// Converts points stored with the given distance between consecutive values of a field. For binary data the stride is
+// the point size and fields are interleaved; for binary_compressed data each field is a column of its own.
+void convert_points(const Header &header, size_t points, float *out,
+                    const std::array<const uint8_t *, XYZI_FLOATS> &columns,
+                    const std::array<size_t, XYZI_FLOATS> &strides) {
+    const auto channels = find_xyzi_fields(header);
+    for (size_t ch = 0; ch < XYZI_FLOATS; ++ch) {
+        if (channels[ch] == NO_FIELD) {
+            for (size_t i = 0; i < points; ++i)
+                out[i * XYZI_FLOATS + ch] = 0.0f;
+            continue;
+        }
+        const Field &field = header.fields[channels[ch]];
+        const uint8_t *src = columns[ch];
+        if (field.type == 'F' && field.size == 4) {
+            for (size_t i = 0; i < points; ++i)
+                out[i * XYZI_FLOATS + ch] = load<float>(src + i * strides[ch]);
+        } else {
+            for (size_t i = 0; i < points; ++i)
+                out[i * XYZI_FLOATS + ch] = read_value(src + i * strides[ch], field);
+        }
+    }
+}
+
+// LZF decompression as used by PCL for binary_compressed data. Returns false on corrupted input or if the output
+// does not fill out_size exactly.
+bool lzf_decompress(const uint8_t *in, size_t in_size, uint8_t *out, size_t out_size) {
+    const uint8_t *ip = in;
+    const uint8_t *const in_end = in + in_size;
+    uint8_t *op = out;
+    uint8_t *const out_end = out + out_size;
+
+    while (ip < in_end) {
+        size_t ctrl = *ip++;
+        if (ctrl < 32) {
+            // literal run of ctrl + 1 bytes
+            const size_t len = ctrl + 1;
+            if (static_cast<size_t>(out_end - op) < len || static_cast<size_t>(in_end - ip) < len)
+                return false;
+            memcpy(op, ip, len);
+            op += len;
+            ip += len;
+        } else {
+            // back reference, may overlap the output being written
+            size_t len = ctrl >> 5;
+            size_t distance = (ctrl & 0x1f) << 8;
+            if (len == 7) {
+                if (ip >= in_end)
+                    return false;
+                len += *ip++;
+            }
+            if (ip >= in_end)
+                return false;
+            distance += *ip++ + 1;
+            len += 2;
+            if (static_cast<size_t>(op - out) < distance || static_cast<size_t>(out_end - op) < len)
+                return false;
+            const uint8_t *ref = op - distance;
+            for (size_t i = 0; i < len; ++i)
+                op[i] = ref[i];
+            op += len;
+        }
+    }
+    return op == out_end;
+}
+
+bool read_ascii(const char *data, size_t size, const Header &header, float *out, size_t &points) {
+    // channel of every value of a point, counting each element of multi-count fields
+    const auto channels = find_xyzi_fields(header);
+    std::vector<size_t> first_token;
+    size_t tokens_per_point = 0;
+    for (const Field &field : header.fields) {
+        first_token.push_back(tokens_per_point);
+        tokens_per_point += field.count;
+    }
+    std::vector<int> token_channel(tokens_per_point, NO_FIELD);
+    size_t tokens_needed = 0;
+    for (size_t ch = 0; ch < XYZI_FLOATS; ++ch) {
+        if (channels[ch] == NO_FIELD)
+            continue;
+        const size_t token = first_token[channels[ch]];
+        token_channel[token] = static_cast<int>(ch);
+        tokens_needed = std::max(tokens_needed, token + 1);
+    }
+
+    points = 0;
+    const char *p = data + header.data_offset;
+    const char *const end = data + size;
+    while (p < end && points < header.points) {
+        const void *newline = memchr(p, '\n', end - p);
+        const char *eol = newline ? static_cast<const char *>(newline) : end;
+
+        float values[XYZI_FLOATS] = {};
+        size_t token = 0;
+        bool ok = true;
+        const char *q = p;
+        while (ok && token < tokens_needed) {
+            while (q < eol && is_space(*q))
+                ++q;
+            if (q == eol || *q == '#')
+                break;
+            const char *token_end = q;
+            while (token_end < eol && !is_space(*token_end))
+                ++token_end;
+            if (token_channel[token] != NO_FIELD)
+                ok = parse_number(std::string_view(q, token_end - q), values[token_channel[token]]);
+            q = token_end;
+            ++token;
+        }
+
+        // empty, comment and malformed lines are skipped
+        if (ok && token == tokens_needed && tokens_needed > 0) {
+            memcpy(out + points * XYZI_FLOATS, values, sizeof(values));
+            ++points;
+        }
+        p = eol + 1;
+    }
+    return true;
+}
+
+bool read_binary(const uint8_t *data, size_t size, const Header &header, float *out, size_t &points) {
+    const uint8_t *payload = data + header.data_offset;
+    points = std::min(header.points, (size - header.data_offset) / header.point_size);
+    if (is_xyzi_float32(header)) {
+        memcpy(out, payload, points * XYZI_POINT_SIZE);
+        return true;
+    }
+
+    const auto channels = find_xyzi_fields(header);
+    std::array<const uint8_t *, XYZI_FLOATS> columns = {};
+    std::array<size_t, XYZI_FLOATS> strides = {};
+    for (size_t ch = 0; ch < XYZI_FLOATS; ++ch) {
+        if (channels[ch] != NO_FIELD)
+            columns[ch] = payload + header.fields[channels[ch]].offset;
+        strides[ch] = header.point_size;
+    }
+    convert_points(header, points, out, columns, strides);
+    return true;
+}
+
+// Highest LZF expansion, a 3-byte back reference outputs up to 264 bytes
+constexpr uint64_t LZF_MAX_EXPANSION = 264 / 3;
+
+// Reads the sizes preceding binary_compressed data and checks them against POINTS and the payload, so that nothing is
+// allocated for a header claiming more points than the payload can decompress to
+bool read_compressed_sizes(const uint8_t *data, size_t size, const Header &header, uint32_t &compressed_size,
+                           uint32_t &uncompressed_size, std::string &error) {
+    const uint8_t *payload = data + header.data_offset;
+    const size_t available = size > header.data_offset ? size - header.data_offset : 0;
+    if (available < 2 * sizeof(uint32_t)) {
+        error = "binary_compressed PCD payload is truncated";
+        return false;
+    }
+    memcpy(&compressed_size, payload, sizeof(uint32_t));
+    memcpy(&uncompressed_size, payload + sizeof(uint32_t), sizeof(uint32_t));
+    if (compressed_size > available - 2 * sizeof(uint32_t)) {
+        error = "binary_compressed PCD payload is truncated";
+        return false;
+    }
+    if (header.points > UINT32_MAX / header.point_size || uncompressed_size != header.points * header.point_size) {
+        error = "binary_compressed PCD size does not match POINTS";
+        return false;
+    }
+    if (uncompressed_size > compressed_size * LZF_MAX_EXPANSION) {
+        error = "binary_compressed PCD size exceeds what its payload can decompress to";
+        return false;
+    }
+    return true;
+}
+
+bool read_binary_compressed(const uint8_t *data, size_t size, const Header &header, float *out, size_t &points,
+                            std::string &error) {
+    const uint8_t *payload = data + header.data_offset;
+    uint32_t compressed_size = 0;
+    uint32_t uncompressed_size = 0;
+    if (!read_compressed_sizes(data, size, header, compressed_size, uncompressed_size, error))
+        return false;
+
+    // decompression buffer is reused by the following frames of the streaming thread
+    thread_local std::vector<uint8_t> columns_data;
+    columns_data.resize(uncompressed_size);
+    if (!lzf_decompress(payload + 2 * sizeof(uint32_t), compressed_size, columns_data.data(), uncompressed_size)) {
+        error = "Failed to decompress binary_compressed PCD payload";
+        return false;
+    }
+
+    // each field is stored as a column of all points, in the order of fields
+    points = header.points;
+    const auto channels = find_xyzi_fields(header);
+    std::array<const uint8_t *, XYZI_FLOATS> columns = {};
+    std::array<size_t, XYZI_FLOATS> strides = {};
+    for (size_t ch = 0; ch < XYZI_FLOATS; ++ch) {
+        if (channels[ch] == NO_FIELD)
+            continue;
+        const Field &field = header.fields[channels[ch]];
+        columns[ch] = columns_data.data() + field.offset * header.points;
+        strides[ch] = static_cast<size_t>(field.size) * field.count;
+    }
+    convert_points(header, points, out, columns, strides);
+    return true;
+}
+
+} // namespace
+
+bool parse_header(const char *data, size_t size, Header &header, std::string &error) {
+    header = Header();
+    std::vector<std::string_view> sizes, types, counts;
+    bool width_set = false, points_set = false, data_set = false;
+
+    size_t pos = 0;
+    while (pos < size && !data_set) {
+        const auto tokens = split(next_line(data, size, pos));
+        if (tokens.empty() || tokens[0].front() == '#')
+            continue;
+
+        const std::string_view key = tokens[0];
+        const std::vector<std::string_view> values(tokens.begin() + 1, tokens.end());
+        if (key == "VERSION" || key == "VIEWPOINT") {
+            continue;
+        } else if (key == "FIELDS" || key == "COLUMNS") {
+            for (auto name : values)
+                header.fields.push_back(Field{std::string(name)});
+        } else if (key == "SIZE") {
+            sizes = values;
+        } else if (key == "TYPE") {
+            types = values;
+        } else if (key == "COUNT") {
+            counts = values;
+        } else if (key == "WIDTH") {
+            width_set = values.size() == 1 && parse_number(values[0], header.width);
+        } else if (key == "HEIGHT") {
+            if (values.size() != 1 || !parse_number(values[0], header.height)) {
+                error = "Invalid HEIGHT in PCD header";
+                return false;
+            }
+        } else if (key == "POINTS") {
+            points_set = values.size() == 1 && parse_number(values[0], header.points);
+        } else if (key == "DATA") {
+            if (values.size() == 1 && values[0] == "ascii") {
+                header.data = DataFormat::ASCII;
+            } else if (values.size() == 1 && values[0] == "binary") {
+                header.data = DataFormat::BINARY;
+            } else if (values.size() == 1 && values[0] == "binary_compressed") {
+                header.data = DataFormat::BINARY_COMPRESSED;
+            } else {
+                error = "Unsupported PCD DATA format";
+                return false;
+            }
+            header.data_offset = pos;
+            data_set = true;
+        } else {
+            error = "Unexpected line in PCD header: " + std::string(key);
+            return false;
+        }
+    }
+
+    if (!data_set) {
+        error = "PCD header has no DATA line";
+        return false;
+    }
+    if (header.fields.empty()) {
+        error = "PCD header has no FIELDS";
+        return false;
+    }
+    if (sizes.size() != header.fields.size() || types.size() != header.fields.size() ||
+        (!counts.empty() && counts.size() != header.fields.size())) {
+        error = "PCD header SIZE, TYPE and COUNT do not match FIELDS";
+        return false;
+    }
+    if (!width_set && !points_set) {
+        error = "PCD header has neither WIDTH nor POINTS";
+        return false;
+    }
+    if (!points_set)
+        header.points = header.width * header.height;
+
+    for (size_t f = 0; f < header.fields.size(); ++f) {
+        Field &field = header.fields[f];
+        field.type = types[f].size() == 1 ? types[f].front() : '\0';
+        if (!parse_number(sizes[f], field.size) || !is_valid_type(field.type, field.size) ||
+            (!counts.empty() && (!parse_number(counts[f], field.count) || field.count == 0))) {
+            error = "Unsupported SIZE, TYPE or COUNT of PCD field " + field.name;
+            return false;
+        }
+        field.offset = header.point_size;
+        header.point_size += static_cast<size_t>(field.size) * field.count;
+    }
+    return true;
+}
+
+bool is_xyzi_float32(const Header &header) {
+    static const char *const names[XYZI_FLOATS] = {"x", "y", "z", "intensity"};
+    if (header.fields.size() != XYZI_FLOATS)
+        return false;
+    for (size_t f = 0; f < XYZI_FLOATS; ++f) {
+        const Field &field = header.fields[f];
+        const bool name_matches = field.name == names[f] || (f == 3 && field.name == "i");
+        if (!name_matches || field.type != 'F' || field.size != sizeof(float) || field.count != 1)
+            return false;
+    }
+    return true;
+}
+
+size_t max_points(const uint8_t *data, size_t size, const Header &header) {
+    const size_t payload = size > header.data_offset ? size - header.data_offset : 0;
+    switch (header.data) {
+    case DataFormat::ASCII:
+        // every point takes at least one character and a separator
+        return std::min(header.points, payload / 2 + 1);
+    case DataFormat::BINARY:
+        return std::min(header.points, payload / header.point_size);
+    case DataFormat::BINARY_COMPRESSED: {
+        uint32_t compressed_size = 0;
+        uint32_t uncompressed_size = 0;
+        std::string error;
+        return read_compressed_sizes(data, size, header, compressed_size, uncompressed_size, error) ? header.points : 0;
+    }
+    }
+    return 0;
+}
+
+bool read_points(const uint8_t *data, size_t size, const Header &header, float *out, size_t &points,
+                 std::string &error) {
+    points = 0;
+    if (header.data_offset > size) {
+        error = "PCD payload offset out of range";
+        return false;
+    }
+    switch (header.data) {
+    case DataFormat::ASCII:
+        return read_ascii(reinterpret_cast<const char *>(data), size, header, out, points);
+    case DataFormat::BINARY:
+        return read_binary(data, size, header, out, points);
+    case DataFormat::BINARY_COMPRESSED:
+        return read_binary_compressed(data, size, header, out, points, error);
+    }
+    return false;
+}
+
+} // namespace pcd
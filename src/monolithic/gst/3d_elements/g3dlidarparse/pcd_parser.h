@@ -0,0 +1,56 @@
+/*******************************************************************************
+ * Copyright (C) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+// Point Cloud Data (PCD) v0.7 file parsing into x, y, z, intensity float32 points, the layout g3dlidarparse outputs.
+namespace pcd {
+
+constexpr size_t XYZI_FLOATS = 4;
+constexpr size_t XYZI_POINT_SIZE = XYZI_FLOATS * sizeof(float);
+
+enum class DataFormat { ASCII, BINARY, BINARY_COMPRESSED };
+
+struct Field {
+    std::string name;
+    uint32_t size = 4;
+    char type = 'F'; // 'F' floating point, 'I' signed, 'U' unsigned integer
+    uint32_t count = 1;
+    size_t offset = 0; // byte offset within a point (binary) or of the field column per point (binary_compressed)
+};
+
+struct Header {
+    std::vector<Field> fields;
+    size_t width = 0;
+    size_t height = 1;
+    size_t points = 0;
+    DataFormat data = DataFormat::ASCII;
+    size_t data_offset = 0; // first byte after the DATA line
+    size_t point_size = 0;  // sum of size * count over fields
+};
+
+// Parses the header at the start of data. Returns false and sets error if it is malformed or unsupported.
+bool parse_header(const char *data, size_t size, Header &header, std::string &error);
+
+// True if binary points are stored exactly as x, y, z, intensity float32, so the payload can be used without conversion
+bool is_xyzi_float32(const Header &header);
+
+// Upper bound of the number of points read_points() writes for the file, not trusting POINTS alone. 0 if the
+// binary_compressed payload can't hold POINTS points, read_points() reports why.
+size_t max_points(const uint8_t *data, size_t size, const Header &header);
+
+// Converts the points of a parsed file to x, y, z, intensity float32. out must hold max_points() * XYZI_FLOATS floats.
+// Missing intensity is set to 0, other fields are skipped. points is set to the number of points written, which is less
+// than header.points if the payload is truncated. Returns false and sets error if the payload cannot be decoded.
+bool read_points(const uint8_t *data, size_t size, const Header &header, float *out, size_t &points,
+                 std::string &error);
+
+} // namespace pcd
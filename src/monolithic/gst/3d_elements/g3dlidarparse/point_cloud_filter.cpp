@@ -0,0 +1,190 @@
+/*******************************************************************************
+ * Copyright (C) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+#include "point_cloud_filter.h"
+
+#include <algorithm>
+#include <bit>
+#include <cmath>
+#include <cstring>
+#include <limits>
+
+namespace {
+
+constexpr size_t POINT_FLOATS = 4;
+constexpr uint32_t EMPTY_SLOT = std::numeric_limits<uint32_t>::max();
+
+// Ground plane search: number of candidate planes, points used to score each of them, and the minimal vertical
+// component of the plane normal, so that walls and slopes steeper than ~25 degrees are not taken for the ground
+constexpr int GROUND_ITERATIONS = 64;
+constexpr size_t GROUND_SAMPLES = 4096;
+constexpr float GROUND_MIN_NORMAL_Z = 0.9f;
+
+// Voxel coordinates are kept in int32
+constexpr float MAX_VOXEL_INDEX = 2.0e9f;
+
+uint32_t voxel_hash(int32_t ix, int32_t iy, int32_t iz) {
+    uint32_t h = static_cast<uint32_t>(ix) * 0x9E3779B1u;
+    h ^= static_cast<uint32_t>(iy) * 0x85EBCA77u;
+    h ^= static_cast<uint32_t>(iz) * 0xC2B2AE3Du;
+    h ^= h >> 15;
+    h *= 0x2C1B3C6Du;
+    h ^= h >> 12;
+    return h;
+}
+
+struct Plane {
+    float a = 0.0f, b = 0.0f, c = 0.0f, d = 0.0f; // a*x + b*y + c*z + d = 0 with unit normal
+
+    float distance(const float *p) const {
+        return std::fabs(a * p[0] + b * p[1] + c * p[2] + d);
+    }
+};
+
+bool plane_from_points(const float *p1, const float *p2, const float *p3, Plane &plane) {
+    const float u[3] = {p2[0] - p1[0], p2[1] - p1[1], p2[2] - p1[2]};
+    const float v[3] = {p3[0] - p1[0], p3[1] - p1[1], p3[2] - p1[2]};
+    float n[3] = {u[1] * v[2] - u[2] * v[1], u[2] * v[0] - u[0] * v[2], u[0] * v[1] - u[1] * v[0]};
+    const float norm = std::sqrt(n[0] * n[0] + n[1] * n[1] + n[2] * n[2]);
+    if (!(norm > 1e-6f))
+        return false;
+    plane.a = n[0] / norm;
+    plane.b = n[1] / norm;
+    plane.c = n[2] / norm;
+    plane.d = -(plane.a * p1[0] + plane.b * p1[1] + plane.c * p1[2]);
+    return std::fabs(plane.c) >= GROUND_MIN_NORMAL_Z;
+}
+
+} // namespace
+
+PointCloudFilter::PointCloudFilter(const PointCloudFilterParams &params) : _params(params) {
+}
+
+bool PointCloudFilter::enabled() const {
+    return _params.crop || _params.voxel_size > 0.0f || _params.ground_threshold > 0.0f;
+}
+
+size_t PointCloudFilter::apply(const float *in, size_t count, float *out) {
+    if (_params.crop) {
+        count = crop(in, count, out);
+    } else if (in != out) {
+        memcpy(out, in, count * POINT_FLOATS * sizeof(float));
+    }
+    if (_params.ground_threshold > 0.0f)
+        count = remove_ground(out, count);
+    if (_params.voxel_size > 0.0f)
+        count = downsample(out, count);
+    return count;
+}
+
+size_t PointCloudFilter::crop(const float *in, size_t count, float *out) const {
+    const float *roi = _params.roi;
+    size_t kept = 0;
+    for (size_t i = 0; i < count; ++i) {
+        const float *p = in + i * POINT_FLOATS;
+        // comparisons are false for NaN coordinates, so such points are dropped as well
+        const bool inside = p[0] >= roi[0] && p[0] <= roi[3] && p[1] >= roi[1] && p[1] <= roi[4] && p[2] >= roi[2] &&
+                            p[2] <= roi[5];
+        if (inside) {
+            if (out + kept * POINT_FLOATS != p)
+                memmove(out + kept * POINT_FLOATS, p, POINT_FLOATS * sizeof(float));
+            ++kept;
+        }
+    }
+    return kept;
+}
+
+// RANSAC fit of a near-horizontal plane, scored on an evenly spaced subset of points. The generator is reseeded for
+// every frame, so the same cloud is always filtered the same way.
+size_t PointCloudFilter::remove_ground(float *points, size_t count) {
+    if (count < 3)
+        return count;
+
+    const size_t step = std::max<size_t>(1, count / GROUND_SAMPLES);
+    const float threshold = _params.ground_threshold;
+    _random.seed(std::minstd_rand::default_seed);
+    std::uniform_int_distribution<size_t> pick(0, count - 1);
+
+    Plane best;
+    size_t best_inliers = 0;
+    for (int iteration = 0; iteration < GROUND_ITERATIONS; ++iteration) {
+        Plane plane;
+        if (!plane_from_points(points + pick(_random) * POINT_FLOATS, points + pick(_random) * POINT_FLOATS,
+                               points + pick(_random) * POINT_FLOATS, plane))
+            continue;
+        size_t inliers = 0;
+        for (size_t i = 0; i < count; i += step)
+            inliers += plane.distance(points + i * POINT_FLOATS) <= threshold;
+        if (inliers > best_inliers) {
+            best_inliers = inliers;
+            best = plane;
+        }
+    }
+    if (best_inliers == 0)
+        return count;
+
+    size_t kept = 0;
+    for (size_t i = 0; i < count; ++i) {
+        const float *p = points + i * POINT_FLOATS;
+        if (!(best.distance(p) <= threshold)) {
+            if (kept != i)
+                memcpy(points + kept * POINT_FLOATS, p, POINT_FLOATS * sizeof(float));
+            ++kept;
+        }
+    }
+    return kept;
+}
+
+// Replaces points of every occupied voxel by their centroid. Voxels are output in the order of their first point.
+size_t PointCloudFilter::downsample(float *points, size_t count) {
+    const float inv_size = 1.0f / _params.voxel_size;
+    const size_t capacity = std::bit_ceil(std::max<size_t>(count * 2, 16));
+    const size_t mask = capacity - 1;
+    _voxels.assign(capacity, Voxel{0, 0, 0, EMPTY_SLOT});
+    _centroids.clear();
+
+    for (size_t i = 0; i < count; ++i) {
+        const float *p = points + i * POINT_FLOATS;
+        const float fx = std::floor(p[0] * inv_size);
+        const float fy = std::floor(p[1] * inv_size);
+        const float fz = std::floor(p[2] * inv_size);
+        // also drops NaN and infinite coordinates
+        if (!(std::fabs(fx) < MAX_VOXEL_INDEX && std::fabs(fy) < MAX_VOXEL_INDEX && std::fabs(fz) < MAX_VOXEL_INDEX))
+            continue;
+        const int32_t ix = static_cast<int32_t>(fx);
+        const int32_t iy = static_cast<int32_t>(fy);
+        const int32_t iz = static_cast<int32_t>(fz);
+
+        size_t pos = voxel_hash(ix, iy, iz) & mask;
+        while (_voxels[pos].slot != EMPTY_SLOT &&
+               (_voxels[pos].ix != ix || _voxels[pos].iy != iy || _voxels[pos].iz != iz))
+            pos = (pos + 1) & mask;
+
+        Voxel &voxel = _voxels[pos];
+        if (voxel.slot == EMPTY_SLOT) {
+            voxel = Voxel{ix, iy, iz, static_cast<uint32_t>(_centroids.size())};
+            _centroids.push_back(Centroid{0.0f, 0.0f, 0.0f, 0.0f, 0});
+        }
+        Centroid &centroid = _centroids[voxel.slot];
+        centroid.x += p[0];
+        centroid.y += p[1];
+        centroid.z += p[2];
+        centroid.intensity += p[3];
+        ++centroid.points;
+    }
+
+    // every point was read above, so centroids can overwrite the input
+    for (size_t v = 0; v < _centroids.size(); ++v) {
+        const Centroid &centroid = _centroids[v];
+        const float inv_points = 1.0f / centroid.points;
+        float *out = points + v * POINT_FLOATS;
+        out[0] = centroid.x * inv_points;
+        out[1] = centroid.y * inv_points;
+        out[2] = centroid.z * inv_points;
+        out[3] = centroid.intensity * inv_points;
+    }
+    return _centroids.size();
+}
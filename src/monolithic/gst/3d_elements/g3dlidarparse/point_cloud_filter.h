@@ -0,0 +1,54 @@
+/*******************************************************************************
+ * Copyright (C) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+struct PointCloudFilterParams {
+    // Axis-aligned box points are kept in: x_min, y_min, z_min, x_max, y_max, z_max
+    bool crop = false;
+    float roi[6] = {};
+    // Edge of cubic voxels points are merged in, 0 disables downsampling
+    float voxel_size = 0.0f;
+    // Distance to the fitted ground plane points within are removed at, 0 disables ground removal
+    float ground_threshold = 0.0f;
+};
+
+// CPU pre-filter for x, y, z, intensity float32 point clouds: range cropping, ground plane removal and voxel-grid
+// downsampling, applied in this order. Working memory is kept between frames.
+class PointCloudFilter {
+  public:
+    explicit PointCloudFilter(const PointCloudFilterParams &params);
+
+    bool enabled() const;
+
+    // Filters count points from in to out and returns the number of points written. out may be equal to in for
+    // in-place filtering, otherwise it must hold count points.
+    size_t apply(const float *in, size_t count, float *out);
+
+  private:
+    size_t crop(const float *in, size_t count, float *out) const;
+    size_t remove_ground(float *points, size_t count);
+    size_t downsample(float *points, size_t count);
+
+    struct Voxel {
+        int32_t ix, iy, iz;
+        uint32_t slot;
+    };
+    struct Centroid {
+        float x, y, z, intensity;
+        uint32_t points;
+    };
+
+    PointCloudFilterParams _params;
+    std::vector<Voxel> _voxels; // open addressing hash table by voxel coordinates
+    std::vector<Centroid> _centroids;
+    std::minstd_rand _random;
+};
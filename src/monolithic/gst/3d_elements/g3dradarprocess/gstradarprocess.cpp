@@ -6,6 +6,7 @@
 
 #include "gstradarprocess.h"
 #include "g3d_radarprocess_meta.h"
+#include "radar_cube_reorder.h"
 #include "radar_config.hpp"
 #include <algorithm>
 #include <chrono>
@@ -105,7 +106,6 @@ static void gst_radar_process_finalize(GObject *object) {
     GstRadarProcess *filter = GST_RADAR_PROCESS(object);
 
     g_free(filter->radar_config);
-    filter->input_data.clear();
     filter->output_data.clear();
 
     if (filter->radar_buffer) {
@@ -256,7 +256,6 @@ static gboolean gst_radar_process_start(GstBaseTransform *trans) {
 
         // Allocate buffers
         size_t total_samples = filter->trn * filter->num_chirps * filter->adc_samples;
-        filter->input_data.resize(total_samples);
         filter->output_data.resize(total_samples);
 
         GST_INFO_OBJECT(filter, "Allocated buffers for %zu complex samples", total_samples);
@@ -431,7 +430,6 @@ static gboolean gst_radar_process_stop(GstBaseTransform *trans) {
     }
     filter->radar_buffer_size = 0;
 
-    filter->input_data.clear();
     filter->output_data.clear();
     filter->tracking_desc_buf.clear();
     filter->last_frame_time = GST_CLOCK_TIME_NONE;
@@ -448,29 +446,6 @@ static GstCaps *gst_radar_process_transform_caps(GstBaseTransform *trans, GstPad
     }
 }
 
-// DC removal function: removes mean from real and imaginary parts
-static void dc_removal(std::complex<float> *data, size_t count) {
-    if (count == 0)
-        return;
-
-    // Calculate mean of real and imaginary parts
-    float real_sum = 0.0f;
-    float imag_sum = 0.0f;
-
-    for (size_t i = 0; i < count; i++) {
-        real_sum += data[i].real();
-        imag_sum += data[i].imag();
-    }
-
-    float real_avg = real_sum / count;
-    float imag_avg = imag_sum / count;
-
-    // Subtract mean from each sample
-    for (size_t i = 0; i < count; i++) {
-        data[i] = std::complex<float>(data[i].real() - real_avg, data[i].imag() - imag_avg);
-    }
-}
-
 static GstFlowReturn gst_radar_process_transform_ip(GstBaseTransform *trans, GstBuffer *buffer) {
     GstRadarProcess *filter = GST_RADAR_PROCESS(trans);
 
@@ -509,36 +484,14 @@ static GstFlowReturn gst_radar_process_transform_ip(GstBaseTransform *trans, Gst
         return GST_FLOW_ERROR;
     }
 
-    // Copy input data (c*trn*s layout)
-    std::complex<float> *input_ptr = reinterpret_cast<std::complex<float> *>(map.data);
-    std::copy(input_ptr, input_ptr + filter->input_data.size(), filter->input_data.begin());
+    const std::complex<float> *input_ptr = reinterpret_cast<const std::complex<float> *>(map.data);
 
     GST_DEBUG_OBJECT(filter, "Processing frame #%" G_GUINT64_FORMAT ":TRN=%u, Chirps=%u, Samples=%u", filter->frame_id,
                      filter->trn, filter->num_chirps, filter->adc_samples);
 
-    // Reorder from c*trn*s to trn*c*s and apply DC removal
-    for (guint c = 0; c < filter->num_chirps; c++) {
-        for (guint t = 0; t < filter->trn; t++) {
-            // Apply DC removal on each 256-sample segment
-            std::complex<float> temp_samples[256];
-
-            // Extract samples for this chirp and channel
-            for (guint s = 0; s < filter->adc_samples; s++) {
-                // Input layout: c*trn*s
-                size_t input_idx = c * filter->trn * filter->adc_samples + t * filter->adc_samples + s;
-                temp_samples[s] = filter->input_data[input_idx];
-            }
-
-            // Apply DC removal
-            dc_removal(temp_samples, filter->adc_samples);
-
-            // Copy to output with new layout: trn*c*s
-            for (guint s = 0; s < filter->adc_samples; s++) {
-                size_t output_idx = t * filter->num_chirps * filter->adc_samples + c * filter->adc_samples + s;
-                filter->output_data[output_idx] = temp_samples[s];
-            }
-        }
-    }
+    // Reorder from c*trn*s to trn*c*s and apply DC removal, reading straight from the mapped buffer
+    radar_cube::reorder_dc_removal(input_ptr, filter->output_data.data(), filter->trn, filter->num_chirps,
+                                   filter->adc_samples);
 
     // Update RadarCube mat pointer to output_data
     // std::complex<float> and cfloat have compatible memory layout
@@ -575,7 +528,7 @@ static GstFlowReturn gst_radar_process_transform_ip(GstBaseTransform *trans, Gst
     GST_DEBUG_OBJECT(filter, "radarTracking completed, tracking %d objects", filter->tracking_result.len);
 
     // Copy processed data back to buffer
-    std::copy(filter->output_data.begin(), filter->output_data.end(), input_ptr);
+    std::memcpy(map.data, filter->output_data.data(), map.size);
     gst_buffer_unmap(buffer, &map);
 
     // Add radar processing results as metadata to the buffer
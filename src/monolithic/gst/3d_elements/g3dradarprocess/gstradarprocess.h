@@ -48,7 +48,6 @@ struct _GstRadarProcess {
     gdouble total_processing_time;
 
     // Processing buffers
-    std::vector<std::complex<float>> input_data;
     std::vector<std::complex<float>> output_data;
 
     // [libradar.so required] Radar parameters for libradar.so
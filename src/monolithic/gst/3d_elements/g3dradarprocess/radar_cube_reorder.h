@@ -0,0 +1,67 @@
+/*******************************************************************************
+ * Copyright (C) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+#pragma once
+
+#include <complex>
+#include <cstddef>
+
+namespace radar_cube {
+
+// Number of partial sums per row. A multiple of two keeps real and imaginary parts in separate lanes, and independent
+// accumulators let the compiler vectorize the reduction without reassociating floating point additions.
+constexpr size_t MEAN_LANES = 16;
+
+// Mean of the real and imaginary parts of count interleaved complex samples
+inline std::complex<float> row_mean(const float *row, size_t count) {
+    float acc[MEAN_LANES] = {};
+    const size_t floats = count * 2;
+    const size_t blocked = floats - floats % MEAN_LANES;
+    size_t i = 0;
+    for (; i < blocked; i += MEAN_LANES) {
+        for (size_t k = 0; k < MEAN_LANES; ++k)
+            acc[k] += row[i + k];
+    }
+    for (; i < floats; i += 2) {
+        acc[0] += row[i];
+        acc[1] += row[i + 1];
+    }
+
+    float real_sum = 0.0f;
+    float imag_sum = 0.0f;
+    for (size_t k = 0; k < MEAN_LANES; k += 2) {
+        real_sum += acc[k];
+        imag_sum += acc[k + 1];
+    }
+    return {real_sum / count, imag_sum / count};
+}
+
+// Reorders a radar cube from chirp*trn*sample to trn*chirp*sample layout and removes the DC component (mean of real
+// and imaginary parts) of every sample row. Sample rows are contiguous in both layouts, so each row is read once from
+// input, and its mean is subtracted while it is still in L1, writing straight to its place in output. input and output
+// must not overlap; there is no limit on the number of samples.
+inline void reorder_dc_removal(const std::complex<float> *input, std::complex<float> *output, size_t trn,
+                               size_t num_chirps, size_t adc_samples) {
+    if (adc_samples == 0)
+        return;
+
+    for (size_t t = 0; t < trn; ++t) {
+        for (size_t c = 0; c < num_chirps; ++c) {
+            const float *src = reinterpret_cast<const float *>(input + (c * trn + t) * adc_samples);
+            float *dst = reinterpret_cast<float *>(output + (t * num_chirps + c) * adc_samples);
+
+            const std::complex<float> mean = row_mean(src, adc_samples);
+            const float dc_real = mean.real();
+            const float dc_imag = mean.imag();
+            for (size_t s = 0; s < adc_samples; ++s) {
+                dst[2 * s] = src[2 * s] - dc_real;
+                dst[2 * s + 1] = src[2 * s + 1] - dc_imag;
+            }
+        }
+    }
+}
+
+} // namespace radar_cube
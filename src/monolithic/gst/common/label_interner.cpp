@@ -0,0 +1,60 @@
+/*******************************************************************************
+ * Copyright (C) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+#include "label_interner.h"
+
+#include <gst/gst.h>
+
+#include <algorithm>
+
+LabelInterner::LabelInterner(const std::vector<std::string> &labels, size_t capacity)
+    : _capacity(capacity), _recent(std::max<size_t>(capacity, 1)) {
+    _label_quarks.reserve(labels.size());
+    _labels.reserve(labels.size());
+    for (const std::string &label : labels) {
+        const GQuark quark = g_quark_from_string(label.c_str());
+        _label_quarks.push_back(quark);
+        _labels.emplace(label, quark);
+    }
+}
+
+GQuark LabelInterner::intern(const std::string &label) {
+    if (label.empty())
+        return 0;
+
+    auto it = _labels.find(label);
+    if (it != _labels.end())
+        return it->second;
+
+    std::lock_guard<std::mutex> lock(_mutex);
+    if (const GQuark *cached = _recent.find(label))
+        return *cached;
+
+    // an existing quark costs nothing to reuse, only new ones count against the capacity
+    GQuark quark = g_quark_try_string(label.c_str());
+    if (!quark) {
+        if (_created >= _capacity) {
+            if (!_full_reported) {
+                GST_WARNING("Label table is full after %zu labels, further new labels are not interned", _capacity);
+                _full_reported = true;
+            }
+            return 0;
+        }
+        quark = g_quark_from_string(label.c_str());
+        ++_created;
+    }
+    _recent.put(label, quark);
+    return quark;
+}
+
+GQuark LabelInterner::intern(const char *label) {
+    return label ? intern(std::string(label)) : 0;
+}
+
+size_t LabelInterner::created() const {
+    std::lock_guard<std::mutex> lock(_mutex);
+    return _created;
+}
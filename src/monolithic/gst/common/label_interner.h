@@ -0,0 +1,59 @@
+/*******************************************************************************
+ * Copyright (C) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+#pragma once
+
+#include "lru_cache.h"
+
+#include <glib.h>
+
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+/**
+ * Maps label strings to GQuarks for analytics metadata, which only accepts labels as quarks.
+ *
+ * GQuarks are never freed and every g_quark_from_string() call takes a process-wide lock, so data-dependent strings
+ * must not be turned into quarks without bound. Model labels are interned once at construction. Any other label is
+ * looked up in a per-instance LRU cache and only a limited number of them may create new quarks; past that limit
+ * intern() returns 0 for unseen labels and the caller is expected to carry the text as a string instead.
+ *
+ * Free-form text (VLM answers, transcripts) should not be interned at all.
+ */
+class LabelInterner {
+  public:
+    static constexpr size_t DEFAULT_CAPACITY = 1024;
+
+    explicit LabelInterner(const std::vector<std::string> &labels = {}, size_t capacity = DEFAULT_CAPACITY);
+
+    LabelInterner(const LabelInterner &) = delete;
+    LabelInterner &operator=(const LabelInterner &) = delete;
+
+    // Quarks of the labels passed at construction, in the same order
+    const std::vector<GQuark> &label_quarks() const {
+        return _label_quarks;
+    }
+
+    // Returns the quark of label, or 0 for an empty label and for a new label once capacity new quarks were created.
+    // Thread-safe.
+    GQuark intern(const std::string &label);
+    GQuark intern(const char *label);
+
+    // Number of quarks created for labels other than the model labels
+    size_t created() const;
+
+  private:
+    std::vector<GQuark> _label_quarks;
+    std::unordered_map<std::string, GQuark> _labels; // read-only after construction
+
+    const size_t _capacity;
+    mutable std::mutex _mutex;
+    LRUCache<std::string, GQuark> _recent;
+    size_t _created = 0;
+    bool _full_reported = false;
+};
@@ -6,6 +6,7 @@
 
 #include "fpscounter.h"
 
+#include <algorithm>
 #include <assert.h>
 #include <chrono>
 #include <exception>
@@ -15,7 +16,7 @@
 #include <unistd.h>
 #endif
 #include <cmath>
-#include <numeric>
+#include <utility>
 
 #include <gst/analytics/analytics.h>
 
@@ -45,11 +46,75 @@ unsigned count_rois(GstBuffer *buffer) {
 
 } // namespace
 
+////////////////////////////////////////////////////////////////////////////////
+// RunningStats
+
+void RunningStats::add(double value) {
+    ++count;
+    const double delta = value - mean;
+    mean += delta / count;
+    m2 += delta * (value - mean);
+}
+
+void RunningStats::merge(const RunningStats &other) {
+    if (other.count == 0)
+        return;
+    if (count == 0) {
+        *this = other;
+        return;
+    }
+    const double total = static_cast<double>(count + other.count);
+    const double delta = other.mean - mean;
+    mean += delta * other.count / total;
+    m2 += other.m2 + delta * delta * count * other.count / total;
+    count += other.count;
+}
+
+double RunningStats::std_dev() const {
+    if (count < 2)
+        return 0.0;
+    double std_dev = std::sqrt(m2 / (count - 1));
+    // in case of very big number at the beginning of calculation return 0.0
+    if (std_dev > 1000.0)
+        return 0.0;
+    return std_dev;
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 // IterativeFpsCounter
 
-bool IterativeFpsCounter::NewFrame(const std::string &element_name, FILE *output, GstBuffer *buffer) {
+std::shared_ptr<IterativeFpsCounter::StreamStats> IterativeFpsCounter::GetStream(const std::string &element_name,
+                                                                                  Clock::time_point now) {
+    {
+        std::shared_lock<std::shared_mutex> lock(streams_mutex);
+        auto it = streams.find(element_name);
+        if (it != streams.end())
+            return it->second;
+    }
+
     std::lock_guard<std::mutex> lock(mutex);
+    std::unique_lock<std::shared_mutex> streams_lock(streams_mutex);
+    auto it = streams.find(element_name);
+    if (it != streams.end())
+        return it->second;
+
+    if (!init_time.time_since_epoch().count()) {
+        init_time = now;
+        last_time = now;
+    }
+    // reset average counter everytime a new stream is detected
+    if (average) {
+        init_time = now;
+        last_time = now;
+        for (auto &stream : streams)
+            stream.second->frames = 0;
+    }
+    auto stream = std::make_shared<StreamStats>();
+    streams.emplace(element_name, stream);
+    return stream;
+}
+
+bool IterativeFpsCounter::NewFrame(const std::string &element_name, FILE *output, GstBuffer *buffer) {
     if (++total_frames <= starting_frame)
         return false;
     if (output == nullptr)
@@ -57,11 +122,12 @@ bool IterativeFpsCounter::NewFrame(const std::string &element_name, FILE *output
 
     detections += count_rois(buffer);
 
-    auto now = std::chrono::high_resolution_clock::now();
-    if (print_std_dev) {
-        double millis = std::chrono::duration_cast<std::chrono::microseconds>(now - last_time).count() * MICRO_TO_MILLI;
-        frame_intervals[element_name].push_back(millis);
-    }
+    auto now = Clock::now();
+    auto stream = GetStream(element_name, now);
+    stream->frames.fetch_add(1, std::memory_order_relaxed);
+
+    double latency = 0.0;
+    bool has_latency = false;
     if (print_latency) {
         GstVideoTimeCodeMeta *tc_meta = nullptr;
         if (buffer) {
@@ -73,76 +139,39 @@ bool IterativeFpsCounter::NewFrame(const std::string &element_name, FILE *output
             double frame_date_time_millis = g_date_time_get_microsecond(frame_date_time) * MICRO_TO_MILLI;
             frame_date_time_millis += g_date_time_to_unix(frame_date_time) * SECOND_TO_MILLI;
             double now_millis = std::chrono::duration_cast<std::chrono::milliseconds>(now.time_since_epoch()).count();
-            latencies[element_name].push_back(now_millis - frame_date_time_millis);
+            latency = now_millis - frame_date_time_millis;
+            has_latency = true;
+            latency_percentiles.record(latency);
         } else {
             print_latency = false;
         }
     }
-
-    if (!init_time.time_since_epoch().count()) {
-        init_time = last_time = now;
-    }
-
-    // reset average counter everytime a new stream is detected
-    if (average && (num_frames.find(element_name) == num_frames.end())) {
-        init_time = last_time = now;
-        for (auto it = num_frames.begin(); it != num_frames.end(); it++)
-            it->second = 0;
-    }
-
-    num_frames[element_name]++;
-
-    double sec = std::chrono::duration_cast<seconds_double>(now - last_time).count();
-    if (sec >= interval) {
-        last_time = now;
-        if (average) {
-            sec = std::chrono::duration_cast<seconds_double>(now - init_time).count();
-            PrintFPS(output, sec);
-        } else {
-            PrintFPS(output, sec);
-            for (auto it = num_frames.begin(); it != num_frames.end(); it++)
-                it->second = 0;
+    if (print_std_dev || has_latency) {
+        std::lock_guard<std::mutex> lock(stream->mutex);
+        if (print_std_dev) {
+            if (stream->last_frame_time.time_since_epoch().count()) {
+                auto micros = std::chrono::duration_cast<std::chrono::microseconds>(now - stream->last_frame_time);
+                stream->intervals.add(micros.count() * MICRO_TO_MILLI);
+            }
+            stream->last_frame_time = now;
         }
-        return true;
+        if (has_latency)
+            stream->latencies.add(latency);
     }
-    return false;
-}
 
-double IterativeFpsCounter::calculate_std_dev(std::vector<double> &v) {
-    // create vector for differences between adjacent elements of v
-    std::vector<double> diffs;
-    double prev_val = *(v.begin());
-    for (auto it = v.begin() + 1; it != v.end(); ++it) {
-        if (*it - prev_val < 0) {
-            // in case of concatenated input vector, during measuring total vector
-            continue;
-        }
-        diffs.push_back(*it - prev_val);
-        prev_val = *it;
-    }
-    auto sum = std::accumulate(diffs.begin(), diffs.end(), 0.0);
-    auto diffs_size = diffs.size();
-    if (diffs_size == 0)
-        return 0.0;
-    auto mean = sum / diffs_size;
-    // computes squares sum needed to calculate standard deviation
-    auto sq_sum = 0.0;
-    for (auto &el : diffs) {
-        sq_sum += (el - mean) * (el - mean);
-    }
-    double std_dev = diffs_size < 2 ? 0.0 : std::sqrt(sq_sum / (diffs_size - 1));
-    // in case of very big number at the beginning of calculation return 0.0
-    if (std_dev > 1000.0)
-        return 0.0;
-    return std_dev;
-}
+    if (std::chrono::duration_cast<seconds_double>(now - last_time.load()).count() < interval)
+        return false;
 
-double IterativeFpsCounter::calculate_latency(std::vector<double> &v) {
-    auto v_size = v.size();
-    if (v_size == 0)
-        return 0.0;
-    auto sum = std::accumulate(v.begin(), v.end(), 0.0);
-    return (sum / v_size);
+    std::lock_guard<std::mutex> lock(mutex);
+    // another stream may have printed in the meantime
+    double sec = std::chrono::duration_cast<seconds_double>(now - last_time.load()).count();
+    if (sec < interval)
+        return false;
+    last_time = now;
+    if (average)
+        sec = std::chrono::duration_cast<seconds_double>(now - init_time).count();
+    PrintFPS(output, sec);
+    return true;
 }
 
 void IterativeFpsCounter::PrintFPS(FILE *output, double sec, bool eos) {
@@ -153,12 +182,37 @@ void IterativeFpsCounter::PrintFPS(FILE *output, double sec, bool eos) {
                 sec);
         return;
     }
-    if (num_frames.empty())
+
+    // streams are printed in name order
+    std::vector<std::pair<std::string, std::shared_ptr<StreamStats>>> sorted_streams;
+    {
+        std::shared_lock<std::shared_mutex> lock(streams_mutex);
+        sorted_streams.assign(streams.begin(), streams.end());
+    }
+    if (sorted_streams.empty())
         return;
+    std::sort(sorted_streams.begin(), sorted_streams.end(),
+              [](const auto &a, const auto &b) { return a.first < b.first; });
+
+    std::vector<unsigned> num_frames;
+    std::vector<RunningStats> intervals;
+    std::vector<RunningStats> latencies;
+    RunningStats total_intervals;
+    RunningStats total_latencies;
+    for (auto &stream : sorted_streams) {
+        // the iterative counter starts over after each print, frames arriving meanwhile go to the next interval
+        num_frames.push_back(average ? stream.second->frames.load() : stream.second->frames.exchange(0));
+        std::lock_guard<std::mutex> lock(stream.second->mutex);
+        // estimators are reset for the next iteration of displaying
+        intervals.push_back(std::exchange(stream.second->intervals, RunningStats()));
+        latencies.push_back(std::exchange(stream.second->latencies, RunningStats()));
+        total_intervals.merge(intervals.back());
+        total_latencies.merge(latencies.back());
+    }
 
     double total = 0;
-    for (const auto &num : num_frames)
-        total += num.second;
+    for (unsigned num : num_frames)
+        total += num;
     total /= sec;
 
     if (average) {
@@ -182,55 +236,35 @@ void IterativeFpsCounter::PrintFPS(FILE *output, double sec, bool eos) {
             total / num_frames.size());
     if (num_frames.size() > 1 && print_each_stream) {
         fprintf(output, " (");
-        auto num = num_frames.begin();
-        fprintf(output, "%.2f", num->second / sec);
-        for (++num; num != num_frames.end(); ++num)
-            fprintf(output, ", %.2f", num->second / sec);
+        fprintf(output, "%.2f", num_frames[0] / sec);
+        for (size_t i = 1; i < num_frames.size(); ++i)
+            fprintf(output, ", %.2f", num_frames[i] / sec);
         fprintf(output, ")");
     }
     if (print_std_dev) {
-        for (auto &num_frame : num_frames) {
-            total_frame_intervals.insert(total_frame_intervals.end(), frame_intervals[num_frame.first].begin(),
-                                         frame_intervals[num_frame.first].end());
-        }
-        fprintf(output, "\nstd dev interval: %.2fms", calculate_std_dev(total_frame_intervals));
-        // clear vector for the next iteration of displaying standard deviation
-        total_frame_intervals.clear();
+        fprintf(output, "\nstd dev interval: %.2fms", total_intervals.std_dev());
         if (num_frames.size() > 1 && print_each_stream) {
             fprintf(output, " (");
-            auto num = num_frames.begin();
-            fprintf(output, "%.2f", calculate_std_dev(frame_intervals[num->first]));
-            for (++num; num != num_frames.end(); ++num) {
-                fprintf(output, ", %.2f", calculate_std_dev(frame_intervals[num->first]));
-            }
+            fprintf(output, "%.2f", intervals[0].std_dev());
+            for (size_t i = 1; i < intervals.size(); ++i)
+                fprintf(output, ", %.2f", intervals[i].std_dev());
             fprintf(output, ")");
         }
-        for (auto &num_frame : num_frames) {
-            // clear vector for the next iteration of displaying standard deviation
-            frame_intervals[num_frame.first].clear();
-        }
     }
     if (print_latency) {
-        for (auto &num_frame : num_frames) {
-            total_latencies.insert(total_latencies.end(), latencies[num_frame.first].begin(),
-                                   latencies[num_frame.first].end());
-        }
-        fprintf(output, "\nlatency: %.2fms", calculate_latency(total_latencies));
-        // clear vector for the next iteration of displaying standard deviation
-        total_latencies.clear();
+        fprintf(output, "\nlatency: %.2fms", total_latencies.mean);
         if (num_frames.size() > 1 && print_each_stream) {
             fprintf(output, " (");
-            auto num = num_frames.begin();
-            fprintf(output, "%.2f", calculate_latency(latencies[num->first]));
-            for (++num; num != num_frames.end(); ++num) {
-                fprintf(output, ", %.2f", calculate_latency(latencies[num->first]));
-            }
+            fprintf(output, "%.2f", latencies[0].mean);
+            for (size_t i = 1; i < latencies.size(); ++i)
+                fprintf(output, ", %.2f", latencies[i].mean);
             fprintf(output, ")");
         }
-        for (auto &num_frame : num_frames) {
-            // clear vector for the next iteration of displaying standard deviation
-            latencies[num_frame.first].clear();
-        }
+        latency_histogram::Snapshot current = latency_percentiles.snapshot();
+        latency_histogram::Snapshot delta = current.since(latency_base);
+        latency_base = current;
+        fprintf(output, ", p50=%.2fms, p95=%.2fms, p99=%.2fms", delta.percentile(0.5), delta.percentile(0.95),
+                delta.percentile(0.99));
     }
     fprintf(output, "\n");
     fflush(output);
@@ -240,21 +274,22 @@ void IterativeFpsCounter::EOS(const std::string &element_name, FILE *output) {
     assert(output);
     std::lock_guard<std::mutex> lock(mutex);
     if (!eos_result_reported) {
-        auto now = std::chrono::high_resolution_clock::now();
-        auto last = average ? init_time : last_time;
+        auto now = Clock::now();
+        auto last = average ? init_time : last_time.load();
         double sec = std::chrono::duration_cast<seconds_double>(now - last).count();
         PrintFPS(output, sec, true);
         eos_result_reported = true;
     }
 
     // remove stream from counter list
-    if (num_frames.find(element_name) != num_frames.end()) {
-        num_frames.erase(element_name);
+    std::unique_lock<std::shared_mutex> streams_lock(streams_mutex);
+    if (streams.erase(element_name)) {
         // reset counter if there are still active streams
-        if (num_frames.size() > 0) {
-            init_time = last_time = std::chrono::high_resolution_clock::now();
-            for (auto it = num_frames.begin(); it != num_frames.end(); it++)
-                it->second = 0;
+        if (streams.size() > 0) {
+            init_time = Clock::now();
+            last_time = init_time;
+            for (auto &stream : streams)
+                stream.second->frames = 0;
             eos_result_reported = false;
         }
     }
@@ -6,16 +6,20 @@
 
 #pragma once
 
+#include "latency_histogram.h"
 #include "named_pipe.h"
 
+#include <atomic>
 #include <chrono>
 #include <functional>
 #include <gst/video/video.h>
 #include <map>
 #include <memory>
 #include <mutex>
+#include <shared_mutex>
 #include <string>
 #include <thread>
+#include <unordered_map>
 
 class FpsCounter {
   public:
@@ -24,6 +28,17 @@ class FpsCounter {
     virtual void EOS(const std::string &element_name, FILE *output) = 0;
 };
 
+// Welford's online mean and variance, merged across streams with Chan's parallel formula
+struct RunningStats {
+    uint64_t count = 0;
+    double mean = 0.0;
+    double m2 = 0.0; // sum of squared differences from the mean
+
+    void add(double value);
+    void merge(const RunningStats &other);
+    double std_dev() const;
+};
+
 class IterativeFpsCounter : public FpsCounter {
   public:
     IterativeFpsCounter(unsigned starting_frame, unsigned interval, bool average, bool print_std_dev,
@@ -34,37 +49,45 @@ class IterativeFpsCounter : public FpsCounter {
     }
     bool NewFrame(const std::string &element_name, FILE *output, GstBuffer *buffer) override;
     void EOS(const std::string &element_name, FILE *) override;
-    double calculate_std_dev(std::vector<double> &v);
-    double calculate_latency(std::vector<double> &v);
     float get_avg_fps() {
-        std::lock_guard<std::mutex> lock(mutex);
-        return avg_fps;
+        return avg_fps.load(std::memory_order_relaxed);
     }
     unsigned get_detections() {
-        std::lock_guard<std::mutex> lock(mutex);
-        return detections;
+        return detections.load(std::memory_order_relaxed);
     }
 
   protected:
+    using Clock = std::chrono::high_resolution_clock;
+
+    // Per-stream state with constant memory. Frames are counted lock-free, the estimators are guarded by a
+    // per-stream mutex which is only contended when the counter prints.
+    struct StreamStats {
+        std::atomic<unsigned> frames{0};
+        std::mutex mutex;
+        RunningStats intervals; // frame intervals in ms since the last print
+        RunningStats latencies; // frame latencies in ms since the last print
+        Clock::time_point last_frame_time;
+    };
+
     unsigned starting_frame;
     unsigned interval;
     bool average;
     bool print_each_stream;
-    unsigned total_frames;
-    unsigned detections;
-    float avg_fps;
-    std::chrono::time_point<std::chrono::high_resolution_clock> init_time;
-    std::chrono::time_point<std::chrono::high_resolution_clock> last_time;
-    std::map<std::string, int> num_frames;
-    std::map<std::string, std::vector<double>> frame_intervals;
-    std::map<std::string, std::vector<double>> latencies;
-    std::vector<double> total_frame_intervals;
-    std::vector<double> total_latencies;
-    std::mutex mutex;
+    std::atomic<unsigned> total_frames;
+    std::atomic<unsigned> detections;
+    std::atomic<float> avg_fps;
+    Clock::time_point init_time;
+    std::atomic<Clock::time_point> last_time{Clock::time_point()};
+    std::unordered_map<std::string, std::shared_ptr<StreamStats>> streams;
+    std::shared_mutex streams_mutex;          // guards the streams map, taken after mutex
+    LatencyHistogram latency_percentiles;     // latencies of all streams, for percentiles
+    latency_histogram::Snapshot latency_base; // histogram state at the last print
+    std::mutex mutex;                         // serializes printing, stream registration and EOS
     bool eos_result_reported;
     bool print_std_dev;
-    bool print_latency;
+    std::atomic<bool> print_latency;
 
+    std::shared_ptr<StreamStats> GetStream(const std::string &element_name, Clock::time_point now);
     void PrintFPS(FILE *output, double sec, bool eos = false);
 };
 
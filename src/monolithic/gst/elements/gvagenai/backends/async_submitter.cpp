@@ -0,0 +1,119 @@
+/*******************************************************************************
+ * Copyright (C) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+#include "async_submitter.hpp"
+
+#include <algorithm>
+#include <exception>
+#include <stdexcept>
+
+GST_DEBUG_CATEGORY_EXTERN(gst_gvagenai_debug);
+#define GST_CAT_DEFAULT gst_gvagenai_debug
+
+namespace genai {
+
+AsyncSubmitter::AsyncSubmitter(IGenAIBackend::Ptr backend, size_t max_pending, OverflowPolicy policy)
+    : backend_(std::move(backend)), max_pending_(std::max<size_t>(max_pending, 1)), policy_(policy) {
+    if (!backend_) {
+        throw std::invalid_argument("AsyncSubmitter requires a backend");
+    }
+    worker_ = std::thread(&AsyncSubmitter::worker_loop, this);
+}
+
+AsyncSubmitter::~AsyncSubmitter() {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stop_ = true;
+        pending_.clear();
+    }
+    job_ready_.notify_all();
+    worker_.join();
+}
+
+bool AsyncSubmitter::submit(GenRequest req, GstClockTime pts_start, GstClockTime pts_end) {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (pending_.size() >= max_pending_) {
+            ++dropped_;
+            if (policy_ == OverflowPolicy::SkipIfBusy) {
+                GST_DEBUG("Backend busy, skipping request for PTS %" GST_TIME_FORMAT, GST_TIME_ARGS(pts_start));
+                return false;
+            }
+            GST_DEBUG("Backend busy, dropping oldest request for PTS %" GST_TIME_FORMAT,
+                      GST_TIME_ARGS(pending_.front().pts_start));
+            pending_.pop_front();
+        }
+        pending_.push_back(Job{std::move(req), pts_start, pts_end});
+    }
+    job_ready_.notify_one();
+    return true;
+}
+
+std::vector<AsyncCompletion> AsyncSubmitter::take_completed() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    std::vector<AsyncCompletion> completed;
+    completed.swap(completed_);
+    return completed;
+}
+
+void AsyncSubmitter::drain() {
+    std::unique_lock<std::mutex> lock(mutex_);
+    idle_.wait(lock, [this] { return stop_ || (pending_.empty() && !running_job_); });
+}
+
+void AsyncSubmitter::discard() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    pending_.clear();
+    completed_.clear();
+    ++generation_;
+    if (!running_job_)
+        idle_.notify_all();
+}
+
+size_t AsyncSubmitter::dropped() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return dropped_;
+}
+
+void AsyncSubmitter::worker_loop() {
+    std::unique_lock<std::mutex> lock(mutex_);
+    while (true) {
+        job_ready_.wait(lock, [this] { return stop_ || !pending_.empty(); });
+        if (stop_)
+            break;
+
+        Job job = std::move(pending_.front());
+        pending_.pop_front();
+        running_job_ = true;
+        const uint64_t generation = generation_;
+        lock.unlock();
+
+        AsyncCompletion completion;
+        completion.pts_start = job.pts_start;
+        completion.pts_end = job.pts_end;
+        try {
+            completion.result = backend_->submit(std::move(job.request)).get();
+            completion.ok = true;
+        } catch (const std::exception &e) {
+            completion.error = e.what();
+        } catch (...) {
+            completion.error = "unknown error";
+        }
+
+        lock.lock();
+        if (generation == generation_)
+            completed_.push_back(std::move(completion));
+        else
+            GST_DEBUG("Discarding result of request for PTS %" GST_TIME_FORMAT, GST_TIME_ARGS(job.pts_start));
+        running_job_ = false;
+        if (pending_.empty())
+            idle_.notify_all();
+    }
+    running_job_ = false;
+    idle_.notify_all();
+}
+
+} // namespace genai
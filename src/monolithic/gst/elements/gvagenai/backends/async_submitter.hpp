@@ -0,0 +1,112 @@
+/*******************************************************************************
+ * Copyright (C) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+#pragma once
+
+#include "genai_backend.hpp"
+
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace genai {
+
+/**
+ * @brief What AsyncSubmitter does with a new request when max_pending requests already wait for the worker
+ */
+enum class OverflowPolicy {
+    DropOldest, // discard the oldest waiting request, so results follow the most recent frames
+    SkipIfBusy  // discard the new request
+};
+
+/**
+ * @brief Outcome of a request run by AsyncSubmitter, tagged with the PTS range of the frames it was built from
+ */
+struct AsyncCompletion {
+    GstClockTime pts_start = GST_CLOCK_TIME_NONE; // PTS of the first frame of the request
+    GstClockTime pts_end = GST_CLOCK_TIME_NONE;   // PTS of the last frame of the request
+    bool ok = false;
+    GenAIResult result; // valid if ok
+    std::string error;  // set if not ok
+};
+
+/**
+ * @brief Runs backend requests on a worker thread, so the streaming thread is not blocked by generation
+ *
+ * Requests run one at a time in submission order. At most max_pending requests wait behind the running one; the
+ * overflow policy decides which request is discarded beyond that. Completions are collected by the caller with
+ * take_completed(), typically once per outgoing buffer.
+ */
+class AsyncSubmitter {
+  public:
+    AsyncSubmitter(IGenAIBackend::Ptr backend, size_t max_pending, OverflowPolicy policy);
+
+    /**
+     * @brief Stops the worker. Waiting requests are discarded, the running one is waited for.
+     */
+    ~AsyncSubmitter();
+
+    AsyncSubmitter(const AsyncSubmitter &) = delete;
+    AsyncSubmitter &operator=(const AsyncSubmitter &) = delete;
+
+    /**
+     * @brief Queue a request without blocking
+     * @return false if the request was discarded by SkipIfBusy policy
+     */
+    bool submit(GenRequest req, GstClockTime pts_start, GstClockTime pts_end);
+
+    /**
+     * @brief Move out completions collected since the previous call, in completion order
+     */
+    std::vector<AsyncCompletion> take_completed();
+
+    /**
+     * @brief Block until no request is waiting or running
+     */
+    void drain();
+
+    /**
+     * @brief Discard waiting requests and completions not yet taken, without waiting for the running request. The
+     * result of the running request is discarded as well when it completes.
+     */
+    void discard();
+
+    /**
+     * @brief Number of requests discarded by the overflow policy
+     */
+    size_t dropped() const;
+
+  private:
+    struct Job {
+        GenRequest request;
+        GstClockTime pts_start;
+        GstClockTime pts_end;
+    };
+
+    void worker_loop();
+
+    IGenAIBackend::Ptr backend_;
+    const size_t max_pending_;
+    const OverflowPolicy policy_;
+
+    mutable std::mutex mutex_;
+    std::condition_variable job_ready_;
+    std::condition_variable idle_;
+    std::deque<Job> pending_;
+    std::vector<AsyncCompletion> completed_;
+    bool running_job_ = false;
+    bool stop_ = false;
+    size_t dropped_ = 0;
+    uint64_t generation_ = 0; // bumped by discard(), completions of older generations are dropped
+
+    std::thread worker_; // started last, after the state it uses
+};
+
+} // namespace genai
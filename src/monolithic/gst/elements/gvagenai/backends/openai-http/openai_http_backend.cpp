@@ -176,10 +176,33 @@ OpenAIHttpBackend::OpenAIHttpBackend(const HttpBackendParams &params)
 
     generation_config_ = params.generation_config;
 
+    curl_ = curl_easy_init();
+    if (!curl_) {
+        throw std::runtime_error("Failed to initialize libcurl handle");
+    }
+    headers_ = curl_slist_append(headers_, "Content-Type: application/json");
+    if (!api_key_.empty()) {
+        const std::string auth_header = "Authorization: Bearer " + api_key_;
+        headers_ = curl_slist_append(headers_, auth_header.c_str());
+    }
+
+    // Options which are the same for every request; the handle keeps its connection cache between requests
+    curl_easy_setopt(curl_, CURLOPT_URL, chat_completions_url_.c_str());
+    curl_easy_setopt(curl_, CURLOPT_POST, 1L);
+    curl_easy_setopt(curl_, CURLOPT_HTTPHEADER, headers_);
+    curl_easy_setopt(curl_, CURLOPT_WRITEFUNCTION, curl_write_callback);
+    curl_easy_setopt(curl_, CURLOPT_TIMEOUT_MS, timeout_ms_);
+    curl_easy_setopt(curl_, CURLOPT_TCP_KEEPALIVE, 1L);
+    curl_easy_setopt(curl_, CURLOPT_NOSIGNAL, 1L); // requests may run on a worker thread
+
     GST_INFO("Initialized OpenAI-HTTP backend: url=%s, model=%s", chat_completions_url_.c_str(), model_name_.c_str());
 }
 
-OpenAIHttpBackend::~OpenAIHttpBackend() = default;
+OpenAIHttpBackend::~OpenAIHttpBackend() {
+    if (curl_)
+        curl_easy_cleanup(curl_);
+    curl_slist_free_all(headers_);
+}
 
 void OpenAIHttpBackend::set_generation_config(const std::string &cfg) {
     generation_config_ = cfg;
@@ -220,36 +243,23 @@ std::future<GenAIResult> OpenAIHttpBackend::submit(GenRequest req) {
         }
         const std::string request_body = body.dump();
 
-        // Perform the HTTP POST via libcurl.
-        CURL *curl = curl_easy_init();
-        if (!curl) {
-            throw std::runtime_error("Failed to initialize libcurl handle");
-        }
-
-        struct curl_slist *headers = nullptr;
-        headers = curl_slist_append(headers, "Content-Type: application/json");
-        std::string auth_header;
-        if (!api_key_.empty()) {
-            auth_header = "Authorization: Bearer " + api_key_;
-            headers = curl_slist_append(headers, auth_header.c_str());
-        }
-
+        // Perform the HTTP POST on the persistent handle, reusing its connection when the server keeps it alive.
         std::string response_body;
-        curl_easy_setopt(curl, CURLOPT_URL, chat_completions_url_.c_str());
-        curl_easy_setopt(curl, CURLOPT_POST, 1L);
-        curl_easy_setopt(curl, CURLOPT_POSTFIELDS, request_body.c_str());
-        curl_easy_setopt(curl, CURLOPT_POSTFIELDSIZE, static_cast<long>(request_body.size()));
-        curl_easy_setopt(curl, CURLOPT_HTTPHEADER, headers);
-        curl_easy_setopt(curl, CURLOPT_WRITEFUNCTION, curl_write_callback);
-        curl_easy_setopt(curl, CURLOPT_WRITEDATA, &response_body);
-        curl_easy_setopt(curl, CURLOPT_TIMEOUT_MS, timeout_ms_);
-
-        CURLcode res = curl_easy_perform(curl);
+        CURLcode res;
         long http_status = 0;
-        curl_easy_getinfo(curl, CURLINFO_RESPONSE_CODE, &http_status);
-
-        curl_slist_free_all(headers);
-        curl_easy_cleanup(curl);
+        {
+            std::lock_guard<std::mutex> lock(curl_mutex_);
+            curl_easy_setopt(curl_, CURLOPT_POSTFIELDS, request_body.c_str());
+            curl_easy_setopt(curl_, CURLOPT_POSTFIELDSIZE, static_cast<long>(request_body.size()));
+            curl_easy_setopt(curl_, CURLOPT_WRITEDATA, &response_body);
+
+            res = curl_easy_perform(curl_);
+            curl_easy_getinfo(curl_, CURLINFO_RESPONSE_CODE, &http_status);
+
+            // do not leave pointers to this call's locals in the handle
+            curl_easy_setopt(curl_, CURLOPT_POSTFIELDS, nullptr);
+            curl_easy_setopt(curl_, CURLOPT_WRITEDATA, nullptr);
+        }
 
         if (res != CURLE_OK) {
             throw std::runtime_error(std::string("HTTP request failed: ") + curl_easy_strerror(res));
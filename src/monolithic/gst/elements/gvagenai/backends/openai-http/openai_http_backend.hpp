@@ -9,8 +9,11 @@
 #include "../genai_backend.hpp"
 
 #include <future>
+#include <mutex>
 #include <string>
 
+struct curl_slist;
+
 namespace genai {
 
 /**
@@ -23,6 +26,8 @@ namespace genai {
  * request.
  *
  * Per-element instance (see GenAIBackendRegistry: never shared/cached).
+ * One libcurl easy handle is kept for the lifetime of the backend, so the
+ * connection to the server (and TLS session) is reused between requests.
  * "Video" presentation (as_video=true) is not supported by the Chat
  * Completions API; frames are always sent as independent images.
  */
@@ -70,6 +75,11 @@ class OpenAIHttpBackend : public IGenAIBackend {
     bool include_metrics_;
 
     std::string generation_config_; // raw KEY=VALUE,KEY=VALUE string
+
+    // Persistent libcurl easy handle (CURL *) and request headers; requests on it are serialized
+    std::mutex curl_mutex_;
+    void *curl_ = nullptr;
+    struct curl_slist *headers_ = nullptr;
 };
 
 } // namespace genai
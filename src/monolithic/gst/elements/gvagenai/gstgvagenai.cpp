@@ -13,11 +13,14 @@
 
 #include "gva_caps.h"
 #include "gva_json_meta.h"
-#include <gst/analytics/gstanalyticsclassificationmtd.h>
+#include "gva_tensor_meta.h"
 
+#include "backends/async_submitter.hpp"
 #include "backends/frame_utils.hpp"
 #include "backends/genai_backend.hpp"
 
+#include <nlohmann/json.hpp>
+
 #include <vector>
 
 GST_DEBUG_CATEGORY(gst_gvagenai_debug);
@@ -41,7 +44,10 @@ enum {
     PROP_HTTP_SERVER_URL,
     PROP_HTTP_API_KEY,
     PROP_HTTP_TIMEOUT,
-    PROP_VISION_MODE
+    PROP_VISION_MODE,
+    PROP_ASYNC,
+    PROP_MAX_PENDING,
+    PROP_OVERFLOW_POLICY
 };
 
 // How accumulated frames are presented to the VLM. Determines the native vision tag the
@@ -65,6 +71,32 @@ static GType gst_gvagenai_vision_mode_get_type(void) {
     return vision_mode_type;
 }
 
+// What async mode does with a new chunk when max-pending chunks already wait for the backend
+enum GstGvaGenAIOverflowPolicy {
+    GVAGENAI_OVERFLOW_POLICY_SKIP_IF_BUSY = 0, // discard the new chunk
+    GVAGENAI_OVERFLOW_POLICY_DROP_OLDEST = 1   // discard the oldest waiting chunk
+};
+
+#define GST_TYPE_GVAGENAI_OVERFLOW_POLICY (gst_gvagenai_overflow_policy_get_type())
+static GType gst_gvagenai_overflow_policy_get_type(void) {
+    static GType overflow_policy_type = 0;
+    if (g_once_init_enter(&overflow_policy_type)) {
+        static const GEnumValue policies[] = {
+            {GVAGENAI_OVERFLOW_POLICY_SKIP_IF_BUSY, "Discard the new chunk", "skip-if-busy"},
+            {GVAGENAI_OVERFLOW_POLICY_DROP_OLDEST, "Discard the oldest waiting chunk", "drop-oldest"},
+            {0, NULL, NULL}};
+        GType type = g_enum_register_static("GstGvaGenAIOverflowPolicy", policies);
+        g_once_init_leave(&overflow_policy_type, type);
+    }
+    return overflow_policy_type;
+}
+
+// Name of the frame-level tensor carrying the latest result text
+#define GVAGENAI_RESULT_TENSOR_NAME "genai_result"
+
+// Name of the element message carrying an async result which completed after the last buffer
+#define GVAGENAI_RESULT_MESSAGE_NAME "gvagenai-result"
+
 // Pad templates
 #define GVAGENAI_SYSTEM_MEM_CAPS GST_VIDEO_CAPS_MAKE("{ RGB, RGBA, RGBx, BGR, BGRA, BGRx, NV12, I420 }") "; "
 #ifdef _WIN32
@@ -91,6 +123,11 @@ struct GvaGenAIRuntime {
     BackendPtr backend;
     std::shared_ptr<dlstreamer::MemoryMapperGSTToCPU> mapper;
     std::vector<ov::Tensor> frames;
+    GstClockTime chunk_start_pts = GST_CLOCK_TIME_NONE; // PTS of the first accumulated frame
+
+    // Async mode only: runs requests off the streaming thread. Declared last, so it is destroyed (and its worker
+    // joined) before the rest of the runtime.
+    std::unique_ptr<genai::AsyncSubmitter> async;
 };
 
 // GObject vmethod implementations
@@ -101,6 +138,7 @@ static void gst_gvagenai_finalize(GObject *object);
 // GstBaseTransform vmethod implementations
 static gboolean gst_gvagenai_start(GstBaseTransform *base);
 static gboolean gst_gvagenai_stop(GstBaseTransform *base);
+static gboolean gst_gvagenai_sink_event(GstBaseTransform *base, GstEvent *event);
 static GstFlowReturn gst_gvagenai_transform_ip(GstBaseTransform *base, GstBuffer *buf);
 static gboolean gst_gvagenai_set_caps(GstBaseTransform *base, GstCaps *incaps, GstCaps *outcaps);
 
@@ -127,6 +165,7 @@ static void gst_gvagenai_class_init(GstGvaGenAIClass *klass) {
 
     base_transform_class->start = GST_DEBUG_FUNCPTR(gst_gvagenai_start);
     base_transform_class->stop = GST_DEBUG_FUNCPTR(gst_gvagenai_stop);
+    base_transform_class->sink_event = GST_DEBUG_FUNCPTR(gst_gvagenai_sink_event);
     base_transform_class->transform_ip = GST_DEBUG_FUNCPTR(gst_gvagenai_transform_ip);
     base_transform_class->set_caps = GST_DEBUG_FUNCPTR(gst_gvagenai_set_caps);
 
@@ -210,6 +249,25 @@ static void gst_gvagenai_class_init(GstGvaGenAIClass *klass) {
                                                         "Optional request timeout in milliseconds", NULL,
                                                         G_PARAM_READWRITE));
 
+    g_object_class_install_property(
+        gobject_class, PROP_ASYNC,
+        g_param_spec_boolean("async", "Async",
+                             "Run inference on a worker thread so frames keep flowing during generation. Results are "
+                             "attached to the next outgoing buffer together with the PTS range of their chunk.",
+                             FALSE, G_PARAM_READWRITE));
+
+    g_object_class_install_property(gobject_class, PROP_MAX_PENDING,
+                                    g_param_spec_uint("max-pending", "Max Pending",
+                                                      "Async mode: number of chunks that may wait for the backend "
+                                                      "while another one is being processed",
+                                                      1, G_MAXUINT, 1, G_PARAM_READWRITE));
+
+    g_object_class_install_property(
+        gobject_class, PROP_OVERFLOW_POLICY,
+        g_param_spec_enum("overflow-policy", "Overflow Policy",
+                          "Async mode: which chunk to discard when max-pending chunks already wait for the backend",
+                          GST_TYPE_GVAGENAI_OVERFLOW_POLICY, GVAGENAI_OVERFLOW_POLICY_SKIP_IF_BUSY, G_PARAM_READWRITE));
+
     g_object_class_install_property(
         gobject_class, PROP_VISION_MODE,
         g_param_spec_enum("vision-mode", "Vision Mode",
@@ -244,6 +302,10 @@ static void gst_gvagenai_init(GstGvaGenAI *gvagenai) {
     gvagenai->prompt_string = NULL;
     gvagenai->prompt_changed = FALSE;
 
+    gvagenai->async = FALSE;
+    gvagenai->max_pending = 1;
+    gvagenai->overflow_policy = GVAGENAI_OVERFLOW_POLICY_SKIP_IF_BUSY;
+
     gvagenai->backend = NULL;
     gvagenai->last_result = NULL;
     gvagenai->last_confidence = -1.0f;
@@ -369,6 +431,15 @@ static void gst_gvagenai_set_property(GObject *object, guint prop_id, const GVal
     case PROP_VISION_MODE:
         gvagenai->config.vision_mode = g_value_get_enum(value);
         break;
+    case PROP_ASYNC:
+        gvagenai->async = g_value_get_boolean(value);
+        break;
+    case PROP_MAX_PENDING:
+        gvagenai->max_pending = g_value_get_uint(value);
+        break;
+    case PROP_OVERFLOW_POLICY:
+        gvagenai->overflow_policy = g_value_get_enum(value);
+        break;
     default:
         G_OBJECT_WARN_INVALID_PROPERTY_ID(object, prop_id, pspec);
         break;
@@ -427,6 +498,15 @@ static void gst_gvagenai_get_property(GObject *object, guint prop_id, GValue *va
     case PROP_VISION_MODE:
         g_value_set_enum(value, gvagenai->config.vision_mode);
         break;
+    case PROP_ASYNC:
+        g_value_set_boolean(value, gvagenai->async);
+        break;
+    case PROP_MAX_PENDING:
+        g_value_set_uint(value, gvagenai->max_pending);
+        break;
+    case PROP_OVERFLOW_POLICY:
+        g_value_set_enum(value, gvagenai->overflow_policy);
+        break;
     default:
         G_OBJECT_WARN_INVALID_PROPERTY_ID(object, prop_id, pspec);
         break;
@@ -496,10 +576,17 @@ static gboolean gst_gvagenai_start(GstBaseTransform *base) {
     // Create backend through the process-wide registry using the element config
     try {
         BackendPtr backend = genai::GenAIBackendRegistry::instance().create_backend(gvagenai->config);
-        auto *runtime = new GvaGenAIRuntime();
+        auto runtime = std::make_unique<GvaGenAIRuntime>();
         runtime->backend = std::move(backend);
         runtime->mapper = std::make_shared<dlstreamer::MemoryMapperGSTToCPU>(nullptr, nullptr);
-        gvagenai->backend = runtime;
+        if (gvagenai->async) {
+            const auto policy = gvagenai->overflow_policy == GVAGENAI_OVERFLOW_POLICY_DROP_OLDEST
+                                    ? genai::OverflowPolicy::DropOldest
+                                    : genai::OverflowPolicy::SkipIfBusy;
+            runtime->async = std::make_unique<genai::AsyncSubmitter>(runtime->backend, gvagenai->max_pending, policy);
+            GST_INFO_OBJECT(gvagenai, "Async inference enabled: max-pending=%u", gvagenai->max_pending);
+        }
+        gvagenai->backend = runtime.release();
     } catch (const std::exception &e) {
         GST_ELEMENT_ERROR(gvagenai, LIBRARY, INIT, ("Failed to initialize GenAI backend"), ("%s", e.what()));
         return FALSE;
@@ -508,11 +595,19 @@ static gboolean gst_gvagenai_start(GstBaseTransform *base) {
     return TRUE;
 }
 
+static void post_async_results(GstGvaGenAI *gvagenai, GvaGenAIRuntime *runtime);
+
 static gboolean gst_gvagenai_stop(GstBaseTransform *base) {
     GstGvaGenAI *gvagenai = GST_GVAGENAI(base);
 
     if (gvagenai->backend) {
         auto *runtime = static_cast<GvaGenAIRuntime *>(gvagenai->backend);
+        if (runtime->async)
+            post_async_results(gvagenai, runtime);
+        if (runtime->async && runtime->async->dropped() > 0) {
+            GST_INFO_OBJECT(gvagenai, "Async inference discarded %zu chunk(s) while the backend was busy",
+                            runtime->async->dropped());
+        }
         delete runtime;
         gvagenai->backend = NULL;
     }
@@ -524,6 +619,108 @@ static gboolean gst_gvagenai_stop(GstBaseTransform *base) {
     return TRUE;
 }
 
+static void attach_json_meta(GstGvaGenAI *gvagenai, GstBuffer *buf, const std::string &message) {
+    const GstMetaInfo *meta_info = gst_gva_json_meta_get_info();
+    if (meta_info && gst_buffer_is_writable(buf)) {
+        auto *json_meta = (GstGVAJSONMeta *)gst_buffer_add_meta(buf, meta_info, NULL);
+        if (!json_meta) {
+            GST_ELEMENT_WARNING(gvagenai, STREAM, FAILED, ("Failed to add JSON meta"),
+                                ("Could not add GstGVAJSONMeta to buffer"));
+        } else {
+            json_meta->message = g_strdup(message.c_str());
+            GST_INFO_OBJECT(gvagenai, "Added meta message: %s", json_meta->message);
+        }
+    }
+}
+
+// Adds the PTS range of the frames an async result was generated from to the backend's JSON
+static std::string add_pts_range(const std::string &raw_json, GstClockTime pts_start, GstClockTime pts_end) {
+    nlohmann::ordered_json json_obj = nlohmann::ordered_json::parse(raw_json, nullptr, false);
+    if (json_obj.is_discarded() || !json_obj.is_object())
+        return raw_json;
+    if (GST_CLOCK_TIME_IS_VALID(pts_start))
+        json_obj["pts_start"] = pts_start;
+    if (GST_CLOCK_TIME_IS_VALID(pts_end))
+        json_obj["pts_end"] = pts_end;
+    return json_obj.dump();
+}
+
+// Async mode: attach results completed since the previous buffer to this one
+static void attach_async_results(GstGvaGenAI *gvagenai, GvaGenAIRuntime *runtime, GstBuffer *buf) {
+    for (auto &completion : runtime->async->take_completed()) {
+        g_free(gvagenai->last_result);
+        gvagenai->last_result = NULL;
+        gvagenai->last_confidence = -1.0f;
+
+        if (!completion.ok) {
+            GST_ELEMENT_WARNING(gvagenai, STREAM, FAILED, ("Failed to run backend inference"),
+                                ("Error: %s", completion.error.c_str()));
+            continue;
+        }
+
+        gvagenai->last_result = g_strdup(completion.result.text.c_str());
+        gvagenai->last_confidence = completion.result.confidence;
+        GST_DEBUG_OBJECT(gvagenai,
+                         "Attaching result of chunk %" GST_TIME_FORMAT " - %" GST_TIME_FORMAT
+                         " to buffer %" GST_TIME_FORMAT,
+                         GST_TIME_ARGS(completion.pts_start), GST_TIME_ARGS(completion.pts_end),
+                         GST_TIME_ARGS(GST_BUFFER_PTS(buf)));
+        attach_json_meta(gvagenai, buf,
+                         add_pts_range(completion.result.raw_json, completion.pts_start, completion.pts_end));
+    }
+}
+
+// Async mode: wait for chunks still waiting or running and post their results as element messages, as no buffer is
+// left to attach them to
+static void post_async_results(GstGvaGenAI *gvagenai, GvaGenAIRuntime *runtime) {
+    runtime->async->drain();
+    for (auto &completion : runtime->async->take_completed()) {
+        g_free(gvagenai->last_result);
+        gvagenai->last_result = NULL;
+        gvagenai->last_confidence = -1.0f;
+
+        if (!completion.ok) {
+            GST_ELEMENT_WARNING(gvagenai, STREAM, FAILED, ("Failed to run backend inference"),
+                                ("Error: %s", completion.error.c_str()));
+            continue;
+        }
+
+        gvagenai->last_result = g_strdup(completion.result.text.c_str());
+        gvagenai->last_confidence = completion.result.confidence;
+        GST_DEBUG_OBJECT(gvagenai, "Posting result of chunk %" GST_TIME_FORMAT " - %" GST_TIME_FORMAT,
+                         GST_TIME_ARGS(completion.pts_start), GST_TIME_ARGS(completion.pts_end));
+        const std::string message =
+            add_pts_range(completion.result.raw_json, completion.pts_start, completion.pts_end);
+        GstStructure *structure =
+            gst_structure_new(GVAGENAI_RESULT_MESSAGE_NAME, "message", G_TYPE_STRING, message.c_str(), "pts-start",
+                              G_TYPE_UINT64, completion.pts_start, "pts-end", G_TYPE_UINT64, completion.pts_end, NULL);
+        gst_element_post_message(GST_ELEMENT(gvagenai), gst_message_new_element(GST_OBJECT(gvagenai), structure));
+    }
+}
+
+static gboolean gst_gvagenai_sink_event(GstBaseTransform *base, GstEvent *event) {
+    GstGvaGenAI *gvagenai = GST_GVAGENAI(base);
+    auto *runtime = static_cast<GvaGenAIRuntime *>(gvagenai->backend);
+
+    switch (GST_EVENT_TYPE(event)) {
+    case GST_EVENT_EOS:
+        // results of chunks still in flight are delivered before EOS goes downstream
+        if (runtime && runtime->async)
+            post_async_results(gvagenai, runtime);
+        break;
+    case GST_EVENT_FLUSH_START:
+        // not serialized: drop chunks in flight without waiting for the backend, the streaming thread owns
+        // last_result
+        if (runtime && runtime->async)
+            runtime->async->discard();
+        break;
+    default:
+        break;
+    }
+
+    return GST_BASE_TRANSFORM_CLASS(gst_gvagenai_parent_class)->sink_event(base, event);
+}
+
 static GstFlowReturn gst_gvagenai_transform_ip(GstBaseTransform *base, GstBuffer *buf) {
     GstGvaGenAI *gvagenai = GST_GVAGENAI(base);
 
@@ -575,6 +772,8 @@ static GstFlowReturn gst_gvagenai_transform_ip(GstBaseTransform *base, GstBuffer
     if (!skip_frame) {
         // Accumulate frame as an RGB tensor (converted once, centrally, for all backends)
         try {
+            if (runtime->frames.empty())
+                runtime->chunk_start_pts = GST_BUFFER_PTS(buf);
             runtime->frames.push_back(genai::gst_buffer_to_rgb_tensor(*runtime->mapper, buf, &info));
         } catch (const std::exception &e) {
             GST_ELEMENT_ERROR(gvagenai, STREAM, FAILED, ("Failed to add frame to backend"), ("Error: %s", e.what()));
@@ -606,55 +805,54 @@ static GstFlowReturn gst_gvagenai_transform_ip(GstBaseTransform *base, GstBuffer
             req.timestamp = GST_BUFFER_TIMESTAMP(buf);
             runtime->frames.clear(); // a moved-from vector is not guaranteed empty
 
-            genai::GenAIResult result;
-            try {
-                result = backend->submit(std::move(req)).get();
-            } catch (const std::exception &e) {
-                GST_ELEMENT_WARNING(gvagenai, STREAM, FAILED, ("Failed to run backend inference"),
-                                    ("Error: %s", e.what()));
+            if (runtime->async) {
+                // Frames keep flowing, the result is attached to a later buffer
+                if (!runtime->async->submit(std::move(req), runtime->chunk_start_pts, GST_BUFFER_PTS(buf))) {
+                    GST_DEBUG_OBJECT(gvagenai, "Backend busy, skipped chunk ending at %" GST_TIME_FORMAT,
+                                     GST_TIME_ARGS(GST_BUFFER_PTS(buf)));
+                }
+            } else {
+                genai::GenAIResult result;
+                try {
+                    result = backend->submit(std::move(req)).get();
+                } catch (const std::exception &e) {
+                    GST_ELEMENT_WARNING(gvagenai, STREAM, FAILED, ("Failed to run backend inference"),
+                                        ("Error: %s", e.what()));
+                    g_free(gvagenai->last_result);
+                    gvagenai->last_result = NULL;
+                    gvagenai->last_confidence = -1.0f;
+                    return GST_FLOW_OK;
+                }
+
+                // Persist last result/confidence for watermark rendering on subsequent frames
                 g_free(gvagenai->last_result);
-                gvagenai->last_result = NULL;
-                gvagenai->last_confidence = -1.0f;
-                return GST_FLOW_OK;
-            }
+                gvagenai->last_result = g_strdup(result.text.c_str());
+                gvagenai->last_confidence = result.confidence;
 
-            // Persist last result/confidence for watermark rendering on subsequent frames
-            g_free(gvagenai->last_result);
-            gvagenai->last_result = g_strdup(result.text.c_str());
-            gvagenai->last_confidence = result.confidence;
-
-            const GstMetaInfo *meta_info = gst_gva_json_meta_get_info();
-            if (meta_info && gst_buffer_is_writable(buf)) {
-                auto *json_meta = (GstGVAJSONMeta *)gst_buffer_add_meta(buf, meta_info, NULL);
-                if (!json_meta) {
-                    GST_ELEMENT_WARNING(gvagenai, STREAM, FAILED, ("Failed to add JSON meta"),
-                                        ("Could not add GstGVAJSONMeta to buffer"));
-                } else {
-                    json_meta->message = g_strdup(result.raw_json.c_str());
-                    GST_INFO_OBJECT(gvagenai, "Added meta message: %s", json_meta->message);
-                }
+                attach_json_meta(gvagenai, buf, result.raw_json);
             }
         } else {
             GST_DEBUG_OBJECT(gvagenai, "Added frame %u of %u", (guint)runtime->frames.size(), gvagenai->chunk_size);
         }
     }
 
-    // Emit GstAnalyticsClsMtd on EVERY frame so gvawatermark renders persistently.
-    // Uses the last known result (persists across frames until the next inference completes).
+    if (runtime->async)
+        attach_async_results(gvagenai, runtime, buf);
+
+    // Attach the last known result to EVERY frame so gvawatermark renders it persistently (it persists across frames
+    // until the next inference completes). The answer is free-form text, so it is carried as a string in a frame-level
+    // tensor rather than as a classification label: label quarks are never freed and would grow with every answer.
     const gchar *last_result = gvagenai->last_result;
     if (last_result && last_result[0] != '\0' && gst_buffer_is_writable(buf)) {
-        GstAnalyticsRelationMeta *rmeta = gst_buffer_get_analytics_relation_meta(buf);
-        if (!rmeta) {
-            rmeta = gst_buffer_add_analytics_relation_meta(buf);
-        }
-        if (rmeta) {
-            GQuark label = g_quark_from_string(last_result);
-            // Pass 0.0 when confidence is unavailable (greedy decoding) so gvawatermark
-            // renders the label text without a confidence percentage.
-            const float raw_cls_conf = gvagenai->last_confidence;
-            gfloat cls_confidence = (raw_cls_conf >= 0.0f) ? raw_cls_conf : 0.0f;
-            GstAnalyticsClsMtd cls_mtd = {0, nullptr};
-            gst_analytics_relation_meta_add_cls_mtd(rmeta, 1, &cls_confidence, &label, &cls_mtd);
+        auto *tensor_meta = (GstGVATensorMeta *)gst_buffer_add_meta(buf, gst_gva_tensor_meta_get_info(), NULL);
+        if (tensor_meta) {
+            gst_structure_free(tensor_meta->data);
+            tensor_meta->data = gst_structure_new(GVAGENAI_RESULT_TENSOR_NAME, "label", G_TYPE_STRING, last_result,
+                                                  "model_name", G_TYPE_STRING, gvagenai->config.model, NULL);
+            // Confidence is unavailable for greedy decoding: leave it out so gvawatermark renders the text only
+            if (gvagenai->last_confidence >= 0.0f)
+                gst_structure_set(tensor_meta->data, "confidence", G_TYPE_DOUBLE, (gdouble)gvagenai->last_confidence,
+                                  NULL);
         }
     }
 
@@ -36,6 +36,11 @@ struct _GstGvaGenAI {
     guint frame_counter;
     gdouble input_fps; // input stream fps cached from caps, used to derive VideoMetadata.fps
 
+    // Async inference: chunks are queued for a worker thread instead of blocking the streaming thread
+    gboolean async;
+    guint max_pending;    // chunks that may wait for the backend while another one runs
+    gint overflow_policy; // GstGvaGenAIOverflowPolicy
+
     gboolean prompt_changed; // flag to indicate if prompt was updated and needs to be reloaded
     gchar *prompt_string;
 
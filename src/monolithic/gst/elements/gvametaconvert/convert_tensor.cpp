@@ -8,18 +8,10 @@
 
 using json = nlohmann::json;
 
-template <typename T>
-inline void add_array_object(const std::string &name, T &&array, json &jobject) {
-    json jarray;
-
-    for (const auto &item : array)
-        jarray += item;
-
-    jobject.push_back(json::object_t::value_type(name, jarray));
-}
+namespace {
 
-void attach_gvaluearray_to_json(const GVA::Tensor &tensor, const std::string &fieldname, json &jobject) {
-    const GValue *garray = gst_structure_get_value(tensor.gst_structure(), fieldname.c_str());
+void write_gvaluearray(JsonWriter &writer, const GVA::Tensor &tensor, const char *fieldname) {
+    const GValue *garray = gst_structure_get_value(tensor.gst_structure(), fieldname);
     if (!garray)
         return;
 
@@ -27,86 +19,105 @@ void attach_gvaluearray_to_json(const GVA::Tensor &tensor, const std::string &fi
     if (size == 0)
         return;
 
-    json data_array;
+    writer.key(fieldname);
+    writer.begin_array();
     for (guint i = 0; i < size; ++i) {
         const GValue *val = gst_value_array_get_value(garray, i);
         if (G_VALUE_HOLDS_STRING(val)) {
             const gchar *str = g_value_get_string(val);
-            data_array += std::string(str ? str : "");
+            writer.value(str ? str : "");
         } else if (G_VALUE_HOLDS_UINT(val)) {
-            data_array += g_value_get_uint(val);
+            writer.value(g_value_get_uint(val));
         } else if (G_VALUE_HOLDS_INT(val)) {
-            data_array += g_value_get_int(val);
+            writer.value(g_value_get_int(val));
         } else if (G_VALUE_HOLDS_FLOAT(val)) {
-            data_array += g_value_get_float(val);
+            writer.value(g_value_get_float(val));
         }
     }
+    // values of other types are skipped, field is omitted if none is left
+    if (writer.end_array() == 0)
+        writer.pop_member();
+}
 
-    if (!data_array.is_null())
-        jobject.push_back(json::object_t::value_type(fieldname, data_array));
+void write_keypoints_fields(JsonWriter &writer, const GVA::Tensor &tensor) {
+    write_gvaluearray(writer, tensor, "point_connections");
+    write_gvaluearray(writer, tensor, "point_names");
 }
 
-void convert_keypoints_fields(const GVA::Tensor &tensor, json &jobject) {
-    attach_gvaluearray_to_json(tensor, "point_connections", jobject);
-    attach_gvaluearray_to_json(tensor, "point_names", jobject);
+template <typename T>
+void write_array(JsonWriter &writer, const char *name, const std::vector<T> &array) {
+    writer.key(name);
+    writer.begin_array();
+    for (const auto &item : array)
+        writer.value(item);
+    writer.end_array();
 }
 
-json convert_tensor(const GVA::Tensor &s_tensor) {
-    json jobject = json::object();
+} // namespace
+
+void write_tensor(JsonWriter &writer, const GVA::Tensor &s_tensor) {
+    writer.begin_object();
     std::string precision_value = s_tensor.precision_as_string();
     if (!precision_value.empty()) {
-        jobject.push_back(json::object_t::value_type("precision", precision_value));
+        writer.member("precision", precision_value);
     }
     std::string layout_value = s_tensor.layout_as_string();
     if (!layout_value.empty()) {
-        jobject.push_back(json::object_t::value_type("layout", layout_value));
+        writer.member("layout", layout_value);
     }
     if (s_tensor.has_field("dims")) {
-        add_array_object("dims", s_tensor.dims(), jobject);
+        const std::vector<guint> dims = s_tensor.dims();
+        if (!dims.empty()) {
+            write_array(writer, "dims", dims);
+        } else {
+            // field holding no dimensions is written as null
+            writer.key("dims");
+            writer.null();
+        }
     }
     std::string name_value = s_tensor.name();
     if (!name_value.empty()) {
-        jobject.push_back(json::object_t::value_type("name", name_value));
+        writer.member("name", name_value);
     }
     std::string model_name_value = s_tensor.model_name();
     if (!model_name_value.empty()) {
-        jobject.push_back(json::object_t::value_type("model_name", model_name_value));
+        writer.member("model_name", model_name_value);
     }
     std::string layer_name_value = s_tensor.layer_name();
     if (!layer_name_value.empty()) {
-        jobject.push_back(json::object_t::value_type("layer_name", layer_name_value));
+        writer.member("layer_name", layer_name_value);
     }
     if ((model_name_value.empty() || layer_name_value.empty()) && s_tensor.has_field("semantic_tag")) {
         std::string semantic_tag = s_tensor.get_string("semantic_tag");
         if (!semantic_tag.empty()) {
-            jobject.push_back(json::object_t::value_type("semantic_tag", semantic_tag));
+            writer.member("semantic_tag", semantic_tag);
         }
     }
     if (s_tensor.has_field("tensor_name")) {
         std::string tensor_name_value = s_tensor.get_string("tensor_name");
         if (!tensor_name_value.empty()) {
-            jobject.push_back(json::object_t::value_type("tensor_name", tensor_name_value));
+            writer.member("tensor_name", tensor_name_value);
         }
     }
     if (s_tensor.has_field("dims_order")) {
         std::string dims_order_value = s_tensor.get_string("dims_order");
         if (!dims_order_value.empty()) {
-            jobject.push_back(json::object_t::value_type("dims_order", dims_order_value));
+            writer.member("dims_order", dims_order_value);
         }
     }
     std::string format_value = s_tensor.format();
     if (!format_value.empty()) {
-        jobject.push_back(json::object_t::value_type("format", format_value));
+        writer.member("format", format_value);
     }
     std::string type_value = s_tensor.type();
     if ((model_name_value.empty() || layer_name_value.empty()) && !type_value.empty()) {
-        jobject.push_back(json::object_t::value_type("type", type_value));
+        writer.member("type", type_value);
     }
 
     if (!s_tensor.is_detection()) {
         std::string label_value = s_tensor.label();
         if (!label_value.empty()) {
-            jobject.push_back(json::object_t::value_type("label", label_value));
+            writer.member("label", label_value);
         }
     }
     if (s_tensor.has_field("confidence")) {
@@ -114,42 +125,37 @@ json convert_tensor(const GVA::Tensor &s_tensor) {
         if (conf_vec.size() > 1) {
             bool all_same = std::all_of(conf_vec.begin(), conf_vec.end(), [&](float v) { return v == conf_vec[0]; });
             if (all_same) {
-                jobject.push_back(json::object_t::value_type("confidence", static_cast<double>(conf_vec[0])));
+                writer.member("confidence", conf_vec[0]);
             } else {
-                json jarray;
-                for (auto v : conf_vec)
-                    jarray += v;
-                jobject.push_back(json::object_t::value_type("confidence", jarray));
+                write_array(writer, "confidence", conf_vec);
             }
         } else {
-            jobject.push_back(json::object_t::value_type("confidence", s_tensor.confidence()));
+            writer.member("confidence", s_tensor.confidence());
         }
     }
     if (s_tensor.has_field("label_id")) {
-        jobject.push_back(json::object_t::value_type("label_id", s_tensor.get_int("label_id")));
+        writer.member("label_id", s_tensor.get_int("label_id"));
     }
 
-    json data_array;
     if (s_tensor.precision() == GVA::Tensor::Precision::U8) {
         const std::vector<uint8_t> data = s_tensor.data<uint8_t>();
-        for (const auto &val : data) {
-            data_array += val;
-        }
+        if (!data.empty())
+            write_array(writer, "data", data);
     } else if (s_tensor.precision() == GVA::Tensor::Precision::I64) {
         const std::vector<int64_t> data = s_tensor.data<int64_t>();
-        for (const auto &val : data) {
-            data_array += val;
-        }
+        if (!data.empty())
+            write_array(writer, "data", data);
     } else {
         const std::vector<float> data = s_tensor.data<float>();
-        for (const auto &val : data) {
-            data_array += val;
-        }
-    }
-    if (!data_array.is_null()) {
-        jobject.push_back(json::object_t::value_type("data", data_array));
+        if (!data.empty())
+            write_array(writer, "data", data);
     }
-    convert_keypoints_fields(s_tensor, jobject);
+    write_keypoints_fields(writer, s_tensor);
+    writer.end_object();
+}
 
-    return jobject;
+json convert_tensor(const GVA::Tensor &s_tensor) {
+    JsonWriter writer;
+    write_tensor(writer, s_tensor);
+    return json::parse(writer.str());
 }
@@ -1,14 +1,23 @@
 /*******************************************************************************
- * Copyright (C) 2018-2024 Intel Corporation
+ * Copyright (C) 2018-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  ******************************************************************************/
 
 #pragma once
 #include "gva_utils.h"
+#include "json_writer.h"
 #include "tensor.h"
 #include <iomanip>
 #include <iostream>
 #include <nlohmann/json.hpp>
 
-nlohmann::json convert_tensor(const GVA::Tensor &s_tensor);
\ No newline at end of file
+/**
+ * @brief Write tensor as JSON object to writer
+ */
+void write_tensor(JsonWriter &writer, const GVA::Tensor &s_tensor);
+
+/**
+ * @brief Same as write_tensor, but returns JSON object as tree
+ */
+nlohmann::json convert_tensor(const GVA::Tensor &s_tensor);
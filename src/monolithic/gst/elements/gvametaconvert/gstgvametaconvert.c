@@ -261,6 +261,7 @@ static void gst_gva_meta_convert_reset(GstGvaMetaConvert *gvametaconvert) {
     gst_gva_metaconvert_set_format(gvametaconvert, DEFAULT_FORMAT);
     gvametaconvert->info = NULL;
     gvametaconvert->json_indent = DEFAULT_JSON_INDENT;
+    json_converter_state_set_tags(gvametaconvert->json_state, gvametaconvert->tags, gvametaconvert->json_indent);
 #ifdef AUDIO
     gvametaconvert->audio_info = NULL;
 #endif
@@ -287,6 +288,7 @@ static GstStateChangeReturn gst_gva_meta_convert_change_state(GstElement *elemen
 }
 
 static void gst_gva_meta_convert_init(GstGvaMetaConvert *gvametaconvert) {
+    gvametaconvert->json_state = json_converter_state_new();
     gst_gva_meta_convert_reset(gvametaconvert);
 }
 
@@ -309,6 +311,7 @@ void gst_gva_meta_convert_set_property(GObject *object, guint property_id, const
     case PROP_TAGS:
         g_free(gvametaconvert->tags);
         gvametaconvert->tags = g_value_dup_string(value);
+        json_converter_state_set_tags(gvametaconvert->json_state, gvametaconvert->tags, gvametaconvert->json_indent);
         break;
     case PROP_ADD_EMPTY_DETECTION_RESULTS:
         gvametaconvert->add_empty_detection_results = g_value_get_boolean(value);
@@ -324,6 +327,7 @@ void gst_gva_meta_convert_set_property(GObject *object, guint property_id, const
         break;
     case PROP_JSON_INDENT:
         gvametaconvert->json_indent = g_value_get_int(value);
+        json_converter_state_set_tags(gvametaconvert->json_state, gvametaconvert->tags, gvametaconvert->json_indent);
         break;
     case PROP_TIMESTAMP_RTP:
         gvametaconvert->timestamp_rtp = g_value_get_boolean(value);
@@ -396,6 +400,8 @@ void gst_gva_meta_convert_finalize(GObject *object) {
     /* clean up object here */
 
     gst_gva_meta_convert_cleanup(gvametaconvert);
+    json_converter_state_free(gvametaconvert->json_state);
+    gvametaconvert->json_state = NULL;
 
     G_OBJECT_CLASS(gst_gva_meta_convert_parent_class)->finalize(object);
 }
@@ -26,6 +26,7 @@ GST_DEBUG_CATEGORY_EXTERN(gst_gva_meta_convert_debug_category);
 #define GST_IS_GVA_META_CONVERT_CLASS(obj) (G_TYPE_CHECK_CLASS_TYPE((klass), GST_TYPE_GVA_META_CONVERT))
 typedef struct _GstGvaMetaConvert GstGvaMetaConvert;
 typedef struct _GstGvaMetaConvertClass GstGvaMetaConvertClass;
+typedef struct _JsonConverterState JsonConverterState;
 
 typedef gboolean (*convert_function_type)(GstGvaMetaConvert *converter, GstBuffer *buffer);
 
@@ -52,6 +53,7 @@ struct _GstGvaMetaConvert {
     GstAudioInfo *audio_info;
 #endif
     gint json_indent;
+    JsonConverterState *json_state;
 };
 
 struct _GstGvaMetaConvertClass {
@@ -0,0 +1,323 @@
+/*******************************************************************************
+ * Copyright (C) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+#include "json_writer.h"
+
+#include <algorithm>
+#include <charconv>
+#include <cmath>
+#include <stdexcept>
+
+namespace {
+
+constexpr char HEX_DIGITS[] = "0123456789abcdef";
+
+bool in_range(std::string_view text, size_t index, unsigned char min, unsigned char max) {
+    if (index >= text.size())
+        return false;
+    const auto byte = static_cast<unsigned char>(text[index]);
+    return byte >= min && byte <= max;
+}
+
+// Length of UTF-8 sequence starting at index (RFC 3629), 0 if the sequence is invalid
+size_t utf8_sequence_size(std::string_view text, size_t index) {
+    const auto lead = static_cast<unsigned char>(text[index]);
+    if (lead >= 0xC2 && lead <= 0xDF)
+        return in_range(text, index + 1, 0x80, 0xBF) ? 2 : 0;
+    if (lead >= 0xE0 && lead <= 0xEF) {
+        const unsigned char min = lead == 0xE0 ? 0xA0 : 0x80;
+        const unsigned char max = lead == 0xED ? 0x9F : 0xBF;
+        return in_range(text, index + 1, min, max) && in_range(text, index + 2, 0x80, 0xBF) ? 3 : 0;
+    }
+    if (lead >= 0xF0 && lead <= 0xF4) {
+        const unsigned char min = lead == 0xF0 ? 0x90 : 0x80;
+        const unsigned char max = lead == 0xF4 ? 0x8F : 0xBF;
+        return in_range(text, index + 1, min, max) && in_range(text, index + 2, 0x80, 0xBF) &&
+                       in_range(text, index + 3, 0x80, 0xBF)
+                   ? 4
+                   : 0;
+    }
+    return 0;
+}
+
+} // namespace
+
+JsonWriter::JsonWriter(int indent, size_t depth) : _indent(indent), _depth(depth) {
+}
+
+void JsonWriter::reset(int indent) {
+    _out.clear();
+    _indent = indent;
+    _containers.clear();
+    _members.clear();
+    _keys.clear();
+}
+
+void JsonWriter::begin_object() {
+    before_value();
+    _out += '{';
+    _containers.push_back({true, _members.size(), _keys.size(), 0});
+}
+
+size_t JsonWriter::end_object() {
+    const Container container = _containers.back();
+    if (container.count > 1)
+        normalize(container);
+    const size_t count = _members.size() - container.first_member;
+    _members.resize(container.first_member);
+    _keys.resize(container.keys_size);
+    _containers.pop_back();
+    if (count)
+        newline(_containers.size() + _depth);
+    _out += '}';
+    return count;
+}
+
+void JsonWriter::begin_array() {
+    before_value();
+    _out += '[';
+    _containers.push_back({false, _members.size(), _keys.size(), 0});
+}
+
+size_t JsonWriter::end_array() {
+    const size_t count = _containers.back().count;
+    _containers.pop_back();
+    if (count)
+        newline(_containers.size() + _depth);
+    _out += ']';
+    return count;
+}
+
+void JsonWriter::key(std::string_view name, bool replace) {
+    Container &container = _containers.back();
+    const size_t begin = _out.size();
+    separator(container.count++);
+    _members.push_back({_keys.size(), name.size(), begin, _out.size(), replace});
+    _keys.append(name);
+    _out += '"';
+    escape(name);
+    _out += _indent < 0 ? "\":" : "\": ";
+}
+
+void JsonWriter::pop_member() {
+    Container &container = _containers.back();
+    const Member &member = _members.back();
+    _out.resize(member.begin);
+    _keys.resize(member.key_offset);
+    _members.pop_back();
+    container.count--;
+}
+
+void JsonWriter::null() {
+    before_value();
+    _out += "null";
+}
+
+void JsonWriter::value(bool flag) {
+    before_value();
+    _out += flag ? "true" : "false";
+}
+
+void JsonWriter::value(double number) {
+    before_value();
+    if (!std::isfinite(number)) {
+        _out += "null";
+        return;
+    }
+    // Shortest representation which reads back as the same double, as printed by nlohmann::json::dump
+    char buffer[64];
+    const char *end = nlohmann::detail::to_chars(buffer, buffer + sizeof(buffer), number);
+    _out.append(buffer, end - buffer);
+}
+
+void JsonWriter::value_signed(long long number) {
+    before_value();
+    char buffer[24];
+    const auto result = std::to_chars(buffer, buffer + sizeof(buffer), number);
+    _out.append(buffer, result.ptr - buffer);
+}
+
+void JsonWriter::value_unsigned(unsigned long long number) {
+    before_value();
+    char buffer[24];
+    const auto result = std::to_chars(buffer, buffer + sizeof(buffer), number);
+    _out.append(buffer, result.ptr - buffer);
+}
+
+void JsonWriter::value(std::string_view text) {
+    before_value();
+    _out += '"';
+    escape(text);
+    _out += '"';
+}
+
+void JsonWriter::value(const nlohmann::json &tree) {
+    switch (tree.type()) {
+    case nlohmann::json::value_t::object:
+        begin_object();
+        for (const auto &item : tree.items()) {
+            key(item.key());
+            value(item.value());
+        }
+        end_object();
+        break;
+    case nlohmann::json::value_t::array:
+        begin_array();
+        for (const auto &element : tree)
+            value(element);
+        end_array();
+        break;
+    case nlohmann::json::value_t::string:
+        value(tree.get_ref<const std::string &>());
+        break;
+    case nlohmann::json::value_t::boolean:
+        value(tree.get<bool>());
+        break;
+    case nlohmann::json::value_t::number_integer:
+        value(tree.get<nlohmann::json::number_integer_t>());
+        break;
+    case nlohmann::json::value_t::number_unsigned:
+        value(tree.get<nlohmann::json::number_unsigned_t>());
+        break;
+    case nlohmann::json::value_t::number_float:
+        value(tree.get<nlohmann::json::number_float_t>());
+        break;
+    default:
+        // binary values are never produced by parsing JSON text
+        null();
+        break;
+    }
+}
+
+void JsonWriter::raw(std::string_view serialized) {
+    before_value();
+    _out.append(serialized);
+}
+
+void JsonWriter::before_value() {
+    // object members are preceded by separator written by key()
+    if (!_containers.empty() && !_containers.back().object)
+        separator(_containers.back().count++);
+}
+
+void JsonWriter::separator(size_t count) {
+    if (count)
+        _out += ',';
+    if (_indent >= 0)
+        newline(_containers.size() + _depth);
+}
+
+void JsonWriter::newline(size_t depth) {
+    if (_indent < 0)
+        return;
+    _out += '\n';
+    _out.append(depth * _indent, ' ');
+}
+
+// Escaping of nlohmann::json::dump with ensure_ascii=false, invalid UTF-8 is an error as with default error handler
+void JsonWriter::escape(std::string_view text) {
+    size_t plain_begin = 0;
+    size_t i = 0;
+    while (i < text.size()) {
+        const auto byte = static_cast<unsigned char>(text[i]);
+        if (byte >= 0x80) {
+            const size_t size = utf8_sequence_size(text, i);
+            if (!size)
+                throw std::invalid_argument("invalid UTF-8 sequence at index " + std::to_string(i));
+            i += size;
+            continue;
+        }
+        if (byte >= 0x20 && byte != '"' && byte != '\\') {
+            i++;
+            continue;
+        }
+
+        _out.append(text.substr(plain_begin, i - plain_begin));
+        switch (byte) {
+        case '"':
+            _out += "\\\"";
+            break;
+        case '\\':
+            _out += "\\\\";
+            break;
+        case '\b':
+            _out += "\\b";
+            break;
+        case '\t':
+            _out += "\\t";
+            break;
+        case '\n':
+            _out += "\\n";
+            break;
+        case '\f':
+            _out += "\\f";
+            break;
+        case '\r':
+            _out += "\\r";
+            break;
+        default:
+            _out += "\\u00";
+            _out += HEX_DIGITS[byte >> 4];
+            _out += HEX_DIGITS[byte & 0xF];
+            break;
+        }
+        plain_begin = ++i;
+    }
+    _out.append(text.substr(plain_begin));
+}
+
+std::string_view JsonWriter::member_key(const Member &member) const {
+    return std::string_view(_keys).substr(member.key_offset, member.key_size);
+}
+
+// Sort members of the object being closed by key and drop repeated keys, unless they are already in order
+void JsonWriter::normalize(const Container &container) {
+    const size_t first = container.first_member;
+    const size_t last = _members.size();
+    bool sorted = true;
+    for (size_t i = first + 1; i < last && sorted; ++i)
+        sorted = member_key(_members[i - 1]) < member_key(_members[i]);
+    if (sorted)
+        return;
+
+    _order.resize(last - first);
+    for (size_t i = 0; i < _order.size(); ++i)
+        _order[i] = first + i;
+    std::stable_sort(_order.begin(), _order.end(),
+                     [this](size_t a, size_t b) { return member_key(_members[a]) < member_key(_members[b]); });
+
+    // Within a run of equal keys (in write order), the last replacing member wins, otherwise the first one
+    size_t kept = 0;
+    for (size_t i = 0; i < _order.size();) {
+        size_t winner = _order[i];
+        size_t j = i + 1;
+        for (; j < _order.size() && member_key(_members[_order[j]]) == member_key(_members[_order[i]]); ++j) {
+            if (_members[_order[j]].replace)
+                winner = _order[j];
+        }
+        _order[kept++] = winner;
+        i = j;
+    }
+    _order.resize(kept);
+
+    _scratch.clear();
+    const size_t region_begin = _members[first].begin;
+    for (size_t i = 0; i < _order.size(); ++i) {
+        const size_t index = _order[i];
+        const size_t body_end = index + 1 < last ? _members[index + 1].begin : _out.size();
+        if (i)
+            _scratch += ',';
+        if (_indent >= 0) {
+            _scratch += '\n';
+            _scratch.append((_containers.size() + _depth) * _indent, ' ');
+        }
+        _scratch.append(_out, _members[index].body, body_end - _members[index].body);
+    }
+    _out.replace(region_begin, _out.size() - region_begin, _scratch);
+
+    // Keep bookkeeping consistent with the rewritten text, end_object() drops it right after
+    _members.resize(first + _order.size());
+}
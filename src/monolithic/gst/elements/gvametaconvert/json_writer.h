@@ -0,0 +1,131 @@
+/*******************************************************************************
+ * Copyright (C) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+#pragma once
+
+#include <nlohmann/json.hpp>
+
+#include <concepts>
+#include <string>
+#include <string_view>
+#include <vector>
+
+/**
+ * @brief Writes JSON text straight into a string buffer, without building a nlohmann::json tree.
+ *
+ * Output is byte-identical to nlohmann::json::dump(indent) of the tree that would be built by the same sequence of
+ * calls: object members are sorted by key, number and string formatting follows nlohmann, and for repeated keys the
+ * first member wins as with push_back(), unless the member is written with replace set, which behaves as operator[].
+ * Members written out of key order are reordered when the object is closed, at the cost of copying its text once.
+ * The buffer keeps its capacity across reset(), so a writer reused for every frame does not allocate in steady state.
+ */
+class JsonWriter {
+  public:
+    /**
+     * @param indent as in nlohmann::json::dump, negative value selects the compact form
+     * @param depth nesting level the written value is placed at, for values serialized ahead of time (see raw())
+     */
+    explicit JsonWriter(int indent = -1, size_t depth = 0);
+
+    /**
+     * @brief Discard written text and start a new value
+     */
+    void reset(int indent);
+
+    const std::string &str() const {
+        return _out;
+    }
+
+    void begin_object();
+    /**
+     * @return number of members of the closed object
+     */
+    size_t end_object();
+    void begin_array();
+    /**
+     * @return number of elements of the closed array
+     */
+    size_t end_array();
+
+    /**
+     * @brief Start a member of the current object, the next written value is the member value
+     */
+    void key(std::string_view name, bool replace = false);
+
+    /**
+     * @brief Remove the last written member of the current object, e.g. an array which turned out to be empty
+     */
+    void pop_member();
+
+    void null();
+    void value(bool flag);
+    void value(double number);
+    void value(float number) {
+        value(static_cast<double>(number));
+    }
+    template <std::integral T>
+    void value(T number) {
+        if constexpr (std::is_signed_v<T>)
+            value_signed(number);
+        else
+            value_unsigned(number);
+    }
+    void value(std::string_view text);
+    void value(const char *text) {
+        value(std::string_view(text));
+    }
+    void value(const std::string &text) {
+        value(std::string_view(text));
+    }
+    void value(const nlohmann::json &tree);
+
+    /**
+     * @brief Insert a value serialized ahead of time by a writer with the same indent and depth of this value
+     */
+    void raw(std::string_view serialized);
+
+    template <typename T>
+    void member(std::string_view name, T &&member_value) {
+        key(name);
+        value(std::forward<T>(member_value));
+    }
+
+  private:
+    struct Container {
+        bool object;
+        size_t first_member; // index in _members
+        size_t keys_size;    // size of _keys when container was opened
+        size_t count;
+    };
+
+    struct Member {
+        size_t key_offset; // in _keys
+        size_t key_size;
+        size_t begin; // position of separator preceding the member in _out
+        size_t body;  // position of the quoted key in _out
+        bool replace;
+    };
+
+    void value_signed(long long number);
+    void value_unsigned(unsigned long long number);
+    void before_value();
+    void separator(size_t count);
+    void newline(size_t depth);
+    void escape(std::string_view text);
+    void close(char bracket);
+    void normalize(const Container &container);
+    std::string_view member_key(const Member &member) const;
+
+    std::string _out;
+    int _indent;
+    size_t _depth;
+    std::vector<Container> _containers;
+    std::vector<Member> _members;
+    std::string _keys;
+    // Scratch space of normalize()
+    std::vector<size_t> _order;
+    std::string _scratch;
+};
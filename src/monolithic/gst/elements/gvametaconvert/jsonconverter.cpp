@@ -17,6 +17,7 @@
 #include "g3d_radarprocess_meta.h"
 #include "gva_json_meta.h"
 #include "gva_tensor_meta.h"
+#include "json_writer.h"
 
 #include <dlstreamer/gst/metadata/g3d_od_mtd.h>
 #include <dlstreamer/gst/metadata/gstanalyticskeypointdescriptor.h>
@@ -29,6 +30,7 @@
 #include <gst/rtp/rtp.h>
 #include <nlohmann/json.hpp>
 
+#include <algorithm>
 #include <iomanip>
 #include <iostream>
 
@@ -37,6 +39,12 @@ using json = nlohmann::json;
 GST_DEBUG_CATEGORY_STATIC(gst_json_converter_debug);
 #define GST_CAT_DEFAULT gst_json_converter_debug
 
+struct _JsonConverterState {
+    JsonWriter writer; // message of the frame being converted
+    bool has_tags = false;
+    std::string tags; // serialized when tags or json-indent property is set
+};
+
 namespace {
 
 #define TIMESTAMP_LENGTH_BEFORE_MICROSECONDS 23
@@ -68,25 +76,38 @@ gchar *cut_microseconds(const gchar *input) {
 }
 
 /**
- * @return JSON object which contains parameters such as resolution, timestamp, source and tags.
+ * Writes tags as pre-serialized at the nesting level of frame members
+ */
+void write_tags(JsonWriter &writer, const JsonConverterState *state) {
+    if (state && state->has_tags) {
+        writer.key("tags");
+        writer.raw(state->tags);
+    }
+}
+
+/**
+ * Writes members of frame object such as resolution, timestamp, source and tags.
  */
-json get_frame_data(GstGvaMetaConvert *converter, GstBuffer *buffer) {
+void write_frame_data(JsonWriter &writer, GstGvaMetaConvert *converter, GstBuffer *buffer) {
     assert(converter && buffer && "Expected valid pointers GstGvaMetaConvert and GstBuffer");
 
-    json res = json::object();
     GstSegment converter_segment = converter->base_gvametaconvert.segment;
     GstClockTime timestamp = gst_segment_to_stream_time(&converter_segment, GST_FORMAT_TIME, buffer->pts);
 
     GstVideoTimeCodeMeta *tc_meta = gst_buffer_get_video_time_code_meta(buffer);
 
-    if (converter->info)
-        res["resolution"] = json::object({{"width", converter->info->width}, {"height", converter->info->height}});
+    if (converter->info) {
+        writer.key("resolution");
+        writer.begin_object();
+        writer.member("height", converter->info->height);
+        writer.member("width", converter->info->width);
+        writer.end_object();
+    }
     if (converter->source)
-        res["source"] = converter->source;
+        writer.member("source", converter->source);
     if (timestamp != G_MAXUINT64)
-        res["timestamp"] = timestamp;
-    if (converter->tags && json::accept(converter->tags))
-        res["tags"] = json::parse(converter->tags);
+        writer.member("timestamp", timestamp);
+    write_tags(writer, converter->json_state);
     if (tc_meta) {
         GstVideoTimeCode *vtc = gst_video_time_code_copy(&tc_meta->tc);
         GDateTime *frame_date_time = gst_video_time_code_to_date_time(vtc);
@@ -121,7 +142,7 @@ json get_frame_data(GstGvaMetaConvert *converter, GstBuffer *buffer) {
             }
 
             // Store the formatted timestamp in the result
-            res["system_timestamp"] = iso_string;
+            writer.member("system_timestamp", iso_string);
 
             // Free the allocated resources
             g_free(iso_string);
@@ -135,9 +156,6 @@ json get_frame_data(GstGvaMetaConvert *converter, GstBuffer *buffer) {
     }
 
     if (converter->timestamp_rtp) {
-        json rtp_info = json::object();
-        bool has_rtp_info = false;
-
         // Extract absolute sender NTP time from GstReferenceTimestampMeta if available.
         // Requires rtspsrc with add-reference-timestamp-meta=true.
         GstCaps *ntp_caps = gst_caps_new_empty_simple("timestamp/x-ntp");
@@ -149,59 +167,101 @@ json get_frame_data(GstGvaMetaConvert *converter, GstBuffer *buffer) {
             constexpr guint64 NTP_UNIX_OFFSET_NS = G_GUINT64_CONSTANT(2208988800) * GST_SECOND;
             if (ref_meta->timestamp >= NTP_UNIX_OFFSET_NS) {
                 guint64 unix_ns = ref_meta->timestamp - NTP_UNIX_OFFSET_NS;
-                rtp_info["sender_ntp_unix_timestamp_ns"] = unix_ns;
-                has_rtp_info = true;
+                writer.key("rtp");
+                writer.begin_object();
+                writer.member("sender_ntp_unix_timestamp_ns", unix_ns);
+                writer.end_object();
             }
         }
+    }
+}
 
-        if (has_rtp_info)
-            res["rtp"] = rtp_info;
+/* Annotate camera 2D detection with the id of the 3D detection it was fused
+ * with, if any. g3dobjectfuser records the cross-modal pairing as an
+ * IS_PART_OF relation from the camera GstAnalyticsODMtd to a GstAnalyticsTrackingMtd
+ * whose tracking_id is the matching GstAnalytics3DODMtd id on the 3D stream
+ * (relations cannot span buffers, hence the tracking-mtd indirection). Each 2D
+ * object already carries its OD mtd id as "region_id", so look the relation up
+ * by that id and expose the target as "associated_3d_object_id" (matching the
+ * "id" field of the corresponding objects_3d entry). */
+void write_cross_modal_link(JsonWriter &writer, GstAnalyticsRelationMeta *rmeta, gint region_id) {
+    guint od_id = static_cast<guint>(region_id);
+
+    gpointer state = NULL;
+    GstAnalyticsTrackingMtd link_mtd;
+    if (gst_analytics_relation_meta_get_direct_related(rmeta, od_id, GST_ANALYTICS_REL_TYPE_IS_PART_OF,
+                                                       gst_analytics_tracking_mtd_get_mtd_type(), &state, &link_mtd)) {
+        guint64 tracking_id = 0;
+        GstClockTime first_seen = 0, last_seen = 0;
+        gboolean lost = FALSE;
+        if (gst_analytics_tracking_mtd_get_info(&link_mtd, &tracking_id, &first_seen, &last_seen, &lost)) {
+            writer.key("associated_3d_object_id", true);
+            writer.value(tracking_id);
+        }
     }
-    return res;
 }
 
 /**
- * @return JSON array which contains ROIs attributes and their detection results.
- * Also contains ROIs classification results if any.
+ * Writes ROIs attributes and their detection results as elements of the current array.
+ * Also writes ROIs classification results if any.
  */
-/* Convert the GstAnalyticsODMtd-based detections (and their linked tracking /
- * keypoint / zone metadata) on @buffer to a JSON array. @video_info describes
- * the frame geometry; pass converter->info for the primary stream, or a
- * per-buffer GstVideoInfo when iterating batched streams. */
-json convert_roi_detection(GstGvaMetaConvert *converter, GstBuffer *buffer, GstVideoInfo *video_info) {
-    assert(converter && buffer && video_info && "Expected valid pointers GstGvaMetaConvert, GstBuffer, GstVideoInfo");
-
-    json res = json::array();
-    GVA::VideoFrame video_frame(buffer, video_info);
-    for (GVA::RegionOfInterest &roi : video_frame.regions()) {
+/* Write the GstAnalyticsODMtd-based detections (and their linked tracking /
+ * keypoint / zone metadata) of a frame. @regions come from the primary stream
+ * or from a batched stream; pass @links_rmeta of a batched stream to annotate
+ * objects with cross-modal links. */
+void write_roi_detection(JsonWriter &writer, GstGvaMetaConvert *converter, std::vector<GVA::RegionOfInterest> &regions,
+                         GstAnalyticsRelationMeta *links_rmeta) {
+    assert(converter && "Expected valid pointer GstGvaMetaConvert");
+
+    for (GVA::RegionOfInterest &roi : regions) {
         gint id = roi.object_id();
 
-        json jobject = json::object();
+        writer.begin_object();
 
+        // Written first, so that a classification attribute named "tensors" does not take its place
         if (converter->add_tensor_data) {
-            jobject["tensors"] = json::array();
+            writer.key("tensors");
+            writer.begin_array();
+            for (GList *l = roi.get_params(); l; l = g_list_next(l)) {
+                GVA::Tensor s_tensor = GVA::Tensor((GstStructure *)l->data);
+                // Skip legacy keypoint/segmentation/raw tensors — replaced by analytics-sourced ones below
+                if (s_tensor.type() != GVA::GST_ANALYTICS_KEYPOINTS_2_TENSOR &&
+                    s_tensor.type() != GVA::GST_ANALYTICS_SEGMENTATION_2_TENSOR &&
+                    s_tensor.type() != GVA::GST_ANALYTICS_TENSOR_2_TENSOR) {
+                    write_tensor(writer, s_tensor);
+                }
+            }
+            // Add analytics-sourced keypoint/segmentation/raw tensors (replacing legacy tensor)
+            for (const auto &tensor : roi.tensors()) {
+                if (tensor.type() == GVA::GST_ANALYTICS_KEYPOINTS_2_TENSOR ||
+                    tensor.type() == GVA::GST_ANALYTICS_SEGMENTATION_2_TENSOR ||
+                    tensor.type() == GVA::GST_ANALYTICS_TENSOR_2_TENSOR) {
+                    write_tensor(writer, tensor);
+                }
+            }
+            writer.end_array();
         }
 
         auto rect = roi.rect();
 
-        jobject.push_back({"x", rect.x});
-        jobject.push_back({"y", rect.y});
-        jobject.push_back({"w", rect.w});
-        jobject.push_back({"h", rect.h});
-        jobject.push_back({"region_id", roi.region_id()});
+        writer.member("x", rect.x);
+        writer.member("y", rect.y);
+        writer.member("w", rect.w);
+        writer.member("h", rect.h);
+        writer.member("region_id", roi.region_id());
 
         gint parent_id = roi.parent_id();
         if (parent_id >= 0) {
-            jobject.push_back({"parent_id", parent_id});
+            writer.member("parent_id", parent_id);
         }
 
         if (id != 0)
-            jobject.push_back({"id", id});
+            writer.member("id", id);
 
         const std::string roi_type = roi.label();
 
         if (!roi_type.empty()) {
-            jobject.push_back({"roi_type", roi_type});
+            writer.member("roi_type", roi_type);
         }
         for (GList *l = roi.get_params(); l; l = g_list_next(l)) {
 
@@ -216,24 +276,30 @@ json convert_roi_detection(GstGvaMetaConvert *converter, GstBuffer *buffer, GstV
                 int label_id;
                 if (gst_structure_get(s, "x_min", G_TYPE_DOUBLE, &xminval, "x_max", G_TYPE_DOUBLE, &xmaxval, "y_min",
                                       G_TYPE_DOUBLE, &yminval, "y_max", G_TYPE_DOUBLE, &ymaxval, NULL)) {
-                    json detection = json::object(
-                        {{"bounding_box",
-                          {{"x_min", xminval}, {"x_max", xmaxval}, {"y_min", yminval}, {"y_max", ymaxval}}}});
+                    writer.key("detection");
+                    writer.begin_object();
+                    writer.key("bounding_box");
+                    writer.begin_object();
+                    writer.member("x_max", xmaxval);
+                    writer.member("x_min", xminval);
+                    writer.member("y_max", ymaxval);
+                    writer.member("y_min", yminval);
+                    writer.end_object();
 
                     if (gst_structure_get(s, "confidence", G_TYPE_DOUBLE, &confidence, NULL)) {
-                        detection.push_back({"confidence", confidence});
+                        writer.member("confidence", confidence);
                     }
 
                     if (gst_structure_get(s, "label_id", G_TYPE_INT, &label_id, NULL)) {
-                        detection.push_back({"label_id", label_id});
+                        writer.member("label_id", label_id);
                     }
 
                     const std::string label = roi.label();
 
                     if (!label.empty()) {
-                        detection.push_back({"label", label});
+                        writer.member("label", label);
                     }
-                    jobject.push_back(json::object_t::value_type("detection", detection));
+                    writer.end_object();
 
                     // Handle extra_params_json if present
                     if (gst_structure_has_field(s, "extra_params_json")) {
@@ -242,9 +308,8 @@ json convert_roi_detection(GstGvaMetaConvert *converter, GstBuffer *buffer, GstV
                             const gchar *json_str = g_value_get_string(val);
                             if (json_str && strlen(json_str) > 0) {
                                 try {
-                                    jobject.push_back(
-                                        json::object_t::value_type("extra_params", nlohmann::json::parse(json_str)));
-                                } catch (const std::exception &e) {
+                                    writer.member("extra_params", json::parse(json_str));
+                                } catch (const json::parse_error &e) {
                                     GST_WARNING("Failed to parse extra_params_json: %s", e.what());
                                     // Do not add the field if parsing fails
                                 }
@@ -262,129 +327,99 @@ json convert_roi_detection(GstGvaMetaConvert *converter, GstBuffer *buffer, GstV
                     const gchar *attribute_name = gst_structure_has_field(s, "attribute_name")
                                                       ? gst_structure_get_string(s, "attribute_name")
                                                       : s_name;
-                    json classification = json::object({{"label", label}, {"model", {{"name", model_name}}}});
+                    writer.key(attribute_name);
+                    writer.begin_object();
+                    writer.member("label", label);
+                    writer.key("model");
+                    writer.begin_object();
+                    writer.member("name", model_name);
+                    writer.end_object();
 
                     if (gst_structure_get(s, "confidence", G_TYPE_DOUBLE, &confidence, NULL)) {
-                        classification.push_back({"confidence", confidence});
+                        writer.member("confidence", confidence);
                     }
 
                     if (gst_structure_get(s, "label_id", G_TYPE_INT, &label_id, NULL)) {
-                        classification.push_back({"label_id", label_id});
+                        writer.member("label_id", label_id);
                     }
 
-                    jobject.push_back(json::object_t::value_type(attribute_name, classification));
+                    writer.end_object();
                     g_free(label);
                     g_free(model_name);
                 }
             }
-            if (converter->add_tensor_data) {
-                GVA::Tensor s_tensor = GVA::Tensor((GstStructure *)l->data);
-                // Skip legacy keypoint/segmentation/raw tensors — replaced by analytics-sourced ones below
-                if (s_tensor.type() != GVA::GST_ANALYTICS_KEYPOINTS_2_TENSOR &&
-                    s_tensor.type() != GVA::GST_ANALYTICS_SEGMENTATION_2_TENSOR &&
-                    s_tensor.type() != GVA::GST_ANALYTICS_TENSOR_2_TENSOR) {
-                    jobject["tensors"].push_back(convert_tensor(s_tensor));
-                }
-            }
         }
 
-        // Add analytics-sourced keypoint/segmentation/raw tensors to "tensors" array (replacing legacy tensor)
-        if (converter->add_tensor_data) {
-            for (const auto &tensor : roi.tensors()) {
-                if (tensor.type() == GVA::GST_ANALYTICS_KEYPOINTS_2_TENSOR ||
-                    tensor.type() == GVA::GST_ANALYTICS_SEGMENTATION_2_TENSOR ||
-                    tensor.type() == GVA::GST_ANALYTICS_TENSOR_2_TENSOR) {
-                    jobject["tensors"].push_back(convert_tensor(tensor));
-                }
-            }
-        }
-
-        // Add zone violations and tripwire crossings for this object
+        // Zone violations, tripwire crossings and dwell times replace attributes of the same name
         auto zones = roi.zone_violations();
         if (!zones.empty()) {
-            jobject["zone_violations"] = zones;
+            writer.key("zone_violations", true);
+            writer.begin_array();
+            for (const auto &zone : zones)
+                writer.value(zone);
+            writer.end_array();
         }
 
         auto tripwires = roi.tripwire_crossings();
         if (!tripwires.empty()) {
-            json jtripwires = json::array();
+            writer.key("tripwire_crossings", true);
+            writer.begin_array();
             for (const auto &crossing : tripwires) {
-                json jcrossing = json::object();
-                jcrossing["tripwire_id"] = crossing.tripwire_id;
-                jcrossing["direction"] = crossing.direction;
-                jtripwires.push_back(jcrossing);
+                writer.begin_object();
+                writer.member("direction", crossing.direction);
+                writer.member("tripwire_id", crossing.tripwire_id);
+                writer.end_object();
             }
-            jobject["tripwire_crossings"] = jtripwires;
+            writer.end_array();
         }
 
         auto dwell_times = roi.dwell_times();
         if (!dwell_times.empty()) {
-            json jdwell_times = json::array();
+            writer.key("dwell_times", true);
+            writer.begin_array();
             for (const auto &dwell : dwell_times) {
-                json jdwell = json::object();
-                jdwell["zone_id"] = dwell.zone_id;
-                jdwell["dwell_time_sec"] = dwell.dwell_time_sec;
-                jdwell["first_seen_timestamp_sec"] = dwell.first_seen_timestamp_sec;
-                jdwell_times.push_back(jdwell);
+                writer.begin_object();
+                writer.member("dwell_time_sec", dwell.dwell_time_sec);
+                writer.member("first_seen_timestamp_sec", dwell.first_seen_timestamp_sec);
+                writer.member("zone_id", dwell.zone_id);
+                writer.end_object();
             }
-            jobject["dwell_times"] = jdwell_times;
+            writer.end_array();
         }
 
-        if (!jobject.empty()) {
-            res.push_back(jobject);
-        }
-    }
-    return res;
-}
-
-/**
- * @return JSON array which contains raw tensor metas from frame.
- */
-json convert_frame_tensors(GstGvaMetaConvert *converter, GstBuffer *buffer) {
-    assert(converter && buffer && "Expected valid pointers GstGvaMetaConvert and GstBuffer");
+        if (links_rmeta)
+            write_cross_modal_link(writer, links_rmeta, roi.region_id());
 
-    GVA::VideoFrame video_frame(buffer, converter->info);
-    const std::vector<GVA::Tensor> tensors = video_frame.tensors();
-    json array = json::array();
-    for (auto &tensor : video_frame.tensors()) {
-        if (tensor.type() != GVA::GST_ANALYTICS_CLS_2_TENSOR) {
-            array.push_back(convert_tensor(tensor));
-        }
+        writer.end_object();
     }
-    return array;
 }
 
 /**
- * @return JSON object which contains full-frame attributes and full-frame classification results from frame.
+ * Writes full-frame attributes and full-frame classification results from frame tensors as object.
  */
-json convert_frame_classification(GstGvaMetaConvert *converter, GstBuffer *buffer) {
-    assert(converter && buffer && "Expected valid pointers GstGvaMetaConvert and GstBuffer");
-
-    GVA::VideoFrame video_frame(buffer, converter->info);
-    const std::vector<GVA::Tensor> tensors = video_frame.tensors();
-    if (tensors.empty())
-        return json{};
+void write_frame_classification(JsonWriter &writer, GstGvaMetaConvert *converter, std::vector<GVA::Tensor> &tensors) {
+    assert(converter && "Expected valid pointer GstGvaMetaConvert");
 
-    json jobject = json::object();
+    writer.begin_object();
     if (converter->add_tensor_data) {
-        jobject["tensors"] = json::array();
+        // TODO: If we later suppress duplicate raw tensors for interpreted classifications, that logic must be
+        // scoped to an explicit backward-compatible contract rather than all tensors with classification-style
+        // metadata. Current behavior intentionally preserves the historical JSON payload for non-depth pipelines.
+        writer.key("tensors");
+        writer.begin_array();
+        for (GVA::Tensor &tensor : tensors)
+            write_tensor(writer, tensor);
+        writer.end_array();
     }
-    jobject.push_back({"x", 0});
-    jobject.push_back({"y", 0});
-    jobject.push_back({"w", converter->info->width});
-    jobject.push_back({"h", converter->info->height});
+    writer.member("x", 0);
+    writer.member("y", 0);
+    writer.member("w", converter->info->width);
+    writer.member("h", converter->info->height);
 
-    for (GVA::Tensor &tensor : video_frame.tensors()) {
+    for (GVA::Tensor &tensor : tensors) {
         if (tensor.has_field("label") || tensor.has_field("label_id")) {
             std::string label = tensor.label();
             std::string model_name = tensor.model_name();
-            json classification = json::object({});
-            if (!label.empty()) {
-                classification.push_back(json::object_t::value_type("label", label));
-            }
-            if (!model_name.empty()) {
-                classification.push_back(json::object_t::value_type("model", {{"name", model_name}}));
-            }
             std::string attribute_name;
             if (tensor.has_field("semantic_tag")) {
                 std::string tag = tensor.get_string("semantic_tag");
@@ -395,42 +430,44 @@ json convert_frame_classification(GstGvaMetaConvert *converter, GstBuffer *buffe
                 attribute_name =
                     tensor.has_field("attribute_name") ? tensor.get_string("attribute_name") : tensor.name();
 
+            writer.key(attribute_name);
+            writer.begin_object();
+            if (!label.empty()) {
+                writer.member("label", label);
+            }
+            if (!model_name.empty()) {
+                writer.key("model");
+                writer.begin_object();
+                writer.member("name", model_name);
+                writer.end_object();
+            }
             if (tensor.has_field("confidence")) {
-                classification.push_back(json::object_t::value_type("confidence", tensor.confidence()));
+                writer.member("confidence", tensor.confidence());
             }
             if (tensor.has_field("label_id")) {
-                classification.push_back(json::object_t::value_type("label_id", tensor.get_int("label_id")));
+                writer.member("label_id", tensor.get_int("label_id"));
             }
-
-            jobject.push_back(json::object_t::value_type(attribute_name, classification));
-        }
-        // TODO: If we later suppress duplicate raw tensors for interpreted classifications, that logic must be scoped
-        // to an explicit backward-compatible contract rather than all tensors with classification-style metadata.
-        // Current behavior intentionally preserves the historical JSON payload for non-depth pipelines.
-        if (converter->add_tensor_data) {
-            jobject["tensors"].push_back(convert_tensor(tensor));
+            writer.end_object();
         }
     }
-    return jobject;
+    writer.end_object();
 }
 
 /**
- * @return JSON array which contains audio transcription classification metadata from buffer.
+ * Writes audio transcription classification metadata from buffer as elements of the current array.
  * This function specifically filters for transcription metadata from gvaaudiotranscribe element.
  * It only processes classification metadata that:
  * 1. Is not related to specific ROIs (not part of object detection)
  * 2. Has a classification descriptor indicating it originates from gvaaudiotranscribe
  * This function should only be called from the audio processing path.
  */
-json convert_audio_transcription_classification(GstGvaMetaConvert *converter, GstBuffer *buffer) {
+void write_audio_transcription_classification(JsonWriter &writer, GstGvaMetaConvert *converter, GstBuffer *buffer) {
     assert(converter && buffer && "Expected valid pointers GstGvaMetaConvert and GstBuffer");
 
-    json res = json::array();
-
     // Get analytics relation metadata
     GstAnalyticsRelationMeta *relation_meta = gst_buffer_get_analytics_relation_meta(buffer);
     if (!relation_meta) {
-        return res; // No analytics metadata
+        return; // No analytics metadata
     }
 
     // Helper lambda to check if a classification metadata is related to a transcription descriptor
@@ -484,123 +521,112 @@ json convert_audio_transcription_classification(GstGvaMetaConvert *converter, Gs
                 GQuark label_quark = gst_analytics_cls_mtd_get_quark(cls_mtd, i);
                 const gchar *label = g_quark_to_string(label_quark);
 
-                json classification = json::object();
-                classification["label"] = label ? label : "";
-
                 // Only include confidence for actual results (non-zero confidence)
                 // Descriptors with 0.0 confidence are metadata markers - skip them
                 const gfloat epsilon = 1e-6f;
                 if (confidence > epsilon) {
-                    classification["confidence"] = confidence;
-                    res.push_back(classification);
+                    writer.begin_object();
+                    writer.member("confidence", confidence);
+                    writer.member("label", label ? label : "");
+                    writer.end_object();
                 }
             }
         }
     }
-
-    return res;
 }
 
-json convert_radar_process_meta(GstGvaMetaConvert *converter, GstBuffer *buffer) {
-    UNUSED(converter);
-    json result = json::object();
-
-    // Find GstRadarProcessMeta
-    gpointer state = NULL;
-    GstMeta *meta;
-    while ((meta = gst_buffer_iterate_meta_filtered(buffer, &state, GST_RADAR_PROCESS_META_API_TYPE))) {
-        GstRadarProcessMeta *radar_meta = (GstRadarProcessMeta *)meta;
-
-        result["frame_id"] = radar_meta->frame_id;
-        result["timestamp"] = g_get_real_time();
-
-        // Add point clouds
-        json point_clouds_obj = json::object();
-        point_clouds_obj["count"] = radar_meta->point_clouds_len;
-        json points_array = json::array();
-        for (gint i = 0; i < radar_meta->point_clouds_len; i++) {
-            json point;
-            point["range"] = radar_meta->ranges[i];
-            point["speed"] = radar_meta->speeds[i];
-            point["angle"] = radar_meta->angles[i];
-            point["snr"] = radar_meta->snrs[i];
-            points_array.push_back(point);
-        }
-        point_clouds_obj["points"] = points_array;
-        result["point_clouds"] = point_clouds_obj;
-
-        // Add clusters
-        json clusters_obj = json::object();
-        clusters_obj["count"] = radar_meta->num_clusters;
-        json clusters_array = json::array();
-        for (gint i = 0; i < radar_meta->num_clusters; i++) {
-            json cluster;
-            cluster["index"] = radar_meta->cluster_idx[i];
-            cluster["center_x"] = radar_meta->cluster_cx[i];
-            cluster["center_y"] = radar_meta->cluster_cy[i];
-            cluster["radius_x"] = radar_meta->cluster_rx[i];
-            cluster["radius_y"] = radar_meta->cluster_ry[i];
-            cluster["avg_velocity"] = radar_meta->cluster_av[i];
-            clusters_array.push_back(cluster);
-        }
-        clusters_obj["data"] = clusters_array;
-        result["clusters"] = clusters_obj;
-
-        // Add tracked objects
-        json tracked_obj = json::object();
-        tracked_obj["count"] = radar_meta->num_tracked_objects;
-        json tracked_array = json::array();
-        for (gint i = 0; i < radar_meta->num_tracked_objects; i++) {
-            json tracker;
-            tracker["id"] = radar_meta->tracker_ids[i];
-            tracker["position_x"] = radar_meta->tracker_x[i];
-            tracker["position_y"] = radar_meta->tracker_y[i];
-            tracker["velocity_x"] = radar_meta->tracker_vx[i];
-            tracker["velocity_y"] = radar_meta->tracker_vy[i];
-            tracked_array.push_back(tracker);
-        }
-        tracked_obj["objects"] = tracked_array;
-        result["tracked_objects"] = tracked_obj;
-
-        // Only process the first radar meta
-        break;
+/**
+ * Writes radar processing results as object. Members of per-point objects are written in key order, so that the
+ * writer doesn't need to reorder them.
+ */
+void write_radar_process_meta(JsonWriter &writer, GstRadarProcessMeta *radar_meta) {
+    writer.begin_object();
+    writer.member("frame_id", radar_meta->frame_id);
+    writer.member("timestamp", g_get_real_time());
+
+    // Add point clouds
+    writer.key("point_clouds");
+    writer.begin_object();
+    writer.member("count", radar_meta->point_clouds_len);
+    writer.key("points");
+    writer.begin_array();
+    for (gint i = 0; i < radar_meta->point_clouds_len; i++) {
+        writer.begin_object();
+        writer.member("angle", radar_meta->angles[i]);
+        writer.member("range", radar_meta->ranges[i]);
+        writer.member("snr", radar_meta->snrs[i]);
+        writer.member("speed", radar_meta->speeds[i]);
+        writer.end_object();
     }
-
-    return result;
-}
-
-json get_lidar_frame_data(GstGvaMetaConvert *converter, GstBuffer *buffer, LidarMeta *lidar_meta) {
-    if (!converter || !buffer || !lidar_meta) {
-        if (converter)
-            GST_ERROR_OBJECT(converter, "Unexpected null pointer in get_lidar_frame_data");
-        else
-            GST_ERROR("Unexpected null pointer in get_lidar_frame_data");
-        return json::object();
+    writer.end_array();
+    writer.end_object();
+
+    // Add clusters
+    writer.key("clusters");
+    writer.begin_object();
+    writer.member("count", radar_meta->num_clusters);
+    writer.key("data");
+    writer.begin_array();
+    for (gint i = 0; i < radar_meta->num_clusters; i++) {
+        writer.begin_object();
+        writer.member("avg_velocity", radar_meta->cluster_av[i]);
+        writer.member("center_x", radar_meta->cluster_cx[i]);
+        writer.member("center_y", radar_meta->cluster_cy[i]);
+        writer.member("index", radar_meta->cluster_idx[i]);
+        writer.member("radius_x", radar_meta->cluster_rx[i]);
+        writer.member("radius_y", radar_meta->cluster_ry[i]);
+        writer.end_object();
     }
+    writer.end_array();
+    writer.end_object();
+
+    // Add tracked objects
+    writer.key("tracked_objects");
+    writer.begin_object();
+    writer.member("count", radar_meta->num_tracked_objects);
+    writer.key("objects");
+    writer.begin_array();
+    for (gint i = 0; i < radar_meta->num_tracked_objects; i++) {
+        writer.begin_object();
+        writer.member("id", radar_meta->tracker_ids[i]);
+        writer.member("position_x", radar_meta->tracker_x[i]);
+        writer.member("position_y", radar_meta->tracker_y[i]);
+        writer.member("velocity_x", radar_meta->tracker_vx[i]);
+        writer.member("velocity_y", radar_meta->tracker_vy[i]);
+        writer.end_object();
+    }
+    writer.end_array();
+    writer.end_object();
 
-    json result = json::object();
-
-    if (converter->source)
-        result["source"] = converter->source;
-    if (converter->tags && json::accept(converter->tags))
-        result["tags"] = json::parse(converter->tags);
+    writer.end_object();
+}
 
+void write_stream_timestamp(JsonWriter &writer, GstGvaMetaConvert *converter, GstBuffer *buffer) {
     if (converter->base_gvametaconvert.segment.format == GST_FORMAT_TIME && GST_CLOCK_TIME_IS_VALID(buffer->pts)) {
         GstClockTime timestamp =
             gst_segment_to_stream_time(&converter->base_gvametaconvert.segment, GST_FORMAT_TIME, buffer->pts);
         if (timestamp != G_MAXUINT64)
-            result["timestamp"] = timestamp;
+            writer.member("timestamp", timestamp);
     }
+}
 
-    result["lidar_frame"] = json::object({
-        {"frame_id", lidar_meta->frame_id},
-        {"stream_id", lidar_meta->stream_id},
-        {"point_count", lidar_meta->lidar_point_count},
-        {"exit_source_timestamp", lidar_meta->exit_source_timestamp},
-        {"exit_g3dinference_timestamp", lidar_meta->exit_g3dinference_timestamp},
-    });
+void write_lidar_frame_data(JsonWriter &writer, GstGvaMetaConvert *converter, GstBuffer *buffer,
+                            LidarMeta *lidar_meta) {
+    assert(converter && buffer && lidar_meta && "Expected valid pointers GstGvaMetaConvert, GstBuffer, LidarMeta");
 
-    return result;
+    if (converter->source)
+        writer.member("source", converter->source);
+    write_tags(writer, converter->json_state);
+    write_stream_timestamp(writer, converter, buffer);
+
+    writer.key("lidar_frame");
+    writer.begin_object();
+    writer.member("exit_g3dinference_timestamp", lidar_meta->exit_g3dinference_timestamp);
+    writer.member("exit_source_timestamp", lidar_meta->exit_source_timestamp);
+    writer.member("frame_id", lidar_meta->frame_id);
+    writer.member("point_count", lidar_meta->lidar_point_count);
+    writer.member("stream_id", lidar_meta->stream_id);
+    writer.end_object();
 }
 
 /* Map a sensor modality enum to a stable JSON string. */
@@ -615,13 +641,12 @@ const char *modality_to_string(GstAnalytics3DSensorModality modality) {
     }
 }
 
-/* Serialize every GstAnalytics3DODMtd on @rmeta to a JSON array. Each entry
- * carries the 3D oriented box, class, confidence and sensor modality, and
- * a tracking id if available. */
-json convert_3d_od_mtds(GstAnalyticsRelationMeta *rmeta) {
-    json objects = json::array();
+/* Write every GstAnalytics3DODMtd on @rmeta as elements of the current array.
+ * Each entry carries the 3D oriented box, class, confidence and sensor
+ * modality, and a tracking id if available. Members are written in key order. */
+void write_3d_od_mtds(JsonWriter &writer, GstAnalyticsRelationMeta *rmeta) {
     if (!rmeta)
-        return objects;
+        return;
 
     gpointer state = NULL;
     GstAnalytics3DODMtd od_mtd;
@@ -636,24 +661,25 @@ json convert_3d_od_mtds(GstAnalyticsRelationMeta *rmeta) {
         gst_analytics_3d_od_mtd_get_class(&od_mtd, &class_id, &confidence);
         gst_analytics_3d_od_mtd_get_modality(&od_mtd, &modality);
 
-        json object = json::object({
-            // Per-frame 3D detection id (the GstAnalytics3DODMtd id). Camera
-            // detections reference this via "associated_3d_object_id".
-            {"id", od_mtd.id},
-            {"bbox_3d",
-             {{"x", x},
-              {"y", y},
-              {"z", z},
-              {"l", length},
-              {"w", width},
-              {"h", height},
-              {"yaw", yaw},
-              {"pitch", pitch},
-              {"roll", roll}}},
-            {"confidence", confidence},
-            {"label_id", class_id},
-            {"modality", modality_to_string(modality)},
-        });
+        writer.begin_object();
+        writer.key("bbox_3d");
+        writer.begin_object();
+        writer.member("h", height);
+        writer.member("l", length);
+        writer.member("pitch", pitch);
+        writer.member("roll", roll);
+        writer.member("w", width);
+        writer.member("x", x);
+        writer.member("y", y);
+        writer.member("yaw", yaw);
+        writer.member("z", z);
+        writer.end_object();
+        writer.member("confidence", confidence);
+        // Per-frame 3D detection id (the GstAnalytics3DODMtd id). Camera
+        // detections reference this via "associated_3d_object_id".
+        writer.member("id", od_mtd.id);
+        writer.member("label_id", class_id);
+        writer.member("modality", modality_to_string(modality));
 
         // A linked tracking mtd carries the track id.
         gpointer rel_state = NULL;
@@ -665,69 +691,40 @@ json convert_3d_od_mtds(GstAnalyticsRelationMeta *rmeta) {
             GstClockTime first_seen = 0, last_seen = 0;
             gboolean lost = FALSE;
             if (gst_analytics_tracking_mtd_get_info(&trk_mtd, &tracking_id, &first_seen, &last_seen, &lost))
-                object["track_id"] = tracking_id;
+                writer.member("track_id", tracking_id);
         }
 
-        objects.push_back(object);
+        writer.end_object();
     }
-
-    return objects;
 }
 
-json convert_lidar_inference_meta(GstGvaMetaConvert *converter, GstBuffer *buffer) {
-    LidarMeta *lidar_meta = reinterpret_cast<LidarMeta *>(gst_buffer_get_meta(buffer, LIDAR_META_API_TYPE));
-    if (!lidar_meta)
-        return json::object();
-
-    json result = get_lidar_frame_data(converter, buffer, lidar_meta);
-    json objects = convert_3d_od_mtds(gst_buffer_get_analytics_relation_meta(buffer));
-
-    if (!objects.empty())
-        result["objects"] = objects;
-
-    return result;
-}
-
-/* Annotate each camera 2D detection with the id of the 3D detection it was
- * fused with, if any. g3dobjectfuser records the cross-modal pairing as an
- * IS_PART_OF relation from the camera GstAnalyticsODMtd to a GstAnalyticsTrackingMtd
- * whose tracking_id is the matching GstAnalytics3DODMtd id on the 3D stream
- * (relations cannot span buffers, hence the tracking-mtd indirection). Each 2D
- * object already carries its OD mtd id as "region_id", so look the relation up
- * by that id and expose the target as "associated_3d_object_id" (matching the
- * "id" field of the corresponding objects_3d entry). */
-void add_cross_modal_links(json &objects_2d, GstAnalyticsRelationMeta *rmeta) {
-    if (!rmeta)
-        return;
-    for (json &obj : objects_2d) {
-        auto it = obj.find("region_id");
-        if (it == obj.end() || !it->is_number_integer())
-            continue;
-        guint od_id = static_cast<guint>(it->get<int>());
-
-        gpointer state = NULL;
-        GstAnalyticsTrackingMtd link_mtd;
-        if (gst_analytics_relation_meta_get_direct_related(rmeta, od_id, GST_ANALYTICS_REL_TYPE_IS_PART_OF,
-                                                           gst_analytics_tracking_mtd_get_mtd_type(), &state,
-                                                           &link_mtd)) {
-            guint64 tracking_id = 0;
-            GstClockTime first_seen = 0, last_seen = 0;
-            gboolean lost = FALSE;
-            if (gst_analytics_tracking_mtd_get_info(&link_mtd, &tracking_id, &first_seen, &last_seen, &lost))
-                obj["associated_3d_object_id"] = tracking_id;
-        }
-    }
+/**
+ * Writes lidar frame with its 3D detections as object.
+ * @return number of detections
+ */
+size_t write_lidar_inference_meta(JsonWriter &writer, GstGvaMetaConvert *converter, GstBuffer *buffer,
+                                  LidarMeta *lidar_meta) {
+    writer.begin_object();
+    write_lidar_frame_data(writer, converter, buffer, lidar_meta);
+    writer.key("objects");
+    writer.begin_array();
+    write_3d_od_mtds(writer, gst_buffer_get_analytics_relation_meta(buffer));
+    const size_t objects = writer.end_array();
+    if (!objects)
+        writer.pop_member();
+    writer.end_object();
+    return objects;
 }
 
-/* Convert one stream's source buffer inside a GstAnalyticsBatchMeta to JSON.
+/* Write one stream's source buffer inside a GstAnalyticsBatchMeta as object.
  * Camera streams carry GstAnalyticsODMtd + tracking; the 3D-sensor stream
  * carries GstAnalytics3DODMtd + tracking. */
-json convert_batch_stream(GstGvaMetaConvert *converter, GstAnalyticsBatchStream *stream) {
-    json jstream = json::object();
-    jstream["stream_index"] = stream->index;
+void write_batch_stream(JsonWriter &writer, GstGvaMetaConvert *converter, GstAnalyticsBatchStream *stream) {
+    writer.begin_object();
+    writer.member("stream_index", stream->index);
 
     if (const gchar *stream_id = gst_analytics_batch_stream_get_stream_id(stream))
-        jstream["stream_id"] = stream_id;
+        writer.member("stream_id", stream_id);
 
     // The first mini object is the stream's source buffer.
     GstBuffer *stream_buf = NULL;
@@ -737,15 +734,19 @@ json convert_batch_stream(GstGvaMetaConvert *converter, GstAnalyticsBatchStream
             break;
         }
     }
-    if (!stream_buf)
-        return jstream;
+    if (!stream_buf) {
+        writer.end_object();
+        return;
+    }
 
     GstAnalyticsRelationMeta *rmeta = gst_buffer_get_analytics_relation_meta(stream_buf);
 
     // 3D detections (lidar/radar sensor stream).
-    json objects_3d = convert_3d_od_mtds(rmeta);
-    if (!objects_3d.empty())
-        jstream["objects_3d"] = objects_3d;
+    writer.key("objects_3d");
+    writer.begin_array();
+    write_3d_od_mtds(writer, rmeta);
+    if (!writer.end_array())
+        writer.pop_member();
 
     // 2D detections (camera streams): Derive geometry from the stream caps,
     // falling back to the buffer's own video meta.
@@ -763,39 +764,43 @@ json convert_batch_stream(GstGvaMetaConvert *converter, GstAnalyticsBatchStream
     }
 
     if (have_info) {
-        json objects_2d = convert_roi_detection(converter, stream_buf, &stream_info);
-        add_cross_modal_links(objects_2d, rmeta);
-        if (!objects_2d.empty())
-            jstream["objects"] = objects_2d;
+        GVA::VideoFrame video_frame(stream_buf, &stream_info);
+        std::vector<GVA::RegionOfInterest> regions = video_frame.regions();
+        if (!regions.empty()) {
+            writer.key("objects");
+            writer.begin_array();
+            write_roi_detection(writer, converter, regions, rmeta);
+            writer.end_array();
+        }
     }
 
-    return jstream;
+    writer.end_object();
 }
 
-json convert_analytics_batch_meta(GstGvaMetaConvert *converter, GstBuffer *buffer) {
-    GstAnalyticsBatchMeta *batch_meta = gst_buffer_get_analytics_batch_meta(buffer);
-    if (!batch_meta || batch_meta->n_streams == 0)
-        return json::object();
-
-    json result = json::object();
+void write_analytics_batch_meta(JsonWriter &writer, GstGvaMetaConvert *converter, GstBuffer *buffer,
+                                GstAnalyticsBatchMeta *batch_meta) {
+    writer.begin_object();
     if (converter->source)
-        result["source"] = converter->source;
-    if (converter->tags && json::accept(converter->tags))
-        result["tags"] = json::parse(converter->tags);
+        writer.member("source", converter->source);
+    write_tags(writer, converter->json_state);
+    write_stream_timestamp(writer, converter, buffer);
 
-    if (converter->base_gvametaconvert.segment.format == GST_FORMAT_TIME && GST_CLOCK_TIME_IS_VALID(buffer->pts)) {
-        GstClockTime timestamp =
-            gst_segment_to_stream_time(&converter->base_gvametaconvert.segment, GST_FORMAT_TIME, buffer->pts);
-        if (timestamp != G_MAXUINT64)
-            result["timestamp"] = timestamp;
-    }
-
-    json streams = json::array();
+    writer.key("streams");
+    writer.begin_array();
     for (gsize i = 0; i < batch_meta->n_streams; ++i)
-        streams.push_back(convert_batch_stream(converter, &batch_meta->streams[i]));
-    result["streams"] = streams;
+        write_batch_stream(writer, converter, &batch_meta->streams[i]);
+    writer.end_array();
+    writer.end_object();
+}
 
-    return result;
+void add_json_meta(GstGvaMetaConvert *converter, GstBuffer *buffer, const std::string &message, const char *kind) {
+    GstGVAJSONMeta *json_meta = GST_GVA_JSON_META_ADD(buffer);
+    if (json_meta) {
+        json_meta->message = g_strdup(message.c_str());
+        GST_INFO_OBJECT(converter, "%s JSON message: %s", kind, message.c_str());
+    } else {
+        GST_ERROR_OBJECT(converter, "Failed to add GVA JSON meta for %s data", kind);
+    }
 }
 
 } // namespace
@@ -813,127 +818,109 @@ gboolean to_json(GstGvaMetaConvert *converter, GstBuffer *buffer) {
         return FALSE;
     }
 
+    if (!converter->json_state) {
+        GST_ERROR_OBJECT(converter, "Failed convert to json: JSON converter state is null");
+        return FALSE;
+    }
+
+    // Message is written to the same buffer for every frame, so its capacity is reused
+    JsonWriter &writer = converter->json_state->writer;
+    writer.reset(converter->json_indent);
+
     try {
         // Check for a batched multi-stream buffer first
-        json batch_data = convert_analytics_batch_meta(converter, buffer);
-        if (!batch_data.empty()) {
-            std::string json_message = batch_data.dump(converter->json_indent);
-            GstGVAJSONMeta *json_meta = GST_GVA_JSON_META_ADD(buffer);
-            if (json_meta) {
-                json_meta->message = g_strdup(json_message.c_str());
-                GST_INFO_OBJECT(converter, "Batch JSON message: %s", json_message.c_str());
-            } else {
-                GST_ERROR_OBJECT(converter, "Failed to add GVA JSON meta for batch data");
-            }
+        GstAnalyticsBatchMeta *batch_meta = gst_buffer_get_analytics_batch_meta(buffer);
+        if (batch_meta && batch_meta->n_streams != 0) {
+            write_analytics_batch_meta(writer, converter, buffer, batch_meta);
+            add_json_meta(converter, buffer, writer.str(), "Batch");
             return TRUE;
         }
 
         // Check for radar metadata first
-        json radar_data = convert_radar_process_meta(converter, buffer);
-        if (!radar_data.empty()) {
-            std::string json_message = radar_data.dump(converter->json_indent);
-
-            // Add as GVA JSON meta
-            GstGVAJSONMeta *json_meta = GST_GVA_JSON_META_ADD(buffer);
-            if (json_meta) {
-                json_meta->message = g_strdup(json_message.c_str());
-                GST_INFO_OBJECT(converter, "Radar JSON message: %s", json_message.c_str());
-            } else {
-                GST_ERROR_OBJECT(converter, "Failed to add GVA JSON meta for radar data");
-            }
+        GstRadarProcessMeta *radar_meta =
+            reinterpret_cast<GstRadarProcessMeta *>(gst_buffer_get_meta(buffer, GST_RADAR_PROCESS_META_API_TYPE));
+        if (radar_meta) {
+            write_radar_process_meta(writer, radar_meta);
+            add_json_meta(converter, buffer, writer.str(), "Radar");
             return TRUE;
         }
 
-        json lidar_data = convert_lidar_inference_meta(converter, buffer);
-        if (!lidar_data.empty()) {
-            const bool has_objects = lidar_data.contains("objects") && !lidar_data["objects"].empty();
-            const bool has_tensors = lidar_data.contains("tensors") && !lidar_data["tensors"].empty();
-
-            if (!has_objects && !has_tensors && !converter->add_empty_detection_results) {
+        LidarMeta *lidar_meta = reinterpret_cast<LidarMeta *>(gst_buffer_get_meta(buffer, LIDAR_META_API_TYPE));
+        if (lidar_meta) {
+            const size_t objects = write_lidar_inference_meta(writer, converter, buffer, lidar_meta);
+            if (!objects && !converter->add_empty_detection_results) {
                 GST_DEBUG_OBJECT(converter, "No LiDAR detections found. Not posting JSON message");
                 return TRUE;
             }
-
-            std::string json_message = lidar_data.dump(converter->json_indent);
-            GstGVAJSONMeta *json_meta = GST_GVA_JSON_META_ADD(buffer);
-            if (json_meta) {
-                json_meta->message = g_strdup(json_message.c_str());
-                GST_INFO_OBJECT(converter, "LiDAR JSON message: %s", json_message.c_str());
-            } else {
-                GST_ERROR_OBJECT(converter, "Failed to add GVA JSON meta for LiDAR data");
-            }
+            add_json_meta(converter, buffer, writer.str(), "LiDAR");
             return TRUE;
         }
 
         if (converter->info) {
-            json jframe = get_frame_data(converter, buffer);
-            /* objects section */
-            json jframe_objects;
-            json roi_detection = convert_roi_detection(converter, buffer, converter->info);
-            if (!roi_detection.empty()) {
-                jframe_objects = roi_detection;
-            } /* roi_detection can contain multiple objects, while frame_classification - only one */
-            json frame_classification = convert_frame_classification(converter, buffer);
-            if (!frame_classification.empty()) {
-                jframe_objects.push_back(frame_classification);
-            }
-
-            /* tensors section */
-            json jframe_tensors;
-            if (converter->add_tensor_data) {
-                jframe_tensors = convert_frame_tensors(converter, buffer);
-            }
-
-            if (jframe_objects.empty() && jframe_tensors.empty()) {
+            GVA::VideoFrame video_frame(buffer, converter->info);
+            std::vector<GVA::RegionOfInterest> regions = video_frame.regions();
+            std::vector<GVA::Tensor> tensors = video_frame.tensors();
+
+            /* objects section: ROIs and an object with full-frame classification, if frame has tensors */
+            const bool has_objects = !regions.empty() || !tensors.empty();
+            /* tensors section: raw tensors of frame */
+            auto is_raw_tensor = [](GVA::Tensor &tensor) { return tensor.type() != GVA::GST_ANALYTICS_CLS_2_TENSOR; };
+            const bool has_tensors =
+                converter->add_tensor_data && std::any_of(tensors.begin(), tensors.end(), is_raw_tensor);
+
+            if (!has_objects && !has_tensors) {
                 if (!converter->add_empty_detection_results) {
                     GST_DEBUG_OBJECT(converter, "No detections found. Not posting JSON message");
                     return TRUE;
                 }
             }
 
-            if (!jframe.is_null()) {
-                if (!jframe_objects.empty()) {
-                    jframe["objects"] = jframe_objects;
-                }
-                if (!jframe_tensors.empty()) {
-                    jframe["tensors"] = jframe_tensors;
+            writer.begin_object();
+            write_frame_data(writer, converter, buffer);
+            if (has_objects) {
+                writer.key("objects");
+                writer.begin_array();
+                write_roi_detection(writer, converter, regions, nullptr);
+                if (!tensors.empty())
+                    write_frame_classification(writer, converter, tensors);
+                writer.end_array();
+            }
+            if (has_tensors) {
+                writer.key("tensors");
+                writer.begin_array();
+                for (auto &tensor : tensors) {
+                    if (is_raw_tensor(tensor))
+                        write_tensor(writer, tensor);
                 }
-                std::string json_message = jframe.dump(converter->json_indent);
-                GVA::VideoFrame video_frame(buffer, converter->info);
-                video_frame.add_message(json_message);
-                GST_INFO_OBJECT(converter, "JSON message: %s", json_message.c_str());
+                writer.end_array();
             }
+            writer.end_object();
+
+            video_frame.add_message(writer.str());
+            GST_INFO_OBJECT(converter, "JSON message: %s", writer.str().c_str());
         }
 #ifdef AUDIO
         else {
             // For audio streams, handle transcription classification first, then fall back to traditional audio
             // metadata
-            json audio_transcription_classification = convert_audio_transcription_classification(converter, buffer);
-            if (!audio_transcription_classification.empty()) {
-                // Create audio JSON message with analytics classification
-                json audio_frame = json::object();
-                GstSegment converter_segment = converter->base_gvametaconvert.segment;
-                GstClockTime timestamp = gst_segment_to_stream_time(&converter_segment, GST_FORMAT_TIME, buffer->pts);
-
-                if (converter->source)
-                    audio_frame["source"] = converter->source;
-                if (timestamp != G_MAXUINT64)
-                    audio_frame["timestamp"] = timestamp;
-                if (converter->tags && json::accept(converter->tags))
-                    audio_frame["tags"] = json::parse(converter->tags);
-
-                audio_frame["transcription"] = audio_transcription_classification;
-
-                std::string json_message = audio_frame.dump(converter->json_indent);
-
-                // Add as GVA JSON meta
-                GstGVAJSONMeta *json_meta = GST_GVA_JSON_META_ADD(buffer);
-                if (json_meta) {
-                    json_meta->message = g_strdup(json_message.c_str());
-                    GST_INFO_OBJECT(converter, "Audio JSON message: %s", json_message.c_str());
-                } else {
-                    GST_ERROR_OBJECT(converter, "Failed to add GVA JSON meta to audio buffer");
-                }
+            GstSegment converter_segment = converter->base_gvametaconvert.segment;
+            GstClockTime timestamp = gst_segment_to_stream_time(&converter_segment, GST_FORMAT_TIME, buffer->pts);
+
+            // Create audio JSON message with analytics classification
+            writer.begin_object();
+            if (converter->source)
+                writer.member("source", converter->source);
+            if (timestamp != G_MAXUINT64)
+                writer.member("timestamp", timestamp);
+            write_tags(writer, converter->json_state);
+            writer.key("transcription");
+            writer.begin_array();
+            write_audio_transcription_classification(writer, converter, buffer);
+            const size_t transcriptions = writer.end_array();
+            writer.end_object();
+
+            if (transcriptions) {
+                add_json_meta(converter, buffer, writer.str(), "Audio");
                 return TRUE;
             } else {
                 // Fall back to traditional audio metadata conversion
@@ -946,4 +933,33 @@ gboolean to_json(GstGvaMetaConvert *converter, GstBuffer *buffer) {
         return FALSE;
     }
     return TRUE;
-}
\ No newline at end of file
+}
+
+JsonConverterState *json_converter_state_new(void) {
+    GST_DEBUG_CATEGORY_INIT(gst_json_converter_debug, "jsonconverter", 0, "JSON converter");
+    return new JsonConverterState();
+}
+
+void json_converter_state_free(JsonConverterState *state) {
+    delete state;
+}
+
+void json_converter_state_set_tags(JsonConverterState *state, const gchar *tags, gint json_indent) {
+    if (!state)
+        return;
+
+    state->has_tags = tags && json::accept(tags);
+    state->tags.clear();
+    if (!state->has_tags)
+        return;
+
+    // Tags are members of top-level object, so they are serialized at its nesting level
+    JsonWriter writer(json_indent, 1);
+    try {
+        writer.value(json::parse(tags));
+        state->tags = writer.str();
+    } catch (const std::exception &e) {
+        GST_WARNING("Failed to serialize tags: %s", e.what());
+        state->has_tags = false;
+    }
+}
@@ -1,5 +1,5 @@
 /*******************************************************************************
- * Copyright (C) 2018-2020 Intel Corporation
+ * Copyright (C) 2018-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  ******************************************************************************/
@@ -14,6 +14,12 @@ extern "C" {
 
 gboolean to_json(GstGvaMetaConvert *converter, GstBuffer *buffer);
 
+/* Per-element state of JSON converter: message buffer reused across frames and pre-serialized tags */
+JsonConverterState *json_converter_state_new(void);
+void json_converter_state_free(JsonConverterState *state);
+/* Parse and serialize tags once, call whenever tags or json-indent property changes */
+void json_converter_state_set_tags(JsonConverterState *state, const gchar *tags, gint json_indent);
+
 #ifdef __cplusplus
 } /* extern C */
 #endif /* __cplusplus */
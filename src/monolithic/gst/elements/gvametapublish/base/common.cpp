@@ -1,5 +1,5 @@
 /*******************************************************************************
- * Copyright (C) 2021 Intel Corporation
+ * Copyright (C) 2021-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  ******************************************************************************/
@@ -37,3 +37,54 @@ GType gva_metapublish_file_format_get_type(void) {
 
     return gva_metapublish_file_format_type;
 }
+
+const gchar *overflow_policy_to_string(OverflowPolicy policy) {
+    switch (policy) {
+    case GVA_META_PUBLISH_OVERFLOW_BLOCK:
+        return OVERFLOW_POLICY_BLOCK_NAME;
+    case GVA_META_PUBLISH_OVERFLOW_DROP:
+        return OVERFLOW_POLICY_DROP_NAME;
+    default:
+        return UNKNOWN_VALUE_NAME;
+    }
+}
+
+GType gva_metapublish_overflow_policy_get_type(void) {
+    static GType gva_metapublish_overflow_policy_type = 0;
+    static const GEnumValue overflow_policy_types[] = {
+        {GVA_META_PUBLISH_OVERFLOW_BLOCK, "wait until there is space in the queue", OVERFLOW_POLICY_BLOCK_NAME},
+        {GVA_META_PUBLISH_OVERFLOW_DROP, "discard the new message", OVERFLOW_POLICY_DROP_NAME},
+        {0, nullptr, nullptr}};
+
+    if (!gva_metapublish_overflow_policy_type) {
+        gva_metapublish_overflow_policy_type =
+            g_enum_register_static("GvaMetaPublishOverflowPolicy", overflow_policy_types);
+    }
+
+    return gva_metapublish_overflow_policy_type;
+}
+
+const gchar *compression_to_string(CompressionType compression) {
+    switch (compression) {
+    case GVA_META_PUBLISH_COMPRESSION_NONE:
+        return COMPRESSION_NONE_NAME;
+    case GVA_META_PUBLISH_COMPRESSION_GZIP:
+        return COMPRESSION_GZIP_NAME;
+    default:
+        return UNKNOWN_VALUE_NAME;
+    }
+}
+
+GType gva_metapublish_compression_get_type(void) {
+    static GType gva_metapublish_compression_type = 0;
+    static const GEnumValue compression_types[] = {
+        {GVA_META_PUBLISH_COMPRESSION_NONE, "broker messages are sent as they are", COMPRESSION_NONE_NAME},
+        {GVA_META_PUBLISH_COMPRESSION_GZIP, "broker messages are compressed to gzip stream", COMPRESSION_GZIP_NAME},
+        {0, nullptr, nullptr}};
+
+    if (!gva_metapublish_compression_type) {
+        gva_metapublish_compression_type = g_enum_register_static("GvaMetaPublishCompression", compression_types);
+    }
+
+    return gva_metapublish_compression_type;
+}
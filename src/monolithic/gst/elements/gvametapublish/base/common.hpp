@@ -6,6 +6,7 @@
 
 #pragma once
 
+#include "gvametapublish_export.h"
 #include <gst/gst.h>
 
 extern GstStaticPadTemplate gva_meta_publish_sink_template;
@@ -13,10 +14,23 @@ extern GstStaticPadTemplate gva_meta_publish_src_template;
 
 typedef enum { GVA_META_PUBLISH_JSON = 1, GVA_META_PUBLISH_JSON_LINES = 2 } FileFormat;
 
+// What happens to a new message when the publishing queue is full
+typedef enum { GVA_META_PUBLISH_OVERFLOW_BLOCK = 0, GVA_META_PUBLISH_OVERFLOW_DROP = 1 } OverflowPolicy;
+
+// How broker publishers compress envelopes of batched messages
+typedef enum { GVA_META_PUBLISH_COMPRESSION_NONE = 0, GVA_META_PUBLISH_COMPRESSION_GZIP = 1 } CompressionType;
+
 // File specific constants
 constexpr auto STDOUT = "stdout";
 constexpr auto DEFAULT_FILE_PATH = STDOUT;
 constexpr auto DEFAULT_FILE_FORMAT = GVA_META_PUBLISH_JSON;
+constexpr auto DEFAULT_MAX_QUEUE_SIZE = 1024;
+constexpr auto DEFAULT_OVERFLOW_POLICY = GVA_META_PUBLISH_OVERFLOW_BLOCK;
+constexpr auto DEFAULT_FLUSH_INTERVAL = 0;
+constexpr auto DEFAULT_FLUSH_SIZE = 64 * 1024;
+constexpr auto DEFAULT_MAX_FILE_SIZE = 0;
+constexpr auto DEFAULT_ROTATION_INTERVAL = 0;
+constexpr auto DEFAULT_COMPRESS_ROTATED = false;
 
 // Enum value names
 constexpr auto UNKNOWN_VALUE_NAME = "unknown";
@@ -28,6 +42,12 @@ constexpr auto PUBLISH_METHOD_KAFKA_NAME = "kafka";
 constexpr auto FILE_FORMAT_JSON_NAME = "json";
 constexpr auto FILE_FORMAT_JSON_LINES_NAME = "json-lines";
 
+constexpr auto OVERFLOW_POLICY_BLOCK_NAME = "block";
+constexpr auto OVERFLOW_POLICY_DROP_NAME = "drop";
+
+constexpr auto COMPRESSION_NONE_NAME = "none";
+constexpr auto COMPRESSION_GZIP_NAME = "gzip";
+
 // Broker specific constants
 constexpr auto DEFAULT_ADDRESS = "";
 constexpr auto DEFAULT_MQTTCLIENTID = "";
@@ -39,8 +59,26 @@ constexpr auto DEFAULT_TOPIC = "";
 constexpr auto DEFAULT_SIGNAL_HANDOFFS = false;
 constexpr auto DEFAULT_MAX_CONNECT_ATTEMPTS = 1;
 constexpr auto DEFAULT_MAX_RECONNECT_INTERVAL = 30;
+constexpr auto DEFAULT_BATCH_SIZE = 1;
+constexpr auto DEFAULT_BATCH_BYTES = 512 * 1024;
+constexpr auto DEFAULT_BATCH_LINGER = 100;
+constexpr auto DEFAULT_COMPRESSION = GVA_META_PUBLISH_COMPRESSION_NONE;
+constexpr auto DEFAULT_MAX_IN_FLIGHT = 0;
+constexpr auto DEFAULT_SPOOL_DIR = "";
+constexpr auto DEFAULT_MAX_SPOOL_SIZE = 64 * 1024 * 1024;
 
 const gchar *file_format_to_string(FileFormat format);
 
 GType gva_metapublish_file_format_get_type(void);
 #define GST_TYPE_GVA_METAPUBLISH_FILE_FORMAT (gva_metapublish_file_format_get_type())
+
+const gchar *overflow_policy_to_string(OverflowPolicy policy);
+
+GType gva_metapublish_overflow_policy_get_type(void);
+#define GST_TYPE_GVA_METAPUBLISH_OVERFLOW_POLICY (gva_metapublish_overflow_policy_get_type())
+
+// Exported for broker publishers, which are separate plugins
+GVAMETAPUBLISH_EXPORTS const gchar *compression_to_string(CompressionType compression);
+
+GVAMETAPUBLISH_EXPORTS GType gva_metapublish_compression_get_type(void);
+#define GST_TYPE_GVA_METAPUBLISH_COMPRESSION (gva_metapublish_compression_get_type())
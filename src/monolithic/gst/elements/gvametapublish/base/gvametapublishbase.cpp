@@ -70,8 +70,9 @@ class GvaMetaPublishBasePrivate {
             return GST_FLOW_OK;
         }
 
+        // Message is passed as a view, publishers copy only what they keep
         GvaMetaPublishBaseClass *klass = GVA_META_PUBLISH_BASE_GET_CLASS(_base);
-        if (!klass->publish(GVA_META_PUBLISH_BASE(_base), std::string(json_meta->message))) {
+        if (!klass->publish(GVA_META_PUBLISH_BASE(_base), json_meta->message)) {
             GST_ELEMENT_ERROR(_base, RESOURCE, NOT_FOUND, ("Failed to publish message"), (NULL));
             return GST_FLOW_ERROR;
         }
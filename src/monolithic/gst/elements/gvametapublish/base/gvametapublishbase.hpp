@@ -10,6 +10,7 @@
 #include <gst/base/gstbasetransform.h>
 
 #include <string>
+#include <string_view>
 
 G_BEGIN_DECLS
 
@@ -32,7 +33,7 @@ struct GvaMetaPublishBaseClass {
     GstBaseTransformClass base;
 
     void (*handoff)(GstElement *element, GstBuffer *buf);
-    gboolean (*publish)(GvaMetaPublishBase *self, const std::string &message);
+    gboolean (*publish)(GvaMetaPublishBase *self, std::string_view message);
 };
 
 GVAMETAPUBLISH_EXPORTS GType gva_meta_publish_base_get_type(void);
@@ -0,0 +1,453 @@
+/*******************************************************************************
+ * Copyright (C) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+#include "message_batcher.hpp"
+
+#include <algorithm>
+#include <charconv>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <new>
+#include <system_error>
+#include <vector>
+
+#include <zlib.h>
+
+namespace fs = std::filesystem;
+
+namespace {
+
+constexpr auto SPOOL_FILE_EXTENSION = ".envelope";
+constexpr auto SPOOL_TMP_EXTENSION = ".tmp";
+// How often delivery reports are served while envelopes are in flight
+constexpr auto POLL_INTERVAL = std::chrono::milliseconds(100);
+
+bool gzip(const std::string &input, std::string &output) {
+    z_stream stream = {};
+    // window bits + 16 selects gzip wrapper instead of zlib one
+    if (deflateInit2(&stream, Z_DEFAULT_COMPRESSION, Z_DEFLATED, 15 + 16, 8, Z_DEFAULT_STRATEGY) != Z_OK)
+        return false;
+
+    output.resize(deflateBound(&stream, static_cast<uLong>(input.size())));
+    stream.next_in = reinterpret_cast<Bytef *>(const_cast<char *>(input.data()));
+    stream.avail_in = static_cast<uInt>(input.size());
+    stream.next_out = reinterpret_cast<Bytef *>(output.data());
+    stream.avail_out = static_cast<uInt>(output.size());
+    const int result = deflate(&stream, Z_FINISH);
+    output.resize(stream.total_out);
+    deflateEnd(&stream);
+    return result == Z_STREAM_END;
+}
+
+bool read_file(const std::string &path, std::string &content) {
+    std::ifstream file(path, std::ios::binary | std::ios::ate);
+    if (!file)
+        return false;
+    content.resize(static_cast<size_t>(file.tellg()));
+    file.seekg(0);
+    return static_cast<bool>(file.read(content.data(), static_cast<std::streamsize>(content.size())));
+}
+
+// Written under temporary name and renamed, so that spool never holds a partial envelope
+bool write_file(const std::string &path, const std::string &content) {
+    const std::string tmp_path = path + SPOOL_TMP_EXTENSION;
+    {
+        std::ofstream file(tmp_path, std::ios::binary | std::ios::trunc);
+        if (!file.write(content.data(), static_cast<std::streamsize>(content.size())) || !file.flush()) {
+            file.close();
+            std::remove(tmp_path.c_str());
+            return false;
+        }
+    }
+    std::error_code ec;
+    fs::rename(tmp_path, path, ec);
+    if (ec) {
+        std::remove(tmp_path.c_str());
+        return false;
+    }
+    return true;
+}
+
+} // namespace
+
+MessageBatcher::MessageBatcher(MessageBatcherConfig config, EnvelopeSink &sink)
+    : _config(std::move(config)), _sink(sink), _retry_interval(_config.retry_interval) {
+}
+
+MessageBatcher::~MessageBatcher() {
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _stop = true;
+    }
+    _wake.notify_one();
+    _slot_freed.notify_all();
+    if (_thread.joinable())
+        _thread.join();
+}
+
+bool MessageBatcher::start() {
+    if (!_config.spool_dir.empty()) {
+        std::error_code ec;
+        fs::create_directories(_config.spool_dir, ec);
+        if (ec) {
+            std::lock_guard<std::mutex> lock(_mutex);
+            _error = "Error creating spool directory " + _config.spool_dir + ": " + ec.message();
+            return false;
+        }
+
+        // Envelopes left by an earlier run are resent first
+        for (const auto &entry : fs::directory_iterator(_config.spool_dir, ec)) {
+            const fs::path &path = entry.path();
+            if (path.extension() == SPOOL_TMP_EXTENSION) {
+                fs::remove(path, ec);
+                continue;
+            }
+            const std::string stem = path.stem().string();
+            uint64_t seq = 0;
+            const auto parsed = std::from_chars(stem.data(), stem.data() + stem.size(), seq);
+            if (path.extension() != SPOOL_FILE_EXTENSION || parsed.ec != std::errc() ||
+                parsed.ptr != stem.data() + stem.size() || !seq)
+                continue;
+            const auto size = entry.file_size(ec);
+            if (ec)
+                continue;
+            _spool.emplace(seq, static_cast<size_t>(size));
+            _spool_bytes += size;
+            _next_spool_seq = std::max(_next_spool_seq, seq + 1);
+        }
+        _retry_at = Clock::now();
+        // until the broker proves to be available, spooled envelopes are resent one by one
+        _probing = !_spool.empty();
+    }
+
+    _thread = std::thread(&MessageBatcher::run, this);
+    return true;
+}
+
+bool MessageBatcher::add(std::string_view message) {
+    std::unique_lock<std::mutex> send_lock(_send_mutex);
+    if (_batch_count == 0) {
+        if (_config.batch_size > 1)
+            _batch = '[';
+        if (_config.linger.count()) {
+            {
+                std::lock_guard<std::mutex> lock(_mutex);
+                _batch_deadline = Clock::now() + _config.linger;
+            }
+            _wake.notify_one();
+        }
+    } else {
+        _batch += ',';
+    }
+    _batch.append(message);
+    _batch_count++;
+
+    if (_batch_count < _config.batch_size && _batch.size() < _config.batch_bytes)
+        return true;
+    return dispatch(take_batch(), true);
+}
+
+bool MessageBatcher::flush() {
+    std::unique_lock<std::mutex> send_lock(_send_mutex);
+    return dispatch(take_batch(), true);
+}
+
+void MessageBatcher::delivered(uint64_t id, bool success) {
+    std::shared_ptr<Envelope> envelope;
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        auto it = _in_flight.find(id);
+        if (it == _in_flight.end())
+            return;
+        envelope = std::move(it->second);
+        _in_flight.erase(it);
+        if (success) {
+            _stats.delivered++;
+            // broker is back, spool can be drained at full speed
+            _probing = false;
+            _retry_interval = _config.retry_interval;
+            _retry_at = Clock::now();
+        }
+    }
+    _slot_freed.notify_all();
+    _wake.notify_one();
+
+    if (!success) {
+        fail(envelope);
+    } else if (envelope->spool_seq) {
+        std::error_code ec;
+        fs::remove(spool_path(envelope->spool_seq), ec);
+        std::lock_guard<std::mutex> lock(_mutex);
+        _spool_in_flight--;
+        _spool_bytes -= envelope->payload.size();
+    }
+}
+
+bool MessageBatcher::stop(std::chrono::milliseconds timeout) {
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _draining = true;
+    }
+    _slot_freed.notify_all();
+
+    bool ok;
+    {
+        std::unique_lock<std::mutex> send_lock(_send_mutex);
+        ok = dispatch(take_batch(), false);
+    }
+
+    const auto deadline = Clock::now() + timeout;
+    std::unique_lock<std::mutex> lock(_mutex);
+    while (!_in_flight.empty() && Clock::now() < deadline) {
+        lock.unlock();
+        _sink.poll();
+        lock.lock();
+        _slot_freed.wait_until(lock, std::min(deadline, Clock::now() + POLL_INTERVAL),
+                               [this] { return _in_flight.empty(); });
+    }
+    _stop = true;
+    lock.unlock();
+    _wake.notify_one();
+    if (_thread.joinable())
+        _thread.join();
+
+    // Envelopes without report are kept, even if the report is on the way
+    lock.lock();
+    auto in_flight = std::move(_in_flight);
+    _in_flight.clear();
+    lock.unlock();
+    for (auto &item : in_flight) {
+        if (_config.spool_dir.empty()) {
+            std::lock_guard<std::mutex> stats_lock(_mutex);
+            _stats.failed++;
+        } else if (item.second->spool_seq) {
+            std::lock_guard<std::mutex> spool_lock(_mutex);
+            _spool_in_flight--;
+        } else {
+            spool(item.second);
+        }
+    }
+    return ok;
+}
+
+MessageBatcherStats MessageBatcher::stats() const {
+    std::lock_guard<std::mutex> lock(_mutex);
+    return _stats;
+}
+
+std::string MessageBatcher::error() const {
+    std::lock_guard<std::mutex> lock(_mutex);
+    return _error;
+}
+
+std::shared_ptr<MessageBatcher::Envelope> MessageBatcher::take_batch() {
+    if (_batch_count == 0)
+        return nullptr;
+    if (_config.batch_size > 1)
+        _batch += ']';
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _batch_deadline = Clock::time_point::max();
+    }
+
+    auto envelope = std::make_shared<Envelope>();
+    if (_config.compression == EnvelopeCompression::Gzip) {
+        // deflate into buffer of deflateBound() size fails only if zlib can't allocate its state
+        if (!gzip(_batch, envelope->payload))
+            throw std::bad_alloc();
+    } else {
+        envelope->payload = std::move(_batch);
+    }
+    _batch.clear();
+    _batch_count = 0;
+    return envelope;
+}
+
+bool MessageBatcher::dispatch(std::shared_ptr<Envelope> envelope, bool wait_for_slot) {
+    if (!envelope)
+        return true;
+    if (!_config.spool_dir.empty()) {
+        std::unique_lock<std::mutex> lock(_mutex);
+        // Envelopes go after spooled ones, so that order is kept while the broker is unavailable
+        if (_spool_bytes) {
+            lock.unlock();
+            spool(envelope);
+            return true;
+        }
+    }
+    return send(std::move(envelope), wait_for_slot);
+}
+
+bool MessageBatcher::send(std::shared_ptr<Envelope> envelope, bool wait_for_slot) {
+    std::unique_lock<std::mutex> lock(_mutex);
+    if (wait_for_slot)
+        _slot_freed.wait(lock, [this] { return _draining || _stop || has_slot(); });
+    const uint64_t id = ++_next_id;
+    _in_flight.emplace(id, envelope);
+    _stats.sent++;
+    // background thread starts serving delivery reports
+    const bool first_in_flight = _in_flight.size() == 1;
+    lock.unlock();
+    if (first_in_flight)
+        _wake.notify_one();
+
+    if (_sink.send(id, envelope->payload))
+        return true;
+
+    lock.lock();
+    _in_flight.erase(id);
+    lock.unlock();
+    _slot_freed.notify_all();
+    return fail(envelope);
+}
+
+bool MessageBatcher::fail(const std::shared_ptr<Envelope> &envelope) {
+    std::unique_lock<std::mutex> lock(_mutex);
+    if (_config.spool_dir.empty()) {
+        _stats.failed++;
+        return false;
+    }
+
+    // Resend after retry interval, which grows while the broker keeps failing
+    if (_probing)
+        _retry_interval = std::min(2 * _retry_interval, std::max(_config.max_retry_interval, _config.retry_interval));
+    else
+        _retry_interval = _config.retry_interval;
+    _probing = true;
+    _retry_at = Clock::now() + _retry_interval;
+
+    if (envelope->spool_seq) {
+        _spool_in_flight--;
+        _spool.emplace(envelope->spool_seq, envelope->payload.size());
+        return true;
+    }
+    lock.unlock();
+    spool(envelope);
+    return true;
+}
+
+void MessageBatcher::spool(const std::shared_ptr<Envelope> &envelope) {
+    const size_t size = envelope->payload.size();
+    uint64_t seq;
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        if (_spool_bytes + size > _config.max_spool_size) {
+            _stats.dropped++;
+            return;
+        }
+        // reserved before writing, so that concurrent envelopes see the spool busy
+        _spool_bytes += size;
+        seq = _next_spool_seq++;
+    }
+
+    const std::string path = spool_path(seq);
+    const bool written = write_file(path, envelope->payload);
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        if (!written) {
+            _spool_bytes -= size;
+            _stats.dropped++;
+            _error = "Error writing spool file " + path;
+            return;
+        }
+        _spool.emplace(seq, size);
+        _stats.spooled++;
+    }
+    _wake.notify_one();
+}
+
+void MessageBatcher::resend_spooled() {
+    std::unique_lock<std::mutex> send_lock(_send_mutex, std::try_to_lock);
+    if (!send_lock.owns_lock())
+        return;
+
+    while (true) {
+        uint64_t seq;
+        size_t size;
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            if (!can_resend(Clock::now()))
+                return;
+            seq = _spool.begin()->first;
+            size = _spool.begin()->second;
+            _spool.erase(_spool.begin());
+            _spool_in_flight++;
+        }
+
+        auto envelope = std::make_shared<Envelope>();
+        envelope->spool_seq = seq;
+        if (!read_file(spool_path(seq), envelope->payload)) {
+            std::error_code ec;
+            fs::remove(spool_path(seq), ec);
+            std::lock_guard<std::mutex> lock(_mutex);
+            _spool_in_flight--;
+            _spool_bytes -= size;
+            _stats.dropped++;
+            _error = "Error reading spool file " + spool_path(seq);
+            continue;
+        }
+        send(std::move(envelope), false);
+    }
+}
+
+bool MessageBatcher::can_resend(Clock::time_point now) const {
+    return !_stop && !_spool.empty() && now >= _retry_at && has_slot() && !(_probing && _spool_in_flight);
+}
+
+// Reports matter to the batcher only if they free slots or spool, otherwise they are served by the sink on its own
+bool MessageBatcher::polls_reports() const {
+    return !_in_flight.empty() && (_config.max_in_flight || !_config.spool_dir.empty());
+}
+
+bool MessageBatcher::has_slot() const {
+    return !_config.max_in_flight || _in_flight.size() < _config.max_in_flight;
+}
+
+void MessageBatcher::run() {
+    std::unique_lock<std::mutex> lock(_mutex);
+    while (!_stop) {
+        auto deadline = Clock::time_point::max();
+        // lingering envelope waits for a free slot, polled below, rather than exceed the limit
+        if (has_slot())
+            deadline = _batch_deadline;
+        if (!_spool.empty() && has_slot() && !(_probing && _spool_in_flight))
+            deadline = std::min(deadline, _retry_at);
+        if (polls_reports())
+            deadline = std::min(deadline, Clock::now() + POLL_INTERVAL);
+        if (deadline == Clock::time_point::max())
+            _wake.wait(lock);
+        else
+            _wake.wait_until(lock, deadline);
+        if (_stop)
+            break;
+
+        const auto now = Clock::now();
+        const bool poll = polls_reports();
+        const bool linger_due = now >= _batch_deadline && has_slot();
+        const bool resend_due = can_resend(now);
+        lock.unlock();
+
+        if (poll)
+            _sink.poll();
+        if (linger_due) {
+            // the thread adding a message sends the envelope itself if it holds the lock
+            std::unique_lock<std::mutex> send_lock(_send_mutex, std::try_to_lock);
+            if (send_lock.owns_lock())
+                dispatch(take_batch(), false);
+        }
+        if (resend_due)
+            resend_spooled();
+
+        lock.lock();
+    }
+}
+
+std::string MessageBatcher::spool_path(uint64_t seq) const {
+    char name[32];
+    snprintf(name, sizeof(name), "%020llu", static_cast<unsigned long long>(seq));
+    return (fs::path(_config.spool_dir) / (std::string(name) + SPOOL_FILE_EXTENSION)).string();
+}
@@ -0,0 +1,186 @@
+/*******************************************************************************
+ * Copyright (C) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+#pragma once
+
+#include "gvametapublish_export.h"
+
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <thread>
+
+enum class EnvelopeCompression {
+    None,
+    Gzip // payload is a gzip stream (RFC 1952)
+};
+
+struct MessageBatcherConfig {
+    // messages per envelope, 1 sends every message as it is
+    size_t batch_size = 1;
+    // envelope is sent once its messages reach this size
+    size_t batch_bytes = 512 * 1024;
+    // partial envelope is sent this long after its first message, 0 waits until it's complete
+    std::chrono::milliseconds linger{100};
+    EnvelopeCompression compression = EnvelopeCompression::None;
+    // envelopes sent and waiting for delivery report, 0 is unlimited
+    size_t max_in_flight = 0;
+    // directory for envelopes the broker did not take, empty disables spool
+    std::string spool_dir;
+    // envelopes which don't fit into spool are dropped
+    size_t max_spool_size = 64 * 1024 * 1024;
+    // first retry of spooled envelopes, doubled on each failure up to max_retry_interval
+    std::chrono::milliseconds retry_interval{1000};
+    std::chrono::milliseconds max_retry_interval{30000};
+};
+
+struct MessageBatcherStats {
+    size_t sent = 0;      // envelopes handed to the sink, retries included
+    size_t delivered = 0; // envelopes reported as delivered
+    size_t failed = 0;    // envelopes lost because the sink rejected them or reported failure and spool is disabled
+    size_t spooled = 0;   // envelopes written to spool
+    size_t dropped = 0;   // envelopes lost because spool is full or can't be written
+};
+
+/**
+ * @brief Destination of envelopes, implemented by broker specific publishers
+ */
+class EnvelopeSink {
+  public:
+    virtual ~EnvelopeSink() = default;
+
+    /**
+     * @brief Hand envelope to the client. Outcome is reported with MessageBatcher::delivered(id, ...) from any thread,
+     * including from within send() or poll().
+     * @return false if the client rejected the envelope, no report is expected then
+     */
+    virtual bool send(uint64_t id, const std::string &payload) = 0;
+
+    /**
+     * @brief Serve delivery reports, for clients which deliver them only when polled. Called by the background thread
+     * while envelopes are in flight, if in-flight limit or spool is enabled.
+     */
+    virtual void poll() {
+    }
+};
+
+/**
+ * @brief Groups messages into envelopes and sends them to EnvelopeSink, keeping envelopes the broker didn't take
+ *
+ * With batch_size 1 every message is an envelope of its own, otherwise an envelope is a JSON array of messages, sent
+ * when it holds batch_size messages, reaches batch_bytes or lingers for linger time. Envelopes are sent on the thread
+ * calling add(), so that the caller learns about rejected envelopes, or by a background thread for lingering ones.
+ * When max_in_flight envelopes wait for delivery report, add() waits for one to complete.
+ *
+ * With spool enabled, rejected and failed envelopes are written to spool_dir, one file per envelope, and resent
+ * oldest first by the background thread. While spool is not empty, new envelopes are spooled too, so they keep their
+ * order. Spooled envelopes are resent one at a time until one is delivered, with retry interval doubled on each
+ * failure. Spool outlives the batcher, envelopes spooled by an earlier run are resent after start().
+ * An envelope is removed from spool when it's reported as delivered, so delivery is at least once.
+ */
+class GVAMETAPUBLISH_EXPORTS MessageBatcher {
+  public:
+    MessageBatcher(MessageBatcherConfig config, EnvelopeSink &sink);
+
+    /**
+     * @brief Stops the background thread. Unlike stop(), the current envelope and envelopes waiting for report are
+     * discarded, as the sink is commonly the owner being destroyed.
+     */
+    ~MessageBatcher();
+
+    MessageBatcher(const MessageBatcher &) = delete;
+    MessageBatcher &operator=(const MessageBatcher &) = delete;
+
+    /**
+     * @brief Load spool of an earlier run and start the background thread
+     * @return false if spool directory can't be created, see error()
+     */
+    bool start();
+
+    /**
+     * @brief Add message to the current envelope and send the envelope if it's complete
+     * @return false if the sink rejected the envelope and it can't be spooled
+     */
+    bool add(std::string_view message);
+
+    /**
+     * @brief Send the current envelope, regardless of its size
+     * @return false if the sink rejected the envelope and it can't be spooled
+     */
+    bool flush();
+
+    /**
+     * @brief Delivery report for envelope passed to EnvelopeSink::send. Reports of unknown envelopes are ignored.
+     */
+    void delivered(uint64_t id, bool success);
+
+    /**
+     * @brief Send the current envelope, wait up to timeout for delivery reports and stop the background thread.
+     * Envelopes still waiting for report are spooled.
+     * @return false if the last envelope was rejected and can't be spooled
+     */
+    bool stop(std::chrono::milliseconds timeout = std::chrono::milliseconds(0));
+
+    MessageBatcherStats stats() const;
+
+    std::string error() const;
+
+  private:
+    using Clock = std::chrono::steady_clock;
+
+    struct Envelope {
+        std::string payload;
+        uint64_t spool_seq = 0; // spool file holding the payload, 0 if it's not spooled
+    };
+
+    std::shared_ptr<Envelope> take_batch();
+    bool dispatch(std::shared_ptr<Envelope> envelope, bool wait_for_slot);
+    bool send(std::shared_ptr<Envelope> envelope, bool wait_for_slot);
+    bool fail(const std::shared_ptr<Envelope> &envelope);
+    void spool(const std::shared_ptr<Envelope> &envelope);
+    void resend_spooled();
+    bool can_resend(Clock::time_point now) const;
+    bool has_slot() const;
+    bool polls_reports() const;
+    void run();
+
+    std::string spool_path(uint64_t seq) const;
+
+    const MessageBatcherConfig _config;
+    EnvelopeSink &_sink;
+
+    // serializes sending, taken before _mutex
+    std::mutex _send_mutex;
+    std::string _batch;
+    size_t _batch_count = 0;
+
+    mutable std::mutex _mutex;
+    std::condition_variable _wake;
+    std::condition_variable _slot_freed;
+    std::thread _thread;
+    Clock::time_point _batch_deadline = Clock::time_point::max(); // when the current envelope is sent by the thread
+    bool _stop = false;
+    bool _draining = false;
+    std::string _error;
+
+    uint64_t _next_id = 0;
+    std::map<uint64_t, std::shared_ptr<Envelope>> _in_flight; // by id, so that they are spooled in order
+
+    std::map<uint64_t, size_t> _spool; // size of spooled envelopes waiting to be resent, by sequence number
+    size_t _spool_bytes = 0;           // of all spool files, including ones being resent
+    size_t _spool_in_flight = 0;
+    uint64_t _next_spool_seq = 1;
+    Clock::time_point _retry_at;
+    std::chrono::milliseconds _retry_interval;
+    bool _probing = false; // resend one spooled envelope at a time until a delivery succeeds
+
+    MessageBatcherStats _stats;
+};
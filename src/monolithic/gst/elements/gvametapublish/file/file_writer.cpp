@@ -0,0 +1,263 @@
+/*******************************************************************************
+ * Copyright (C) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+#include "file_writer.hpp"
+
+#include <algorithm>
+#include <filesystem>
+#include <system_error>
+
+#include <zlib.h>
+
+namespace {
+
+constexpr auto STDOUT_PATH = "stdout";
+constexpr auto JSON_RECORD_PREFIX = ",\n";
+constexpr size_t GZIP_CHUNK_SIZE = 64 * 1024;
+
+// Compresses path to path.gz and removes path
+bool gzip_file(const std::string &path) {
+    const std::string gz_path = path + ".gz";
+    FILE *in = fopen(path.c_str(), "rb");
+    if (!in)
+        return false;
+    gzFile out = gzopen(gz_path.c_str(), "wb");
+    if (!out) {
+        fclose(in);
+        return false;
+    }
+
+    std::vector<char> chunk(GZIP_CHUNK_SIZE);
+    bool ok = true;
+    size_t size;
+    while (ok && (size = fread(chunk.data(), 1, chunk.size(), in)) > 0)
+        ok = gzwrite(out, chunk.data(), static_cast<unsigned>(size)) == static_cast<int>(size);
+    ok = !ferror(in) && ok;
+    fclose(in);
+    ok = gzclose(out) == Z_OK && ok;
+
+    std::remove(ok ? path.c_str() : gz_path.c_str());
+    return ok;
+}
+
+} // namespace
+
+FileWriter::FileWriter(FileWriterConfig config) : _config(std::move(config)), _stdout(_config.path == STDOUT_PATH) {
+}
+
+FileWriter::~FileWriter() {
+    close();
+}
+
+bool FileWriter::open() {
+    if (!open_segment())
+        return false;
+    _thread = std::thread(&FileWriter::run, this);
+    return true;
+}
+
+bool FileWriter::write(std::string message) {
+    {
+        std::unique_lock<std::mutex> lock(_mutex);
+        const size_t max_queue_size = std::max<size_t>(_config.max_queue_size, 1);
+        if (_config.overflow_policy == FileWriterOverflowPolicy::Block) {
+            _queue_space.wait(lock, [&] { return _failed || _stop || _queue.size() < max_queue_size; });
+        } else if (_queue.size() >= max_queue_size) {
+            _dropped++;
+            return !_failed;
+        }
+        if (_failed || _stop)
+            return false;
+        _queue.push_back(std::move(message));
+    }
+    _queue_ready.notify_one();
+    return true;
+}
+
+bool FileWriter::close() {
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _stop = true;
+    }
+    _queue_ready.notify_one();
+    _queue_space.notify_all();
+    if (_thread.joinable())
+        _thread.join();
+
+    std::lock_guard<std::mutex> lock(_mutex);
+    return !_failed;
+}
+
+size_t FileWriter::dropped() const {
+    std::lock_guard<std::mutex> lock(_mutex);
+    return _dropped;
+}
+
+std::string FileWriter::error() const {
+    std::lock_guard<std::mutex> lock(_mutex);
+    return _error;
+}
+
+void FileWriter::run() {
+    std::vector<std::string> batch;
+    bool ok = true;
+    bool stop = false;
+    while (!stop) {
+        {
+            std::unique_lock<std::mutex> lock(_mutex);
+            auto ready = [this] { return _stop || !_queue.empty(); };
+            const auto deadline = ok ? next_deadline() : Clock::time_point::max();
+            if (deadline == Clock::time_point::max())
+                _queue_ready.wait(lock, ready);
+            else
+                _queue_ready.wait_until(lock, deadline, ready);
+            batch.swap(_queue);
+            stop = _stop;
+        }
+        _queue_space.notify_all();
+
+        // after a failure, messages are discarded so that nobody waits for the queue
+        for (const auto &message : batch) {
+            if (ok)
+                ok = append(message);
+        }
+        batch.clear();
+
+        if (ok && due(Clock::now()))
+            ok = flush();
+        if (ok && _config.rotation_interval.count() && !_stdout && _segment_records &&
+            Clock::now() >= _segment_opened + _config.rotation_interval)
+            ok = rotate();
+    }
+
+    if (ok)
+        close_segment();
+    else if (_file && !_stdout)
+        fclose(_file);
+    _file = nullptr;
+}
+
+bool FileWriter::open_segment() {
+    _segment_records = 0;
+    _segment_bytes = 0;
+    _segment_opened = _last_flush = Clock::now();
+    if (_stdout) {
+        _file = stdout;
+        return true;
+    }
+
+    // JSON Lines are appended to existing file, JSON array can't be continued
+    if (!(_file = fopen(_config.path.c_str(), _config.json_array ? "w" : "a"))) {
+        fail("Error opening file " + _config.path);
+        return false;
+    }
+    if (_config.json_array) {
+        // File will be an array of JSON objects. Start the array with '['
+        _buffer += "[";
+    } else {
+        std::error_code ec;
+        const auto size = std::filesystem::file_size(_config.path, ec);
+        _segment_bytes = ec ? 0 : static_cast<size_t>(size);
+    }
+    return true;
+}
+
+bool FileWriter::close_segment() {
+    if (_config.json_array && !_stdout)
+        _buffer += "]\n";
+    if (!flush())
+        return false;
+    if (!_stdout && fclose(_file) != 0) {
+        _file = nullptr;
+        fail("Error closing file " + _config.path);
+        return false;
+    }
+    _file = nullptr;
+    return true;
+}
+
+bool FileWriter::rotate() {
+    if (!close_segment())
+        return false;
+
+    namespace fs = std::filesystem;
+    std::string segment_path;
+    std::error_code ec;
+    do {
+        segment_path = _config.path + "." + std::to_string(++_segment_index);
+    } while (fs::exists(segment_path, ec) || fs::exists(segment_path + ".gz", ec));
+
+    fs::rename(_config.path, segment_path, ec);
+    if (ec) {
+        fail("Error renaming file " + _config.path + " to " + segment_path + ": " + ec.message());
+        return false;
+    }
+    if (_config.compress_rotated && !gzip_file(segment_path)) {
+        fail("Error compressing file " + segment_path);
+        return false;
+    }
+    return open_segment();
+}
+
+bool FileWriter::append(const std::string &message) {
+    // with record separator or line feed, and closing bracket of JSON array
+    const size_t record_size = message.size() + (_config.json_array ? 4 : 1);
+    if (_config.max_file_size && !_stdout && _segment_records &&
+        _segment_bytes + _buffer.size() + record_size > _config.max_file_size) {
+        if (!rotate())
+            return false;
+    }
+
+    if (_config.json_array) {
+        // a prior record was written, precede this message with record separator
+        if (_segment_records)
+            _buffer += JSON_RECORD_PREFIX;
+        _buffer += message;
+    } else {
+        _buffer += message;
+        _buffer += '\n';
+    }
+    _segment_records++;
+
+    if (_buffer.size() >= _config.flush_size)
+        return flush();
+    return true;
+}
+
+bool FileWriter::flush() {
+    _last_flush = Clock::now();
+    if (_buffer.empty())
+        return true;
+    if (fwrite(_buffer.data(), 1, _buffer.size(), _file) != _buffer.size() || fflush(_file) != 0) {
+        fail("Error writing to file " + _config.path);
+        return false;
+    }
+    _segment_bytes += _buffer.size();
+    _buffer.clear();
+    return true;
+}
+
+bool FileWriter::due(Clock::time_point now) const {
+    return !_buffer.empty() && now >= _last_flush + _config.flush_interval;
+}
+
+FileWriter::Clock::time_point FileWriter::next_deadline() const {
+    auto deadline = Clock::time_point::max();
+    if (!_buffer.empty())
+        deadline = _last_flush + _config.flush_interval;
+    if (_config.rotation_interval.count() && !_stdout && _segment_records)
+        deadline = std::min(deadline, _segment_opened + _config.rotation_interval);
+    return deadline;
+}
+
+void FileWriter::fail(const std::string &error) {
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _failed = true;
+        _error = error;
+    }
+    _queue_space.notify_all();
+}
@@ -0,0 +1,117 @@
+/*******************************************************************************
+ * Copyright (C) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+#pragma once
+
+#include <chrono>
+#include <condition_variable>
+#include <cstdio>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+/**
+ * @brief What FileWriter::write does when max_queue_size messages already wait for the writer thread
+ */
+enum class FileWriterOverflowPolicy {
+    Block, // wait until the writer thread takes queued messages
+    Drop   // discard the new message
+};
+
+struct FileWriterConfig {
+    std::string path;       // output file, "stdout" for standard output
+    bool json_array = true; // file is a JSON array of records, otherwise JSON Lines appended to existing file
+    size_t max_queue_size = 1024;
+    FileWriterOverflowPolicy overflow_policy = FileWriterOverflowPolicy::Block;
+    std::chrono::milliseconds flush_interval{0}; // 0 writes out queued messages as soon as the queue is drained
+    size_t flush_size = 64 * 1024;               // bytes buffered before they are written regardless of interval
+    size_t max_file_size = 0;                    // rotate file when it would grow past this size, 0 disables
+    std::chrono::seconds rotation_interval{0};   // rotate file opened this long ago, 0 disables
+    bool compress_rotated = false;               // gzip closed segments
+};
+
+/**
+ * @brief Writes messages to a file on a background thread
+ *
+ * Messages are queued by write() and appended by the writer thread, which coalesces them in a buffer written out
+ * by flush_size bytes or flush_interval, whatever comes first. When rotation is enabled, the closed segment is renamed
+ * to <path>.<N> (and compressed to <path>.<N>.gz) and a new file is started at path, so each segment is a valid
+ * JSON array or JSON Lines file. Compression runs on the writer thread, so it delays messages queued meanwhile.
+ */
+class FileWriter {
+  public:
+    explicit FileWriter(FileWriterConfig config);
+
+    /**
+     * @brief Stops the writer as close() does
+     */
+    ~FileWriter();
+
+    FileWriter(const FileWriter &) = delete;
+    FileWriter &operator=(const FileWriter &) = delete;
+
+    /**
+     * @brief Open the output file and start the writer thread
+     * @return false if the file cannot be opened, see error()
+     */
+    bool open();
+
+    /**
+     * @brief Queue a message. Depending on overflow policy, waits for space in the queue or drops the message.
+     * @return false if the writer failed, see error()
+     */
+    bool write(std::string message);
+
+    /**
+     * @brief Write out all queued messages, finalize and close the file and stop the writer thread
+     * @return false if the writer failed, see error()
+     */
+    bool close();
+
+    /**
+     * @brief Number of messages discarded by Drop overflow policy
+     */
+    size_t dropped() const;
+
+    std::string error() const;
+
+  private:
+    using Clock = std::chrono::steady_clock;
+
+    void run();
+    bool open_segment();
+    bool close_segment();
+    bool rotate();
+    bool append(const std::string &message);
+    bool flush();
+    bool due(Clock::time_point now) const;
+    Clock::time_point next_deadline() const;
+    void fail(const std::string &error);
+
+    const FileWriterConfig _config;
+    const bool _stdout;
+
+    mutable std::mutex _mutex;
+    std::condition_variable _queue_ready;
+    std::condition_variable _queue_space;
+    std::vector<std::string> _queue;
+    bool _stop = false;
+    bool _failed = false;
+    size_t _dropped = 0;
+    std::string _error;
+
+    // Owned by the writer thread once started
+    FILE *_file = nullptr;
+    std::string _buffer;
+    size_t _segment_records = 0;
+    size_t _segment_bytes = 0;
+    unsigned _segment_index = 0;
+    Clock::time_point _segment_opened;
+    Clock::time_point _last_flush;
+
+    std::thread _thread;
+};
@@ -1,103 +1,36 @@
 /*******************************************************************************
- * Copyright (C) 2018-2025 Intel Corporation
+ * Copyright (C) 2018-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  ******************************************************************************/
 
 #include "gvametapublishfile.hpp"
+#include "file_writer.hpp"
 
 #include <common.hpp>
 
-#include <stdio.h>
+#include <memory>
 #include <string>
-
-#ifdef _MSC_VER
-// MSVC alternative for gcc ftello
-#define ftello _ftelli64
-#endif
+#include <string_view>
 
 GST_DEBUG_CATEGORY_STATIC(gva_meta_publish_file_debug_category);
 #define GST_CAT_DEFAULT gva_meta_publish_file_debug_category
 
-namespace {
-
-constexpr auto JSON_RECORD_PREFIX = ",\n";
-constexpr auto JSON_LINES_RECORD_SUFFIX = "\n";
-
-} // namespace
-
 /* Properties */
 enum {
     PROP_0,
     PROP_FILE_PATH,
     PROP_FILE_FORMAT,
+    PROP_MAX_QUEUE_SIZE,
+    PROP_OVERFLOW_POLICY,
+    PROP_FLUSH_INTERVAL,
+    PROP_FLUSH_SIZE,
+    PROP_MAX_FILE_SIZE,
+    PROP_ROTATION_INTERVAL,
+    PROP_COMPRESS_ROTATED,
 };
 
 class GvaMetaPublishFilePrivate {
-  private:
-    void write_message_prefix() {
-        // Add comma and line feed before the record when producing a JSON
-        if (_file_format == GVA_META_PUBLISH_JSON) {
-            if (ftello(_output_file) > 2) {
-                // a prior record was written, precede this message with record separator
-                fputs(JSON_RECORD_PREFIX, _output_file);
-            }
-        }
-    }
-
-    void write_message_suffix() {
-        // Add line feed after each record when producing a JSON Lines file/FIFO
-        if (_file_format == GVA_META_PUBLISH_JSON_LINES) {
-            fputs(JSON_LINES_RECORD_SUFFIX, _output_file);
-        }
-    }
-
-    bool write_message(const std::string &message) {
-        if (!_output_file)
-            return false;
-        write_message_prefix();
-        fputs(message.c_str(), _output_file);
-        write_message_suffix();
-        fflush(_output_file);
-        return true;
-    }
-
-    bool finalize_file() {
-        if (!_output_file) {
-            return false;
-        }
-        if (_file_format == GVA_META_PUBLISH_JSON && ftello(_output_file) > 0) {
-            fputs("]", _output_file);
-        }
-        fputs("\n", _output_file);
-        // For any pathfile we initialized w/ fopen(), invoke corresponding fclose()
-        if (_file_path != STDOUT) {
-            if (fclose(_output_file) != 0) {
-                return false;
-            }
-        }
-        return true;
-    }
-
-    bool initialize_file() {
-        if (_file_path == STDOUT) {
-            _output_file = stdout;
-            return true;
-        }
-        if (_file_format == GVA_META_PUBLISH_JSON) {
-            if (!(_output_file = fopen(_file_path.c_str(), "w+"))) {
-                return false;
-            }
-            // File will be an array of JSON objects. Start the array with '['
-            fputs("[", _output_file);
-        } else { // GVA_META_PUBLISH_JSON_LINES
-            if (!(_output_file = fopen(_file_path.c_str(), "a+"))) {
-                return false;
-            }
-        }
-        return true;
-    }
-
   public:
     GvaMetaPublishFilePrivate(GvaMetaPublishBase *base) : _base(base) {
     }
@@ -109,29 +42,53 @@ class GvaMetaPublishFilePrivate {
             GST_ELEMENT_ERROR(_base, RESOURCE, NOT_FOUND, ("file_path cannot be NULL."), (NULL));
             return false;
         }
-        if (!initialize_file()) {
-            GST_ELEMENT_ERROR(_base, RESOURCE, NOT_FOUND, ("Error opening file %s.", _file_path.c_str()), (nullptr));
+
+        FileWriterConfig config;
+        config.path = _file_path;
+        config.json_array = _file_format == GVA_META_PUBLISH_JSON;
+        config.max_queue_size = _max_queue_size;
+        config.overflow_policy = _overflow_policy == GVA_META_PUBLISH_OVERFLOW_DROP ? FileWriterOverflowPolicy::Drop
+                                                                                     : FileWriterOverflowPolicy::Block;
+        config.flush_interval = std::chrono::milliseconds(_flush_interval);
+        config.flush_size = _flush_size;
+        config.max_file_size = _max_file_size;
+        config.rotation_interval = std::chrono::seconds(_rotation_interval);
+        config.compress_rotated = _compress_rotated;
+
+        _writer = std::make_unique<FileWriter>(std::move(config));
+        if (!_writer->open()) {
+            GST_ELEMENT_ERROR(_base, RESOURCE, NOT_FOUND, ("Error opening file %s.", _file_path.c_str()),
+                              ("%s", _writer->error().c_str()));
+            _writer.reset();
             return false;
         }
         return true;
     }
 
     gboolean stop() {
-        if (!finalize_file()) {
-            GST_ERROR_OBJECT(_base, "Error finalizing file.");
+        if (!_writer)
+            return false;
+        const bool closed = _writer->close();
+        if (_writer->dropped())
+            GST_WARNING_OBJECT(_base, "%zu messages were dropped because the queue was full", _writer->dropped());
+        if (!closed) {
+            GST_ERROR_OBJECT(_base, "Error finalizing file: %s", _writer->error().c_str());
+            _writer.reset();
             return false;
         }
+        _writer.reset();
         GST_DEBUG_OBJECT(_base, "File finalized successfully.");
         return true;
     }
 
-    gboolean publish(const std::string &message) {
-        if (!write_message(message)) {
-            GST_ERROR_OBJECT(_base, "Error writing inference to file.");
+    gboolean publish(std::string_view message) {
+        if (!_writer || !_writer->write(std::string(message))) {
+            GST_ERROR_OBJECT(_base, "Error writing inference to file: %s",
+                             _writer ? _writer->error().c_str() : "file is not open");
             return false;
         }
 
-        GST_DEBUG_OBJECT(_base, "Message was written successfully.");
+        GST_DEBUG_OBJECT(_base, "Message was queued successfully.");
 
         return true;
     }
@@ -144,6 +101,27 @@ class GvaMetaPublishFilePrivate {
         case PROP_FILE_FORMAT:
             g_value_set_enum(value, _file_format);
             break;
+        case PROP_MAX_QUEUE_SIZE:
+            g_value_set_uint(value, _max_queue_size);
+            break;
+        case PROP_OVERFLOW_POLICY:
+            g_value_set_enum(value, _overflow_policy);
+            break;
+        case PROP_FLUSH_INTERVAL:
+            g_value_set_uint(value, _flush_interval);
+            break;
+        case PROP_FLUSH_SIZE:
+            g_value_set_uint(value, _flush_size);
+            break;
+        case PROP_MAX_FILE_SIZE:
+            g_value_set_uint64(value, _max_file_size);
+            break;
+        case PROP_ROTATION_INTERVAL:
+            g_value_set_uint(value, _rotation_interval);
+            break;
+        case PROP_COMPRESS_ROTATED:
+            g_value_set_boolean(value, _compress_rotated);
+            break;
         default:
             return false;
         }
@@ -158,6 +136,27 @@ class GvaMetaPublishFilePrivate {
         case PROP_FILE_FORMAT:
             _file_format = static_cast<FileFormat>(g_value_get_enum(value));
             break;
+        case PROP_MAX_QUEUE_SIZE:
+            _max_queue_size = g_value_get_uint(value);
+            break;
+        case PROP_OVERFLOW_POLICY:
+            _overflow_policy = static_cast<OverflowPolicy>(g_value_get_enum(value));
+            break;
+        case PROP_FLUSH_INTERVAL:
+            _flush_interval = g_value_get_uint(value);
+            break;
+        case PROP_FLUSH_SIZE:
+            _flush_size = g_value_get_uint(value);
+            break;
+        case PROP_MAX_FILE_SIZE:
+            _max_file_size = g_value_get_uint64(value);
+            break;
+        case PROP_ROTATION_INTERVAL:
+            _rotation_interval = g_value_get_uint(value);
+            break;
+        case PROP_COMPRESS_ROTATED:
+            _compress_rotated = g_value_get_boolean(value);
+            break;
         default:
             return false;
         }
@@ -169,7 +168,14 @@ class GvaMetaPublishFilePrivate {
 
     std::string _file_path;
     FileFormat _file_format = GVA_META_PUBLISH_JSON;
-    FILE *_output_file = nullptr;
+    guint _max_queue_size = DEFAULT_MAX_QUEUE_SIZE;
+    OverflowPolicy _overflow_policy = DEFAULT_OVERFLOW_POLICY;
+    guint _flush_interval = DEFAULT_FLUSH_INTERVAL;
+    guint _flush_size = DEFAULT_FLUSH_SIZE;
+    guint64 _max_file_size = DEFAULT_MAX_FILE_SIZE;
+    guint _rotation_interval = DEFAULT_ROTATION_INTERVAL;
+    bool _compress_rotated = DEFAULT_COMPRESS_ROTATED;
+    std::unique_ptr<FileWriter> _writer;
 };
 
 G_DEFINE_TYPE_EXTENDED(GvaMetaPublishFile, gva_meta_publish_file, GST_TYPE_GVA_META_PUBLISH_BASE, 0,
@@ -221,7 +227,7 @@ static void gva_meta_publish_file_class_init(GvaMetaPublishFileClass *klass) {
     base_transform_class->start = [](GstBaseTransform *base) { return GVA_META_PUBLISH_FILE(base)->impl->start(); };
     base_transform_class->stop = [](GstBaseTransform *base) { return GVA_META_PUBLISH_FILE(base)->impl->stop(); };
 
-    base_metapublish_class->publish = [](GvaMetaPublishBase *base, const std::string &message) {
+    base_metapublish_class->publish = [](GvaMetaPublishBase *base, std::string_view message) {
         return GVA_META_PUBLISH_FILE(base)->impl->publish(message);
     };
 
@@ -237,4 +243,38 @@ static void gva_meta_publish_file_class_init(GvaMetaPublishFileClass *klass) {
         gobject_class, PROP_FILE_FORMAT,
         g_param_spec_enum("file-format", "File Format", "Structure of JSON objects in the file",
                           GST_TYPE_GVA_METAPUBLISH_FILE_FORMAT, DEFAULT_FILE_FORMAT, prm_flags));
+    g_object_class_install_property(gobject_class, PROP_MAX_QUEUE_SIZE,
+                                    g_param_spec_uint("max-queue-size", "Max Queue Size",
+                                                      "Maximum number of messages waiting to be written to the file",
+                                                      1, G_MAXUINT, DEFAULT_MAX_QUEUE_SIZE, prm_flags));
+    g_object_class_install_property(
+        gobject_class, PROP_OVERFLOW_POLICY,
+        g_param_spec_enum("overflow-policy", "Overflow Policy", "What to do with a new message when the queue is full",
+                          GST_TYPE_GVA_METAPUBLISH_OVERFLOW_POLICY, DEFAULT_OVERFLOW_POLICY, prm_flags));
+    g_object_class_install_property(
+        gobject_class, PROP_FLUSH_INTERVAL,
+        g_param_spec_uint("flush-interval", "Flush Interval",
+                          "Maximum time in milliseconds messages are buffered before they are written to the file. "
+                          "0 writes them as soon as no more messages are queued",
+                          0, G_MAXUINT, DEFAULT_FLUSH_INTERVAL, prm_flags));
+    g_object_class_install_property(
+        gobject_class, PROP_FLUSH_SIZE,
+        g_param_spec_uint("flush-size", "Flush Size",
+                          "Buffered size in bytes at which messages are written regardless of flush-interval",
+                          1, G_MAXUINT, DEFAULT_FLUSH_SIZE, prm_flags));
+    g_object_class_install_property(
+        gobject_class, PROP_MAX_FILE_SIZE,
+        g_param_spec_uint64("max-file-size", "Max File Size",
+                            "Size in bytes the file is rotated at. Closed file is renamed to <file-path>.<N>. "
+                            "0 disables size-based rotation",
+                            0, G_MAXUINT64, DEFAULT_MAX_FILE_SIZE, prm_flags));
+    g_object_class_install_property(
+        gobject_class, PROP_ROTATION_INTERVAL,
+        g_param_spec_uint("rotation-interval", "Rotation Interval",
+                          "Time in seconds the file is rotated after. 0 disables time-based rotation", 0, G_MAXUINT,
+                          DEFAULT_ROTATION_INTERVAL, prm_flags));
+    g_object_class_install_property(gobject_class, PROP_COMPRESS_ROTATED,
+                                    g_param_spec_boolean("compress-rotated", "Compress Rotated",
+                                                         "Compress rotated files with gzip to <file-path>.<N>.gz",
+                                                         DEFAULT_COMPRESS_ROTATED, prm_flags));
 }
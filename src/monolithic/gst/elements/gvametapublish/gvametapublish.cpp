@@ -47,6 +47,20 @@ enum {
     PROP_PASSWORD,
     PROP_JSON_CONFIG_FILE,
     PROP_SIGNAL_HANDOFFS,
+    PROP_MAX_QUEUE_SIZE,
+    PROP_OVERFLOW_POLICY,
+    PROP_FLUSH_INTERVAL,
+    PROP_FLUSH_SIZE,
+    PROP_MAX_FILE_SIZE,
+    PROP_ROTATION_INTERVAL,
+    PROP_COMPRESS_ROTATED,
+    PROP_BATCH_SIZE,
+    PROP_BATCH_BYTES,
+    PROP_BATCH_LINGER,
+    PROP_COMPRESSION,
+    PROP_MAX_IN_FLIGHT,
+    PROP_SPOOL_DIR,
+    PROP_MAX_SPOOL_SIZE,
 };
 
 class GvaMetaPublishPrivate {
@@ -101,6 +115,48 @@ class GvaMetaPublishPrivate {
         case PROP_JSON_CONFIG_FILE: // Handle JSON configuration file property
             _json_config_file = g_value_get_string(value);
             break;
+        case PROP_MAX_QUEUE_SIZE:
+            _max_queue_size = g_value_get_uint(value);
+            break;
+        case PROP_OVERFLOW_POLICY:
+            _overflow_policy = static_cast<OverflowPolicy>(g_value_get_enum(value));
+            break;
+        case PROP_FLUSH_INTERVAL:
+            _flush_interval = g_value_get_uint(value);
+            break;
+        case PROP_FLUSH_SIZE:
+            _flush_size = g_value_get_uint(value);
+            break;
+        case PROP_MAX_FILE_SIZE:
+            _max_file_size = g_value_get_uint64(value);
+            break;
+        case PROP_ROTATION_INTERVAL:
+            _rotation_interval = g_value_get_uint(value);
+            break;
+        case PROP_COMPRESS_ROTATED:
+            _compress_rotated = g_value_get_boolean(value);
+            break;
+        case PROP_BATCH_SIZE:
+            _batch_size = g_value_get_uint(value);
+            break;
+        case PROP_BATCH_BYTES:
+            _batch_bytes = g_value_get_uint(value);
+            break;
+        case PROP_BATCH_LINGER:
+            _batch_linger = g_value_get_uint(value);
+            break;
+        case PROP_COMPRESSION:
+            _compression = static_cast<CompressionType>(g_value_get_enum(value));
+            break;
+        case PROP_MAX_IN_FLIGHT:
+            _max_in_flight = g_value_get_uint(value);
+            break;
+        case PROP_SPOOL_DIR:
+            _spool_dir = g_value_get_string(value);
+            break;
+        case PROP_MAX_SPOOL_SIZE:
+            _max_spool_size = g_value_get_uint64(value);
+            break;
         default:
             G_OBJECT_WARN_INVALID_PROPERTY_ID(G_OBJECT(_base), prop_id, pspec);
             break;
@@ -142,6 +198,48 @@ class GvaMetaPublishPrivate {
         case PROP_JSON_CONFIG_FILE: // Handle JSON configuration file property
             g_value_set_string(value, _json_config_file.c_str());
             break;
+        case PROP_MAX_QUEUE_SIZE:
+            g_value_set_uint(value, _max_queue_size);
+            break;
+        case PROP_OVERFLOW_POLICY:
+            g_value_set_enum(value, _overflow_policy);
+            break;
+        case PROP_FLUSH_INTERVAL:
+            g_value_set_uint(value, _flush_interval);
+            break;
+        case PROP_FLUSH_SIZE:
+            g_value_set_uint(value, _flush_size);
+            break;
+        case PROP_MAX_FILE_SIZE:
+            g_value_set_uint64(value, _max_file_size);
+            break;
+        case PROP_ROTATION_INTERVAL:
+            g_value_set_uint(value, _rotation_interval);
+            break;
+        case PROP_COMPRESS_ROTATED:
+            g_value_set_boolean(value, _compress_rotated);
+            break;
+        case PROP_BATCH_SIZE:
+            g_value_set_uint(value, _batch_size);
+            break;
+        case PROP_BATCH_BYTES:
+            g_value_set_uint(value, _batch_bytes);
+            break;
+        case PROP_BATCH_LINGER:
+            g_value_set_uint(value, _batch_linger);
+            break;
+        case PROP_COMPRESSION:
+            g_value_set_enum(value, _compression);
+            break;
+        case PROP_MAX_IN_FLIGHT:
+            g_value_set_uint(value, _max_in_flight);
+            break;
+        case PROP_SPOOL_DIR:
+            g_value_set_string(value, _spool_dir.c_str());
+            break;
+        case PROP_MAX_SPOOL_SIZE:
+            g_value_set_uint64(value, _max_spool_size);
+            break;
         default:
             G_OBJECT_WARN_INVALID_PROPERTY_ID(G_OBJECT(_base), prop_id, pspec);
             break;
@@ -162,8 +260,12 @@ class GvaMetaPublishPrivate {
 
         switch (_method) {
         case GVA_META_PUBLISH_FILE:
-            if ((_metapublish = gst_element_factory_make("gvametapublishfile", nullptr)))
-                g_object_set(_metapublish, "file-format", _file_format, "file-path", _file_path.c_str(), nullptr);
+            if ((_metapublish = gst_element_factory_make("gvametapublishfile", nullptr))) {
+                g_object_set(_metapublish, "file-format", _file_format, "file-path", _file_path.c_str(),
+                             "max-queue-size", _max_queue_size, "overflow-policy", _overflow_policy, "flush-interval",
+                             _flush_interval, "flush-size", _flush_size, "max-file-size", _max_file_size,
+                             "rotation-interval", _rotation_interval, "compress-rotated", _compress_rotated, nullptr);
+            }
             break;
         case GVA_META_PUBLISH_MQTT:
             if ((_metapublish = gst_element_factory_make("gvametapublishmqtt", nullptr))) {
@@ -194,6 +296,10 @@ class GvaMetaPublishPrivate {
                 method_type_to_string(_method));
             return false;
         }
+        if (_method == GVA_META_PUBLISH_MQTT || _method == GVA_META_PUBLISH_KAFKA)
+            g_object_set(_metapublish, "batch-size", _batch_size, "batch-bytes", _batch_bytes, "batch-linger",
+                         _batch_linger, "compression", _compression, "max-in-flight", _max_in_flight, "spool-dir",
+                         _spool_dir.c_str(), "max-spool-size", _max_spool_size, nullptr);
         g_object_set(_metapublish, "signal-handoffs", _signal_handoffs, nullptr);
         gst_bin_add_many(GST_BIN(_base), _metapublish, nullptr);
 
@@ -229,6 +335,20 @@ class GvaMetaPublishPrivate {
     std::string _password;
     std::string _json_config_file;
     bool _signal_handoffs = false;
+    guint _max_queue_size = DEFAULT_MAX_QUEUE_SIZE;
+    OverflowPolicy _overflow_policy = DEFAULT_OVERFLOW_POLICY;
+    guint _flush_interval = DEFAULT_FLUSH_INTERVAL;
+    guint _flush_size = DEFAULT_FLUSH_SIZE;
+    guint64 _max_file_size = DEFAULT_MAX_FILE_SIZE;
+    guint _rotation_interval = DEFAULT_ROTATION_INTERVAL;
+    gboolean _compress_rotated = DEFAULT_COMPRESS_ROTATED;
+    guint _batch_size = DEFAULT_BATCH_SIZE;
+    guint _batch_bytes = DEFAULT_BATCH_BYTES;
+    guint _batch_linger = DEFAULT_BATCH_LINGER;
+    CompressionType _compression = DEFAULT_COMPRESSION;
+    guint _max_in_flight = DEFAULT_MAX_IN_FLIGHT;
+    std::string _spool_dir = DEFAULT_SPOOL_DIR;
+    guint64 _max_spool_size = DEFAULT_MAX_SPOOL_SIZE;
 };
 
 G_DEFINE_TYPE_EXTENDED(GvaMetaPublish, gva_meta_publish, GST_TYPE_BIN, 0, G_ADD_PRIVATE(GvaMetaPublish);
@@ -354,4 +474,83 @@ static void gva_meta_publish_class_init(GvaMetaPublishClass *klass) {
     g_object_class_install_property(gobject_class, PROP_JSON_CONFIG_FILE,
                                     g_param_spec_string("mqtt-config", "Config", "[method= mqtt] MQTT config file",
                                                         DEFAULT_MQTTCONFIG_FILE, prm_flags));
+    g_object_class_install_property(
+        gobject_class, PROP_MAX_QUEUE_SIZE,
+        g_param_spec_uint("max-queue-size", "Max Queue Size",
+                          "[method= file] Maximum number of messages waiting to be written to the file", 1, G_MAXUINT,
+                          DEFAULT_MAX_QUEUE_SIZE, prm_flags));
+    g_object_class_install_property(gobject_class, PROP_OVERFLOW_POLICY,
+                                    g_param_spec_enum("overflow-policy", "Overflow Policy",
+                                                      "[method= file] What to do with a new message when the queue "
+                                                      "is full",
+                                                      GST_TYPE_GVA_METAPUBLISH_OVERFLOW_POLICY, DEFAULT_OVERFLOW_POLICY,
+                                                      prm_flags));
+    g_object_class_install_property(
+        gobject_class, PROP_FLUSH_INTERVAL,
+        g_param_spec_uint("flush-interval", "Flush Interval",
+                          "[method= file] Maximum time in milliseconds messages are buffered before they are written "
+                          "to the file. 0 writes them as soon as no more messages are queued",
+                          0, G_MAXUINT, DEFAULT_FLUSH_INTERVAL, prm_flags));
+    g_object_class_install_property(
+        gobject_class, PROP_FLUSH_SIZE,
+        g_param_spec_uint("flush-size", "Flush Size",
+                          "[method= file] Buffered size in bytes at which messages are written regardless of "
+                          "flush-interval",
+                          1, G_MAXUINT, DEFAULT_FLUSH_SIZE, prm_flags));
+    g_object_class_install_property(
+        gobject_class, PROP_MAX_FILE_SIZE,
+        g_param_spec_uint64("max-file-size", "Max File Size",
+                            "[method= file] Size in bytes the file is rotated at. Closed file is renamed to "
+                            "<file-path>.<N>. 0 disables size-based rotation",
+                            0, G_MAXUINT64, DEFAULT_MAX_FILE_SIZE, prm_flags));
+    g_object_class_install_property(
+        gobject_class, PROP_ROTATION_INTERVAL,
+        g_param_spec_uint("rotation-interval", "Rotation Interval",
+                          "[method= file] Time in seconds the file is rotated after. 0 disables time-based rotation",
+                          0, G_MAXUINT, DEFAULT_ROTATION_INTERVAL, prm_flags));
+    g_object_class_install_property(
+        gobject_class, PROP_COMPRESS_ROTATED,
+        g_param_spec_boolean("compress-rotated", "Compress Rotated",
+                             "[method= file] Compress rotated files with gzip to <file-path>.<N>.gz",
+                             DEFAULT_COMPRESS_ROTATED, prm_flags));
+    g_object_class_install_property(
+        gobject_class, PROP_BATCH_SIZE,
+        g_param_spec_uint("batch-size", "Batch Size",
+                          "[method= kafka | mqtt] Maximum number of messages grouped into one broker message. Groups "
+                          "of more than 1 message are JSON arrays",
+                          1, G_MAXUINT, DEFAULT_BATCH_SIZE, prm_flags));
+    g_object_class_install_property(
+        gobject_class, PROP_BATCH_BYTES,
+        g_param_spec_uint("batch-bytes", "Batch Bytes",
+                          "[method= kafka | mqtt] Size in bytes of grouped messages at which the group is sent "
+                          "regardless of batch-size",
+                          1, G_MAXUINT, DEFAULT_BATCH_BYTES, prm_flags));
+    g_object_class_install_property(
+        gobject_class, PROP_BATCH_LINGER,
+        g_param_spec_uint("batch-linger", "Batch Linger",
+                          "[method= kafka | mqtt] Maximum time in milliseconds the first message of incomplete group "
+                          "waits for more messages. 0 waits until batch-size or batch-bytes is reached",
+                          0, G_MAXUINT, DEFAULT_BATCH_LINGER, prm_flags));
+    g_object_class_install_property(
+        gobject_class, PROP_COMPRESSION,
+        g_param_spec_enum("compression", "Compression", "[method= kafka | mqtt] Compression of broker messages",
+                          GST_TYPE_GVA_METAPUBLISH_COMPRESSION, DEFAULT_COMPRESSION, prm_flags));
+    g_object_class_install_property(
+        gobject_class, PROP_MAX_IN_FLIGHT,
+        g_param_spec_uint("max-in-flight", "Max In Flight",
+                          "[method= kafka | mqtt] Maximum number of broker messages waiting for delivery report, "
+                          "publishing waits for a report when it's reached. 0 is unlimited",
+                          0, G_MAXUINT, DEFAULT_MAX_IN_FLIGHT, prm_flags));
+    g_object_class_install_property(
+        gobject_class, PROP_SPOOL_DIR,
+        g_param_spec_string("spool-dir", "Spool Directory",
+                            "[method= kafka | mqtt] Directory where broker messages the broker failed to take are "
+                            "kept until they are resent. Empty disables spooling",
+                            DEFAULT_SPOOL_DIR, prm_flags));
+    g_object_class_install_property(
+        gobject_class, PROP_MAX_SPOOL_SIZE,
+        g_param_spec_uint64("max-spool-size", "Max Spool Size",
+                            "[method= kafka | mqtt] Maximum size in bytes of spooled broker messages, messages beyond "
+                            "it are dropped",
+                            1, G_MAXUINT64, DEFAULT_MAX_SPOOL_SIZE, prm_flags));
 }
@@ -72,7 +72,7 @@ static void gva_meta_publish_kafka_class_init(GvaMetaPublishKafkaClass *klass) {
     base_transform_class->start = [](GstBaseTransform *base) { return GVA_META_PUBLISH_KAFKA(base)->impl->start(); };
     base_transform_class->stop = [](GstBaseTransform *base) { return GVA_META_PUBLISH_KAFKA(base)->impl->stop(); };
 
-    base_metapublish_class->publish = [](GvaMetaPublishBase *base, const std::string &message) {
+    base_metapublish_class->publish = [](GvaMetaPublishBase *base, std::string_view message) {
         return GVA_META_PUBLISH_KAFKA(base)->impl->publish(message);
     };
 
@@ -97,6 +97,43 @@ static void gva_meta_publish_kafka_class_init(GvaMetaPublishKafkaClass *klass) {
                           "Maximum time in seconds between reconnection attempts. Initial "
                           "interval is 1 second and will be doubled on each failure up to this maximum interval.",
                           1, 300, DEFAULT_MAX_RECONNECT_INTERVAL, prm_flags));
+    g_object_class_install_property(gobject_class, PROP_BATCH_SIZE,
+                                    g_param_spec_uint("batch-size", "Batch Size",
+                                                      "Maximum number of messages grouped into one record. Records of "
+                                                      "more than 1 message are JSON arrays",
+                                                      1, G_MAXUINT, DEFAULT_BATCH_SIZE, prm_flags));
+    g_object_class_install_property(
+        gobject_class, PROP_BATCH_BYTES,
+        g_param_spec_uint("batch-bytes", "Batch Bytes",
+                          "Size in bytes of grouped messages at which the record is sent regardless of batch-size", 1,
+                          G_MAXUINT, DEFAULT_BATCH_BYTES, prm_flags));
+    g_object_class_install_property(
+        gobject_class, PROP_BATCH_LINGER,
+        g_param_spec_uint("batch-linger", "Batch Linger",
+                          "Maximum time in milliseconds the first message of incomplete record waits for more "
+                          "messages. 0 waits until batch-size or batch-bytes is reached",
+                          0, G_MAXUINT, DEFAULT_BATCH_LINGER, prm_flags));
+    g_object_class_install_property(gobject_class, PROP_COMPRESSION,
+                                    g_param_spec_enum("compression", "Compression", "Compression of records",
+                                                      GST_TYPE_GVA_METAPUBLISH_COMPRESSION, DEFAULT_COMPRESSION,
+                                                      prm_flags));
+    g_object_class_install_property(
+        gobject_class, PROP_MAX_IN_FLIGHT,
+        g_param_spec_uint("max-in-flight", "Max In Flight",
+                          "Maximum number of records waiting for delivery report, publishing waits for a report "
+                          "when it's reached. 0 is unlimited",
+                          0, G_MAXUINT, DEFAULT_MAX_IN_FLIGHT, prm_flags));
+    g_object_class_install_property(
+        gobject_class, PROP_SPOOL_DIR,
+        g_param_spec_string("spool-dir", "Spool Directory",
+                            "Directory where records the broker failed to take are kept until they are resent. "
+                            "Empty disables spooling",
+                            DEFAULT_SPOOL_DIR, prm_flags));
+    g_object_class_install_property(
+        gobject_class, PROP_MAX_SPOOL_SIZE,
+        g_param_spec_uint64("max-spool-size", "Max Spool Size",
+                            "Maximum size in bytes of spooled records, records beyond it are dropped", 1, G_MAXUINT64,
+                            DEFAULT_MAX_SPOOL_SIZE, prm_flags));
 }
 
 static gboolean plugin_init(GstPlugin *plugin) {
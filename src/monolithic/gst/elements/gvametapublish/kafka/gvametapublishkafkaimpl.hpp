@@ -6,13 +6,17 @@
 
 #pragma once
 
+#include <common.hpp>
 #include <gvametapublishbase.hpp>
+#include <message_batcher.hpp>
 
 #include <librdkafka/rdkafkacpp.h>
 
+#include <chrono>
 #include <cstdint>
 #include <memory>
 #include <string>
+#include <string_view>
 
 namespace {
 constexpr auto MILLISEC_PER_SEC = 1000;
@@ -25,10 +29,17 @@ enum {
     PROP_TOPIC,
     PROP_MAX_CONNECT_ATTEMPTS,
     PROP_MAX_RECONNECT_INTERVAL,
+    PROP_BATCH_SIZE,
+    PROP_BATCH_BYTES,
+    PROP_BATCH_LINGER,
+    PROP_COMPRESSION,
+    PROP_MAX_IN_FLIGHT,
+    PROP_SPOOL_DIR,
+    PROP_MAX_SPOOL_SIZE,
 };
 
 template <typename ProducerFactory, typename TopicFactory>
-class GvaMetaPublishKafkaImpl : public RdKafka::DeliveryReportCb, public RdKafka::EventCb {
+class GvaMetaPublishKafkaImpl : public RdKafka::DeliveryReportCb, public RdKafka::EventCb, public EnvelopeSink {
   private:
     bool init_kafka_producer() {
         std::unique_ptr<RdKafka::Conf> producerConfig(RdKafka::Conf::create(RdKafka::Conf::CONF_GLOBAL));
@@ -75,18 +86,39 @@ class GvaMetaPublishKafkaImpl : public RdKafka::DeliveryReportCb, public RdKafka
         return true;
     }
 
+    MessageBatcherConfig batcher_config() const {
+        MessageBatcherConfig config;
+        config.batch_size = _batch_size;
+        config.batch_bytes = _batch_bytes;
+        config.linger = std::chrono::milliseconds(_batch_linger);
+        config.compression =
+            _compression == GVA_META_PUBLISH_COMPRESSION_GZIP ? EnvelopeCompression::Gzip : EnvelopeCompression::None;
+        config.max_in_flight = _max_in_flight;
+        config.spool_dir = _spool_dir;
+        config.max_spool_size = _max_spool_size;
+        config.max_retry_interval = std::chrono::seconds(_max_reconnect_interval);
+        return config;
+    }
+
   public:
     GvaMetaPublishKafkaImpl(GvaMetaPublishBase *base) : _base(base) {
     }
 
-    ~GvaMetaPublishKafkaImpl() override = default;
+    ~GvaMetaPublishKafkaImpl() override {
+        // Batcher thread polls the producer, so it's stopped first
+        _batcher.reset();
+    }
 
     void dr_cb(RdKafka::Message &message) final {
-        if (message.err() != RdKafka::ERR_NO_ERROR) {
+        const bool delivered = message.err() == RdKafka::ERR_NO_ERROR;
+        if (!delivered) {
             GST_ERROR_OBJECT(_base, "Message failed to publish to Kafka. Error message: %s", message.errstr().c_str());
         } else {
             GST_DEBUG_OBJECT(_base, "Message successfully published to Kafka");
         }
+        // Envelope id is passed as message opaque
+        if (_batcher)
+            _batcher->delivered(reinterpret_cast<uintptr_t>(message.msg_opaque()), delivered);
     }
 
     void event_cb(RdKafka::Event &event) final {
@@ -114,6 +146,13 @@ class GvaMetaPublishKafkaImpl : public RdKafka::DeliveryReportCb, public RdKafka
             return false;
         }
 
+        _batcher = std::make_unique<MessageBatcher>(batcher_config(), *this);
+        if (!_batcher->start()) {
+            GST_ELEMENT_ERROR(_base, RESOURCE, NOT_FOUND, ("Failed to start"), ("%s", _batcher->error().c_str()));
+            _batcher.reset();
+            return false;
+        }
+
         return true;
     }
 
@@ -121,6 +160,10 @@ class GvaMetaPublishKafkaImpl : public RdKafka::DeliveryReportCb, public RdKafka
         if (!_producer)
             return true;
 
+        // Last envelope is produced before the producer is flushed
+        if (_batcher && !_batcher->flush())
+            GST_ERROR_OBJECT(_base, "Failed to publish last envelope.");
+
         if (_producer->flush(3 * MILLISEC_PER_SEC) != RdKafka::ERR_NO_ERROR) {
             GST_ERROR_OBJECT(_base, "Failed to flush kafka producer.");
             auto queue_size = _producer->outq_len();
@@ -131,28 +174,51 @@ class GvaMetaPublishKafkaImpl : public RdKafka::DeliveryReportCb, public RdKafka
             GST_DEBUG_OBJECT(_base, "Successfully flushed Kafka producer.");
         }
 
+        if (_batcher) {
+            // Envelopes still waiting for delivery report are spooled, if spool is enabled
+            _batcher->stop();
+            const auto stats = _batcher->stats();
+            GST_DEBUG_OBJECT(_base, "Envelopes sent: %zu, delivered: %zu, spooled: %zu", stats.sent, stats.delivered,
+                             stats.spooled);
+            if (stats.dropped)
+                GST_WARNING_OBJECT(_base, "%zu envelopes were dropped because spool is full", stats.dropped);
+            _batcher.reset();
+        }
+
         return true;
     }
 
-    gboolean publish(const std::string &message) {
-        if (!_producer) {
+    gboolean publish(std::string_view message) {
+        if (!_producer || !_batcher) {
             GST_ERROR_OBJECT(_base, "Producer handler is null. Cannot publish message.");
             return false;
         }
+        if (!_batcher->add(message))
+            return false;
+
+        GST_DEBUG_OBJECT(_base, "Kafka message sent.");
+        return true;
+    }
+
+    bool send(uint64_t id, const std::string &payload) final {
+        // Serves delivery reports of earlier envelopes
         _producer->poll(0);
         if (_producer->produce(_kafka_topic.get(), RdKafka::Topic::PARTITION_UA, RdKafka::Producer::MSG_COPY,
-                               (void *)const_cast<char *>(message.c_str()), message.size(), nullptr, nullptr)) {
+                               const_cast<char *>(payload.data()), payload.size(), nullptr,
+                               reinterpret_cast<void *>(static_cast<uintptr_t>(id)))) {
 
             std::string error;
             _producer->fatal_error(error);
             GST_ERROR_OBJECT(_base, "Failed to publish message: %s", error.c_str());
             return false;
         }
-
-        GST_DEBUG_OBJECT(_base, "Kafka message sent.");
         return true;
     }
 
+    void poll() final {
+        _producer->poll(0);
+    }
+
     bool get_property(guint prop_id, GValue *value) {
         switch (prop_id) {
         case PROP_ADDRESS:
@@ -167,6 +233,27 @@ class GvaMetaPublishKafkaImpl : public RdKafka::DeliveryReportCb, public RdKafka
         case PROP_MAX_RECONNECT_INTERVAL:
             g_value_set_uint(value, _max_reconnect_interval);
             break;
+        case PROP_BATCH_SIZE:
+            g_value_set_uint(value, _batch_size);
+            break;
+        case PROP_BATCH_BYTES:
+            g_value_set_uint(value, _batch_bytes);
+            break;
+        case PROP_BATCH_LINGER:
+            g_value_set_uint(value, _batch_linger);
+            break;
+        case PROP_COMPRESSION:
+            g_value_set_enum(value, _compression);
+            break;
+        case PROP_MAX_IN_FLIGHT:
+            g_value_set_uint(value, _max_in_flight);
+            break;
+        case PROP_SPOOL_DIR:
+            g_value_set_string(value, _spool_dir.c_str());
+            break;
+        case PROP_MAX_SPOOL_SIZE:
+            g_value_set_uint64(value, _max_spool_size);
+            break;
         default:
             return false;
         }
@@ -187,6 +274,27 @@ class GvaMetaPublishKafkaImpl : public RdKafka::DeliveryReportCb, public RdKafka
         case PROP_MAX_RECONNECT_INTERVAL:
             _max_reconnect_interval = g_value_get_uint(value);
             break;
+        case PROP_BATCH_SIZE:
+            _batch_size = g_value_get_uint(value);
+            break;
+        case PROP_BATCH_BYTES:
+            _batch_bytes = g_value_get_uint(value);
+            break;
+        case PROP_BATCH_LINGER:
+            _batch_linger = g_value_get_uint(value);
+            break;
+        case PROP_COMPRESSION:
+            _compression = static_cast<CompressionType>(g_value_get_enum(value));
+            break;
+        case PROP_MAX_IN_FLIGHT:
+            _max_in_flight = g_value_get_uint(value);
+            break;
+        case PROP_SPOOL_DIR:
+            _spool_dir = g_value_get_string(value);
+            break;
+        case PROP_MAX_SPOOL_SIZE:
+            _max_spool_size = g_value_get_uint64(value);
+            break;
         default:
             return false;
         }
@@ -200,8 +308,16 @@ class GvaMetaPublishKafkaImpl : public RdKafka::DeliveryReportCb, public RdKafka
     std::string _topic;
     uint32_t _max_connect_attempts = 0;
     uint32_t _max_reconnect_interval = 0;
+    guint _batch_size = DEFAULT_BATCH_SIZE;
+    guint _batch_bytes = DEFAULT_BATCH_BYTES;
+    guint _batch_linger = DEFAULT_BATCH_LINGER;
+    CompressionType _compression = DEFAULT_COMPRESSION;
+    guint _max_in_flight = DEFAULT_MAX_IN_FLIGHT;
+    std::string _spool_dir = DEFAULT_SPOOL_DIR;
+    guint64 _max_spool_size = DEFAULT_MAX_SPOOL_SIZE;
 
     std::unique_ptr<RdKafka::Producer> _producer;
     std::unique_ptr<RdKafka::Topic> _kafka_topic;
     uint32_t _connection_attempt = 0;
+    std::unique_ptr<MessageBatcher> _batcher;
 };
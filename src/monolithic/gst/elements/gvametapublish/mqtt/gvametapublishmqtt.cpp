@@ -13,17 +13,26 @@ using json = nlohmann::json;
 #include "gvametapublishmqtt.hpp"
 
 #include <common.hpp>
+#include <message_batcher.hpp>
 #include <safe_arithmetic.hpp>
 
 #include <MQTTAsync.h>
 
+#include <chrono>
 #include <cstdint>
+#include <memory>
 #include <string>
+#include <string_view>
 #include <thread>
 
 GST_DEBUG_CATEGORY_STATIC(gva_meta_publish_mqtt_debug_category);
 #define GST_CAT_DEFAULT gva_meta_publish_mqtt_debug_category
 
+namespace {
+// How long stop waits for delivery of envelopes sent last
+constexpr auto DELIVERY_TIMEOUT = std::chrono::seconds(3);
+} // namespace
+
 /* Properties */
 enum {
     PROP_0,
@@ -35,10 +44,25 @@ enum {
     PROP_USERNAME,
     PROP_PASSWORD,
     PROP_JSON_CONFIG_FILE,
+    PROP_BATCH_SIZE,
+    PROP_BATCH_BYTES,
+    PROP_BATCH_LINGER,
+    PROP_COMPRESSION,
+    PROP_MAX_IN_FLIGHT,
+    PROP_SPOOL_DIR,
+    PROP_MAX_SPOOL_SIZE,
 };
 
-class GvaMetaPublishMqttPrivate {
+class GvaMetaPublishMqttPrivate : public EnvelopeSink {
   private:
+    // Context of sent envelope, released by the callback reporting its delivery. Holds the batcher, as callbacks
+    // may come after it's replaced by restart.
+    struct Delivery {
+        GvaMetaPublishMqttPrivate *self;
+        std::shared_ptr<MessageBatcher> batcher;
+        uint64_t id;
+    };
+
     // MQTT CALLBACKS
     void on_connect_success(MQTTAsync_successData * /*response*/) {
         GST_DEBUG_OBJECT(_base, "Successfully connected to MQTT");
@@ -63,12 +87,14 @@ class GvaMetaPublishMqttPrivate {
     void on_delivery_complete(MQTTAsync_token /*token*/) {
     }
 
-    void on_send_success(MQTTAsync_successData * /*response*/) {
+    void on_send_success(const Delivery &delivery, MQTTAsync_successData * /*response*/) {
         GST_DEBUG_OBJECT(_base, "Message successfully published to MQTT");
+        delivery.batcher->delivered(delivery.id, true);
     }
 
-    void on_send_failure(MQTTAsync_failureData * /*response*/) {
+    void on_send_failure(const Delivery &delivery, MQTTAsync_failureData * /*response*/) {
         GST_ERROR_OBJECT(_base, "Message failed to publish to MQTT");
+        delivery.batcher->delivered(delivery.id, false);
     }
 
     void on_disconnect_success(MQTTAsync_successData * /*response*/) {
@@ -96,6 +122,20 @@ class GvaMetaPublishMqttPrivate {
         }
     }
 
+    MessageBatcherConfig batcher_config() const {
+        MessageBatcherConfig config;
+        config.batch_size = _batch_size;
+        config.batch_bytes = _batch_bytes;
+        config.linger = std::chrono::milliseconds(_batch_linger);
+        config.compression =
+            _compression == GVA_META_PUBLISH_COMPRESSION_GZIP ? EnvelopeCompression::Gzip : EnvelopeCompression::None;
+        config.max_in_flight = _max_in_flight;
+        config.spool_dir = _spool_dir;
+        config.max_spool_size = _max_spool_size;
+        config.max_retry_interval = std::chrono::seconds(_max_reconnect_interval);
+        return config;
+    }
+
   public:
     GvaMetaPublishMqttPrivate(GvaMetaPublishBase *parent) : _base(parent) {
         _connect_options = MQTTAsync_connectOptions_initializer;
@@ -135,7 +175,10 @@ class GvaMetaPublishMqttPrivate {
         };
     }
 
-    ~GvaMetaPublishMqttPrivate() {
+    ~GvaMetaPublishMqttPrivate() override {
+        // Batcher thread sends through the client, so it's stopped before the client is destroyed
+        if (_batcher)
+            _batcher->stop();
         MQTTAsync_destroy(&_client);
         GST_DEBUG("Successfully freed MQTT client.");
     }
@@ -267,43 +310,69 @@ class GvaMetaPublishMqttPrivate {
             return false;
         }
         GST_DEBUG_OBJECT(_base, "Connect request sent to MQTT.");
+
+        _batcher = std::make_shared<MessageBatcher>(batcher_config(), *this);
+        if (!_batcher->start()) {
+            GST_ERROR_OBJECT(_base, "Failed to start MQTT message batcher: %s", _batcher->error().c_str());
+            return false;
+        }
+        return true;
+    }
+
+    gboolean publish(std::string_view message) {
+        // Rejected messages are reported by send(), they don't stop the pipeline
+        if (_batcher && !_batcher->add(message))
+            GST_DEBUG_OBJECT(_base, "MQTT message was dropped.");
         return true;
     }
 
-    gboolean publish(const std::string &message) {
+    bool send(uint64_t id, const std::string &payload) override {
         MQTTAsync_message mqtt_message = MQTTAsync_message_initializer;
-        mqtt_message.payload = const_cast<char *>(message.c_str());
-        mqtt_message.payloadlen = safe_convert<int>(message.size());
+        mqtt_message.payload = const_cast<char *>(payload.data());
+        mqtt_message.payloadlen = safe_convert<int>(payload.size());
         mqtt_message.retained = FALSE;
 
         // TODO Validate message is JSON
         MQTTAsync_responseOptions ro = MQTTAsync_responseOptions_initializer;
-        ro.context = this;
+        ro.context = new Delivery{this, _batcher, id};
         ro.onSuccess = [](void *context, MQTTAsync_successData *response) {
             if (!context) {
                 GST_ERROR("Got null context on mqtt success callback");
                 return;
             }
-            static_cast<GvaMetaPublishMqttPrivate *>(context)->on_send_success(response);
+            std::unique_ptr<Delivery> delivery(static_cast<Delivery *>(context));
+            delivery->self->on_send_success(*delivery, response);
         };
         ro.onFailure = [](void *context, MQTTAsync_failureData *response) {
             if (!context) {
                 GST_ERROR("Got null context on mqtt failure callback");
                 return;
             }
-            static_cast<GvaMetaPublishMqttPrivate *>(context)->on_send_failure(response);
+            std::unique_ptr<Delivery> delivery(static_cast<Delivery *>(context));
+            delivery->self->on_send_failure(*delivery, response);
         };
 
         auto c = MQTTAsync_sendMessage(_client, _topic.c_str(), &mqtt_message, &ro);
         if (c != MQTTASYNC_SUCCESS) {
+            delete static_cast<Delivery *>(ro.context);
             GST_ERROR_OBJECT(_base, "Message was not accepted for publication. Error code %d.", c);
-            return true;
+            return false;
         }
         GST_DEBUG_OBJECT(_base, "MQTT message sent.");
         return true;
     }
 
     gboolean stop() {
+        if (_batcher) {
+            // Envelopes still waiting for delivery report after timeout are spooled, if spool is enabled
+            _batcher->stop(DELIVERY_TIMEOUT);
+            const auto stats = _batcher->stats();
+            GST_DEBUG_OBJECT(_base, "Envelopes sent: %zu, delivered: %zu, spooled: %zu", stats.sent, stats.delivered,
+                             stats.spooled);
+            if (stats.dropped)
+                GST_WARNING_OBJECT(_base, "%zu envelopes were dropped because spool is full", stats.dropped);
+        }
+
         if (!MQTTAsync_isConnected(_client)) {
             GST_DEBUG_OBJECT(_base, "MQTT client is not connected. Nothing to disconnect");
             return true;
@@ -344,6 +413,27 @@ class GvaMetaPublishMqttPrivate {
         case PROP_JSON_CONFIG_FILE: // Handle JSON configuration file property
             _json_config_file = g_value_get_string(value);
             break;
+        case PROP_BATCH_SIZE:
+            _batch_size = g_value_get_uint(value);
+            break;
+        case PROP_BATCH_BYTES:
+            _batch_bytes = g_value_get_uint(value);
+            break;
+        case PROP_BATCH_LINGER:
+            _batch_linger = g_value_get_uint(value);
+            break;
+        case PROP_COMPRESSION:
+            _compression = static_cast<CompressionType>(g_value_get_enum(value));
+            break;
+        case PROP_MAX_IN_FLIGHT:
+            _max_in_flight = g_value_get_uint(value);
+            break;
+        case PROP_SPOOL_DIR:
+            _spool_dir = g_value_get_string(value);
+            break;
+        case PROP_MAX_SPOOL_SIZE:
+            _max_spool_size = g_value_get_uint64(value);
+            break;
         default:
             return false;
         }
@@ -377,6 +467,27 @@ class GvaMetaPublishMqttPrivate {
         case PROP_JSON_CONFIG_FILE: // Handle JSON configuration file property
             g_value_set_string(value, _json_config_file.c_str());
             break;
+        case PROP_BATCH_SIZE:
+            g_value_set_uint(value, _batch_size);
+            break;
+        case PROP_BATCH_BYTES:
+            g_value_set_uint(value, _batch_bytes);
+            break;
+        case PROP_BATCH_LINGER:
+            g_value_set_uint(value, _batch_linger);
+            break;
+        case PROP_COMPRESSION:
+            g_value_set_enum(value, _compression);
+            break;
+        case PROP_MAX_IN_FLIGHT:
+            g_value_set_uint(value, _max_in_flight);
+            break;
+        case PROP_SPOOL_DIR:
+            g_value_set_string(value, _spool_dir.c_str());
+            break;
+        case PROP_MAX_SPOOL_SIZE:
+            g_value_set_uint64(value, _max_spool_size);
+            break;
         default:
             return false;
         }
@@ -396,6 +507,15 @@ class GvaMetaPublishMqttPrivate {
 
     std::string _json_config_file;
 
+    guint _batch_size = DEFAULT_BATCH_SIZE;
+    guint _batch_bytes = DEFAULT_BATCH_BYTES;
+    guint _batch_linger = DEFAULT_BATCH_LINGER;
+    CompressionType _compression = DEFAULT_COMPRESSION;
+    guint _max_in_flight = DEFAULT_MAX_IN_FLIGHT;
+    std::string _spool_dir = DEFAULT_SPOOL_DIR;
+    guint64 _max_spool_size = DEFAULT_MAX_SPOOL_SIZE;
+    std::shared_ptr<MessageBatcher> _batcher;
+
     uint32_t _ssl_verify = 0;
     uint32_t _ssl_enable_server_cert_auth = 0;
 
@@ -493,7 +613,7 @@ static void gva_meta_publish_mqtt_class_init(GvaMetaPublishMqttClass *klass) {
     base_transform_class->start = [](GstBaseTransform *base) { return GVA_META_PUBLISH_MQTT(base)->impl->start(); };
     base_transform_class->stop = [](GstBaseTransform *base) { return GVA_META_PUBLISH_MQTT(base)->impl->stop(); };
 
-    base_metapublish_class->publish = [](GvaMetaPublishBase *base, const std::string &message) {
+    base_metapublish_class->publish = [](GvaMetaPublishBase *base, std::string_view message) {
         return GVA_META_PUBLISH_MQTT(base)->impl->publish(message);
     };
 
@@ -536,6 +656,43 @@ static void gva_meta_publish_mqtt_class_init(GvaMetaPublishMqttClass *klass) {
     g_object_class_install_property(gobject_class, PROP_JSON_CONFIG_FILE,
                                     g_param_spec_string("mqtt-config", "Config", "[method= mqtt] MQTT config file",
                                                         DEFAULT_MQTTCONFIG_FILE, prm_flags));
+    g_object_class_install_property(gobject_class, PROP_BATCH_SIZE,
+                                    g_param_spec_uint("batch-size", "Batch Size",
+                                                      "Maximum number of messages grouped into one MQTT message. "
+                                                      "Groups of more than 1 message are JSON arrays",
+                                                      1, G_MAXUINT, DEFAULT_BATCH_SIZE, prm_flags));
+    g_object_class_install_property(
+        gobject_class, PROP_BATCH_BYTES,
+        g_param_spec_uint("batch-bytes", "Batch Bytes",
+                          "Size in bytes of grouped messages at which the group is sent regardless of batch-size", 1,
+                          G_MAXUINT, DEFAULT_BATCH_BYTES, prm_flags));
+    g_object_class_install_property(
+        gobject_class, PROP_BATCH_LINGER,
+        g_param_spec_uint("batch-linger", "Batch Linger",
+                          "Maximum time in milliseconds the first message of incomplete group waits for more "
+                          "messages. 0 waits until batch-size or batch-bytes is reached",
+                          0, G_MAXUINT, DEFAULT_BATCH_LINGER, prm_flags));
+    g_object_class_install_property(gobject_class, PROP_COMPRESSION,
+                                    g_param_spec_enum("compression", "Compression", "Compression of MQTT messages",
+                                                      GST_TYPE_GVA_METAPUBLISH_COMPRESSION, DEFAULT_COMPRESSION,
+                                                      prm_flags));
+    g_object_class_install_property(
+        gobject_class, PROP_MAX_IN_FLIGHT,
+        g_param_spec_uint("max-in-flight", "Max In Flight",
+                          "Maximum number of MQTT messages waiting for delivery report, publishing waits for a report "
+                          "when it's reached. 0 is unlimited",
+                          0, G_MAXUINT, DEFAULT_MAX_IN_FLIGHT, prm_flags));
+    g_object_class_install_property(
+        gobject_class, PROP_SPOOL_DIR,
+        g_param_spec_string("spool-dir", "Spool Directory",
+                            "Directory where MQTT messages the broker failed to take are kept until they are resent. "
+                            "Empty disables spooling",
+                            DEFAULT_SPOOL_DIR, prm_flags));
+    g_object_class_install_property(
+        gobject_class, PROP_MAX_SPOOL_SIZE,
+        g_param_spec_uint64("max-spool-size", "Max Spool Size",
+                            "Maximum size in bytes of spooled MQTT messages, messages beyond it are dropped", 1,
+                            G_MAXUINT64, DEFAULT_MAX_SPOOL_SIZE, prm_flags));
 
     // Override the state change function
     GstElementClass *element_class = GST_ELEMENT_CLASS(klass);
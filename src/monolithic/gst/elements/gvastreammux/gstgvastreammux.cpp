@@ -5,6 +5,7 @@
  ******************************************************************************/
 
 #include "gstgvastreammux.h"
+#include "gva_streammux_pad_queue.h"
 #include <gst/analytics/gstanalyticsbatchmeta.h>
 
 #include <cstdio>
@@ -23,6 +24,7 @@ enum {
     PROP_MAX_QUEUE_SIZE,
     PROP_SYNC_MODE,
     PROP_OUTPUT_MODE,
+    PROP_STATS,
 };
 
 #define DEFAULT_MAX_FPS 0.0
@@ -118,6 +120,48 @@ static GvaStreammuxPadData *get_pad_data(GstGvaStreammux *mux, GstPad *pad) {
     return (GvaStreammuxPadData *)g_object_get_data(G_OBJECT(pad), "mux-pad-data");
 }
 
+/* Pipeline clock, or the system clock while the element has none (before
+ * PLAYING). Returns a new ref. */
+static GstClock *gst_gva_streammux_obtain_clock(GstGvaStreammux *mux) {
+    GstClock *clock = gst_element_get_clock(GST_ELEMENT(mux));
+    return clock ? clock : gst_system_clock_obtain();
+}
+
+/* Wait on clock until time, unless the wait is unscheduled through *clock_id.
+ * Must be called with mux->lock held, which is released while waiting. */
+static GstClockReturn gst_gva_streammux_wait_clock(GstGvaStreammux *mux, GstClock *clock, GstClockTime time,
+                                                   GstClockID *clock_id) {
+    GstClockID id = gst_clock_new_single_shot_id(clock, time);
+    *clock_id = id;
+    g_mutex_unlock(&mux->lock);
+    GstClockReturn ret = gst_clock_id_wait(id, NULL);
+    g_mutex_lock(&mux->lock);
+    *clock_id = NULL;
+    gst_clock_id_unref(id);
+    return ret;
+}
+
+/* Wake the output task from a wait for buffers, caps or EOS. Must be called
+ * with mux->lock held. */
+static void gst_gva_streammux_wake_output(GstGvaStreammux *mux) {
+    if (mux->batch_clock_id)
+        gst_clock_id_unschedule(mux->batch_clock_id);
+    g_cond_broadcast(&mux->cond);
+}
+
+/* Make chain() and the output task return. Must be called with mux->lock held. */
+static void gst_gva_streammux_set_flushing(GstGvaStreammux *mux) {
+    g_atomic_int_set(&mux->flushing, TRUE);
+    gst_gva_streammux_wake_output(mux);
+    if (mux->pacing_clock_id)
+        gst_clock_id_unschedule(mux->pacing_clock_id);
+    for (guint i = 0; i < mux->pad_data->len; i++) {
+        GvaStreammuxPadData *pdata = (GvaStreammuxPadData *)g_ptr_array_index(mux->pad_data, i);
+        if (pdata)
+            pad_queue_wake(pdata->queue);
+    }
+}
+
 static void gst_gva_streammux_class_init(GstGvaStreammuxClass *klass) {
     GObjectClass *gobject_class = G_OBJECT_CLASS(klass);
     GstElementClass *element_class = GST_ELEMENT_CLASS(klass);
@@ -171,7 +215,7 @@ static void gst_gva_streammux_class_init(GstGvaStreammuxClass *klass) {
         gobject_class, PROP_MAX_QUEUE_SIZE,
         g_param_spec_uint("max-queue-size", "Max Queue Size",
                           "Maximum number of buffers per pad queue before blocking upstream (back-pressure)", 1,
-                          G_MAXUINT, DEFAULT_MAX_QUEUE_SIZE,
+                          GST_GVA_STREAMMUX_MAX_QUEUE_SIZE, DEFAULT_MAX_QUEUE_SIZE,
                           (GParamFlags)(G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS)));
 
     g_object_class_install_property(
@@ -201,6 +245,15 @@ static void gst_gva_streammux_class_init(GstGvaStreammuxClass *klass) {
                           "sources such as video + lidar; unpack downstream with gvastreamdemux).",
                           GST_TYPE_GVA_STREAMMUX_OUTPUT_MODE, DEFAULT_OUTPUT_MODE,
                           (GParamFlags)(G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS)));
+
+    g_object_class_install_property(
+        gobject_class, PROP_STATS,
+        g_param_spec_boxed("stats", "Statistics",
+                           "Per sink pad statistics, one 'sink_N' structure field per pad with: "
+                           "'queue-depth' (buffers currently queued), 'late-drops' (buffers dropped for being "
+                           "behind the last pushed batch) and 'wait-time' (total ns upstream was blocked on a "
+                           "full queue). Counters are reset when the element starts.",
+                           GST_TYPE_STRUCTURE, (GParamFlags)(G_PARAM_READABLE | G_PARAM_STATIC_STRINGS)));
 }
 
 static void gst_gva_streammux_init(GstGvaStreammux *mux) {
@@ -226,12 +279,16 @@ static void gst_gva_streammux_init(GstGvaStreammux *mux) {
     mux->current_caps = NULL;
     mux->caps_negotiated = FALSE;
     mux->segment_sent = FALSE;
-    mux->last_output_time = GST_CLOCK_TIME_NONE;
+    mux->next_output_time = GST_CLOCK_TIME_NONE;
     mux->max_fps_duration = GST_CLOCK_TIME_NONE;
     // coverity[missing_lock]
     mux->batch_anchor_pts = GST_CLOCK_TIME_NONE;
-    mux->batch_start_real_time = 0;
+    mux->batch_clock = NULL;
+    mux->batch_deadline = GST_CLOCK_TIME_NONE;
     mux->last_pushed_batch_pts = GST_CLOCK_TIME_NONE;
+    mux->output_waiting = FALSE;
+    mux->batch_clock_id = NULL;
+    mux->pacing_clock_id = NULL;
     // coverity[missing_lock]
     mux->eos_pad_count = 0;
 
@@ -253,10 +310,8 @@ static void gst_gva_streammux_init(GstGvaStreammux *mux) {
 static void gst_gva_streammux_flush_pad_queues(GstGvaStreammux *mux) {
     for (guint i = 0; i < mux->pad_data->len; i++) {
         GvaStreammuxPadData *pdata = (GvaStreammuxPadData *)g_ptr_array_index(mux->pad_data, i);
-        if (!pdata)
-            continue;
-        while (!g_queue_is_empty(&pdata->buffer_queue))
-            gst_buffer_unref((GstBuffer *)g_queue_pop_head(&pdata->buffer_queue));
+        if (pdata)
+            pad_queue_clear(pdata->queue);
     }
 }
 
@@ -268,13 +323,14 @@ static void gst_gva_streammux_finalize(GObject *object) {
     for (guint i = 0; i < mux->pad_data->len; i++) {
         GvaStreammuxPadData *pdata = (GvaStreammuxPadData *)g_ptr_array_index(mux->pad_data, i);
         if (pdata) {
-            g_queue_clear(&pdata->buffer_queue);
+            delete pdata->queue;
             if (pdata->caps)
                 gst_caps_unref(pdata->caps);
             g_free(pdata);
         }
     }
     g_ptr_array_free(mux->pad_data, TRUE);
+    gst_object_replace((GstObject **)&mux->batch_clock, NULL);
 
     g_mutex_clear(&mux->lock);
     g_cond_clear(&mux->cond);
@@ -343,6 +399,25 @@ static void gst_gva_streammux_get_property(GObject *object, guint prop_id, GValu
     case PROP_OUTPUT_MODE:
         g_value_set_enum(value, mux->output_mode);
         break;
+    case PROP_STATS: {
+        GstStructure *stats = gst_structure_new_empty("gvastreammux-stats");
+        g_mutex_lock(&mux->lock);
+        for (guint i = 0; i < mux->pad_data->len; i++) {
+            GvaStreammuxPadData *pdata = (GvaStreammuxPadData *)g_ptr_array_index(mux->pad_data, i);
+            if (!pdata)
+                continue;
+            GstStructure *pad_stats = gst_structure_new(
+                "pad-stats", "queue-depth", G_TYPE_UINT, pad_queue_length(pdata->queue), "late-drops", G_TYPE_UINT64,
+                pdata->late_drops, "wait-time", G_TYPE_UINT64, pdata->queue->wait_time.load(), NULL);
+            gchar *name = g_strdup_printf("sink_%u", pdata->pad_index);
+            gst_structure_set(stats, name, GST_TYPE_STRUCTURE, pad_stats, NULL);
+            g_free(name);
+            gst_structure_free(pad_stats);
+        }
+        g_mutex_unlock(&mux->lock);
+        g_value_take_boxed(value, stats);
+        break;
+    }
     default:
         G_OBJECT_WARN_INVALID_PROPERTY_ID(object, prop_id, pspec);
         break;
@@ -445,13 +520,14 @@ static GstPad *gst_gva_streammux_request_new_pad(GstElement *element, GstPadTemp
     GvaStreammuxPadData *pdata = g_new0(GvaStreammuxPadData, 1);
     pdata->pad = sinkpad;
     pdata->pad_index = pad_index;
-    g_queue_init(&pdata->buffer_queue);
+    pdata->queue = new GvaStreammuxPadQueue(mux->max_queue_size);
     pdata->eos = FALSE;
     pdata->flushing = FALSE;
     pdata->first_pts_set = FALSE;
     pdata->first_pts = GST_CLOCK_TIME_NONE;
     pdata->segment_start = GST_CLOCK_TIME_NONE;
     pdata->caps = NULL;
+    pdata->late_drops = 0;
 
     g_object_set_data(G_OBJECT(sinkpad), "mux-pad-data", pdata);
 
@@ -480,28 +556,41 @@ static void gst_gva_streammux_release_pad(GstElement *element, GstPad *pad) {
 
     g_mutex_lock(&mux->lock);
 
+    /* Detach the pad from the output task and the event handlers, and make a
+     * chain() blocked on its full queue return. A chain() already running may
+     * still use the pad data until the pad is deactivated below. */
     GvaStreammuxPadData *pdata = get_pad_data(mux, pad);
     if (pdata) {
+        g_object_set_data(G_OBJECT(pad), "mux-pad-data", NULL);
         if (pdata->flushing && mux->flushing_pads_count > 0)
             mux->flushing_pads_count--;
-        while (!g_queue_is_empty(&pdata->buffer_queue))
-            gst_buffer_unref((GstBuffer *)g_queue_pop_head(&pdata->buffer_queue));
+        if (pdata->eos && mux->eos_pad_count > 0)
+            mux->eos_pad_count--;
         if (pdata->pad_index < mux->pad_data->len)
             g_ptr_array_index(mux->pad_data, pdata->pad_index) = NULL;
-        g_queue_clear(&pdata->buffer_queue);
-        if (pdata->caps)
-            gst_caps_unref(pdata->caps);
-        g_free(pdata);
+        pad_queue_close(pdata->queue);
     }
 
     mux->sinkpads = g_list_remove(mux->sinkpads, pad);
     mux->num_sink_pads--;
-
-    gst_element_remove_pad(element, pad);
+    gst_gva_streammux_wake_output(mux);
 
     GST_INFO_OBJECT(mux, "Released pad, remaining pads=%u", mux->num_sink_pads);
 
     g_mutex_unlock(&mux->lock);
+
+    /* Outside mux->lock: deactivating the pad waits on its stream lock for
+     * chain() and event handlers, which take mux->lock, to return. Removing a
+     * pad doesn't deactivate it. */
+    gst_pad_set_active(pad, FALSE);
+    gst_element_remove_pad(element, pad);
+
+    if (pdata) {
+        delete pdata->queue;
+        if (pdata->caps)
+            gst_caps_unref(pdata->caps);
+        g_free(pdata);
+    }
 }
 
 /* State changes */
@@ -518,16 +607,25 @@ static GstStateChangeReturn gst_gva_streammux_change_state(GstElement *element,
         mux->send_stream_start = TRUE;
         mux->segment_sent = FALSE;
         mux->caps_negotiated = FALSE;
-        mux->flushing = FALSE;
-        mux->last_output_time = GST_CLOCK_TIME_NONE;
+        g_atomic_int_set(&mux->flushing, FALSE);
+        mux->next_output_time = GST_CLOCK_TIME_NONE;
         mux->batch_anchor_pts = GST_CLOCK_TIME_NONE;
         mux->last_pushed_batch_pts = GST_CLOCK_TIME_NONE;
         mux->eos_pad_count = 0;
         gst_segment_init(&mux->segment, GST_FORMAT_TIME);
         for (guint i = 0; i < mux->pad_data->len; i++) {
             GvaStreammuxPadData *pdata = (GvaStreammuxPadData *)g_ptr_array_index(mux->pad_data, i);
-            if (pdata)
-                pdata->eos = FALSE;
+            if (!pdata)
+                continue;
+            pdata->eos = FALSE;
+            pdata->late_drops = 0;
+            /* No streaming thread runs yet, so the ring can be resized to a
+             * max-queue-size changed since the pad was requested. */
+            if (pdata->queue->slots.size() != mux->max_queue_size) {
+                delete pdata->queue;
+                pdata->queue = new GvaStreammuxPadQueue(mux->max_queue_size);
+            }
+            pdata->queue->wait_time = 0;
         }
         if (mux->pad_data->len > mux->num_sink_pads) {
             GST_WARNING_OBJECT(mux,
@@ -544,8 +642,9 @@ static GstStateChangeReturn gst_gva_streammux_change_state(GstElement *element,
         /* Tear down our streaming threads BEFORE chaining up, because the
          * base-class change_state below deactivates the pads and that path
          * deadlocks against our own threads:
-         *   1. chain() parks in g_cond_wait() on back-pressure while holding a
-         *      sink pad's stream lock; pad deactivation needs that stream lock.
+         *   1. chain() parks in g_cond_wait() on back-pressure (full pad queue)
+         *      while holding a sink pad's stream lock; pad deactivation needs
+         *      that stream lock.
          *   2. the srcpad output-loop task holds the srcpad stream lock while
          *      running; the base class deactivating the srcpad grabs the pad
          *      object lock and waits for that stream lock, while the task waits
@@ -556,8 +655,7 @@ static GstStateChangeReturn gst_gva_streammux_change_state(GstElement *element,
          * then stop the srcpad task ourselves so it is fully joined (stream
          * lock released) before the base class deactivates an idle pad. */
         g_mutex_lock(&mux->lock);
-        mux->flushing = TRUE;
-        g_cond_broadcast(&mux->cond);
+        gst_gva_streammux_set_flushing(mux);
         g_mutex_unlock(&mux->lock);
         gst_pad_stop_task(mux->srcpad);
         break;
@@ -750,7 +848,7 @@ static gboolean gst_gva_streammux_sink_event(GstPad *pad, GstObject *parent, Gst
             }
             /* Unblock the output loop, which waits until the mode is decided. */
             g_mutex_lock(&mux->lock);
-            g_cond_broadcast(&mux->cond);
+            gst_gva_streammux_wake_output(mux);
             g_mutex_unlock(&mux->lock);
         }
 
@@ -793,7 +891,7 @@ static gboolean gst_gva_streammux_sink_event(GstPad *pad, GstObject *parent, Gst
         if (!mux->caps_negotiated && all_live_pads_have_caps(mux)) {
             caps_to_push = negotiate_src_caps(mux, &need_stream_start, &need_segment, &caps_mismatch);
         }
-        g_cond_signal(&mux->cond);
+        gst_gva_streammux_wake_output(mux);
         g_mutex_unlock(&mux->lock);
 
         if (caps_mismatch) {
@@ -815,7 +913,7 @@ static gboolean gst_gva_streammux_sink_event(GstPad *pad, GstObject *parent, Gst
             if (need_segment)
                 gst_pad_push_event(mux->srcpad, gst_event_new_segment(&mux->segment));
             g_mutex_lock(&mux->lock);
-            g_cond_broadcast(&mux->cond);
+            gst_gva_streammux_wake_output(mux);
             g_mutex_unlock(&mux->lock);
         }
 
@@ -832,10 +930,8 @@ static gboolean gst_gva_streammux_sink_event(GstPad *pad, GstObject *parent, Gst
             mux->flushing_pads_count++;
             first_flush = (mux->flushing_pads_count == 1);
         }
-        if (first_flush) {
-            mux->flushing = TRUE;
-            g_cond_broadcast(&mux->cond);
-        }
+        if (first_flush)
+            gst_gva_streammux_set_flushing(mux);
         g_mutex_unlock(&mux->lock);
 
         if (first_flush) {
@@ -858,8 +954,9 @@ static gboolean gst_gva_streammux_sink_event(GstPad *pad, GstObject *parent, Gst
             last_flush = (mux->flushing_pads_count == 0);
         }
         if (last_flush) {
-            mux->flushing = FALSE;
+            /* The output task is paused, so the queues have no consumer. */
             gst_gva_streammux_flush_pad_queues(mux);
+            g_atomic_int_set(&mux->flushing, FALSE);
             for (guint i = 0; i < mux->pad_data->len; i++) {
                 GvaStreammuxPadData *pd = (GvaStreammuxPadData *)g_ptr_array_index(mux->pad_data, i);
                 if (pd) {
@@ -897,9 +994,9 @@ static GstFlowReturn gst_gva_streammux_chain(GstPad *pad, GstObject *parent, Gst
     GvaStreammuxPadData *pdata = get_pad_data(mux, pad);
 
     if (!pdata) {
-        GST_ERROR_OBJECT(mux, "No pad data for pad %s", GST_PAD_NAME(pad));
+        GST_DEBUG_OBJECT(mux, "Pad %s is being released", GST_PAD_NAME(pad));
         gst_buffer_unref(buf);
-        return GST_FLOW_ERROR;
+        return GST_FLOW_FLUSHING;
     }
 
     if (mux->sync_mode != GVA_STREAMMUX_SYNC_MODE_NONE) {
@@ -907,44 +1004,25 @@ static GstFlowReturn gst_gva_streammux_chain(GstPad *pad, GstObject *parent, Gst
         normalize_buffer_pts(mux, pdata, buf);
     }
 
-    g_mutex_lock(&mux->lock);
-
-    if (mux->flushing) {
-        g_mutex_unlock(&mux->lock);
+    if (g_atomic_int_get(&mux->flushing)) {
         gst_buffer_unref(buf);
         return GST_FLOW_FLUSHING;
     }
 
-    /* Back-pressure: block if queue is full */
-    while (g_queue_get_length(&pdata->buffer_queue) >= mux->max_queue_size && !mux->flushing) {
-        g_cond_wait(&mux->cond, &mux->lock);
-    }
-
-    if (mux->flushing) {
-        g_mutex_unlock(&mux->lock);
+    /* Back-pressure: block while the queue is full. Late buffers are dropped by
+     * the output task, which knows the last pushed batch. */
+    if (!pad_queue_push_wait(pdata->queue, buf, &mux->flushing)) {
         gst_buffer_unref(buf);
         return GST_FLOW_FLUSHING;
     }
 
-    GstClockTime pts = GST_BUFFER_PTS(buf);
-
-    /* Late frame detection */
-    if (GST_CLOCK_TIME_IS_VALID(pts) && GST_CLOCK_TIME_IS_VALID(mux->last_pushed_batch_pts)) {
-        if (pts + mux->pts_tolerance < mux->last_pushed_batch_pts) {
-            GST_WARNING_OBJECT(mux,
-                               "Late frame from pad sink_%u (pts=%" GST_TIME_FORMAT
-                               " < last_batch_pts=%" GST_TIME_FORMAT "), dropping",
-                               pdata->pad_index, GST_TIME_ARGS(pts), GST_TIME_ARGS(mux->last_pushed_batch_pts));
-            g_mutex_unlock(&mux->lock);
-            gst_buffer_unref(buf);
-            return GST_FLOW_OK;
-        }
+    /* mux->lock is only taken when the output task waits for buffers, and only
+     * by the first pad to deliver one. */
+    if (g_atomic_int_compare_and_exchange(&mux->output_waiting, TRUE, FALSE)) {
+        g_mutex_lock(&mux->lock);
+        gst_gva_streammux_wake_output(mux);
+        g_mutex_unlock(&mux->lock);
     }
-
-    g_queue_push_tail(&pdata->buffer_queue, buf);
-    g_cond_signal(&mux->cond);
-
-    g_mutex_unlock(&mux->lock);
     return GST_FLOW_OK;
 }
 
@@ -1046,33 +1124,52 @@ static gboolean gst_gva_streammux_src_event(GstPad *pad, GstObject *parent, GstE
     }
 }
 
-/* Apply max-fps throttling */
-static void gst_gva_streammux_apply_fps_throttle(GstGvaStreammux *mux) {
-    if (!GST_CLOCK_TIME_IS_VALID(mux->max_fps_duration))
-        return;
-
-    GstClock *clock = gst_element_get_clock(GST_ELEMENT(mux));
-    if (!clock)
-        return;
+/* max-fps pacing: wait on the pipeline clock for the next output slot. Slots
+ * follow each other by max_fps_duration regardless of how long pushing took, so
+ * the rate doesn't drift; a slot missed by more than a period restarts the
+ * schedule instead of bursting to catch up. Returns FALSE if interrupted by a
+ * flush. */
+static gboolean gst_gva_streammux_wait_output_slot(GstGvaStreammux *mux) {
+    const GstClockTime duration = mux->max_fps_duration;
+    if (!GST_CLOCK_TIME_IS_VALID(duration))
+        return TRUE;
 
+    GstClock *clock = gst_gva_streammux_obtain_clock(mux);
     GstClockTime now = gst_clock_get_time(clock);
-    gst_object_unref(clock);
 
-    if (GST_CLOCK_TIME_IS_VALID(mux->last_output_time)) {
-        GstClockTime elapsed = now - mux->last_output_time;
-        if (elapsed < mux->max_fps_duration) {
-            GstClockTime wait = mux->max_fps_duration - elapsed;
-            GST_LOG_OBJECT(mux, "FPS throttle: waiting %" GST_TIME_FORMAT, GST_TIME_ARGS(wait));
-            g_usleep(GST_TIME_AS_USECONDS(wait));
-        }
+    g_mutex_lock(&mux->lock);
+    GstClockTime slot = mux->next_output_time;
+    /* Also restarts after a clock change, e.g. to the pipeline clock on PLAYING */
+    if (!GST_CLOCK_TIME_IS_VALID(slot) || slot + duration < now || slot > now + duration)
+        slot = now;
+    mux->next_output_time = slot + duration;
+    if (slot > now && !g_atomic_int_get(&mux->flushing)) {
+        GST_LOG_OBJECT(mux, "FPS throttle: waiting %" GST_TIME_FORMAT, GST_TIME_ARGS(slot - now));
+        gst_gva_streammux_wait_clock(mux, clock, slot, &mux->pacing_clock_id);
     }
+    gboolean flushing = g_atomic_int_get(&mux->flushing);
+    g_mutex_unlock(&mux->lock);
+
+    gst_object_unref(clock);
+    return !flushing;
 }
 
-static void gst_gva_streammux_update_output_time(GstGvaStreammux *mux) {
-    GstClock *clock = gst_element_get_clock(GST_ELEMENT(mux));
-    if (clock) {
-        mux->last_output_time = gst_clock_get_time(clock);
-        gst_object_unref(clock);
+/* Drop head buffers of a pad which are behind the last pushed batch by more
+ * than pts-tolerance: the batch already moved past their time. Must be called
+ * with mux->lock held. */
+static void gst_gva_streammux_drop_late(GstGvaStreammux *mux, GvaStreammuxPadData *pdata) {
+    if (!GST_CLOCK_TIME_IS_VALID(mux->last_pushed_batch_pts))
+        return;
+    while (GstBuffer *head = pad_queue_peek(pdata->queue)) {
+        GstClockTime pts = GST_BUFFER_PTS(head);
+        if (!GST_CLOCK_TIME_IS_VALID(pts) || pts + mux->pts_tolerance >= mux->last_pushed_batch_pts)
+            return;
+        GST_WARNING_OBJECT(mux,
+                           "Late frame from pad sink_%u (pts=%" GST_TIME_FORMAT " < last_batch_pts=%" GST_TIME_FORMAT
+                           "), dropping",
+                           pdata->pad_index, GST_TIME_ARGS(pts), GST_TIME_ARGS(mux->last_pushed_batch_pts));
+        gst_buffer_unref(pad_queue_pop(pdata->queue));
+        pdata->late_drops++;
     }
 }
 
@@ -1083,6 +1180,17 @@ typedef struct {
     GstCaps *caps; /* own ref; only used in CONTAINER mode */
 } BatchEntry;
 
+static void free_batch(GArray *batch) {
+    for (guint i = 0; i < batch->len; i++) {
+        BatchEntry *e = &g_array_index(batch, BatchEntry, i);
+        if (e->buf)
+            gst_buffer_unref(e->buf);
+        if (e->caps)
+            gst_caps_unref(e->caps);
+    }
+    g_array_free(batch, TRUE);
+}
+
 /* Output task loop: runs on srcpad task thread */
 static void gst_gva_streammux_output_loop(gpointer user_data) {
     GstGvaStreammux *mux = GST_GVA_STREAMMUX(user_data);
@@ -1118,13 +1226,17 @@ static void gst_gva_streammux_output_loop(gpointer user_data) {
         GstClockTime earliest = GST_CLOCK_TIME_NONE;
         gboolean any_buffer = FALSE;
 
+        /* Set before looking at the queues: a buffer queued after the scan
+         * then finds the flag and wakes us. */
+        g_atomic_int_set(&mux->output_waiting, TRUE);
         for (guint i = 0; i < mux->pad_data->len; i++) {
             GvaStreammuxPadData *pdata = (GvaStreammuxPadData *)g_ptr_array_index(mux->pad_data, i);
-            /* Skip a pad only once it is EOS *and* drained: buffers already
-             * queued before EOS must still be batched, not discarded. */
-            if (!pdata || (pdata->eos && g_queue_is_empty(&pdata->buffer_queue)))
+            if (!pdata)
                 continue;
-            GstBuffer *head = (GstBuffer *)g_queue_peek_head(&pdata->buffer_queue);
+            gst_gva_streammux_drop_late(mux, pdata);
+            /* EOS pads are not skipped: buffers queued before EOS must still
+             * be batched, not discarded. */
+            GstBuffer *head = pad_queue_peek(pdata->queue);
             if (head) {
                 any_buffer = TRUE;
                 GstClockTime pts = GST_BUFFER_PTS(head);
@@ -1137,6 +1249,7 @@ static void gst_gva_streammux_output_loop(gpointer user_data) {
         if (!any_buffer) {
             /* All pads EOS and no remaining buffers -> send EOS downstream */
             if (mux->eos_pad_count >= mux->num_sink_pads && mux->num_sink_pads > 0) {
+                g_atomic_int_set(&mux->output_waiting, FALSE);
                 g_mutex_unlock(&mux->lock);
                 gst_pad_push_event(mux->srcpad, gst_event_new_eos());
                 gst_pad_pause_task(mux->srcpad);
@@ -1148,25 +1261,33 @@ static void gst_gva_streammux_output_loop(gpointer user_data) {
             return;
         }
 
+        GstClock *clock = gst_gva_streammux_obtain_clock(mux);
+        GstClockTime now = gst_clock_get_time(clock);
         mux->batch_anchor_pts = earliest;
-        mux->batch_start_real_time = g_get_monotonic_time();
+        mux->batch_deadline = mux->max_wait_time < (GstClockTime)G_MAXINT64 - now ? now + mux->max_wait_time
+                                                                                  : (GstClockTime)G_MAXINT64;
+        gst_object_replace((GstObject **)&mux->batch_clock, GST_OBJECT_CAST(clock));
+        gst_object_unref(clock);
     }
 
-    /* Phase 2: Wait for other pads to contribute within timeout */
-    gint64 deadline = mux->batch_start_real_time + (gint64)(mux->max_wait_time / 1000);
-
+    /* Phase 2: Wait on the clock for other pads to contribute until the batch
+     * deadline. Buffers queued meanwhile unschedule the wait. */
     while (!mux->flushing) {
         guint contributing_count = 0;
         guint eligible_pads = 0;
 
+        g_atomic_int_set(&mux->output_waiting, TRUE);
         for (guint i = 0; i < mux->pad_data->len; i++) {
             GvaStreammuxPadData *pdata = (GvaStreammuxPadData *)g_ptr_array_index(mux->pad_data, i);
+            if (!pdata)
+                continue;
+            gst_gva_streammux_drop_late(mux, pdata);
             /* A drained EOS pad is no longer eligible; an EOS pad that still has
              * queued buffers must be waited on like any live pad. */
-            if (!pdata || (pdata->eos && g_queue_is_empty(&pdata->buffer_queue)))
+            GstBuffer *head = pad_queue_peek(pdata->queue);
+            if (pdata->eos && !head)
                 continue;
             eligible_pads++;
-            GstBuffer *head = (GstBuffer *)g_queue_peek_head(&pdata->buffer_queue);
             if (head) {
                 GstClockTime pts = GST_BUFFER_PTS(head);
                 if (!GST_CLOCK_TIME_IS_VALID(pts) || !GST_CLOCK_TIME_IS_VALID(mux->batch_anchor_pts) ||
@@ -1180,34 +1301,35 @@ static void gst_gva_streammux_output_loop(gpointer user_data) {
             break;
         }
 
-        gint64 now = g_get_monotonic_time();
-        if (now >= deadline) {
+        GstClockReturn wait_ret =
+            gst_gva_streammux_wait_clock(mux, mux->batch_clock, mux->batch_deadline, &mux->batch_clock_id);
+        if (wait_ret != GST_CLOCK_UNSCHEDULED) {
             GST_LOG_OBJECT(mux, "Batch timeout: got %u/%u pads", contributing_count, eligible_pads);
             break;
         }
-
-        g_cond_wait_until(&mux->cond, &mux->lock, deadline);
     }
+    g_atomic_int_set(&mux->output_waiting, FALSE);
 
     if (mux->flushing) {
         g_mutex_unlock(&mux->lock);
         return;
     }
 
-    /* Phase 3: Collect matching buffers */
+    /* Phase 3: Collect matching buffers. Popping wakes chain functions blocked
+     * on full queues. */
     GArray *batch = g_array_new(FALSE, FALSE, sizeof(BatchEntry));
     guint batch_size = 0;
 
     for (guint i = 0; i < mux->pad_data->len; i++) {
         GvaStreammuxPadData *pdata = (GvaStreammuxPadData *)g_ptr_array_index(mux->pad_data, i);
-        if (!pdata || (pdata->eos && g_queue_is_empty(&pdata->buffer_queue)))
+        if (!pdata)
             continue;
-        GstBuffer *head = (GstBuffer *)g_queue_peek_head(&pdata->buffer_queue);
+        GstBuffer *head = pad_queue_peek(pdata->queue);
         if (head) {
             GstClockTime pts = GST_BUFFER_PTS(head);
             if (!GST_CLOCK_TIME_IS_VALID(pts) || !GST_CLOCK_TIME_IS_VALID(mux->batch_anchor_pts) ||
                 pts_abs_diff(pts, mux->batch_anchor_pts) <= mux->pts_tolerance) {
-                head = (GstBuffer *)g_queue_pop_head(&pdata->buffer_queue);
+                head = pad_queue_pop(pdata->queue);
                 BatchEntry entry = {
                     head, pdata->pad_index,
                     (output_mode == GVA_STREAMMUX_OUTPUT_CONTAINER && pdata->caps) ? gst_caps_ref(pdata->caps) : NULL};
@@ -1221,9 +1343,6 @@ static void gst_gva_streammux_output_loop(gpointer user_data) {
     mux->last_pushed_batch_pts = mux->batch_anchor_pts;
     mux->batch_anchor_pts = GST_CLOCK_TIME_NONE;
 
-    /* Wake up chain functions blocked on full queues */
-    g_cond_broadcast(&mux->cond);
-
     g_mutex_unlock(&mux->lock);
 
     /* Phase 4: Push buffers downstream (outside lock) */
@@ -1232,7 +1351,10 @@ static void gst_gva_streammux_output_loop(gpointer user_data) {
         return;
     }
 
-    gst_gva_streammux_apply_fps_throttle(mux);
+    if (!gst_gva_streammux_wait_output_slot(mux)) {
+        free_batch(batch);
+        return;
+    }
 
     GstFlowReturn ret = GST_FLOW_OK;
 
@@ -1250,14 +1372,7 @@ static void gst_gva_streammux_output_loop(gpointer user_data) {
         if (!meta) {
             GST_ERROR_OBJECT(mux, "Failed to add GstAnalyticsBatchMeta to container buffer");
             gst_buffer_unref(container);
-            for (guint i = 0; i < batch->len; i++) {
-                BatchEntry *e = &g_array_index(batch, BatchEntry, i);
-                if (e->buf)
-                    gst_buffer_unref(e->buf);
-                if (e->caps)
-                    gst_caps_unref(e->caps);
-            }
-            g_array_free(batch, TRUE);
+            free_batch(batch);
             gst_pad_pause_task(mux->srcpad);
             return;
         }
@@ -1330,9 +1445,6 @@ static void gst_gva_streammux_output_loop(gpointer user_data) {
         g_array_free(batch, TRUE);
     }
 
-    if (ret == GST_FLOW_OK)
-        gst_gva_streammux_update_output_time(mux);
-
     if (ret != GST_FLOW_OK) {
         GST_INFO_OBJECT(mux, "Pausing output task due to flow return: %s", gst_flow_get_name(ret));
         gst_pad_pause_task(mux->srcpad);
@@ -19,6 +19,9 @@ G_BEGIN_DECLS
 #define GST_IS_GVA_STREAMMUX_CLASS(klass) (G_TYPE_CHECK_CLASS_TYPE((klass), GST_TYPE_GVA_STREAMMUX))
 
 #define GST_GVA_STREAMMUX_MAX_PAD_INDEX 256
+/* Upper bound of "max-queue-size". Each pad's ring allocates all its slots up
+ * front, so the bound keeps a large value from failing the allocation. */
+#define GST_GVA_STREAMMUX_MAX_QUEUE_SIZE 4096
 
 typedef enum {
     GVA_STREAMMUX_SYNC_MODE_NONE = 0,
@@ -49,11 +52,14 @@ GType gst_gva_streammux_output_mode_get_type(void);
 typedef struct _GstGvaStreammux GstGvaStreammux;
 typedef struct _GstGvaStreammuxClass GstGvaStreammuxClass;
 typedef struct _GvaStreammuxPadData GvaStreammuxPadData;
+typedef struct _GvaStreammuxPadQueue GvaStreammuxPadQueue;
 
 struct _GvaStreammuxPadData {
     GstPad *pad;
     guint pad_index;
-    GQueue buffer_queue;
+    /* Bounded ring the pad's streaming thread hands buffers to the output task
+     * through, without taking mux->lock (defined in gva_streammux_pad_queue.h). */
+    GvaStreammuxPadQueue *queue;
     gboolean eos;
     gboolean flushing;
 
@@ -65,6 +71,9 @@ struct _GvaStreammuxPadData {
     /* Caps negotiated on this pad (own ref). In CONTAINER mode each stream
      * carries its own caps; in PASSTHROUGH mode this equals mux->current_caps. */
     GstCaps *caps;
+
+    /* Buffers the output task dropped for being behind the last pushed batch */
+    guint64 late_drops;
 };
 
 struct _GstGvaStreammux {
@@ -84,15 +93,23 @@ struct _GstGvaStreammux {
     guint num_sink_pads;
     gboolean started;
     gboolean send_stream_start;
+    /* Written with g_atomic_int_set under lock, read by chain() without it. */
     gboolean flushing;
 
     /* Number of sink pads currently between FLUSH_START and FLUSH_STOP.
      * Used to coalesce per-pad flush events into a single downstream flush. */
     guint flushing_pads_count;
 
-    /* Synchronization */
+    /* Synchronization. lock guards the element state, buffers pass through the
+     * per-pad queues without it. */
     GMutex lock;
     GCond cond;
+    /* TRUE (atomic) while the output task is going to wait for buffers; the
+     * first sink pad queueing a buffer clears it and wakes the task. */
+    gint output_waiting;
+    /* Clock waits of the output task, unscheduled to wake it early (under lock) */
+    GstClockID batch_clock_id;
+    GstClockID pacing_clock_id;
 
     /* Per-pad data array (GPtrArray of GvaStreammuxPadData*) */
     GPtrArray *pad_data;
@@ -112,13 +129,15 @@ struct _GstGvaStreammux {
     gboolean segment_sent;
     GstSegment segment;
 
-    /* FPS control */
-    GstClockTime last_output_time;
+    /* FPS control: batches are pushed at next_output_time on the pipeline clock,
+     * each slot max_fps_duration after the previous one. */
+    GstClockTime next_output_time;
     GstClockTime max_fps_duration;
 
     /* Batch PTS tracking */
     GstClockTime batch_anchor_pts;
-    gint64 batch_start_real_time;
+    GstClock *batch_clock; /* clock batch_deadline is on (own ref) */
+    GstClockTime batch_deadline;
     GstClockTime last_pushed_batch_pts;
 
     /* Output task */
@@ -0,0 +1,127 @@
+/*******************************************************************************
+ * Copyright (C) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+#ifndef __GVA_STREAMMUX_PAD_QUEUE_H__
+#define __GVA_STREAMMUX_PAD_QUEUE_H__
+
+#include <gst/gst.h>
+
+#include <atomic>
+#include <vector>
+
+/* Bounded single-producer/single-consumer ring between a sink pad's streaming
+ * thread (producer) and the output task (consumer). Buffers are exchanged
+ * through the head/tail counters only; lock and cond are used just by a
+ * producer blocked on a full ring (back-pressure) and whoever wakes it.
+ * Counters are sequentially consistent so that the "store index, then check the
+ * other side's waiting flag" handshakes can't miss a wake-up. */
+struct _GvaStreammuxPadQueue {
+    explicit _GvaStreammuxPadQueue(guint capacity) : slots(capacity, nullptr) {
+        g_mutex_init(&lock);
+        g_cond_init(&cond);
+    }
+
+    ~_GvaStreammuxPadQueue() {
+        for (guint64 i = head.load(); i != tail.load(); i++)
+            gst_buffer_unref(slots[i % slots.size()]);
+        g_mutex_clear(&lock);
+        g_cond_clear(&cond);
+    }
+
+    std::vector<GstBuffer *> slots;
+    alignas(64) std::atomic<guint64> head{0}; /* next slot to pop, advanced by the consumer */
+    alignas(64) std::atomic<guint64> tail{0}; /* next slot to push, advanced by the producer */
+    std::atomic<bool> producer_waiting{false};
+    std::atomic<bool> closed{false};   /* set when the pad is released, a blocked producer gives up */
+    std::atomic<guint64> wait_time{0}; /* total time the producer was blocked on a full ring, ns */
+    GMutex lock;
+    GCond cond;
+};
+
+typedef struct _GvaStreammuxPadQueue GvaStreammuxPadQueue;
+
+/* Producer side. Returns FALSE if the ring is full. */
+inline gboolean pad_queue_push(GvaStreammuxPadQueue *queue, GstBuffer *buf) {
+    const guint64 tail = queue->tail.load(std::memory_order_relaxed);
+    if (tail - queue->head.load() >= queue->slots.size())
+        return FALSE;
+    queue->slots[tail % queue->slots.size()] = buf;
+    queue->tail.store(tail + 1);
+    return TRUE;
+}
+
+/* Producer side. Blocks while the ring is full until a slot frees up, *flushing
+ * is set or the ring is closed. Returns FALSE if buf was not queued, the caller
+ * keeps it then. */
+inline gboolean pad_queue_push_wait(GvaStreammuxPadQueue *queue, GstBuffer *buf, gint *flushing) {
+    if (pad_queue_push(queue, buf))
+        return TRUE;
+
+    gboolean pushed = FALSE;
+    const gint64 wait_start = g_get_monotonic_time();
+    g_mutex_lock(&queue->lock);
+    while (!g_atomic_int_get(flushing) && !queue->closed) {
+        /* Announce the wait before retrying, so a pop in between signals us */
+        queue->producer_waiting = true;
+        if ((pushed = pad_queue_push(queue, buf)))
+            break;
+        g_cond_wait(&queue->cond, &queue->lock);
+    }
+    queue->producer_waiting = false;
+    g_mutex_unlock(&queue->lock);
+    queue->wait_time += (guint64)(g_get_monotonic_time() - wait_start) * GST_USECOND;
+    return pushed;
+}
+
+/* Consumer side. Returns the oldest buffer without removing it, or NULL. */
+inline GstBuffer *pad_queue_peek(GvaStreammuxPadQueue *queue) {
+    const guint64 head = queue->head.load(std::memory_order_relaxed);
+    if (head == queue->tail.load())
+        return NULL;
+    return queue->slots[head % queue->slots.size()];
+}
+
+/* Consumer side. Removes the oldest buffer (transfer full) and wakes the
+ * producer if it waits for space. */
+inline GstBuffer *pad_queue_pop(GvaStreammuxPadQueue *queue) {
+    const guint64 head = queue->head.load(std::memory_order_relaxed);
+    if (head == queue->tail.load())
+        return NULL;
+    GstBuffer *buf = queue->slots[head % queue->slots.size()];
+    queue->slots[head % queue->slots.size()] = nullptr;
+    queue->head.store(head + 1);
+    if (queue->producer_waiting.exchange(false)) {
+        g_mutex_lock(&queue->lock);
+        g_cond_signal(&queue->cond);
+        g_mutex_unlock(&queue->lock);
+    }
+    return buf;
+}
+
+inline guint pad_queue_length(GvaStreammuxPadQueue *queue) {
+    return (guint)(queue->tail.load() - queue->head.load());
+}
+
+/* Consumer side, or while no producer runs. */
+inline void pad_queue_clear(GvaStreammuxPadQueue *queue) {
+    while (GstBuffer *buf = pad_queue_pop(queue))
+        gst_buffer_unref(buf);
+}
+
+/* Wake a producer blocked on a full ring, so it rechecks flushing. */
+inline void pad_queue_wake(GvaStreammuxPadQueue *queue) {
+    g_mutex_lock(&queue->lock);
+    g_cond_broadcast(&queue->cond);
+    g_mutex_unlock(&queue->lock);
+}
+
+/* Make a blocked producer, and any later one, give up on a full ring. */
+inline void pad_queue_close(GvaStreammuxPadQueue *queue) {
+    queue->closed = true;
+    pad_queue_wake(queue);
+}
+
+#endif /* __GVA_STREAMMUX_PAD_QUEUE_H__ */
@@ -45,7 +45,8 @@
  * - Re-identification gallery — Deleted tracks' appearance features and last position are saved, allowing a reappearing
  *   person to be recognized and assigned their previous identity.
  * - Per-track feature budget — Feature history is managed directly within each track using a fixed-size sliding window
- *   rather than through an external metric class.
+ *   rather than through an external metric class. Features are kept L2-normalized in one contiguous matrix per track,
+ *   so the appearance cost of a cascade level is computed with one matrix product per track.
  *
  * See the [arXiv](https://arxiv.org/abs/1703.07402) preprint for more information.
  */
@@ -54,6 +55,7 @@
 #include "utils.h"
 #include <algorithm>
 #include <cmath>
+#include <cstdint>
 #include <numeric>
 #include <set>
 #include <sstream>
@@ -63,6 +65,72 @@ GST_DEBUG_CATEGORY_EXTERN(deep_sort_debug);
 
 namespace DeepSortWrapper {
 
+// FeatureBank implementation
+
+FeatureBank::FeatureBank(int budget, int dim) : budget_(budget), dim_(dim) {
+    if (budget_ > 0)
+        data_.reserve(static_cast<size_t>(budget_) * dim_);
+}
+
+/**
+ * @brief Store L2-normalized copy of the feature, replacing the oldest one when the budget is exhausted
+ */
+void FeatureBank::add(const std::vector<float> &feature) {
+    // Features of another size can never match (cosine distance 1), there is no need to keep them
+    if (feature.size() != static_cast<size_t>(dim_))
+        return;
+
+    float *row = nullptr;
+    if (budget_ <= 0 || rows_ < static_cast<size_t>(budget_)) {
+        data_.resize((rows_ + 1) * dim_);
+        row = data_.data() + rows_ * dim_;
+        ++rows_;
+    } else {
+        row = data_.data() + next_row_ * dim_;
+        next_row_ = (next_row_ + 1) % static_cast<size_t>(budget_);
+    }
+
+    const float norm = std::sqrt(std::inner_product(feature.begin(), feature.end(), feature.begin(), 0.0f));
+    const float scale = norm > 0.0f ? 1.0f / norm : 0.0f;
+    for (int i = 0; i < dim_; ++i)
+        row[i] = feature[i] * scale;
+}
+
+/**
+ * @brief Nearest-neighbor cosine distance (0=identical, 1=orthogonal or no features) for a batch of queries
+ */
+void FeatureBank::min_cosine_distances(const cv::Mat &queries, cv::Mat &dots, float *distances) const {
+    if (empty() || queries.cols != dim_) {
+        std::fill(distances, distances + queries.rows, 1.0f);
+        return;
+    }
+
+    // queries x stored features dot products, features of both sides are unit length
+    const cv::Mat stored(static_cast<int>(rows_), dim_, CV_32F, const_cast<float *>(data_.data()));
+    cv::gemm(queries, stored, 1.0, cv::noArray(), 0.0, dots, cv::GEMM_2_T);
+
+    for (int q = 0; q < queries.rows; ++q) {
+        const float *row = dots.ptr<float>(q);
+        const float best = *std::max_element(row, row + dots.cols);
+        distances[q] = std::min(1.0f, 1.0f - best);
+    }
+}
+
+float FeatureBank::min_cosine_distance(const std::vector<float> &query) const {
+    if (empty() || query.size() != static_cast<size_t>(dim_))
+        return 1.0f;
+
+    float best = -1.0f;
+    for (size_t r = 0; r < rows_; ++r) {
+        const float *row = data_.data() + r * dim_;
+        float dot = 0.0f;
+        for (int i = 0; i < dim_; ++i)
+            dot += row[i] * query[i];
+        best = std::max(best, dot);
+    }
+    return std::min(1.0f, 1.0f - best);
+}
+
 // Track implementation
 
 /**
@@ -71,7 +139,7 @@ namespace DeepSortWrapper {
 Track::Track(const cv::Rect_<float> &bbox, int track_id, int n_init, int max_age, const std::vector<float> &feature,
              int nn_budget)
     : track_id_(track_id), hits_(1), age_(1), time_since_update_(0), state_(TrackState::Tentative), n_init_(n_init),
-      max_age_(max_age), nn_budget_(nn_budget) {
+      max_age_(max_age), nn_budget_(nn_budget), features_(nn_budget) {
     initiate(bbox);
     add_feature(feature);
 }
@@ -231,10 +299,7 @@ cv::Rect_<float> Track::to_bbox() const {
  * @brief Add new feature vector to track's feature history (with budget limit)
  */
 void Track::add_feature(const std::vector<float> &feature) {
-    features_.push_back(feature);
-    if (nn_budget_ > 0 && features_.size() > static_cast<size_t>(nn_budget_)) {
-        features_.pop_front();
-    }
+    features_.add(feature);
 }
 
 /**
@@ -398,11 +463,7 @@ void DeepSortTracker::track(dlstreamer::FramePtr buffer, GVA::VideoFrame &frame_
 
             for (size_t g = 0; g < reid_gallery_.size(); ++g) {
                 // Cosine distance: min over gallery features (nn-distance)
-                float min_dist = INFTY_COST;
-                for (const auto &gfeat : reid_gallery_[g].features) {
-                    float dist = calculate_cosine_distance(detections[det_idx].feature, gfeat);
-                    min_dist = std::min(min_dist, dist);
-                }
+                float min_dist = reid_gallery_[g].features.min_cosine_distance(detections[det_idx].feature);
 
                 if (min_dist < best_dist) {
                     // Spatial sanity check: max 50 pixels/frame movement
@@ -636,23 +697,24 @@ void DeepSortTracker::matching_cascade(const std::vector<Detection> &detections,
         // Build cost matrix: rows=tracks, cols=detections
         size_t n_tracks = track_indices_l.size();
         size_t n_dets = unmatched_detections.size();
-        std::vector<std::vector<float>> cost_matrix(n_tracks, std::vector<float>(n_dets));
-
-        for (size_t row = 0; row < n_tracks; ++row) {
-            int trk_idx = track_indices_l[row];
-            const auto &track_features = tracks_[trk_idx]->features();
+        CostMatrix &cost_matrix = cost_matrix_;
+        cost_matrix.assign(n_tracks, n_dets);
 
-            for (size_t col = 0; col < n_dets; ++col) {
-                int det_idx = unmatched_detections[col];
+        // Unit-length features of the unmatched detections, one row per detection
+        det_features_.create(static_cast<int>(n_dets), DEFAULT_FEATURES_VECTOR_SIZE_128, CV_32F);
+        for (size_t col = 0; col < n_dets; ++col) {
+            const auto &feature = detections[unmatched_detections[col]].feature;
+            float *dst = det_features_.ptr<float>(static_cast<int>(col));
+            if (feature.size() == static_cast<size_t>(det_features_.cols))
+                std::copy(feature.begin(), feature.end(), dst);
+            else
+                std::fill(dst, dst + det_features_.cols, 0.0f);
+        }
 
-                // Compute nearest-neighbor cosine distance (min across stored features)
-                float min_cosine_dist = 1.0f;
-                for (const auto &track_feature : track_features) {
-                    float dist = calculate_cosine_distance(detections[det_idx].feature, track_feature);
-                    min_cosine_dist = std::min(min_cosine_dist, dist);
-                }
-                cost_matrix[row][col] = min_cosine_dist;
-            }
+        // Nearest-neighbor cosine distance (min across stored features) of every detection
+        for (size_t row = 0; row < n_tracks; ++row) {
+            tracks_[track_indices_l[row]]->features().min_cosine_distances(det_features_, feature_dots_,
+                                                                            cost_matrix.row(row));
         }
 
         // Apply Mahalanobis gating
@@ -661,8 +723,8 @@ void DeepSortTracker::matching_cascade(const std::vector<Detection> &detections,
         // Gate by max_cosine_distance threshold
         for (size_t row = 0; row < n_tracks; ++row) {
             for (size_t col = 0; col < n_dets; ++col) {
-                if (cost_matrix[row][col] > max_cosine_distance_) {
-                    cost_matrix[row][col] = max_cosine_distance_ + 1e-5f;
+                if (cost_matrix.at(row, col) > max_cosine_distance_) {
+                    cost_matrix.at(row, col) = max_cosine_distance_ + 1e-5f;
                 }
             }
         }
@@ -674,7 +736,7 @@ void DeepSortTracker::matching_cascade(const std::vector<Detection> &detections,
         // Process assignments: filter by threshold, map back to original indices
         std::vector<bool> det_matched(n_dets, false);
         for (const auto &[row, col] : assignments) {
-            if (cost_matrix[row][col] <= max_cosine_distance_) {
+            if (cost_matrix.at(row, col) <= max_cosine_distance_) {
                 int trk_idx_match = track_indices_l[row];
                 int det_idx_match = unmatched_detections[col];
 
@@ -742,11 +804,7 @@ void DeepSortTracker::matching_cascade(const std::vector<Detection> &detections,
                 int trk_idx = track_indices_l[row];
                 int det_idx = unmatched_detections[col];
                 // Recompute the actual min cosine distance (before gating) for diagnostics
-                float actual_min_cos = 1.0f;
-                for (const auto &tf : tracks_[trk_idx]->features()) {
-                    float d = calculate_cosine_distance(detections[det_idx].feature, tf);
-                    actual_min_cos = std::min(actual_min_cos, d);
-                }
+                float actual_min_cos = tracks_[trk_idx]->features().min_cosine_distance(detections[det_idx].feature);
                 auto gd = tracks_[trk_idx]->gating_distance(detections, {det_idx}, true);
                 float maha = gd.empty() ? -1.f : gd[0];
                 GST_DEBUG("CASCADE REJECT: track_id=%d(tsu=%d) vs det[%d] "
@@ -802,7 +860,8 @@ void DeepSortTracker::min_cost_matching_iou(const std::vector<Detection> &detect
     size_t n_dets = detection_indices.size();
 
     // Build IoU cost matrix: cost = 1 - IoU
-    std::vector<std::vector<float>> cost_matrix(n_tracks, std::vector<float>(n_dets));
+    CostMatrix &cost_matrix = cost_matrix_;
+    cost_matrix.assign(n_tracks, n_dets);
 
     for (size_t row = 0; row < n_tracks; ++row) {
         int trk_idx = track_indices[row];
@@ -812,7 +871,7 @@ void DeepSortTracker::min_cost_matching_iou(const std::vector<Detection> &detect
             GST_DEBUG("IOU STAGE2: track_id=%d BLOCKED by tsu=%d > 1", tracks_[trk_idx]->track_id(),
                       tracks_[trk_idx]->time_since_update());
             for (size_t col = 0; col < n_dets; ++col) {
-                cost_matrix[row][col] = INFTY_COST;
+                cost_matrix.at(row, col) = INFTY_COST;
             }
             continue;
         }
@@ -821,15 +880,15 @@ void DeepSortTracker::min_cost_matching_iou(const std::vector<Detection> &detect
         for (size_t col = 0; col < n_dets; ++col) {
             int det_idx = detection_indices[col];
             float iou = calculate_iou(detections[det_idx].bbox, track_bbox);
-            cost_matrix[row][col] = 1.0f - iou; // IoU distance
+            cost_matrix.at(row, col) = 1.0f - iou; // IoU distance
         }
     }
 
     // Gate by max_iou_distance: cost > threshold means too far apart
     for (size_t row = 0; row < n_tracks; ++row) {
         for (size_t col = 0; col < n_dets; ++col) {
-            if (cost_matrix[row][col] > max_iou_distance_) {
-                cost_matrix[row][col] = max_iou_distance_ + 1e-5f;
+            if (cost_matrix.at(row, col) > max_iou_distance_) {
+                cost_matrix.at(row, col) = max_iou_distance_ + 1e-5f;
             }
         }
     }
@@ -843,7 +902,7 @@ void DeepSortTracker::min_cost_matching_iou(const std::vector<Detection> &detect
     std::vector<bool> det_matched(n_dets, false);
 
     for (const auto &[row, col] : assignments) {
-        if (cost_matrix[row][col] <= max_iou_distance_) {
+        if (cost_matrix.at(row, col) <= max_iou_distance_) {
             matches.push_back({detection_indices[col], track_indices[row]});
             trk_matched[row] = true;
             det_matched[col] = true;
@@ -852,7 +911,7 @@ void DeepSortTracker::min_cost_matching_iou(const std::vector<Detection> &detect
             int det_idx = detection_indices[col];
             float actual_iou = calculate_iou(detections[det_idx].bbox, tracks_[trk_idx]->to_bbox());
             GST_DEBUG("IOU REJECT: track_id=%d vs det[%d] iou=%.3f cost=%.3f (threshold=%.3f)",
-                      tracks_[trk_idx]->track_id(), det_idx, actual_iou, cost_matrix[row][col], max_iou_distance_);
+                      tracks_[trk_idx]->track_id(), det_idx, actual_iou, cost_matrix.at(row, col), max_iou_distance_);
         }
     }
 
@@ -871,8 +930,8 @@ void DeepSortTracker::min_cost_matching_iou(const std::vector<Detection> &detect
 /**
  * @brief Gate cost matrix using Mahalanobis distance and TSU-scaled spatial gating
  */
-void DeepSortTracker::gate_cost_matrix(std::vector<std::vector<float>> &cost_matrix,
-                                       const std::vector<Detection> &detections, const std::vector<int> &track_indices,
+void DeepSortTracker::gate_cost_matrix(CostMatrix &cost_matrix, const std::vector<Detection> &detections,
+                                       const std::vector<int> &track_indices,
                                        const std::vector<int> &detection_indices) {
     // Combined Mahalanobis + TSU-scaled spatial gating.
     // A match is blocked (INFTY_COST) if EITHER gate rejects it:
@@ -909,12 +968,12 @@ void DeepSortTracker::gate_cost_matrix(std::vector<std::vector<float>> &cost_mat
         float max_dist_factor = std::max(base_gate / std::sqrt(static_cast<float>(tsu)), min_gate);
 
         for (size_t col = 0; col < detection_indices.size(); ++col) {
-            if (cost_matrix[row][col] >= INFTY_COST)
+            if (cost_matrix.at(row, col) >= INFTY_COST)
                 continue;
 
             // Gate 1: Mahalanobis (position-only, chi2 95% with 2 DOF)
             if (maha_dists[col] > CHI2INV95_2DOF) {
-                cost_matrix[row][col] = INFTY_COST;
+                cost_matrix.at(row, col) = INFTY_COST;
                 continue;
             }
 
@@ -930,40 +989,15 @@ void DeepSortTracker::gate_cost_matrix(std::vector<std::vector<float>> &cost_mat
 
             // Gate 2: TSU-scaled spatial distance
             if (norm_dist > max_dist_factor) {
-                cost_matrix[row][col] = INFTY_COST;
+                cost_matrix.at(row, col) = INFTY_COST;
                 continue;
             }
 
-            cost_matrix[row][col] += std::min(spatial_weight * norm_dist, max_spatial_penalty);
+            cost_matrix.at(row, col) += std::min(spatial_weight * norm_dist, max_spatial_penalty);
         }
     }
 }
 
-/**
- * @brief Calculate cosine distance between two feature vectors (0=identical, 1=opposite)
- */
-float DeepSortTracker::calculate_cosine_distance(const std::vector<float> &feat1, const std::vector<float> &feat2) {
-    if (feat1.size() != feat2.size()) {
-        return 1.0f; // Maximum distance for mismatched features
-    }
-
-    // Re-normalize to unit length in double precision, then compute 1.0 - dot_product
-    double norm1_sq = 0.0, norm2_sq = 0.0, dot = 0.0;
-    for (size_t i = 0; i < feat1.size(); ++i) {
-        double a = static_cast<double>(feat1[i]);
-        double b = static_cast<double>(feat2[i]);
-        norm1_sq += a * a;
-        norm2_sq += b * b;
-        dot += a * b;
-    }
-    double norm1 = std::sqrt(norm1_sq);
-    double norm2 = std::sqrt(norm2_sq);
-    if (norm1 > 0.0 && norm2 > 0.0) {
-        dot /= (norm1 * norm2);
-    }
-    return static_cast<float>(1.0 - dot);
-}
-
 /**
  * @brief Calculate Intersection over Union (IoU) between two bounding boxes (0=no overlap, 1=perfect match)
  */
@@ -979,8 +1013,7 @@ float DeepSortTracker::calculate_iou(const cv::Rect_<float> &bbox1, const cv::Re
 /**
  * @brief Full Hungarian (Kuhn-Munkres) algorithm for optimal assignment
  */
-void DeepSortTracker::hungarian_assignment(const std::vector<std::vector<float>> &cost_matrix,
-                                           std::vector<std::pair<int, int>> &assignments) {
+void hungarian_assignment(const CostMatrix &cost_matrix, std::vector<std::pair<int, int>> &assignments) {
     assignments.clear();
 
     if (cost_matrix.empty())
@@ -989,16 +1022,14 @@ void DeepSortTracker::hungarian_assignment(const std::vector<std::vector<float>>
     // Epsilon tolerance for floating-point zero comparison
     constexpr float ZERO_THRESH = 1e-6f;
 
-    size_t orig_rows = cost_matrix.size();
-    size_t orig_cols = cost_matrix[0].size();
+    size_t orig_rows = cost_matrix.rows;
+    size_t orig_cols = cost_matrix.cols;
 
-    // Pad to square matrix with zeros for dummy rows/columns
+    // Pad to square row-major matrix with zeros for dummy rows/columns
     size_t n = std::max(orig_rows, orig_cols);
-    std::vector<std::vector<float>> matrix(n, std::vector<float>(n, 0.0f));
+    std::vector<float> matrix(n * n, 0.0f);
     for (size_t i = 0; i < orig_rows; ++i) {
-        for (size_t j = 0; j < orig_cols; ++j) {
-            matrix[i][j] = cost_matrix[i][j];
-        }
+        std::copy(cost_matrix.row(i), cost_matrix.row(i) + orig_cols, matrix.begin() + i * n);
     }
 
     size_t rows = n;
@@ -1006,25 +1037,25 @@ void DeepSortTracker::hungarian_assignment(const std::vector<std::vector<float>>
 
     // Step 1: Subtract row minimums
     for (size_t i = 0; i < rows; ++i) {
-        float row_min = *std::min_element(matrix[i].begin(), matrix[i].end());
+        float row_min = *std::min_element(matrix.begin() + i * n, matrix.begin() + (i + 1) * n);
         for (size_t j = 0; j < cols; ++j) {
-            matrix[i][j] -= row_min;
+            matrix[i * n + j] -= row_min;
         }
     }
 
     // Step 2: Subtract column minimums
     for (size_t j = 0; j < cols; ++j) {
-        float col_min = matrix[0][j];
+        float col_min = matrix[j];
         for (size_t i = 1; i < rows; ++i) {
-            col_min = std::min(col_min, matrix[i][j]);
+            col_min = std::min(col_min, matrix[i * n + j]);
         }
         for (size_t i = 0; i < rows; ++i) {
-            matrix[i][j] -= col_min;
+            matrix[i * n + j] -= col_min;
         }
     }
 
     // Track assignments and coverage
-    std::vector<std::vector<int>> marks(rows, std::vector<int>(cols, 0)); // 0=none, 1=star, 2=prime
+    std::vector<uint8_t> marks(rows * cols, 0); // 0=none, 1=star, 2=prime
     std::vector<bool> row_covered(rows, false);
     std::vector<bool> col_covered(cols, false);
 
@@ -1032,8 +1063,8 @@ void DeepSortTracker::hungarian_assignment(const std::vector<std::vector<float>>
     // First, find a zero and star it if no other star in same row/column
     for (size_t i = 0; i < rows; ++i) {
         for (size_t j = 0; j < cols; ++j) {
-            if (matrix[i][j] <= ZERO_THRESH && !row_covered[i] && !col_covered[j]) {
-                marks[i][j] = 1; // Star this zero
+            if (matrix[i * n + j] <= ZERO_THRESH && !row_covered[i] && !col_covered[j]) {
+                marks[i * n + j] = 1; // Star this zero
                 row_covered[i] = true;
                 col_covered[j] = true;
             }
@@ -1047,7 +1078,7 @@ void DeepSortTracker::hungarian_assignment(const std::vector<std::vector<float>>
     // Cover all columns with starred zeros
     for (size_t i = 0; i < rows; ++i) {
         for (size_t j = 0; j < cols; ++j) {
-            if (marks[i][j] == 1) {
+            if (marks[i * n + j] == 1) {
                 col_covered[j] = true;
             }
         }
@@ -1072,11 +1103,11 @@ void DeepSortTracker::hungarian_assignment(const std::vector<std::vector<float>>
 
             for (size_t i = 0; i < rows && !found_uncovered_zero; ++i) {
                 for (size_t j = 0; j < cols && !found_uncovered_zero; ++j) {
-                    if (matrix[i][j] <= ZERO_THRESH && !row_covered[i] && !col_covered[j]) {
+                    if (matrix[i * n + j] <= ZERO_THRESH && !row_covered[i] && !col_covered[j]) {
                         zero_row = i;
                         zero_col = j;
                         found_uncovered_zero = true;
-                        marks[i][j] = 2; // Prime this zero
+                        marks[i * n + j] = 2; // Prime this zero
                     }
                 }
             }
@@ -1086,7 +1117,7 @@ void DeepSortTracker::hungarian_assignment(const std::vector<std::vector<float>>
                 bool star_in_row = false;
                 size_t star_col = 0;
                 for (size_t j = 0; j < cols; ++j) {
-                    if (marks[zero_row][j] == 1) {
+                    if (marks[zero_row * n + j] == 1) {
                         star_in_row = true;
                         star_col = j;
                         break;
@@ -1108,7 +1139,7 @@ void DeepSortTracker::hungarian_assignment(const std::vector<std::vector<float>>
                         bool found_star = false;
                         size_t star_row = 0;
                         for (size_t i = 0; i < rows; ++i) {
-                            if (marks[i][path.back().second] == 1) {
+                            if (marks[i * n + path.back().second] == 1) {
                                 star_row = i;
                                 found_star = true;
                                 break;
@@ -1120,7 +1151,7 @@ void DeepSortTracker::hungarian_assignment(const std::vector<std::vector<float>>
 
                             // Find primed zero in starred zero's row
                             for (size_t j = 0; j < cols; ++j) {
-                                if (marks[star_row][j] == 2) {
+                                if (marks[star_row * n + j] == 2) {
                                     path.push_back({star_row, j});
                                     break;
                                 }
@@ -1133,17 +1164,17 @@ void DeepSortTracker::hungarian_assignment(const std::vector<std::vector<float>>
                     // Unstar each starred zero and star each primed zero in path
                     for (size_t p = 0; p < path.size(); ++p) {
                         if (p % 2 == 0) {
-                            marks[path[p].first][path[p].second] = 1; // Star
+                            marks[path[p].first * n + path[p].second] = 1; // Star
                         } else {
-                            marks[path[p].first][path[p].second] = 0; // Unstar
+                            marks[path[p].first * n + path[p].second] = 0; // Unstar
                         }
                     }
 
                     // Clear all primes and reset coverage
                     for (size_t i = 0; i < rows; ++i) {
                         for (size_t j = 0; j < cols; ++j) {
-                            if (marks[i][j] == 2)
-                                marks[i][j] = 0;
+                            if (marks[i * n + j] == 2)
+                                marks[i * n + j] = 0;
                         }
                     }
                     std::fill(row_covered.begin(), row_covered.end(), false);
@@ -1152,7 +1183,7 @@ void DeepSortTracker::hungarian_assignment(const std::vector<std::vector<float>>
                     // Cover columns with starred zeros
                     for (size_t i = 0; i < rows; ++i) {
                         for (size_t j = 0; j < cols; ++j) {
-                            if (marks[i][j] == 1) {
+                            if (marks[i * n + j] == 1) {
                                 col_covered[j] = true;
                             }
                         }
@@ -1164,7 +1195,7 @@ void DeepSortTracker::hungarian_assignment(const std::vector<std::vector<float>>
                 for (size_t i = 0; i < rows; ++i) {
                     for (size_t j = 0; j < cols; ++j) {
                         if (!row_covered[i] && !col_covered[j]) {
-                            min_uncovered = std::min(min_uncovered, matrix[i][j]);
+                            min_uncovered = std::min(min_uncovered, matrix[i * n + j]);
                         }
                     }
                 }
@@ -1173,9 +1204,9 @@ void DeepSortTracker::hungarian_assignment(const std::vector<std::vector<float>>
                 for (size_t i = 0; i < rows; ++i) {
                     for (size_t j = 0; j < cols; ++j) {
                         if (row_covered[i] && col_covered[j]) {
-                            matrix[i][j] += min_uncovered;
+                            matrix[i * n + j] += min_uncovered;
                         } else if (!row_covered[i] && !col_covered[j]) {
-                            matrix[i][j] -= min_uncovered;
+                            matrix[i * n + j] -= min_uncovered;
                         }
                     }
                 }
@@ -1186,7 +1217,7 @@ void DeepSortTracker::hungarian_assignment(const std::vector<std::vector<float>>
     // Extract final assignments from starred positions, filtering out dummy rows/columns
     for (size_t i = 0; i < orig_rows; ++i) {
         for (size_t j = 0; j < orig_cols; ++j) {
-            if (marks[i][j] == 1) {
+            if (marks[i * n + j] == 1) {
                 assignments.emplace_back(i, j);
             }
         }
@@ -11,7 +11,6 @@
 
 #include <opencv2/opencv.hpp>
 
-#include <deque>
 #include <memory>
 #include <vector>
 
@@ -32,6 +31,64 @@ constexpr float INFTY_COST = 1e5f;
 // Track states
 enum class TrackState { Tentative = 1, Confirmed = 2, Deleted = 3 };
 
+// Row-major cost matrix shared by the matching stages: rows=tracks, cols=detections
+struct CostMatrix {
+    size_t rows = 0;
+    size_t cols = 0;
+    std::vector<float> data;
+
+    void assign(size_t n_rows, size_t n_cols, float value = 0.0f) {
+        rows = n_rows;
+        cols = n_cols;
+        data.assign(n_rows * n_cols, value);
+    }
+    bool empty() const {
+        return data.empty();
+    }
+    float *row(size_t r) {
+        return data.data() + r * cols;
+    }
+    const float *row(size_t r) const {
+        return data.data() + r * cols;
+    }
+    float &at(size_t r, size_t c) {
+        return data[r * cols + c];
+    }
+    float at(size_t r, size_t c) const {
+        return data[r * cols + c];
+    }
+};
+
+// Optimal (minimum total cost) assignment of rows to columns, min(rows, cols) pairs of (row, col)
+void hungarian_assignment(const CostMatrix &cost_matrix, std::vector<std::pair<int, int>> &assignments);
+
+// Appearance features of a track, L2-normalized on insertion and stored as rows of one contiguous float matrix.
+// Holds at most `budget` rows (unlimited if budget <= 0), the oldest row is overwritten first.
+class FeatureBank {
+  public:
+    explicit FeatureBank(int budget = DEFAULT_NN_BUDGET, int dim = DEFAULT_FEATURES_VECTOR_SIZE_128);
+
+    void add(const std::vector<float> &feature);
+    size_t size() const {
+        return rows_;
+    }
+    bool empty() const {
+        return rows_ == 0;
+    }
+
+    // Nearest-neighbor cosine distance from every row of `queries` (unit-length features) to the stored features.
+    // All stored features are matched against all queries in one matrix product written to `dots`.
+    void min_cosine_distances(const cv::Mat &queries, cv::Mat &dots, float *distances) const;
+    float min_cosine_distance(const std::vector<float> &query) const;
+
+  private:
+    int budget_;
+    int dim_;
+    std::vector<float> data_; // rows_ x dim_ row-major
+    size_t rows_ = 0;
+    size_t next_row_ = 0; // row overwritten next once the budget is reached
+};
+
 // Detection structure for Deep SORT
 struct Detection {
     cv::Rect_<float> bbox;
@@ -75,7 +132,7 @@ class Track {
 
     // Feature management
     void add_feature(const std::vector<float> &feature);
-    const std::deque<std::vector<float>> &features() const {
+    const FeatureBank &features() const {
         return features_;
     }
 
@@ -116,7 +173,7 @@ class Track {
     int nn_budget_;
 
     // Feature storage for cosine distance calculation
-    std::deque<std::vector<float>> features_;
+    FeatureBank features_;
 
     void initiate(const cv::Rect_<float> &bbox);
 };
@@ -124,7 +181,7 @@ class Track {
 // Re-ID gallery entry: stores info from a deleted track for re-identification
 struct GalleryEntry {
     int track_id;
-    std::deque<std::vector<float>> features;
+    FeatureBank features;
     cv::Rect_<float> last_bbox;
     int deletion_frame;
 };
@@ -163,18 +220,18 @@ class DeepSortTracker : public ITracker {
     // Memory mapper for buffer access
     dlstreamer::MemoryMapperPtr buffer_mapper_;
 
+    // Scratch buffers reused across frames
+    CostMatrix cost_matrix_;
+    cv::Mat det_features_;
+    cv::Mat feature_dots_;
+
     // Helper methods
     std::vector<Detection> convert_detections(const std::vector<GVA::RegionOfInterest> &regions);
     void associate_detections_to_tracks(const std::vector<Detection> &detections,
                                         std::vector<std::pair<int, int>> &matches, std::vector<int> &unmatched_dets,
                                         std::vector<int> &unmatched_trks);
-    float calculate_cosine_distance(const std::vector<float> &feat1, const std::vector<float> &feat2);
     float calculate_iou(const cv::Rect_<float> &bbox1, const cv::Rect_<float> &bbox2);
 
-    // Hungarian algorithm for assignment
-    void hungarian_assignment(const std::vector<std::vector<float>> &cost_matrix,
-                              std::vector<std::pair<int, int>> &assignments);
-
     // Matching cascade for confirmed tracks (appearance-based + Mahalanobis gating)
     void matching_cascade(const std::vector<Detection> &detections, const std::vector<int> &track_indices,
                           const std::vector<int> &detection_indices, std::vector<std::pair<int, int>> &matches,
@@ -186,7 +243,7 @@ class DeepSortTracker : public ITracker {
                                std::vector<int> &unmatched_tracks, std::vector<int> &unmatched_detections);
 
     // Gate cost matrix using Mahalanobis distance
-    void gate_cost_matrix(std::vector<std::vector<float>> &cost_matrix, const std::vector<Detection> &detections,
+    void gate_cost_matrix(CostMatrix &cost_matrix, const std::vector<Detection> &detections,
                           const std::vector<int> &track_indices, const std::vector<int> &detection_indices);
 
     void parse_dps_trck_config();
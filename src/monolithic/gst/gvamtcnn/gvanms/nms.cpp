@@ -6,6 +6,7 @@
 
 #include "nms.h"
 #include "mtcnn_common.h"
+#include "non_max_suppression.h"
 #include "safe_arithmetic.hpp"
 #include "utils.h"
 #include "video_frame.h"
@@ -14,67 +15,34 @@
 
 namespace {
 
-gint compare(gconstpointer _c1, gconstpointer _c2) {
-    assert(_c1 && _c2 && "Expected valid pointers to compare");
-    const FaceCandidate *c1 = static_cast<const FaceCandidate *>(_c1);
-    const FaceCandidate *c2 = static_cast<const FaceCandidate *>(_c2);
-
-    return (c1->score > c2->score) ? -1 : ((c1->score == c2->score) ? 0 : 1);
-}
-
-gfloat iou(FaceCandidate *a, FaceCandidate *b, NMSMode mode) {
-    assert(a && b && "Expected valid pointers FaceCandidate");
-    auto x1 = std::max(a->x, b->x);
-    auto y1 = std::max(a->y, b->y);
-    auto x2 = std::min(safe_add(a->x, a->width), safe_add(b->x, b->width));
-    auto y2 = std::min(safe_add(a->y, a->height), safe_add(b->y, b->height));
-    auto w = std::max(0u, (x2 - x1 + 1));
-    auto h = std::max(0u, (y2 - y1 + 1));
-    // To avoid integer overflow, we cast to float and then do the multiplication
-    float inter = safe_convert<float>(w) * safe_convert<float>(h);
-    float areaA = safe_convert<float>(a->width) * safe_convert<float>(a->height);
-    float areaB = safe_convert<float>(b->width) * safe_convert<float>(b->height);
-    float overlap;
-
-    if (mode == NMS_MIN)
-        overlap = inter / MIN(areaA, areaB);
-    else
-        overlap = inter / (areaA + areaB - inter);
-
-    return (overlap >= 0) ? overlap : 0;
-}
-
 void _nms(GArray *results, NMSMode mode, float threshold) {
     assert(results && "Expected valid pointer GArray");
 
-    guint num;
-    guint i, j;
-
-    g_array_sort(results, compare);
-    num = results->len;
-
-    for (i = 0; i < num; i++) {
-        FaceCandidate *first = &g_array_index(results, FaceCandidate, i);
-        if (first->valid == TRUE) {
-            for (j = i + 1; j < num; j++) {
-                FaceCandidate *candi = &g_array_index(results, FaceCandidate, j);
-                if (candi->valid == TRUE) {
-                    if (iou(first, candi, mode) > threshold) {
-                        candi->valid = FALSE;
-                    }
-                }
-            }
-        }
+    // Scratch buffers are reused by every buffer processed on the streaming thread
+    thread_local Utils::NmsEngine engine;
+    thread_local Utils::NmsBoxes boxes;
+    thread_local std::vector<FaceCandidate> kept_candidates;
+
+    Utils::NmsOptions options;
+    options.overlap_threshold = threshold;
+    options.overlap = (mode == NMS_MIN) ? Utils::NmsOverlap::MIN_AREA : Utils::NmsOverlap::UNION;
+    engine.setOptions(options);
+
+    boxes.clear();
+    boxes.reserve(results->len);
+    for (guint i = 0; i < results->len; i++) {
+        const FaceCandidate *c = &g_array_index(results, FaceCandidate, i);
+        boxes.add(safe_convert<float>(c->x), safe_convert<float>(c->y), safe_convert<float>(safe_add(c->x, c->width)),
+                  safe_convert<float>(safe_add(c->y, c->height)), static_cast<float>(c->score));
     }
 
-    i = 0;
-    do {
-        FaceCandidate *c = &g_array_index(results, FaceCandidate, i);
-        if (c->valid == FALSE)
-            g_array_remove_index(results, i);
-        else
-            i++;
-    } while (i < results->len);
+    // Kept candidates come back by descending score
+    kept_candidates.clear();
+    for (size_t index : engine.run(boxes))
+        kept_candidates.push_back(g_array_index(results, FaceCandidate, index));
+
+    g_array_set_size(results, 0);
+    g_array_append_vals(results, kept_candidates.data(), kept_candidates.size());
 }
 
 gboolean process_pnet_nms(GstGvaNms *nms, GstBuffer *buffer) {
@@ -55,6 +55,10 @@
 #define DEFAULT_MIN_BATCH_TIMEOUT -1
 #define DEFAULT_MAX_BATCH_TIMEOUT INT_MAX
 
+#define DEFAULT_MIN_BATCH_DEADLINE -1
+#define DEFAULT_MAX_BATCH_DEADLINE INT_MAX
+#define DEFAULT_BATCH_DEADLINE -1
+
 #define DEFAULT_MIN_RESHAPE_WIDTH 0
 #define DEFAULT_MAX_RESHAPE_WIDTH UINT_MAX
 #define DEFAULT_RESHAPE_WIDTH 0
@@ -102,6 +106,7 @@ enum {
     PROP_RESHAPE,
     PROP_BATCH_SIZE,
     PROP_BATCH_TIMEOUT,
+    PROP_BATCH_DEADLINE,
     PROP_RESHAPE_WIDTH,
     PROP_RESHAPE_HEIGHT,
     PROP_NO_BLOCK,
@@ -317,6 +322,17 @@ void gva_base_inference_class_init(GvaBaseInferenceClass *klass) {
                          "Note: Not supported with VA backends (pre-process-backend=va or va-surface-sharing).",
                          DEFAULT_MIN_BATCH_TIMEOUT, DEFAULT_MAX_BATCH_TIMEOUT, DEFAULT_BATCH_TIMEOUT, param_flags));
 
+    g_object_class_install_property(
+        gobject_class, PROP_BATCH_DEADLINE,
+        g_param_spec_int("batch-deadline", "Batch deadline",
+                         "Maximum time (ms) the oldest frame may wait in a partially filled batch. When the deadline "
+                         "expires, the partial batch is submitted for inference with its tail padded, so batch-size > 1 "
+                         "does not add unbounded latency on low frame rate sources. Unlike batch-timeout, this is "
+                         "handled by the inference backend itself and works with any device and memory type. "
+                         "Value -1 disables the deadline, waiting for a full batch.",
+                         DEFAULT_MIN_BATCH_DEADLINE, DEFAULT_MAX_BATCH_DEADLINE, DEFAULT_BATCH_DEADLINE,
+                         param_flags));
+
     g_object_class_install_property(
         gobject_class, PROP_INFERENCE_INTERVAL,
         g_param_spec_uint("inference-interval", "Inference Interval",
@@ -595,6 +611,7 @@ void gva_base_inference_init(GvaBaseInference *base_inference) {
     base_inference->reshape = DEFAULT_RESHAPE;
     base_inference->batch_size = DEFAULT_BATCH_SIZE;
     base_inference->batch_timeout = DEFAULT_BATCH_TIMEOUT;
+    base_inference->batch_deadline = DEFAULT_BATCH_DEADLINE;
     base_inference->reshape_width = DEFAULT_RESHAPE_WIDTH;
     base_inference->reshape_height = DEFAULT_RESHAPE_HEIGHT;
     base_inference->no_block = DEFAULT_NO_BLOCK;
@@ -883,6 +900,9 @@ void gva_base_inference_set_property(GObject *object, guint property_id, const G
     case PROP_BATCH_TIMEOUT:
         base_inference->batch_timeout = g_value_get_int(value);
         break;
+    case PROP_BATCH_DEADLINE:
+        base_inference->batch_deadline = g_value_get_int(value);
+        break;
     case PROP_RESHAPE_WIDTH:
         base_inference->reshape_width = g_value_get_uint(value);
         break;
@@ -1022,6 +1042,9 @@ void gva_base_inference_get_property(GObject *object, guint property_id, GValue
     case PROP_BATCH_TIMEOUT:
         g_value_set_int(value, base_inference->batch_timeout);
         break;
+    case PROP_BATCH_DEADLINE:
+        g_value_set_int(value, base_inference->batch_deadline);
+        break;
     case PROP_RESHAPE_WIDTH:
         g_value_set_uint(value, base_inference->reshape_width);
         break;
@@ -1347,13 +1370,15 @@ gboolean gva_base_inference_start(GstBaseTransform *trans) {
         base_inference,
         "%s inference parameters:\n -- Model: %s\n -- Model proc: %s\n "
         "-- Device: %s\n -- Inference interval: %d\n -- Reshape: %s\n -- Batch size: %d\n -- Batch timeout: %d\n "
-        "-- Reshape width: %d\n -- Reshape height: %d\n -- No block: %s\n -- Num of requests: %d\n "
+        "-- Batch deadline: %d\n -- Reshape width: %d\n -- Reshape height: %d\n -- No block: %s\n "
+        "-- Num of requests: %d\n "
         "-- Model instance ID: %s\n -- CPU streams: %d\n -- GPU streams: %d\n -- IE config: %s\n "
         "-- Allocator name: %s\n -- Preprocessing type: %s\n -- Object class: %s\n "
         "-- Labels: %s\n",
         GST_ELEMENT_NAME(GST_ELEMENT_CAST(base_inference)), base_inference->model, base_inference->model_proc,
         base_inference->device, base_inference->inference_interval, base_inference->reshape ? "true" : "false",
-        base_inference->batch_size, base_inference->batch_timeout, base_inference->reshape_width,
+        base_inference->batch_size, base_inference->batch_timeout, base_inference->batch_deadline,
+        base_inference->reshape_width,
         base_inference->reshape_height, base_inference->no_block ? "true" : "false", base_inference->nireq,
         base_inference->model_instance_id, base_inference->cpu_streams, base_inference->gpu_streams,
         base_inference->ie_config, base_inference->allocator_name, base_inference->pre_proc_type,
@@ -1394,6 +1419,8 @@ gboolean gva_base_inference_stop(GstBaseTransform *trans) {
 
     try {
         self->inference->FlushInference();
+        // frames still queued won't be pushed from a stopped element
+        self->inference->ReleaseElement(self);
     } catch (const std::exception &e) {
         GST_ELEMENT_ERROR(self, CORE, STATE_CHANGE, ("base_inference failed on stop"),
                           ("%s", Utils::createNestedErrorMsg(e).c_str()));
@@ -59,6 +59,7 @@ typedef struct _GvaBaseInference {
     guint inference_interval;
     guint batch_size;
     gint batch_timeout;
+    gint batch_deadline;
     guint reshape_width;
     guint reshape_height;
     guint nireq;
@@ -8,11 +8,10 @@
 
 #include "gstgvaclassify.h"
 #include "gva_base_inference.h"
-#include "model_api_converters.h"
 #include "model_proc_provider.h"
+#include "model_registry.h"
 
 #include <map>
-#include <openvino/openvino.hpp>
 #include <string>
 
 namespace {
@@ -44,20 +43,10 @@ bool model_requires_depth_roi_mode(GvaBaseInference *base_inference) {
         return is_depth_model;
     }
 
-    if (base_inference->ov_extension_lib && base_inference->ov_extension_lib[0] != '\0') {
-        static ov::Core extension_core;
-        extension_core.add_extension(base_inference->ov_extension_lib);
-        auto model = extension_core.read_model(base_inference->model);
-        auto output_processors = ModelApiConverters::get_model_info_postproc(model, base_inference->model);
-        const bool is_depth_model = is_depth_estimation_output_processor(output_processors);
-        for (auto &entry : output_processors)
-            gst_structure_free(entry.second);
-        return is_depth_model;
-    }
-
-    static ov::Core core;
-    auto model = core.read_model(base_inference->model);
-    auto output_processors = ModelApiConverters::get_model_info_postproc(model, base_inference->model);
+    // the model is parsed once and shared with the inference instance created later
+    const gchar *ov_extension_lib = base_inference->ov_extension_lib;
+    auto output_processors =
+        ModelRegistry::get_model_info_postproc(base_inference->model, ov_extension_lib ? ov_extension_lib : "");
     const bool is_depth_model = is_depth_estimation_output_processor(output_processors);
     for (auto &entry : output_processors)
         gst_structure_free(entry.second);
@@ -55,6 +55,10 @@ namespace {
 const int DEFAULT_GPU_DRM_ID = 128;          // -> /dev/dri/renderD128
 const int MAX_STREAMS_SHARING_VADISPLAY = 4; // Maximum number of streams sharing the same VADisplay context
 
+// Safety net for waiting on downstream queue: state changes (e.g. PAUSED -> READY) flush the queue without pushing
+// any buffer, so no probe notification arrives
+constexpr auto DOWNSTREAM_WAIT_FALLBACK = std::chrono::milliseconds(100);
+
 inline std::shared_ptr<Allocator> CreateAllocator(const char *const allocator_name) {
     std::shared_ptr<Allocator> allocator;
     if (allocator_name != nullptr) {
@@ -221,6 +225,9 @@ InferenceConfig CreateNestedInferenceConfig(GvaBaseInference *gva_base_inference
     if (batch_timeout > -1) {
         inference[ov::auto_batch_timeout.name()] = std::to_string(batch_timeout);
     }
+    if (gva_base_inference->batch_deadline > -1) {
+        base[KEY_BATCH_DEADLINE] = std::to_string(gva_base_inference->batch_deadline);
+    }
 
     // add KEY_VAAPI_THREAD_POOL_SIZE, KEY_VAAPI_FAST_SCALE_LOAD_FACTOR elements to preprocessor config
     // other elements from pre_processor info are consumed by model proc info
@@ -651,6 +658,35 @@ void UpdateClassificationHistory(gint meta_id, GvaBaseInference *gva_base_infere
         gvaclassify->classification_history->UpdateROIParams(meta_id, classification_result);
 }
 
+void UpdateClassificationHistory(GvaBaseInference *gva_base_inference,
+                                 const std::vector<std::shared_ptr<InferenceFrame>> &inference_rois) {
+    for (const std::shared_ptr<InferenceFrame> &inference_roi : inference_rois) {
+        gint meta_id = 0;
+        if (inference_roi->roi.id >= 0) {
+            GMutexLockGuard guard(&inference_roi->gva_base_inference->meta_mutex);
+            GstAnalyticsRelationMeta *relation_meta = gst_buffer_get_analytics_relation_meta(inference_roi->buffer);
+            if (!relation_meta) {
+                throw std::runtime_error("Failed to find relation meta");
+            }
+
+            GstAnalyticsODMtd od_mtd;
+            if (!gst_analytics_relation_meta_get_od_mtd(relation_meta, inference_roi->roi.id, &od_mtd)) {
+                throw std::runtime_error("Failed to find od metadata");
+            }
+
+            if (!post_processing::sameRegion(&od_mtd, &inference_roi->roi)) {
+                throw std::runtime_error("Roi and od meta are not the same region");
+            }
+
+            get_od_id(od_mtd, &meta_id);
+        }
+
+        for (const GstStructure *roi_classification : inference_roi->roi_classifications) {
+            UpdateClassificationHistory(meta_id, gva_base_inference, roi_classification);
+        }
+    }
+}
+
 MemoryType GetMemoryType(CapsFeature caps_feature) {
     switch (caps_feature) {
     case CapsFeature::SYSTEM_MEMORY_CAPS_FEATURE:
@@ -1002,6 +1038,39 @@ void InferenceImpl::FlushOutputs() {
     PushOutput();
 }
 
+/**
+ * Forgets inference element that stops or releases this instance: drops its queued frames and erases its output
+ * queue, so a new element allocated at the same address starts from a fresh queue. Releases its cached downstream
+ * queue, so the queue isn't kept referenced and probed until the whole instance is destroyed.
+ * Acquires output_frames_mutex and downstream_mutex with std::lock_guard, one at a time.
+ */
+void InferenceImpl::ReleaseElement(GvaBaseInference *element) {
+    {
+        std::lock_guard<std::mutex> guard(downstream_mutex);
+        auto it = downstream_queues.find(&element->base_transform.element.object);
+        if (it != downstream_queues.end()) {
+            ReleaseDownstreamQueue(it->second);
+            downstream_queues.erase(it);
+        }
+    }
+
+    {
+        std::lock_guard<std::mutex> guard(output_frames_mutex);
+        auto it = output_frames.find(element);
+        if (it == output_frames.end())
+            return;
+
+        SourceOutput &source = *it->second;
+        for (OutputFrame &frame : source.frames)
+            gst_buffer_unref(frame.buffer);
+        output_frames_count -= source.frames.size();
+        source.frames.clear();
+        source.first_seq = source.next_seq;
+        output_frames.erase(it);
+    }
+    output_frames_cv.notify_all();
+}
+
 void InferenceImpl::UpdateObjectClasses(const gchar *obj_classes_str) {
     // Lock mutex to avoid data race in case of shared inference instance in multichannel mode
     std::unique_lock<std::mutex> lock(_mutex);
@@ -1065,6 +1134,11 @@ bool InferenceImpl::FilterObjectClass(const std::string &object_class) const {
 InferenceImpl::~InferenceImpl() {
     for (auto proc : model.output_processor_info)
         gst_structure_free(proc.second);
+
+    std::lock_guard<std::mutex> guard(downstream_mutex);
+    for (auto &downstream : downstream_queues)
+        ReleaseDownstreamQueue(downstream.second);
+    downstream_queues.clear();
 }
 
 bool InferenceImpl::IsRoiSizeValid(const GstVideoRegionOfInterestMeta *roi_meta) {
@@ -1143,103 +1217,252 @@ void InferenceImpl::SetAffinityMask(const WinCorePinningMask &mask) {
 #endif
 
 /**
+ * Returns output queue of inference element, creates it on first use.
+ * Must be called with output_frames_mutex held.
+ */
+InferenceImpl::SourceOutput &InferenceImpl::GetSourceOutput(GvaBaseInference *filter) {
+    auto &source = output_frames[filter];
+    if (!source)
+        source = std::make_shared<SourceOutput>();
+    return *source;
+}
+
+/**
+ * Returns queued frame by its sequence number or nullptr if it was already pushed.
+ * Must be called with output_frames_mutex held.
+ */
+InferenceImpl::OutputFrame *InferenceImpl::FindOutputFrame(GvaBaseInference *filter, uint64_t sequence) {
+    auto it = output_frames.find(filter);
+    if (it == output_frames.end())
+        return nullptr;
+
+    SourceOutput &source = *it->second;
+    if (sequence < source.first_seq || sequence >= source.next_seq)
+        return nullptr;
+    return &source.frames[sequence - source.first_seq];
+}
+
+/**
+ * Returns latest presentation timestamp among queued frames. Frames of one element are queued in presentation order,
+ * so only the tail of each queue is inspected.
+ * Must be called with output_frames_mutex held.
+ */
+GstClockTime InferenceImpl::GetLatestQueuedPts() const {
+    GstClockTime latest_pts = 0;
+    for (const auto &source : output_frames) {
+        const auto &frames = source.second->frames;
+        for (auto frame = frames.rbegin(); frame != frames.rend(); ++frame) {
+            if (frame->buffer->pts == GST_CLOCK_TIME_NONE)
+                continue;
+            if (frame->buffer->pts > latest_pts)
+                latest_pts = frame->buffer->pts;
+            break;
+        }
+    }
+    return latest_pts;
+}
+
+/**
+ * Pushes completed frames of all inference elements sharing this instance.
  * Acquires output_frames_mutex with std::lock_guard.
  */
 void InferenceImpl::PushOutput() {
     ITT_TASK(__FUNCTION__);
-    std::lock_guard<std::mutex> guard(output_frames_mutex);
+    std::vector<std::pair<GvaBaseInference *, std::shared_ptr<SourceOutput>>> sources;
+    {
+        std::lock_guard<std::mutex> guard(output_frames_mutex);
+        sources.reserve(output_frames.size());
+        for (auto &source : output_frames)
+            sources.emplace_back(source.first, source.second);
+    }
 
-    // track output queues that are full
-    std::map<std::string, bool> output_full;
+    // each element has own queue, so blocked output of one element doesn't hold frames of others
+    for (auto &source : sources)
+        PushSourceOutput(source.first, *source.second);
+}
 
-    auto frame = output_frames.begin();
-    while (frame != output_frames.end()) {
-        if ((*frame).inference_count != 0) {
-            break; // inference not completed yet
-        }
+/**
+ * Pops completed frames from the head of element's queue and pushes them to element's src pad.
+ * gst_pad_push is called without output_frames_mutex. If another thread is already pushing frames of this element,
+ * it is asked to make one more pass instead of waiting for it.
+ */
+void InferenceImpl::PushSourceOutput(GvaBaseInference *filter, SourceOutput &source) {
+    ITT_TASK(__FUNCTION__);
+    GstObject *src = &filter->base_transform.element.object;
 
-        for (const std::shared_ptr<InferenceFrame> &inference_roi : (*frame).inference_rois) {
-            gint meta_id = 0;
-            if (inference_roi->roi.id >= 0) {
-                GMutexLockGuard guard(&inference_roi->gva_base_inference->meta_mutex);
-                GstAnalyticsRelationMeta *relation_meta = gst_buffer_get_analytics_relation_meta(inference_roi->buffer);
-                if (!relation_meta) {
-                    throw std::runtime_error("Failed to find relation meta");
-                }
+    source.push_requested = true;
+    do {
+        std::unique_lock<std::mutex> push_lock(source.push_mutex, std::try_to_lock);
+        if (!push_lock.owns_lock())
+            return;
 
-                GstAnalyticsODMtd od_mtd;
-                if (!gst_analytics_relation_meta_get_od_mtd(relation_meta, inference_roi->roi.id, &od_mtd)) {
-                    throw std::runtime_error("Failed to find od metadata");
-                }
+        while (source.push_requested.exchange(false)) {
+            {
+                std::lock_guard<std::mutex> guard(output_frames_mutex);
+                if (source.frames.empty() || source.frames.front().inference_count != 0)
+                    continue; // inference not completed yet
+            }
 
-                if (!post_processing::sameRegion(&od_mtd, &inference_roi->roi)) {
-                    throw std::runtime_error("Roi and od meta are not the same region");
+            // do not send frames to a blocked output, they are pushed on the next completion or flush
+            if (CheckSrcPadBlocked(src))
+                return;
+
+            std::vector<OutputFrame> ready_frames;
+            {
+                std::lock_guard<std::mutex> guard(output_frames_mutex);
+                while (!source.frames.empty() && source.frames.front().inference_count == 0) {
+                    ready_frames.push_back(std::move(source.frames.front()));
+                    source.frames.pop_front();
+                    ++source.first_seq;
+                    --output_frames_count;
                 }
-
-                get_od_id(od_mtd, &meta_id);
             }
+            if (ready_frames.empty())
+                continue;
+            output_frames_cv.notify_all();
 
-            for (const GstStructure *roi_classification : inference_roi->roi_classifications) {
-                UpdateClassificationHistory(meta_id, (*frame).filter, roi_classification);
+            for (OutputFrame &frame : ready_frames) {
+                try {
+                    UpdateClassificationHistory(frame.filter, frame.inference_rois);
+                } catch (const std::exception &e) {
+                    GVA_ERROR("Failed to update classification history: %s", Utils::createNestedErrorMsg(e).c_str());
+                }
+                PushBufferToSrcPad(frame);
             }
         }
+    } while (source.push_requested);
+}
+
+/**
+ * Returns downstream 'queue' element (with increased refcount) linked to src pad of inference element or nullptr.
+ * Lookup result is cached until the pad is relinked or the element is released, on first lookup a buffer probe is
+ * installed on queue's src pad to notify threads waiting in WaitSrcPadUnblocked().
+ * Acquires downstream_mutex with std::lock_guard.
+ */
+GstElement *InferenceImpl::AcquireDownstreamQueue(GstObject *src) {
+    GstPad *peer_pad = gst_pad_get_peer(GST_BASE_TRANSFORM_SRC_PAD(src));
+    if (peer_pad == nullptr)
+        return nullptr;
+
+    std::lock_guard<std::mutex> guard(downstream_mutex);
+
+    auto it = downstream_queues.find(src);
+    if (it != downstream_queues.end()) {
+        if (it->second.peer_pad == peer_pad) {
+            gst_object_unref(peer_pad);
+            return it->second.queue ? GST_ELEMENT(gst_object_ref(it->second.queue)) : nullptr;
+        }
+        // src pad was relinked
+        ReleaseDownstreamQueue(it->second);
+        downstream_queues.erase(it);
+    }
+
+    // entry takes ownership of peer pad reference
+    DownstreamQueue downstream;
+    downstream.peer_pad = peer_pad;
+
+    GstObject *dst = gst_pad_get_parent(peer_pad);
+    if (dst != nullptr) {
+        // validate dst is actually a GstElement before casting
+        if (!GST_IS_ELEMENT(dst)) {
+            GST_WARNING_OBJECT(src, "Downstream parent is not a GstElement");
+            gst_object_unref(dst);
+            dst = nullptr;
+        }
+    }
 
-        // 'output_frames' queue can be shared across streams and it is subject to HOL blocking
-        // do not send frame to a blocked output, but check if there frames ready to non-blocked outputs
-        GstObject *src = &(*frame).filter->base_transform.element.object;
-        if (CheckSrcPadBlocked(src) || output_full[src->name]) {
-            output_full[src->name] = true;
-            frame++; // output blocked, try next frame
+    if (dst != nullptr) {
+        // use factory name for precise queue detection
+        // Handles auto-named instances: queue0, queue1, etc.
+        GstElementFactory *factory = gst_element_get_factory(GST_ELEMENT(dst));
+        const gchar *factory_name = factory ? gst_plugin_feature_get_name(GST_PLUGIN_FEATURE(factory)) : nullptr;
+
+        if (factory_name && strcmp(factory_name, "queue") == 0) {
+            downstream.queue = GST_ELEMENT(dst);
+            downstream.queue_src_pad = gst_element_get_static_pad(downstream.queue, "src");
+            if (downstream.queue_src_pad)
+                downstream.probe_id = gst_pad_add_probe(
+                    downstream.queue_src_pad,
+                    static_cast<GstPadProbeType>(GST_PAD_PROBE_TYPE_BUFFER | GST_PAD_PROBE_TYPE_BUFFER_LIST),
+                    DownstreamQueueProbe, this, nullptr);
         } else {
-            PushBufferToSrcPad(*frame);
-            frame = output_frames.erase(frame);
+            gst_object_unref(dst);
         }
     }
+
+    downstream_queues[src] = downstream;
+    return downstream.queue ? GST_ELEMENT(gst_object_ref(downstream.queue)) : nullptr;
 }
 
-bool InferenceImpl::CheckSrcPadBlocked(GstObject *src) {
-    bool blocked = false;
+void InferenceImpl::ReleaseDownstreamQueue(DownstreamQueue &downstream) {
+    if (downstream.queue_src_pad) {
+        if (downstream.probe_id)
+            gst_pad_remove_probe(downstream.queue_src_pad, downstream.probe_id);
+        gst_object_unref(downstream.queue_src_pad);
+    }
+    if (downstream.queue)
+        gst_object_unref(downstream.queue);
+    if (downstream.peer_pad)
+        gst_object_unref(downstream.peer_pad);
+    downstream = DownstreamQueue();
+}
 
-    // store peer pad to properly unref it
-    GstPad *peer_pad = gst_pad_get_peer(GST_BASE_TRANSFORM_SRC_PAD(src));
-    if (peer_pad == nullptr)
-        return false;
+GstPadProbeReturn InferenceImpl::DownstreamQueueProbe(GstPad *, GstPadProbeInfo *, gpointer user_data) {
+    auto *self = static_cast<InferenceImpl *>(user_data);
+    // cheap exit on the hot path, nobody waits for the queue to drain
+    if (self->downstream_waiters.load() == 0)
+        return GST_PAD_PROBE_OK;
 
-    GstObject *dst = gst_pad_get_parent(peer_pad);
-    gst_object_unref(peer_pad); // release peer pad ref
+    {
+        std::lock_guard<std::mutex> guard(self->downstream_mutex);
+        ++self->downstream_generation;
+    }
+    self->downstream_cv.notify_all();
+    return GST_PAD_PROBE_OK;
+}
 
-    if (dst == nullptr)
+bool InferenceImpl::CheckSrcPadBlocked(GstObject *src) {
+    GstElement *queue = AcquireDownstreamQueue(src);
+    if (queue == nullptr)
         return false;
 
-    // validate dst is actually a GstElement before casting
-    if (!GST_IS_ELEMENT(dst)) {
-        GST_WARNING_OBJECT(src, "Downstream parent is not a GstElement");
-        gst_object_unref(dst);
-        return false;
-    }
+    bool blocked = false;
 
-    // use factory name for precise queue detection
-    // Handles auto-named instances: queue0, queue1, etc.
-    GstElementFactory *factory = gst_element_get_factory(GST_ELEMENT(dst));
-    const gchar *factory_name = factory ? gst_plugin_feature_get_name(GST_PLUGIN_FEATURE(factory)) : nullptr;
+    // current state is read without waiting for pending state change, current level is only queried while paused
+    // NOTE: buf_cnt and state not queried atomically - acceptable as heuristic
+    GST_OBJECT_LOCK(queue);
+    const GstState state = GST_STATE(queue);
+    GST_OBJECT_UNLOCK(queue);
 
-    if (factory_name && strcmp(factory_name, "queue") == 0) {
+    if (state == GST_STATE_PAUSED) {
         guint buf_cnt = 0;
-        GstState state, pending;
+        g_object_get(queue, "current-level-buffers", &buf_cnt, NULL);
+        blocked = buf_cnt > 1;
+    }
+
+    gst_object_unref(queue);
+    return blocked;
+}
 
-        g_object_get(dst, "current-level-buffers", &buf_cnt, NULL);
+/**
+ * Blocks until downstream queue of inference element stops blocking. Woken up by buffer probe on queue's src pad.
+ * Must be called without holding _mutex and output_frames_mutex.
+ */
+void InferenceImpl::WaitSrcPadUnblocked(GstObject *src) {
+    ++downstream_waiters;
+    auto waiters_guard = makeScopeGuard([this] { --downstream_waiters; });
 
-        // use timeout instead of GST_CLOCK_TIME_NONE to avoid blocking
-        // NOTE: buf_cnt and state not queried atomically - acceptable as heuristic
-        gst_element_get_state(GST_ELEMENT(dst), &state, &pending, 10 * GST_MSECOND);
+    std::unique_lock<std::mutex> lock(downstream_mutex);
+    // generation is captured before the check, so a drain happening in between is not lost
+    uint64_t generation = downstream_generation;
+    lock.unlock();
 
-        if ((buf_cnt > 1) && (state == GST_STATE_PAUSED)) {
-            blocked = true;
-        }
+    while (CheckSrcPadBlocked(src)) {
+        lock.lock();
+        downstream_cv.wait_for(lock, DOWNSTREAM_WAIT_FALLBACK, [&] { return downstream_generation != generation; });
+        generation = downstream_generation;
+        lock.unlock();
     }
-
-    gst_object_unref(dst);
-    return blocked;
 }
 
 void InferenceImpl::PushBufferToSrcPad(OutputFrame &output_frame) {
@@ -1256,7 +1479,7 @@ void InferenceImpl::PushBufferToSrcPad(OutputFrame &output_frame) {
 std::shared_ptr<InferenceImpl::InferenceResult>
 InferenceImpl::MakeInferenceResult(GvaBaseInference *gva_base_inference, Model &model,
                                    GstVideoRegionOfInterestMeta *meta, std::shared_ptr<InferenceBackend::Image> &image,
-                                   GstBuffer *buffer) {
+                                   GstBuffer *buffer, uint64_t sequence) {
     auto result = std::make_shared<InferenceResult>();
     /* expect that std::make_shared must throw instead of returning nullptr */
     assert(result.get() != nullptr && "Expected a valid InferenceResult");
@@ -1273,11 +1496,13 @@ InferenceImpl::MakeInferenceResult(GvaBaseInference *gva_base_inference, Model &
 
     result->model = &model;
     result->image = image;
+    result->sequence = sequence;
     return result;
 }
 
 GstFlowReturn InferenceImpl::SubmitImages(GvaBaseInference *gva_base_inference,
-                                          const std::vector<GstVideoRegionOfInterestMeta> &metas, GstBuffer *buffer) {
+                                          const std::vector<GstVideoRegionOfInterestMeta> &metas, GstBuffer *buffer,
+                                          uint64_t sequence) {
     ITT_TASK(__FUNCTION__);
     try {
         if (!gva_base_inference)
@@ -1301,27 +1526,33 @@ GstFlowReturn InferenceImpl::SubmitImages(GvaBaseInference *gva_base_inference,
         if (!image)
             throw std::invalid_argument("image is null");
 
-        size_t i = 0;
+        // All ROIs of the frame are handed over at once, so that the backend can pre-process them in parallel
+        std::vector<InferenceBackend::ImageInference::IFrameBase::Ptr> frames;
+        std::vector<std::map<std::string, InferenceBackend::InputLayerDesc::Ptr>> input_preprocessors;
+        frames.reserve(metas.size());
+        input_preprocessors.reserve(metas.size());
+
         const auto execution_region = gva_base_inference->effective_inference_region;
         for (auto meta : metas) {
-            // Workaround for CodeCoverity
-            if (!image)
-                break;
-
-            ApplyImageBoundaries(image, &meta, execution_region, buffer);
-            auto result = MakeInferenceResult(gva_base_inference, model, &meta, image, buffer);
-            // Because image is a shared pointer with custom deleter which performs buffer unmapping
-            // we need to manually reset it after we passed it to the last InferenceResult
-            // Otherwise it may try to unmap buffer which is already pushed to downstream
-            // if completion callback is called before we exit this scope
-            if (++i == metas.size())
-                image.reset();
-            std::map<std::string, InferenceBackend::InputLayerDesc::Ptr> input_preprocessors;
+            // Frames are pre-processed after the loop, so each ROI gets its own copy of the image descriptor to keep
+            // its crop rectangle. The copy holds a reference to the mapped image.
+            InferenceBackend::ImagePtr roi_image(new InferenceBackend::Image(*image),
+                                                 [image](InferenceBackend::Image *copy) { delete copy; });
+            ApplyImageBoundaries(roi_image, &meta, execution_region, buffer);
+            frames.push_back(MakeInferenceResult(gva_base_inference, model, &meta, roi_image, buffer, sequence));
+            input_preprocessors.emplace_back();
             if (!model.input_processor_info.empty() && gva_base_inference->input_prerocessors_factory)
-                input_preprocessors =
+                input_preprocessors.back() =
                     gva_base_inference->input_prerocessors_factory(model.inference, model.input_processor_info, &meta);
-            model.inference->SubmitImage(std::move(result), input_preprocessors);
         }
+
+        // Because image is a shared pointer with custom deleter which performs buffer unmapping
+        // we need to manually reset it after we passed it to the last InferenceResult
+        // Otherwise it may try to unmap buffer which is already pushed to downstream
+        // if completion callback is called before we exit this scope
+        image.reset();
+        if (!frames.empty())
+            model.inference->SubmitImages(frames, input_preprocessors);
     } catch (const std::exception &e) {
         std::throw_with_nested(std::runtime_error("Failed to submit images to inference"));
     }
@@ -1408,6 +1639,7 @@ GstFlowReturn InferenceImpl::TransformFrameIp(GvaBaseInference *gva_base_inferen
     }
 
     // push into output_frames queue
+    uint64_t sequence = 0;
     {
         ITT_TASK("InferenceImpl::TransformFrameIp pushIntoOutputFramesQueue");
         std::unique_lock output_lock(output_frames_mutex);
@@ -1418,7 +1650,7 @@ GstFlowReturn InferenceImpl::TransformFrameIp(GvaBaseInference *gva_base_inferen
             output_lock.unlock();
             lock.unlock();
             GVA_INFO("Wait on blocking output <%s>", src->name);
-            std::this_thread::sleep_for(std::chrono::milliseconds(10));
+            WaitSrcPadUnblocked(src);
             lock.lock();
             output_lock.lock();
         }
@@ -1426,35 +1658,35 @@ GstFlowReturn InferenceImpl::TransformFrameIp(GvaBaseInference *gva_base_inferen
         // schedule frames according to their presentation time
         if (!strcmp(gva_base_inference->scheduling_policy, "latency")) {
             // find latest presentation timestamp in buffered frames
-            GstClockTime latest_pts = 0;
-            for (const auto &output_frame : output_frames)
-                if ((output_frame.buffer->pts != GST_CLOCK_TIME_NONE) && (output_frame.buffer->pts > latest_pts))
-                    latest_pts = output_frame.buffer->pts;
+            GstClockTime latest_pts = GetLatestQueuedPts();
 
             // pause if total number of buffered frames exceeds max number of frames in flight,
             // and frame presentation time is later than ones already queued
             while ((buffer->pts > latest_pts) &&
-                   (output_frames.size() > model.inference->GetNireq() * model.inference->GetBatchSize() *
-                                               gva_base_inference->inference_interval)) {
-                output_lock.unlock();
+                   (output_frames_count > model.inference->GetNireq() * model.inference->GetBatchSize() *
+                                              gva_base_inference->inference_interval)) {
+                // output_frames_mutex is held from the check until the wait, so completion can't be missed
                 lock.unlock();
-                std::this_thread::sleep_for(std::chrono::milliseconds(10));
+                output_frames_cv.wait(output_lock);
+                output_lock.unlock();
                 lock.lock();
                 output_lock.lock();
-                for (const auto &output_frame : output_frames)
-                    if ((output_frame.buffer->pts != GST_CLOCK_TIME_NONE) && (output_frame.buffer->pts > latest_pts))
-                        latest_pts = output_frame.buffer->pts;
+                latest_pts = std::max(latest_pts, GetLatestQueuedPts());
             }
         }
 
-        if (!inference_count && output_frames.empty()) {
-            // If we don't need to run inference and there are no frames queued for inference then finish transform
+        SourceOutput &source = GetSourceOutput(gva_base_inference);
+        if (!inference_count && source.frames.empty()) {
+            // If we don't need to run inference and there are no frames of this element queued for inference then
+            // finish transform
             return GST_FLOW_OK;
         }
 
+        sequence = source.next_seq++;
         InferenceImpl::OutputFrame output_frame = {
             .buffer = buffer, .inference_count = inference_count, .filter = gva_base_inference, .inference_rois = {}};
-        output_frames.push_back(output_frame);
+        source.frames.push_back(std::move(output_frame));
+        ++output_frames_count;
 
         // No need to unref buffer copy further
         buf_guard.disable();
@@ -1464,29 +1696,28 @@ GstFlowReturn InferenceImpl::TransformFrameIp(GvaBaseInference *gva_base_inferen
         }
     }
 
-    return SubmitImages(gva_base_inference, metas, buffer);
+    return SubmitImages(gva_base_inference, metas, buffer, sequence);
 }
 
 void InferenceImpl::PushFramesIfInferenceFailed(
     std::vector<std::shared_ptr<InferenceBackend::ImageInference::IFrameBase>> frames) {
-    std::lock_guard<std::mutex> guard(output_frames_mutex);
-    for (auto &frame : frames) {
-        auto inference_result = std::dynamic_pointer_cast<InferenceResult>(frame);
-        /* InferenceResult is inherited from IFrameBase */
-        assert(inference_result.get() != nullptr && "Expected a valid InferenceResult");
-
-        std::shared_ptr<InferenceFrame> inference_roi = inference_result->inference_frame;
-        auto it =
-            std::find_if(output_frames.begin(), output_frames.end(), [inference_roi](const OutputFrame &output_frame) {
-                return output_frame.buffer == inference_roi->buffer;
-            });
-
-        if (it == output_frames.end())
-            continue;
+    {
+        std::lock_guard<std::mutex> guard(output_frames_mutex);
+        for (auto &frame : frames) {
+            auto inference_result = std::dynamic_pointer_cast<InferenceResult>(frame);
+            /* InferenceResult is inherited from IFrameBase */
+            assert(inference_result.get() != nullptr && "Expected a valid InferenceResult");
+
+            std::shared_ptr<InferenceFrame> inference_roi = inference_result->inference_frame;
+            OutputFrame *output_frame = FindOutputFrame(inference_roi->gva_base_inference, inference_result->sequence);
+            if (output_frame == nullptr)
+                continue;
 
-        PushBufferToSrcPad(*it);
-        output_frames.erase(it);
+            // don't wait for other ROIs of this frame, it's pushed as soon as preceding frames are completed
+            output_frame->inference_count = 0;
+        }
     }
+    PushOutput();
 }
 
 /**
@@ -1495,30 +1726,19 @@ void InferenceImpl::PushFramesIfInferenceFailed(
  * Acquires output_frames_mutex with std::lock_guard.
  *
  * @param[in] inference_roi - InferenceFrame to provide buffer's and inference element's info
+ * @param[in] sequence - sequence number of output_frame assigned in TransformFrameIp
  */
-void InferenceImpl::UpdateOutputFrames(std::shared_ptr<InferenceFrame> &inference_roi) {
+void InferenceImpl::UpdateOutputFrames(std::shared_ptr<InferenceFrame> &inference_roi, uint64_t sequence) {
     assert(inference_roi && "Inference frame is null");
     std::lock_guard<std::mutex> guard(output_frames_mutex);
 
-    /* we must iterate through std::list because it has no lookup operations */
-    for (auto &output_frame : output_frames) {
-        if (output_frame.buffer != inference_roi->buffer)
-            continue;
+    OutputFrame *output_frame = FindOutputFrame(inference_roi->gva_base_inference, sequence);
+    // frame can be already released if inference of its other ROI failed
+    if (output_frame == nullptr || output_frame->inference_count == 0)
+        return;
 
-        /* only gvadetect or full-frame elements are affecting buffer */
-        if (inference_roi->gva_base_inference->type == GST_GVA_DETECT_TYPE ||
-            inference_roi->gva_base_inference->effective_inference_region == FULL_FRAME) {
-            if (output_frame.inference_count == 0)
-                // This condition is necessary if two items in output_frames refer to the same buffer.
-                // If current output_frame.inference_count equals 0, then inference for this output_frame
-                // already happened, but buffer wasn't pushed further by pipeline yet. We skip this buffer
-                // to find another, to which current inference callback really belongs
-                continue;
-        }
-        output_frame.inference_rois.push_back(inference_roi);
-        --output_frame.inference_count;
-        break;
-    }
+    output_frame->inference_rois.push_back(inference_roi);
+    --output_frame->inference_count;
 }
 
 /**
@@ -1539,6 +1759,7 @@ void InferenceImpl::InferenceCompletionCallback(
         return;
 
     std::vector<std::shared_ptr<InferenceFrame>> inference_frames;
+    std::vector<uint64_t> sequences;
     PostProcessor *post_proc = nullptr;
 
     for (auto &frame : frames) {
@@ -1552,6 +1773,7 @@ void InferenceImpl::InferenceCompletionCallback(
         post_proc = inference_roi->gva_base_inference->post_proc;
 
         inference_frames.push_back(inference_roi);
+        sequences.push_back(inference_result->sequence);
     }
 
     try {
@@ -1564,8 +1786,8 @@ void InferenceImpl::InferenceCompletionCallback(
         GST_ERROR("%s", Utils::createNestedErrorMsg(e).c_str());
     }
 
-    for (auto &inference_roi : inference_frames) {
-        UpdateOutputFrames(inference_roi);
+    for (size_t i = 0; i < inference_frames.size(); i++) {
+        UpdateOutputFrames(inference_frames[i], sequences[i]);
     }
     PushOutput();
 }
@@ -15,10 +15,14 @@
 #include <gst/video/video.h>
 
 #include <gst/analytics/analytics.h>
-#include <list>
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <map>
 #include <memory>
 #include <mutex>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 class InferenceImpl {
@@ -39,6 +43,7 @@ class InferenceImpl {
     GstFlowReturn TransformFrameIp(GvaBaseInference *element, GstBuffer *buffer);
     void FlushOutputs();
     void FlushInference();
+    void ReleaseElement(GvaBaseInference *element);
     const Model &GetModel() const;
 
     void UpdateObjectClasses(const gchar *obj_classes_str);
@@ -67,6 +72,7 @@ class InferenceImpl {
         std::shared_ptr<InferenceFrame> inference_frame;
         Model *model;
         std::shared_ptr<InferenceBackend::Image> image;
+        uint64_t sequence = 0; // sequence number of OutputFrame within its inference element
     };
 
     enum InferenceStatus {
@@ -89,8 +95,40 @@ class InferenceImpl {
         std::vector<std::shared_ptr<InferenceFrame>> inference_rois;
     };
 
-    std::list<OutputFrame> output_frames;
+    // Frames of one inference element waiting for inference completion, in submission order.
+    // Frame with sequence number 'seq' is stored at index 'seq - first_seq', so lookup is constant-time.
+    struct SourceOutput {
+        std::deque<OutputFrame> frames;
+        uint64_t first_seq = 0;
+        uint64_t next_seq = 0;
+        // serializes pushes to element's src pad to keep frame order, never held together with output_frames_mutex
+        std::mutex push_mutex;
+        std::atomic<bool> push_requested{false};
+    };
+
+    // instance can be shared across streams (model-instance-id), each element gets its own queue. Queues are shared
+    // with PushOutput(), which pushes them without output_frames_mutex, so a queue erased meanwhile stays alive.
+    std::unordered_map<GvaBaseInference *, std::shared_ptr<SourceOutput>> output_frames;
+    size_t output_frames_count = 0;
     std::mutex output_frames_mutex;
+    // signaled when frames leave 'output_frames'
+    std::condition_variable output_frames_cv;
+
+    // Downstream 'queue' element of each inference element sharing this instance. A buffer probe on the queue's src
+    // pad wakes up streaming threads waiting for the queue to drain.
+    struct DownstreamQueue {
+        // sink pad linked to inference element's src pad
+        GstPad *peer_pad = nullptr;
+        // nullptr if downstream element is not a queue
+        GstElement *queue = nullptr;
+        GstPad *queue_src_pad = nullptr;
+        gulong probe_id = 0;
+    };
+    std::map<GstObject *, DownstreamQueue> downstream_queues;
+    std::mutex downstream_mutex;
+    std::condition_variable downstream_cv;
+    uint64_t downstream_generation = 0; // incremented on every buffer leaving a downstream queue with waiters
+    std::atomic<int> downstream_waiters{0};
 
 #ifndef _WIN32
     void SetAffinityMask(const cpu_set_t &mask);
@@ -98,21 +136,30 @@ class InferenceImpl {
     void SetAffinityMask(const WinCorePinningMask &mask);
 #endif
     void PushOutput();
+    void PushSourceOutput(GvaBaseInference *filter, SourceOutput &source);
+    SourceOutput &GetSourceOutput(GvaBaseInference *filter);
+    OutputFrame *FindOutputFrame(GvaBaseInference *filter, uint64_t sequence);
+    GstClockTime GetLatestQueuedPts() const;
     bool CheckSrcPadBlocked(GstObject *src);
+    void WaitSrcPadUnblocked(GstObject *src);
+    GstElement *AcquireDownstreamQueue(GstObject *src);
+    static void ReleaseDownstreamQueue(DownstreamQueue &downstream);
+    static GstPadProbeReturn DownstreamQueueProbe(GstPad *pad, GstPadProbeInfo *info, gpointer user_data);
     void PushBufferToSrcPad(OutputFrame &output_frame);
     void PushFramesIfInferenceFailed(std::vector<std::shared_ptr<InferenceBackend::ImageInference::IFrameBase>> frames);
     void InferenceCompletionCallback(std::map<std::string, InferenceBackend::OutputBlob::Ptr> blobs,
                                      std::vector<std::shared_ptr<InferenceBackend::ImageInference::IFrameBase>> frames);
-    void UpdateOutputFrames(std::shared_ptr<InferenceFrame> &inference_roi);
+    void UpdateOutputFrames(std::shared_ptr<InferenceFrame> &inference_roi, uint64_t sequence);
     Model CreateModel(GvaBaseInference *gva_base_inference, const std::string &model_file,
                       const std::string &model_proc_path, const std::string &labels_str,
                       const std::string &custom_preproc_lib);
     void UpdateModelReshapeInfo(GvaBaseInference *gva_base_inference);
 
     GstFlowReturn SubmitImages(GvaBaseInference *gva_base_inference,
-                               const std::vector<GstVideoRegionOfInterestMeta> &metas, GstBuffer *buffer);
+                               const std::vector<GstVideoRegionOfInterestMeta> &metas, GstBuffer *buffer,
+                               uint64_t sequence);
     std::shared_ptr<InferenceResult> MakeInferenceResult(GvaBaseInference *gva_base_inference, Model &model,
                                                          GstVideoRegionOfInterestMeta *meta,
                                                          std::shared_ptr<InferenceBackend::Image> &image,
-                                                         GstBuffer *buffer);
+                                                         GstBuffer *buffer, uint64_t sequence);
 };
@@ -80,6 +80,7 @@ void fillElementProps(GvaBaseInference *targetElem, GvaBaseInference *masterElem
     COPY_GSTRING(targetElem->model_proc, masterElem->model_proc);
     targetElem->batch_size = masterElem->batch_size;
     targetElem->batch_timeout = masterElem->batch_timeout;
+    targetElem->batch_deadline = masterElem->batch_deadline;
     targetElem->inference_interval = masterElem->inference_interval;
     targetElem->no_block = masterElem->no_block;
     targetElem->nireq = masterElem->nireq;
@@ -193,7 +194,8 @@ void release_inference_instance(GvaBaseInference *base_inference) {
 
         for (auto it = inference_pool_.begin(); it != inference_pool_.end();) {
             auto infRefs = it->second;
-            infRefs->refs.erase(base_inference);
+            if (infRefs->refs.erase(base_inference) && infRefs->proxy)
+                infRefs->proxy->ReleaseElement(base_inference);
             if (infRefs->refs.empty()) {
                 infRefs->proxy.reset();
                 infRefs.reset();
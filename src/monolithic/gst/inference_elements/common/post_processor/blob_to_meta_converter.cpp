@@ -120,7 +120,19 @@ std::string checkOnNameDeprecation(const std::string &converter_name) {
 BlobToMetaConverter::BlobToMetaConverter(Initializer initializer)
     : model_name(initializer.model_name), input_image_info(initializer.input_image_info),
       outputs_info(initializer.outputs_info), model_proc_output_info(std::move(initializer.model_proc_output_info)),
-      labels(initializer.labels), skip_raw_tensors(initializer.skip_raw_tensors) {
+      labels(initializer.labels), skip_raw_tensors(initializer.skip_raw_tensors), label_interner(labels) {
+}
+
+GstStructure *BlobToMetaConverter::createDetectionTensor(const DetectionRecord &detection) const {
+    GstStructure *detection_tensor = gst_structure_copy(model_proc_output_info.get());
+
+    gst_structure_set_name(detection_tensor, "detection"); // make sure name="detection"
+    gst_structure_set(detection_tensor, "label_id", G_TYPE_INT, detection.label_id, "confidence", G_TYPE_DOUBLE,
+                      detection.confidence, "x_min", G_TYPE_DOUBLE, detection.x_min, "x_max", G_TYPE_DOUBLE,
+                      detection.x_max, "y_min", G_TYPE_DOUBLE, detection.y_min, "y_max", G_TYPE_DOUBLE,
+                      detection.y_max, "rotation", G_TYPE_DOUBLE, detection.rotation, NULL);
+
+    return detection_tensor;
 }
 
 BlobToMetaConverter::Ptr BlobToMetaConverter::create(Initializer initializer, ConverterType converter_type,
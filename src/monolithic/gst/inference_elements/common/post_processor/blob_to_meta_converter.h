@@ -9,6 +9,7 @@
 #include "environment_variable_options_reader.h"
 #include "gst_smart_pointer_types.hpp"
 #include "inference_backend/image_inference.h"
+#include "label_interner.h"
 #include "post_proc_common.h"
 #include "tensor.h"
 
@@ -42,6 +43,9 @@ class BlobToMetaConverter {
     const std::vector<std::string> labels;
     const bool skip_raw_tensors;
 
+    // labels interned once, other label strings produced by the model are cached per converter
+    mutable LabelInterner label_interner;
+
   public:
     const std::string &getModelName() const {
         return model_name;
@@ -103,6 +107,17 @@ class BlobToMetaConverter {
         return convert(output_blobs);
     }
 
+    // Typed entry point for detection converters. Returns false if the converter produces GstStructure
+    // tensors only, in which case callers fall back to convert().
+    virtual bool convertDetections(const OutputBlobs &output_blobs, DetectionsTable &detections) {
+        (void)output_blobs;
+        (void)detections;
+        return false;
+    }
+
+    // Builds the legacy "detection" GstStructure exposed to GstVideoRegionOfInterestMeta consumers.
+    GstStructure *createDetectionTensor(const DetectionRecord &detection) const;
+
     using Ptr = std::unique_ptr<BlobToMetaConverter>;
     static Ptr create(Initializer initializer, ConverterType converter_type,
                       const std::string &displayed_layer_name_in_meta, const std::string &custom_postproc_lib);
@@ -111,6 +126,19 @@ class BlobToMetaConverter {
         return labels;
     }
 
+    // Quarks of getLabels(), in the same order
+    const std::vector<GQuark> &getLabelQuarks() const {
+        return label_interner.label_quarks();
+    }
+
+    // Label quark for analytics metadata, without taking GLib's quark lock for labels seen before
+    GQuark internLabel(const std::string &label) const {
+        return label_interner.intern(label);
+    }
+    GQuark internLabel(const char *label) const {
+        return label_interner.intern(label);
+    }
+
     virtual ~BlobToMetaConverter() = default;
 };
 
@@ -172,14 +172,23 @@ OutputBlobs ConverterFacade::extractProcessedOutputBlobs(const OutputBlobs &all_
 }
 
 void ConverterFacade::convert(const OutputBlobs &all_output_blobs, FramesWrapper &frames) const {
-    TensorsTable tensors_batch;
-    if (process_all_outputs)
-        tensors_batch = blob_to_meta->convert(all_output_blobs, frames);
-    else {
-        const auto processed_output_blobs = extractProcessedOutputBlobs(all_output_blobs);
-        tensors_batch = blob_to_meta->convert(processed_output_blobs, frames);
+    OutputBlobs processed_output_blobs;
+    if (not process_all_outputs)
+        processed_output_blobs = extractProcessedOutputBlobs(all_output_blobs);
+    const OutputBlobs &output_blobs = process_all_outputs ? all_output_blobs : processed_output_blobs;
+
+    // Detection converters hand over typed records, GstStructure is built only for the attached ROI meta
+    DetectionsTable detections_batch;
+    if (blob_to_meta->convertDetections(output_blobs, detections_batch)) {
+        if (frames.need_coordinate_restore() && coordinates_restorer != nullptr)
+            coordinates_restorer->restoreDetections(detections_batch, frames);
+
+        meta_attacher->attachDetections(detections_batch, frames, *blob_to_meta);
+        return;
     }
 
+    TensorsTable tensors_batch = blob_to_meta->convert(output_blobs, frames);
+
     if (frames.need_coordinate_restore() && coordinates_restorer != nullptr)
         coordinates_restorer->restore(tensors_batch, frames);
 
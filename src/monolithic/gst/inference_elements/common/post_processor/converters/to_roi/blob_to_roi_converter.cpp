@@ -27,11 +27,11 @@
 #include "yolo_x.h"
 
 #include "inference_backend/logger.h"
+#include "safe_arithmetic.hpp"
 
 #include <gst/gst.h>
 
 #include <algorithm>
-#include <cassert>
 #include <exception>
 #include <map>
 #include <memory>
@@ -138,7 +138,39 @@ TensorsTable BlobToROIConverter::toTensorsTable(const DetectedObjectsTable &bbox
     return tensors_table;
 }
 
-TensorsTable BlobToROIConverter::storeObjects(DetectedObjectsTable &objects_table) const {
+DetectionsTable BlobToROIConverter::toDetectionsTable(DetectedObjectsTable &bboxes_table) const {
+    size_t batch_size = getModelInputImageInfo().batch_size;
+
+    if (bboxes_table.size() != batch_size)
+        throw std::logic_error("bboxes_table and batch_size must be equal.");
+
+    DetectionsTable detections_table(batch_size);
+
+    for (size_t image_id = 0; image_id < batch_size; ++image_id) {
+        auto &detections = detections_table[image_id];
+        auto &bboxes = bboxes_table[image_id];
+        // one allocation per image, records are filled in place
+        detections.resize(bboxes.size());
+        for (size_t i = 0; i < bboxes.size(); ++i) {
+            DetectedObject &object = bboxes[i];
+            DetectionRecord &detection = detections[i];
+
+            detection.x_min = object.x;
+            detection.y_min = object.y;
+            detection.x_max = object.x + object.w;
+            detection.y_max = object.y + object.h;
+            detection.rotation = object.r;
+            detection.confidence = object.confidence;
+            detection.label_id = safe_convert<int>(object.label_id);
+            detection.label = internLabel(object.label);
+            detection.tensors = std::move(object.tensors);
+        }
+    }
+
+    return detections_table;
+}
+
+void BlobToROIConverter::filterObjects(DetectedObjectsTable &objects_table) const {
     ITT_TASK(__FUNCTION__);
     if (need_nms)
         for (auto &objects : objects_table)
@@ -148,43 +180,92 @@ TensorsTable BlobToROIConverter::storeObjects(DetectedObjectsTable &objects_tabl
         std::erase_if(objects, [](auto &detection) { return !detection.isDetectionValid(); });
         std::for_each(objects.begin(), objects.end(), [](auto &detection) { detection.validateKeypoints(); });
     }
+}
 
+TensorsTable BlobToROIConverter::storeObjects(DetectedObjectsTable &objects_table) const {
+    ITT_TASK(__FUNCTION__);
+    filterObjects(objects_table);
     return toTensorsTable(objects_table);
 }
 
+TensorsTable BlobToROIConverter::convert(const OutputBlobs &output_blobs) {
+    DetectedObjectsTable objects_table = decode(output_blobs);
+    return storeObjects(objects_table);
+}
+
+bool BlobToROIConverter::convertDetections(const OutputBlobs &output_blobs, DetectionsTable &detections) {
+    ITT_TASK(__FUNCTION__);
+    DetectedObjectsTable objects_table = decode(output_blobs);
+    filterObjects(objects_table);
+    detections = toDetectionsTable(objects_table);
+    return true;
+}
+
+Utils::NmsOptions BlobToROIConverter::nmsOptionsFromModelProc(const GstStructure *model_proc_output_info,
+                                                              double iou_threshold) {
+    Utils::NmsOptions options;
+    options.overlap_threshold = static_cast<float>(iou_threshold);
+    if (model_proc_output_info == nullptr)
+        return options;
+
+    gboolean class_aware = FALSE;
+    if (gst_structure_get_boolean(model_proc_output_info, "nms_class_aware", &class_aware))
+        options.class_aware = class_aware;
+
+    const gchar *method = gst_structure_get_string(model_proc_output_info, "nms_method");
+    if (method != nullptr) {
+        const std::string method_name = method;
+        if (method_name == "hard")
+            options.method = Utils::NmsMethod::HARD;
+        else if (method_name == "soft-linear")
+            options.method = Utils::NmsMethod::SOFT_LINEAR;
+        else if (method_name == "soft-gaussian")
+            options.method = Utils::NmsMethod::SOFT_GAUSSIAN;
+        else
+            throw std::invalid_argument("Unsupported nms_method '" + method_name +
+                                        "'. Expected one of: hard, soft-linear, soft-gaussian.");
+    }
+
+    return options;
+}
+
 void BlobToROIConverter::runNms(std::vector<DetectedObject> &candidates) const {
     ITT_TASK(__FUNCTION__);
-    std::sort(candidates.rbegin(), candidates.rend());
+    // Scratch buffers live as long as the streaming thread, so steady-state frames do not allocate
+    thread_local Utils::NmsEngine engine;
+    thread_local Utils::NmsBoxes boxes;
+    thread_local std::vector<uint8_t> keep_mask;
+
+    boxes.clear();
+    boxes.reserve(candidates.size());
+    for (const auto &candidate : candidates)
+        boxes.add(static_cast<float>(candidate.x), static_cast<float>(candidate.y),
+                  static_cast<float>(candidate.x + candidate.w), static_cast<float>(candidate.y + candidate.h),
+                  static_cast<float>(candidate.confidence), safe_convert<int>(candidate.label_id));
 
-    for (auto p_first_candidate = candidates.begin(); p_first_candidate != candidates.end(); ++p_first_candidate) {
-        const auto &first_candidate = *p_first_candidate;
-        double first_candidate_area = first_candidate.w * first_candidate.h;
-
-        for (auto p_candidate = p_first_candidate + 1; p_candidate != candidates.end();) {
-            const auto &candidate = *p_candidate;
-
-            const double inter_width = std::min(first_candidate.x + first_candidate.w, candidate.x + candidate.w) -
-                                       std::max(first_candidate.x, candidate.x);
-            const double inter_height = std::min(first_candidate.y + first_candidate.h, candidate.y + candidate.h) -
-                                        std::max(first_candidate.y, candidate.y);
-            if (inter_width <= 0.0 || inter_height <= 0.0) {
-                ++p_candidate;
-                continue;
-            }
-
-            const double inter_area = inter_width * inter_height;
-            const double candidate_area = candidate.w * candidate.h;
-            const double union_area = candidate_area + first_candidate_area - inter_area;
-
-            assert(union_area != 0 && "union_area is null. Both of the boxes have zero areas.");
-            const double overlap = inter_area / union_area;
-            if (overlap > iou_threshold) {
-                for (auto tensor : p_candidate->tensors) {
-                    gst_structure_free(tensor);
-                }
-                p_candidate = candidates.erase(p_candidate);
-            } else
-                ++p_candidate;
+    engine.setOptions(nms_options);
+    const std::vector<size_t> &kept = engine.run(boxes);
+
+    keep_mask.assign(candidates.size(), 0);
+    for (size_t index : kept)
+        keep_mask[index] = 1;
+
+    // Compact survivors in one pass instead of erasing from the middle of the vector
+    const bool soft = nms_options.method != Utils::NmsMethod::HARD;
+    size_t survivors = 0;
+    for (size_t i = 0; i < candidates.size(); ++i) {
+        if (!keep_mask[i]) {
+            for (auto tensor : candidates[i].tensors)
+                gst_structure_free(tensor);
+            continue;
         }
+        if (survivors != i)
+            candidates[survivors] = std::move(candidates[i]);
+        if (soft)
+            candidates[survivors].confidence = boxes.score[i];
+        ++survivors;
     }
+    candidates.erase(candidates.begin() + survivors, candidates.end());
+
+    std::sort(candidates.rbegin(), candidates.rend());
 }
@@ -9,6 +9,8 @@
 #include "post_processor/blob_to_meta_converter.h"
 #include "post_processor/post_proc_common.h"
 
+#include "non_max_suppression.h"
+
 #include <dlstreamer/gst/videoanalytics/tensor.h>
 #include <gst/gst.h>
 
@@ -135,13 +137,23 @@ class BlobToROIConverter : public BlobToMetaConverter {
     };
     using DetectedObjectsTable = std::vector<std::vector<DetectedObject>>;
 
+    // Decodes model outputs into per-image candidates. NMS and validation are applied by filterObjects().
+    virtual DetectedObjectsTable decode(const OutputBlobs &output_blobs) = 0;
+
+    void filterObjects(DetectedObjectsTable &objects_table) const;
     TensorsTable storeObjects(DetectedObjectsTable &objects) const;
     void runNms(std::vector<DetectedObject> &candidates) const;
     TensorsTable toTensorsTable(const DetectedObjectsTable &bboxes_table) const;
+    DetectionsTable toDetectionsTable(DetectedObjectsTable &bboxes_table) const;
 
     const double confidence_threshold;
     const bool need_nms;
     const double iou_threshold;
+    const Utils::NmsOptions nms_options;
+
+    // Reads optional "nms_class_aware" and "nms_method" from model-proc
+    static Utils::NmsOptions nmsOptionsFromModelProc(const GstStructure *model_proc_output_info,
+                                                     double iou_threshold);
 
   public:
     BlobToROIConverter() = delete;
@@ -149,10 +161,12 @@ class BlobToROIConverter : public BlobToMetaConverter {
     BlobToROIConverter(BlobToMetaConverter::Initializer initializer, double confidence_threshold, bool need_nms,
                        double iou_threshold)
         : BlobToMetaConverter(std::move(initializer)), confidence_threshold(confidence_threshold), need_nms(need_nms),
-          iou_threshold(iou_threshold) {
+          iou_threshold(iou_threshold),
+          nms_options(nmsOptionsFromModelProc(model_proc_output_info.get(), iou_threshold)) {
     }
 
-    virtual TensorsTable convert(const OutputBlobs &output_blobs) = 0;
+    TensorsTable convert(const OutputBlobs &output_blobs) override;
+    bool convertDetections(const OutputBlobs &output_blobs, DetectionsTable &detections) override;
 
     static BlobToMetaConverter::Ptr create(BlobToMetaConverter::Initializer initializer,
                                            const std::string &converter_name, const std::string &custom_postproc_lib);
@@ -126,7 +126,7 @@ void BoxesLabelsScoresConverter::parseOutputBlob(const float *boxes_data, const
     }
 }
 
-TensorsTable BoxesLabelsScoresConverter::convert(const OutputBlobs &output_blobs) {
+BlobToROIConverter::DetectedObjectsTable BoxesLabelsScoresConverter::decode(const OutputBlobs &output_blobs) {
     ITT_TASK(__FUNCTION__);
     try {
         const auto &model_input_image_info = getModelInputImageInfo();
@@ -147,9 +147,9 @@ TensorsTable BoxesLabelsScoresConverter::convert(const OutputBlobs &output_blobs
                             boxes_blob->GetDims(), labels_scores_blob, objects, model_input_image_info, roi_scale);
         }
 
-        return storeObjects(objects_table);
+        return objects_table;
     } catch (const std::exception &e) {
         std::throw_with_nested(std::runtime_error("Failed to do ATSS post-processing."));
     }
-    return TensorsTable{};
+    return DetectedObjectsTable{};
 }
@@ -44,7 +44,7 @@ class BoxesLabelsScoresConverter : public BlobToROIConverter {
         : BlobToROIConverter(std::move(initializer), confidence_threshold, true, iou_threshold) {
     }
 
-    TensorsTable convert(const OutputBlobs &output_blobs) override;
+    DetectedObjectsTable decode(const OutputBlobs &output_blobs) override;
 
     static bool isValidModelBoxesOutput(const std::map<std::string, std::vector<size_t>> &model_outputs_info);
     static bool isValidModelAdditionalOutput(const std::map<std::string, std::vector<size_t>> &model_outputs_info,
@@ -130,7 +130,7 @@ void CenterfaceConverter::addLandmarksTensor(DetectedObject &detected_object, co
     detected_object.tensors.push_back(tensor);
 }
 
-TensorsTable CenterfaceConverter::convert(const OutputBlobs &output_blobs) {
+BlobToROIConverter::DetectedObjectsTable CenterfaceConverter::decode(const OutputBlobs &output_blobs) {
     ITT_TASK(__FUNCTION__);
     try {
         const auto &model_input_image_info = getModelInputImageInfo();
@@ -159,9 +159,9 @@ TensorsTable CenterfaceConverter::convert(const OutputBlobs &output_blobs) {
                    input_height);
         }
 
-        return storeObjects(objects_table);
+        return objects_table;
     } catch (const std::exception &e) {
         std::throw_with_nested(std::runtime_error("Failed to do Centerface post-processing."));
     }
-    return TensorsTable{};
+    return DetectedObjectsTable{};
 }
@@ -22,7 +22,7 @@
 
 using namespace post_processing;
 
-TensorsTable CustomToRoiConverter::convert(const OutputBlobs &output_blobs) {
+BlobToROIConverter::DetectedObjectsTable CustomToRoiConverter::decode(const OutputBlobs &output_blobs) {
     ITT_TASK(__FUNCTION__);
     try {
         const auto &model_input_image_info = getModelInputImageInfo();
@@ -210,9 +210,9 @@ TensorsTable CustomToRoiConverter::convert(const OutputBlobs &output_blobs) {
 
         dlclose(handle);
 
-        return storeObjects(objects_table);
+        return objects_table;
     } catch (const std::exception &e) {
         std::throw_with_nested(std::runtime_error("Failed to do YoloV8 post-processing."));
     }
-    return TensorsTable{};
+    return DetectedObjectsTable{};
 }
@@ -33,7 +33,7 @@ class CustomToRoiConverter : public BlobToROIConverter {
           custom_postproc_lib(custom_postproc_lib) {
     }
 
-    TensorsTable convert(const OutputBlobs &output_blobs) override;
+    DetectedObjectsTable decode(const OutputBlobs &output_blobs) override;
 
     static std::string getName() {
         return "custom_to_roi";
@@ -101,7 +101,7 @@ void DetectionOutputConverter::parseOutputBlob(const InferenceBackend::OutputBlo
     }
 }
 
-TensorsTable DetectionOutputConverter::convert(const OutputBlobs &output_blobs) {
+BlobToROIConverter::DetectedObjectsTable DetectionOutputConverter::decode(const OutputBlobs &output_blobs) {
     ITT_TASK(__FUNCTION__);
     try {
         const auto &model_input_image_info = getModelInputImageInfo();
@@ -123,7 +123,7 @@ TensorsTable DetectionOutputConverter::convert(const OutputBlobs &output_blobs)
             parseOutputBlob(blob, objects, roi_scale);
         }
 
-        return storeObjects(objects);
+        return objects;
     } catch (const std::exception &e) {
         std::throw_with_nested(std::runtime_error("Failed to do SSD post-processing"));
     }
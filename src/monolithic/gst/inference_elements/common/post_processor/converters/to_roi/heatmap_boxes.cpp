@@ -74,7 +74,7 @@ void HeatMapBoxesConverter::parseOutputBlob(const float *data, const std::vector
     }
 }
 
-TensorsTable HeatMapBoxesConverter::convert(const OutputBlobs &output_blobs) {
+BlobToROIConverter::DetectedObjectsTable HeatMapBoxesConverter::decode(const OutputBlobs &output_blobs) {
     ITT_TASK(__FUNCTION__);
     try {
         const auto &model_input_image_info = getModelInputImageInfo();
@@ -98,11 +98,11 @@ TensorsTable HeatMapBoxesConverter::convert(const OutputBlobs &output_blobs) {
                                 blob->GetDims(), objects);
             }
         }
-        return storeObjects(objects_table);
+        return objects_table;
     } catch (const std::exception &e) {
         std::throw_with_nested(std::runtime_error("Failed to do heatmap post-processing."));
     }
-    return TensorsTable{};
+    return DetectedObjectsTable{};
 }
 
 cv::Rect2d HeatMapBoxesConverter::findBoxDimensions(std::vector<cv::Point> &contour) const {
@@ -20,7 +20,7 @@
 
 using namespace post_processing;
 
-TensorsTable MaskRCNNConverter::convert(const OutputBlobs &output_blobs) {
+BlobToROIConverter::DetectedObjectsTable MaskRCNNConverter::decode(const OutputBlobs &output_blobs) {
     ITT_TASK(__FUNCTION__);
     try {
         const auto &model_input_image_info = getModelInputImageInfo();
@@ -164,9 +164,9 @@ TensorsTable MaskRCNNConverter::convert(const OutputBlobs &output_blobs) {
             }
         }
 
-        return storeObjects(objects_table);
+        return objects_table;
     } catch (const std::exception &e) {
         std::throw_with_nested(std::runtime_error("Failed to do Mask-RCNN post-processing."));
     }
-    return TensorsTable{};
+    return DetectedObjectsTable{};
 }
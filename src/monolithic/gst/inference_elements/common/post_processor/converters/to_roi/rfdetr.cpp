@@ -105,7 +105,7 @@ void RFDETRConverter::parseOutputBlobs(const float *logits_data, const std::vect
     }
 }
 
-TensorsTable RFDETRConverter::convert(const OutputBlobs &output_blobs) {
+BlobToROIConverter::DetectedObjectsTable RFDETRConverter::decode(const OutputBlobs &output_blobs) {
     ITT_TASK(__FUNCTION__);
     try {
         const auto &model_input_image_info = getModelInputImageInfo();
@@ -153,14 +153,14 @@ TensorsTable RFDETRConverter::convert(const OutputBlobs &output_blobs) {
                 boxes_blob->GetDims(), objects);
         }
 
-        return storeObjects(objects_table);
+        return objects_table;
     } catch (const std::exception &e) {
         std::throw_with_nested(std::runtime_error("Failed to do RF-DETR post-processing."));
     }
-    return TensorsTable{};
+    return DetectedObjectsTable{};
 }
 
-TensorsTable RFDETRSegConverter::convert(const OutputBlobs &output_blobs) {
+BlobToROIConverter::DetectedObjectsTable RFDETRSegConverter::decode(const OutputBlobs &output_blobs) {
     ITT_TASK(__FUNCTION__);
     try {
         const auto &model_input_image_info = getModelInputImageInfo();
@@ -316,9 +316,9 @@ TensorsTable RFDETRSegConverter::convert(const OutputBlobs &output_blobs) {
             }
         }
 
-        return storeObjects(objects_table);
+        return objects_table;
     } catch (const std::exception &e) {
         std::throw_with_nested(std::runtime_error("Failed to do RF-DETR-Seg post-processing."));
     }
-    return TensorsTable{};
+    return DetectedObjectsTable{};
 }
\ No newline at end of file
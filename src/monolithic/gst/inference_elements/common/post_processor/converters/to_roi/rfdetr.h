@@ -29,7 +29,7 @@ class RFDETRConverter : public BlobToROIConverter {
         : BlobToROIConverter(std::move(initializer), confidence_threshold, false, 0.0) {
     }
 
-    TensorsTable convert(const OutputBlobs &output_blobs) override;
+    DetectedObjectsTable decode(const OutputBlobs &output_blobs) override;
 
     static std::string getName() {
         return "rfdetr";
@@ -46,7 +46,7 @@ class RFDETRSegConverter : public BlobToROIConverter {
         : BlobToROIConverter(std::move(initializer), confidence_threshold, false, 0.0) {
     }
 
-    TensorsTable convert(const OutputBlobs &output_blobs) override;
+    DetectedObjectsTable decode(const OutputBlobs &output_blobs) override;
 
     static std::string getName() {
         return "rfdetr_seg";
@@ -120,7 +120,7 @@ void RTDETRConverter::parseOutputBlobs(const float *logits_data, const std::vect
     }
 }
 
-TensorsTable RTDETRConverter::convert(const OutputBlobs &output_blobs) {
+BlobToROIConverter::DetectedObjectsTable RTDETRConverter::decode(const OutputBlobs &output_blobs) {
     ITT_TASK(__FUNCTION__);
     try {
         const auto &model_input_image_info = getModelInputImageInfo();
@@ -168,9 +168,9 @@ TensorsTable RTDETRConverter::convert(const OutputBlobs &output_blobs) {
                 boxes_blob->GetDims(), objects);
         }
 
-        return storeObjects(objects_table);
+        return objects_table;
     } catch (const std::exception &e) {
         std::throw_with_nested(std::runtime_error("Failed to do RT-DETR post-processing."));
     }
-    return TensorsTable{};
+    return DetectedObjectsTable{};
 }
\ No newline at end of file
@@ -29,7 +29,7 @@ class RTDETRConverter : public BlobToROIConverter {
         : BlobToROIConverter(std::move(initializer), confidence_threshold, false, 0.0) {
     }
 
-    TensorsTable convert(const OutputBlobs &output_blobs) override;
+    DetectedObjectsTable decode(const OutputBlobs &output_blobs) override;
 
     static std::string getName() {
         return "rtdetr";
@@ -356,7 +356,7 @@ BlobToMetaConverter::Ptr YOLOBaseConverter::create(BlobToMetaConverter::Initiali
     return nullptr;
 }
 
-TensorsTable YOLOBaseConverter::convert(const OutputBlobs &output_blobs) {
+BlobToROIConverter::DetectedObjectsTable YOLOBaseConverter::decode(const OutputBlobs &output_blobs) {
     ITT_TASK(__FUNCTION__);
     try {
         const auto &model_input_image_info = getModelInputImageInfo();
@@ -384,9 +384,9 @@ TensorsTable YOLOBaseConverter::convert(const OutputBlobs &output_blobs) {
             }
         }
 
-        return storeObjects(objects_table);
+        return objects_table;
     } catch (const std::exception &e) {
         std::throw_with_nested(std::runtime_error("Failed to do YoloV3 post-processing."));
     }
-    return TensorsTable{};
+    return DetectedObjectsTable{};
 }
@@ -101,7 +101,7 @@ class YOLOBaseConverter : public BlobToROIConverter {
     }
     virtual ~YOLOBaseConverter() = default;
 
-    TensorsTable convert(const OutputBlobs &output_blobs);
+    DetectedObjectsTable decode(const OutputBlobs &output_blobs) override;
 
     static bool tryAutomaticConfig(const ModelImageInputInfo &input_info, const ModelOutputsInfo &outputs_info,
                                    OutputDimsLayout dims_layout, size_t classes, const std::vector<float> &anchors,
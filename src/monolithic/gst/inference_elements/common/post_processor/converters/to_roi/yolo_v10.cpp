@@ -63,7 +63,7 @@ void YOLOv10Converter::parseOutputBlob(const float *data, const std::vector<size
     }
 }
 
-TensorsTable YOLOv10Converter::convert(const OutputBlobs &output_blobs) {
+BlobToROIConverter::DetectedObjectsTable YOLOv10Converter::decode(const OutputBlobs &output_blobs) {
     ITT_TASK(__FUNCTION__);
     try {
         const auto &model_input_image_info = getModelInputImageInfo();
@@ -85,9 +85,9 @@ TensorsTable YOLOv10Converter::convert(const OutputBlobs &output_blobs) {
             }
         }
 
-        return storeObjects(objects_table);
+        return objects_table;
     } catch (const std::exception &e) {
         std::throw_with_nested(std::runtime_error("Failed to do YoloV10 post-processing."));
     }
-    return TensorsTable{};
+    return DetectedObjectsTable{};
 }
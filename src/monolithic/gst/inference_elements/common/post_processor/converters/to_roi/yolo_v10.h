@@ -49,7 +49,7 @@ class YOLOv10Converter : public BlobToROIConverter {
 
     const float *parseOutputBlob(const OutputBlobs &output_blobs, const std::string &key, size_t batch_size,
                                  size_t batch_number) const;
-    TensorsTable convert(const OutputBlobs &output_blobs) override;
+    DetectedObjectsTable decode(const OutputBlobs &output_blobs) override;
 
     static std::string getName() {
         return "yolo_v10";
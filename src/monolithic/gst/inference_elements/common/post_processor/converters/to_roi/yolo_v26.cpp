@@ -18,7 +18,7 @@
 
 using namespace post_processing;
 
-TensorsTable YOLOv26ObbConverter::convert(const OutputBlobs &output_blobs) {
+BlobToROIConverter::DetectedObjectsTable YOLOv26ObbConverter::decode(const OutputBlobs &output_blobs) {
     ITT_TASK(__FUNCTION__);
     try {
         const auto &model_input_image_info = getModelInputImageInfo();
@@ -40,14 +40,14 @@ TensorsTable YOLOv26ObbConverter::convert(const OutputBlobs &output_blobs) {
             }
         }
 
-        return storeObjects(objects_table);
+        return objects_table;
     } catch (const std::exception &e) {
         std::throw_with_nested(std::runtime_error("Failed to do yolo26-obb post-processing."));
     }
-    return TensorsTable{};
+    return DetectedObjectsTable{};
 }
 
-TensorsTable YOLOv26PoseConverter::convert(const OutputBlobs &output_blobs) {
+BlobToROIConverter::DetectedObjectsTable YOLOv26PoseConverter::decode(const OutputBlobs &output_blobs) {
     ITT_TASK(__FUNCTION__);
     try {
         const auto &model_input_image_info = getModelInputImageInfo();
@@ -69,11 +69,11 @@ TensorsTable YOLOv26PoseConverter::convert(const OutputBlobs &output_blobs) {
             }
         }
 
-        return storeObjects(objects_table);
+        return objects_table;
     } catch (const std::exception &e) {
         std::throw_with_nested(std::runtime_error("Failed to do yolo26-pose post-processing."));
     }
-    return TensorsTable{};
+    return DetectedObjectsTable{};
 }
 
 static const GstAnalyticsKeypointDescriptor *coco17_descriptor =
@@ -225,7 +225,7 @@ void YOLOv26SegConverter::parseOutputBlob(const float *boxes_data, const std::ve
     }
 }
 
-TensorsTable YOLOv26SegConverter::convert(const OutputBlobs &output_blobs) {
+BlobToROIConverter::DetectedObjectsTable YOLOv26SegConverter::decode(const OutputBlobs &output_blobs) {
     ITT_TASK(__FUNCTION__);
     try {
         const auto &model_input_image_info = getModelInputImageInfo();
@@ -266,9 +266,9 @@ TensorsTable YOLOv26SegConverter::convert(const OutputBlobs &output_blobs) {
                 masks_blob->GetDims(), objects);
         }
 
-        return storeObjects(objects_table);
+        return objects_table;
     } catch (const std::exception &e) {
         std::throw_with_nested(std::runtime_error("Failed to do yolo26-seg post-processing."));
     }
-    return TensorsTable{};
+    return DetectedObjectsTable{};
 }
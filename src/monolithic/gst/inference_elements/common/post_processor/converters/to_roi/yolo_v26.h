@@ -54,7 +54,7 @@ class YOLOv26ObbConverter : public YOLOv26Converter {
         : YOLOv26Converter(std::move(initializer), confidence_threshold, iou_threshold) {
     }
 
-    TensorsTable convert(const OutputBlobs &output_blobs) override;
+    DetectedObjectsTable decode(const OutputBlobs &output_blobs) override;
 
     static std::string getName() {
         return "yolo_v26_obb";
@@ -72,7 +72,7 @@ class YOLOv26PoseConverter : public YOLOv26Converter {
         : YOLOv26Converter(std::move(initializer), confidence_threshold, iou_threshold) {
     }
 
-    TensorsTable convert(const OutputBlobs &output_blobs) override;
+    DetectedObjectsTable decode(const OutputBlobs &output_blobs) override;
 
     static std::string getName() {
         return "yolo_v26_pose";
@@ -89,7 +89,7 @@ class YOLOv26SegConverter : public YOLOv26Converter {
         : YOLOv26Converter(std::move(initializer), confidence_threshold, iou_threshold) {
     }
 
-    TensorsTable convert(const OutputBlobs &output_blobs) override;
+    DetectedObjectsTable decode(const OutputBlobs &output_blobs) override;
 
     static std::string getName() {
         return "yolo_v26_seg";
@@ -71,7 +71,7 @@ void YOLOv7Converter::parseOutputBlob(const float *data, const std::vector<size_
     }
 }
 
-TensorsTable YOLOv7Converter::convert(const OutputBlobs &output_blobs) {
+BlobToROIConverter::DetectedObjectsTable YOLOv7Converter::decode(const OutputBlobs &output_blobs) {
     ITT_TASK(__FUNCTION__);
     try {
         const auto &model_input_image_info = getModelInputImageInfo();
@@ -93,9 +93,9 @@ TensorsTable YOLOv7Converter::convert(const OutputBlobs &output_blobs) {
             }
         }
 
-        return storeObjects(objects_table);
+        return objects_table;
     } catch (const std::exception &e) {
         std::throw_with_nested(std::runtime_error("Failed to do YoloV7 post-processing."));
     }
-    return TensorsTable{};
+    return DetectedObjectsTable{};
 }
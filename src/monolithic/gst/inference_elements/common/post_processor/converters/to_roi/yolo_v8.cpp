@@ -14,7 +14,9 @@
 #include <dlstreamer/gst/metadata/gstanalyticskeypointdescriptor.h>
 #include <dlstreamer/gst/videoanalytics/tensor.h>
 #include <gst/gst.h>
+#include <opencv2/core/hal/intrin.hpp>
 
+#include <algorithm>
 #include <map>
 #include <memory>
 #include <string>
@@ -22,6 +24,71 @@
 
 using namespace post_processing;
 
+namespace {
+
+// Proposals processed per block, running max/argmax of a block stays in L1 cache while class rows are scanned.
+constexpr size_t SCORE_BLOCK_SIZE = 256;
+
+struct ScoredProposal {
+    size_t index;
+    size_t class_id;
+    float score;
+};
+
+/**
+ * Scans channel-major YOLOv8 output [object_size, proposal_count] in its original layout and keeps running
+ * per-proposal max score and class id across rows [first_score_row, first_score_row + score_rows). Only proposals
+ * with score above threshold are returned. On ties the lowest class id wins, same as cv::minMaxLoc.
+ */
+void findScoredProposals(const float *data, size_t proposal_count, size_t first_score_row, size_t score_rows,
+                         double threshold, std::vector<ScoredProposal> &proposals) {
+    proposals.clear();
+    if (score_rows == 0)
+        return;
+
+    // class ids are kept as floats so that they can be updated with the same mask as scores
+    alignas(64) float max_scores[SCORE_BLOCK_SIZE];
+    alignas(64) float max_classes[SCORE_BLOCK_SIZE];
+
+    const float *scores = data + first_score_row * proposal_count;
+    for (size_t block_start = 0; block_start < proposal_count; block_start += SCORE_BLOCK_SIZE) {
+        const size_t block_size = std::min(SCORE_BLOCK_SIZE, proposal_count - block_start);
+        std::copy_n(scores + block_start, block_size, max_scores);
+        std::fill_n(max_classes, block_size, 0.0f);
+
+        for (size_t class_id = 1; class_id < score_rows; ++class_id) {
+            const float *row = scores + class_id * proposal_count + block_start;
+            const float class_value = static_cast<float>(class_id);
+            size_t i = 0;
+#if (CV_SIMD || CV_SIMD_SCALABLE)
+            const size_t lanes = cv::VTraits<cv::v_float32>::vlanes();
+            const cv::v_float32 v_class = cv::vx_setall_f32(class_value);
+            for (; i + lanes <= block_size; i += lanes) {
+                const cv::v_float32 v_score = cv::vx_load(row + i);
+                const cv::v_float32 v_max = cv::vx_load_aligned(max_scores + i);
+                const cv::v_float32 v_greater = cv::v_gt(v_score, v_max);
+                cv::v_store_aligned(max_scores + i, cv::v_select(v_greater, v_score, v_max));
+                cv::v_store_aligned(max_classes + i,
+                                    cv::v_select(v_greater, v_class, cv::vx_load_aligned(max_classes + i)));
+            }
+#endif
+            for (; i < block_size; ++i) {
+                if (row[i] > max_scores[i]) {
+                    max_scores[i] = row[i];
+                    max_classes[i] = class_value;
+                }
+            }
+        }
+
+        for (size_t i = 0; i < block_size; ++i) {
+            if (max_scores[i] > threshold)
+                proposals.push_back({block_start + i, static_cast<size_t>(max_classes[i]), max_scores[i]});
+        }
+    }
+}
+
+} // namespace
+
 void YOLOv8Converter::parseOutputBlob(const float *data, const std::vector<size_t> &dims,
                                       std::vector<DetectedObject> &objects, bool oob) const {
 
@@ -36,34 +103,32 @@ void YOLOv8Converter::parseOutputBlob(const float *data, const std::vector<size_
 
     size_t object_size = dims[dims_size - 2];
     size_t max_proposal_count = dims[dims_size - 1];
-
-    // transpose
-    cv::Mat outputs(object_size, max_proposal_count, CV_32F, (float *)data);
-    cv::transpose(outputs, outputs);
-    float *output_data = (float *)outputs.data;
-
-    for (size_t i = 0; i < max_proposal_count; ++i) {
-        float *classes_scores = output_data + YOLOV8_OFFSET_CS;
-        cv::Mat scores(1, object_size - YOLOV8_OFFSET_CS - (oob ? 1 : 0), CV_32FC1, classes_scores);
-        cv::Point class_id;
-        double maxClassScore;
-        cv::minMaxLoc(scores, 0, &maxClassScore, 0, &class_id);
-        if (maxClassScore > confidence_threshold) {
-
-            float x = output_data[YOLOV8_OFFSET_X];
-            float y = output_data[YOLOV8_OFFSET_Y];
-            float w = output_data[YOLOV8_OFFSET_W];
-            float h = output_data[YOLOV8_OFFSET_H];
-            float r = oob ? output_data[object_size - 1] : 0;
-            objects.push_back(DetectedObject(x, y, w, h, r, maxClassScore, class_id.x,
-                                             BlobToMetaConverter::getLabelByLabelId(class_id.x), 1.0f / input_width,
-                                             1.0f / input_height, true));
-        }
-        output_data += object_size;
+    size_t score_rows_end = object_size - (oob ? 1 : 0);
+    if (score_rows_end <= YOLOV8_OFFSET_CS)
+        throw std::invalid_argument("Output blob object size " + std::to_string(object_size) + " is too small.");
+
+    // output is channel-major, i-th proposal value of a field is at [field * max_proposal_count + i]
+    std::vector<ScoredProposal> proposals;
+    findScoredProposals(data, max_proposal_count, YOLOV8_OFFSET_CS, score_rows_end - YOLOV8_OFFSET_CS,
+                        confidence_threshold, proposals);
+
+    const float *x_data = data + YOLOV8_OFFSET_X * max_proposal_count;
+    const float *y_data = data + YOLOV8_OFFSET_Y * max_proposal_count;
+    const float *w_data = data + YOLOV8_OFFSET_W * max_proposal_count;
+    const float *h_data = data + YOLOV8_OFFSET_H * max_proposal_count;
+    const float *r_data = data + (object_size - 1) * max_proposal_count;
+
+    objects.reserve(objects.size() + proposals.size());
+    for (const ScoredProposal &proposal : proposals) {
+        const size_t i = proposal.index;
+        float r = oob ? r_data[i] : 0;
+        objects.push_back(DetectedObject(x_data[i], y_data[i], w_data[i], h_data[i], r, proposal.score,
+                                         proposal.class_id, BlobToMetaConverter::getLabelByLabelId(proposal.class_id),
+                                         1.0f / input_width, 1.0f / input_height, true));
     }
 }
 
-TensorsTable YOLOv8Converter::convert(const OutputBlobs &output_blobs) {
+BlobToROIConverter::DetectedObjectsTable YOLOv8Converter::decode(const OutputBlobs &output_blobs) {
     ITT_TASK(__FUNCTION__);
     try {
         const auto &model_input_image_info = getModelInputImageInfo();
@@ -85,14 +150,14 @@ TensorsTable YOLOv8Converter::convert(const OutputBlobs &output_blobs) {
             }
         }
 
-        return storeObjects(objects_table);
+        return objects_table;
     } catch (const std::exception &e) {
         std::throw_with_nested(std::runtime_error("Failed to do YoloV8 post-processing."));
     }
-    return TensorsTable{};
+    return DetectedObjectsTable{};
 }
 
-TensorsTable YOLOv8ObbConverter::convert(const OutputBlobs &output_blobs) {
+BlobToROIConverter::DetectedObjectsTable YOLOv8ObbConverter::decode(const OutputBlobs &output_blobs) {
     ITT_TASK(__FUNCTION__);
     try {
         const auto &model_input_image_info = getModelInputImageInfo();
@@ -114,14 +179,14 @@ TensorsTable YOLOv8ObbConverter::convert(const OutputBlobs &output_blobs) {
             }
         }
 
-        return storeObjects(objects_table);
+        return objects_table;
     } catch (const std::exception &e) {
         std::throw_with_nested(std::runtime_error("Failed to do YoloV8-OBB post-processing."));
     }
-    return TensorsTable{};
+    return DetectedObjectsTable{};
 }
 
-TensorsTable YOLOv8PoseConverter::convert(const OutputBlobs &output_blobs) {
+BlobToROIConverter::DetectedObjectsTable YOLOv8PoseConverter::decode(const OutputBlobs &output_blobs) {
     ITT_TASK(__FUNCTION__);
     try {
         const auto &model_input_image_info = getModelInputImageInfo();
@@ -143,11 +208,11 @@ TensorsTable YOLOv8PoseConverter::convert(const OutputBlobs &output_blobs) {
             }
         }
 
-        return storeObjects(objects_table);
+        return objects_table;
     } catch (const std::exception &e) {
         std::throw_with_nested(std::runtime_error("Failed to do YoloV8 post-processing."));
     }
-    return TensorsTable{};
+    return DetectedObjectsTable{};
 }
 
 static const GstAnalyticsKeypointDescriptor *coco17_descriptor =
@@ -168,66 +233,62 @@ void YOLOv8PoseConverter::parseOutputBlob(const float *data, const std::vector<s
     size_t max_proposal_count = dims[boxes_dims_size - 1];
     size_t keypoint_count = (object_size - YOLOV8_OFFSET_CS - 1) / 3;
 
-    // Transpose objects
-    cv::Mat outputs(object_size, max_proposal_count, CV_32F, (float *)data);
-    cv::transpose(outputs, outputs);
-    float *output_data = (float *)outputs.data;
-
-    for (size_t i = 0; i < max_proposal_count; ++i) {
-        float confidence = output_data[YOLOV8_OFFSET_CS];
-        if (confidence > confidence_threshold) {
-
-            // coordinates are relative to bounding box center
-            float w = output_data[YOLOV8_OFFSET_W];
-            float h = output_data[YOLOV8_OFFSET_H];
-            float x = output_data[YOLOV8_OFFSET_X] - w / 2;
-            float y = output_data[YOLOV8_OFFSET_Y] - h / 2;
-
-            auto detected_object =
-                DetectedObject(x, y, w, h, 0, confidence, 0, BlobToMetaConverter::getLabelByLabelId(0),
-                               1.0f / input_width, 1.0f / input_height, false);
-
-            // create relative keypoint positions within bounding box
-            cv::Mat positions(keypoint_count, 2, CV_32F);
-            std::vector<float> confidences(keypoint_count, 0.0f);
-            for (size_t k = 0; k < keypoint_count; k++) {
-                float position_x = output_data[YOLOV8_OFFSET_CS + 1 + k * 3 + 0];
-                float position_y = output_data[YOLOV8_OFFSET_CS + 1 + k * 3 + 1];
-                positions.at<float>(k, 0) = (position_x - x) / w;
-                positions.at<float>(k, 1) = (position_y - y) / h;
-                confidences[k] = output_data[YOLOV8_OFFSET_CS + 1 + k * 3 + 2];
-            }
-
-            // create tensor with keypoints
-            GstStructure *gst_structure = gst_structure_copy(getModelProcOutputInfo().get());
-            GVA::Tensor tensor(gst_structure);
+    // output is channel-major, i-th proposal value of a field is at [field * max_proposal_count + i]
+    auto field = [data, max_proposal_count](size_t offset, size_t i) { return data[offset * max_proposal_count + i]; };
+
+    std::vector<ScoredProposal> proposals;
+    findScoredProposals(data, max_proposal_count, YOLOV8_OFFSET_CS, 1, confidence_threshold, proposals);
+
+    for (const ScoredProposal &proposal : proposals) {
+        const size_t i = proposal.index;
+        float confidence = proposal.score;
+
+        // coordinates are relative to bounding box center
+        float w = field(YOLOV8_OFFSET_W, i);
+        float h = field(YOLOV8_OFFSET_H, i);
+        float x = field(YOLOV8_OFFSET_X, i) - w / 2;
+        float y = field(YOLOV8_OFFSET_Y, i) - h / 2;
+
+        auto detected_object = DetectedObject(x, y, w, h, 0, confidence, 0, BlobToMetaConverter::getLabelByLabelId(0),
+                                              1.0f / input_width, 1.0f / input_height, false);
+
+        // create relative keypoint positions within bounding box
+        cv::Mat positions(keypoint_count, 2, CV_32F);
+        std::vector<float> confidences(keypoint_count, 0.0f);
+        for (size_t k = 0; k < keypoint_count; k++) {
+            float position_x = field(YOLOV8_OFFSET_CS + 1 + k * 3 + 0, i);
+            float position_y = field(YOLOV8_OFFSET_CS + 1 + k * 3 + 1, i);
+            positions.at<float>(k, 0) = (position_x - x) / w;
+            positions.at<float>(k, 1) = (position_y - y) / h;
+            confidences[k] = field(YOLOV8_OFFSET_CS + 1 + k * 3 + 2, i);
+        }
 
-            tensor.set_name(GVA::GST_ANALYTICS_KEYPOINTS_2_TENSOR);
-            tensor.set_type(GVA::GST_ANALYTICS_KEYPOINTS_2_TENSOR);
-            tensor.set_format(coco17_descriptor->semantic_tag);
+        // create tensor with keypoints
+        GstStructure *gst_structure = gst_structure_copy(getModelProcOutputInfo().get());
+        GVA::Tensor tensor(gst_structure);
 
-            // set tensor data (positions)
-            tensor.set_dims({static_cast<uint32_t>(keypoint_count), 2});
-            tensor.set_data(reinterpret_cast<const void *>(positions.data), keypoint_count * 2 * sizeof(float));
-            tensor.set_precision(GVA::Tensor::Precision::FP32);
+        tensor.set_name(GVA::GST_ANALYTICS_KEYPOINTS_2_TENSOR);
+        tensor.set_type(GVA::GST_ANALYTICS_KEYPOINTS_2_TENSOR);
+        tensor.set_format(coco17_descriptor->semantic_tag);
 
-            // set additional tensor properties as vectors: confidence, point names and point connections
-            tensor.set_vector<float>("confidence", confidences);
+        // set tensor data (positions)
+        tensor.set_dims({static_cast<uint32_t>(keypoint_count), 2});
+        tensor.set_data(reinterpret_cast<const void *>(positions.data), keypoint_count * 2 * sizeof(float));
+        tensor.set_precision(GVA::Tensor::Precision::FP32);
 
-            std::vector<std::string> names(coco17_descriptor->point_names,
-                                           coco17_descriptor->point_names + coco17_descriptor->point_count);
-            std::vector<uint32_t> connections(coco17_descriptor->skeleton_connections,
-                                              coco17_descriptor->skeleton_connections +
-                                                  coco17_descriptor->skeleton_connection_count * 2);
-            tensor.set_vector<std::string>("point_names", names);
-            tensor.set_vector<uint32_t>("point_connections", connections);
+        // set additional tensor properties as vectors: confidence, point names and point connections
+        tensor.set_vector<float>("confidence", confidences);
 
-            detected_object.tensors.push_back(tensor.gst_structure());
-            objects.push_back(detected_object);
-        }
-        output_data += object_size;
+        std::vector<std::string> names(coco17_descriptor->point_names,
+                                       coco17_descriptor->point_names + coco17_descriptor->point_count);
+        std::vector<uint32_t> connections(coco17_descriptor->skeleton_connections,
+                                          coco17_descriptor->skeleton_connections +
+                                              coco17_descriptor->skeleton_connection_count * 2);
+        tensor.set_vector<std::string>("point_names", names);
+        tensor.set_vector<uint32_t>("point_connections", connections);
 
-        // Future optimization: generate masks after running NMS algorithm on detected objects
+        detected_object.tensors.push_back(tensor.gst_structure());
+        objects.push_back(detected_object);
     }
 }
 
@@ -251,74 +312,72 @@ void YOLOv8SegConverter::parseOutputBlob(const float *boxes_data, const std::vec
     size_t mask_height = masks_dims[masks_dims_size - 2];
     size_t mask_width = masks_dims[masks_dims_size - 1];
 
-    // Transpose objects
-    cv::Mat outputs(object_size, max_proposal_count, CV_32F, (float *)boxes_data);
-    cv::transpose(outputs, outputs);
-    float *output_data = (float *)outputs.data;
+    // output is channel-major, i-th proposal value of a field is at [field * max_proposal_count + i]
+    auto field = [boxes_data, max_proposal_count](size_t offset, size_t i) {
+        return boxes_data[offset * max_proposal_count + i];
+    };
 
     // Map masks
     cv::Mat masks(mask_count, mask_width * mask_height, CV_32F, (float *)masks_data);
 
-    for (size_t i = 0; i < max_proposal_count; ++i) {
-        cv::Mat class_scores(1, class_count, CV_32F, output_data + YOLOV8_OFFSET_CS);
-        cv::Mat mask_scores(1, mask_count, CV_32F, output_data + YOLOV8_OFFSET_CS + class_count);
-        cv::Point class_id;
-        double max_class_score;
-        cv::minMaxLoc(class_scores, 0, &max_class_score, 0, &class_id);
-        if (max_class_score > confidence_threshold) {
-
-            // coordinates are relative to bounding box center
-            float w = output_data[YOLOV8_OFFSET_W];
-            float h = output_data[YOLOV8_OFFSET_H];
-            float x = output_data[YOLOV8_OFFSET_X] - w / 2;
-            float y = output_data[YOLOV8_OFFSET_Y] - h / 2;
-
-            auto detected_object = DetectedObject(x, y, w, h, 0, max_class_score, class_id.x,
-                                                  BlobToMetaConverter::getLabelByLabelId(class_id.x),
-                                                  1.0f / input_width, 1.0f / input_height, false);
-
-            // compose mask for detected bounding box
-            cv::Mat composed_mask = mask_scores * masks;
-            composed_mask = composed_mask.reshape(1, mask_height);
-
-            // crop composed mask to fit into object bounding box
-            cv::Mat cropped_mask;
-            int cx = std::max(int(x * mask_width / input_width), int(0));
-            int cy = std::max(int(y * mask_height / input_height), int(0));
-            int cw = std::min(int(w * mask_width / input_width), int(mask_width - cx));
-            int ch = std::min(int(h * mask_height / input_height), int(mask_height - cy));
-            composed_mask(cv::Rect(cx, cy, cw, ch)).copyTo(cropped_mask);
-
-            // apply sigmoid activation
-            cropped_mask.forEach<float>([](float &element, const int position[]) -> void {
-                (void)position;
-                element = 1 / (1 + std::exp(-element));
-            });
-
-            // create segmentation mask tensor
-            GstStructure *gst_structure = gst_structure_copy(getModelProcOutputInfo().get());
-            GVA::Tensor tensor(gst_structure);
-            tensor.set_name("mask_yolov8");
-            tensor.set_format(GVA::TENSOR_FORMAT_INSTANCE_SEGMENTATION);
-            tensor.set_type(GVA::GST_ANALYTICS_SEGMENTATION_2_TENSOR);
-
-            // set tensor data
-            tensor.set_dims({safe_convert<uint32_t>(cropped_mask.cols), safe_convert<uint32_t>(cropped_mask.rows)});
-            tensor.set_precision(GVA::Tensor::Precision::FP32);
-            tensor.set_data(reinterpret_cast<const void *>(cropped_mask.data),
-                            cropped_mask.rows * cropped_mask.cols * sizeof(float));
-
-            // add tensor to the list of detected objects
-            detected_object.tensors.push_back(tensor.gst_structure());
-            objects.push_back(detected_object);
-        }
-        output_data += object_size;
-
-        // Future optimization: generate masks after running NMS algorithm on detected objects
+    std::vector<ScoredProposal> proposals;
+    findScoredProposals(boxes_data, max_proposal_count, YOLOV8_OFFSET_CS, class_count, confidence_threshold,
+                        proposals);
+
+    cv::Mat mask_scores(1, mask_count, CV_32F);
+    for (const ScoredProposal &proposal : proposals) {
+        const size_t i = proposal.index;
+        for (size_t m = 0; m < mask_count; ++m)
+            mask_scores.at<float>(0, m) = field(YOLOV8_OFFSET_CS + class_count + m, i);
+
+        // coordinates are relative to bounding box center
+        float w = field(YOLOV8_OFFSET_W, i);
+        float h = field(YOLOV8_OFFSET_H, i);
+        float x = field(YOLOV8_OFFSET_X, i) - w / 2;
+        float y = field(YOLOV8_OFFSET_Y, i) - h / 2;
+
+        auto detected_object = DetectedObject(x, y, w, h, 0, proposal.score, proposal.class_id,
+                                              BlobToMetaConverter::getLabelByLabelId(proposal.class_id),
+                                              1.0f / input_width, 1.0f / input_height, false);
+
+        // compose mask for detected bounding box
+        cv::Mat composed_mask = mask_scores * masks;
+        composed_mask = composed_mask.reshape(1, mask_height);
+
+        // crop composed mask to fit into object bounding box
+        cv::Mat cropped_mask;
+        int cx = std::max(int(x * mask_width / input_width), int(0));
+        int cy = std::max(int(y * mask_height / input_height), int(0));
+        int cw = std::min(int(w * mask_width / input_width), int(mask_width - cx));
+        int ch = std::min(int(h * mask_height / input_height), int(mask_height - cy));
+        composed_mask(cv::Rect(cx, cy, cw, ch)).copyTo(cropped_mask);
+
+        // apply sigmoid activation
+        cropped_mask.forEach<float>([](float &element, const int position[]) -> void {
+            (void)position;
+            element = 1 / (1 + std::exp(-element));
+        });
+
+        // create segmentation mask tensor
+        GstStructure *gst_structure = gst_structure_copy(getModelProcOutputInfo().get());
+        GVA::Tensor tensor(gst_structure);
+        tensor.set_name("mask_yolov8");
+        tensor.set_format(GVA::TENSOR_FORMAT_INSTANCE_SEGMENTATION);
+        tensor.set_type(GVA::GST_ANALYTICS_SEGMENTATION_2_TENSOR);
+
+        // set tensor data
+        tensor.set_dims({safe_convert<uint32_t>(cropped_mask.cols), safe_convert<uint32_t>(cropped_mask.rows)});
+        tensor.set_precision(GVA::Tensor::Precision::FP32);
+        tensor.set_data(reinterpret_cast<const void *>(cropped_mask.data),
+                        cropped_mask.rows * cropped_mask.cols * sizeof(float));
+
+        // add tensor to the list of detected objects
+        detected_object.tensors.push_back(tensor.gst_structure());
+        objects.push_back(detected_object);
     }
 }
 
-TensorsTable YOLOv8SegConverter::convert(const OutputBlobs &output_blobs) {
+BlobToROIConverter::DetectedObjectsTable YOLOv8SegConverter::decode(const OutputBlobs &output_blobs) {
     ITT_TASK(__FUNCTION__);
     try {
         const auto &model_input_image_info = getModelInputImageInfo();
@@ -359,9 +418,9 @@ TensorsTable YOLOv8SegConverter::convert(const OutputBlobs &output_blobs) {
                 masks_blob->GetDims(), objects);
         }
 
-        return storeObjects(objects_table);
+        return objects_table;
     } catch (const std::exception &e) {
         std::throw_with_nested(std::runtime_error("Failed to do YoloV8-SEG post-processing."));
     }
-    return TensorsTable{};
+    return DetectedObjectsTable{};
 }
\ No newline at end of file
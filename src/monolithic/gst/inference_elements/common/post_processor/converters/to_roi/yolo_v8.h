@@ -46,7 +46,7 @@ class YOLOv8Converter : public BlobToROIConverter {
         : BlobToROIConverter(std::move(initializer), confidence_threshold, true, iou_threshold) {
     }
 
-    TensorsTable convert(const OutputBlobs &output_blobs) override;
+    DetectedObjectsTable decode(const OutputBlobs &output_blobs) override;
 
     static std::string getName() {
         return "yolo_v8";
@@ -63,7 +63,7 @@ class YOLOv8ObbConverter : public YOLOv8Converter {
         : YOLOv8Converter(std::move(initializer), confidence_threshold, iou_threshold) {
     }
 
-    TensorsTable convert(const OutputBlobs &output_blobs) override;
+    DetectedObjectsTable decode(const OutputBlobs &output_blobs) override;
 
     static std::string getName() {
         return "yolo_v8_obb";
@@ -91,7 +91,7 @@ class YOLOv8PoseConverter : public YOLOv8Converter {
         : YOLOv8Converter(std::move(initializer), confidence_threshold, iou_threshold) {
     }
 
-    TensorsTable convert(const OutputBlobs &output_blobs) override;
+    DetectedObjectsTable decode(const OutputBlobs &output_blobs) override;
 
     static std::string getName() {
         return "yolo_v8_pose";
@@ -108,7 +108,7 @@ class YOLOv8SegConverter : public YOLOv8Converter {
         : YOLOv8Converter(std::move(initializer), confidence_threshold, iou_threshold) {
     }
 
-    TensorsTable convert(const OutputBlobs &output_blobs) override;
+    DetectedObjectsTable decode(const OutputBlobs &output_blobs) override;
 
     static std::string getName() {
         return "yolo_v8_seg";
@@ -153,7 +153,12 @@ void ROICoordinatesRestorer::getCoordinates(GstStructure *detection_tensor, cons
                                             uint32_t &h_abs) {
 
     getRealCoordinates(detection_tensor, x_min_real, y_min_real, x_max_real, y_max_real);
+    restoreCoordinates(frame, x_min_real, y_min_real, x_max_real, y_max_real, x_abs, y_abs, w_abs, h_abs);
+}
 
+void ROICoordinatesRestorer::restoreCoordinates(const FrameWrapper &frame, double &x_min_real, double &y_min_real,
+                                                double &x_max_real, double &y_max_real, uint32_t &x_abs,
+                                                uint32_t &y_abs, uint32_t &w_abs, uint32_t &h_abs) {
     if (frame.image_transform_info and frame.image_transform_info->WasTransformation()) {
         restoreActualCoordinates(frame, x_min_real, y_min_real);
         restoreActualCoordinates(frame, x_max_real, y_max_real);
@@ -194,6 +199,22 @@ void ROICoordinatesRestorer::restore(TensorsTable &tensors_batch, const FramesWr
     }
 }
 
+void ROICoordinatesRestorer::restoreDetections(DetectionsTable &detections_batch, const FramesWrapper &frames) {
+    try {
+        checkFramesAndTensorsTable(frames, detections_batch);
+
+        for (size_t i = 0; i < frames.size(); ++i) {
+            const auto &frame = frames[i];
+            for (DetectionRecord &detection : detections_batch[i]) {
+                restoreCoordinates(frame, detection.x_min, detection.y_min, detection.x_max, detection.y_max,
+                                   detection.x_abs, detection.y_abs, detection.w_abs, detection.h_abs);
+            }
+        }
+    } catch (const std::exception &e) {
+        GVA_ERROR("An error occurred while restoring coordinates for ROI: %s", e.what());
+    }
+}
+
 void KeypointsCoordinatesRestorer::restore(TensorsTable &tensors, const FramesWrapper &frames) {
     try {
         checkFramesAndTensorsTable(frames, tensors);
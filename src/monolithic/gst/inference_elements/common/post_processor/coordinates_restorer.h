@@ -12,6 +12,7 @@
 #include <gst/video/gstvideometa.h>
 
 #include <memory>
+#include <stdexcept>
 
 namespace post_processing {
 class CoordinatesRestorer {
@@ -28,6 +29,11 @@ class CoordinatesRestorer {
     }
 
     virtual void restore(TensorsTable &tensors_batch, const FramesWrapper &frames) = 0;
+    virtual void restoreDetections(DetectionsTable &detections_batch, const FramesWrapper &frames) {
+        (void)detections_batch;
+        (void)frames;
+        throw std::logic_error("Coordinates restorer does not support typed detection records");
+    }
 
     using Ptr = std::unique_ptr<CoordinatesRestorer>;
 
@@ -49,6 +55,8 @@ class ROICoordinatesRestorer : public CoordinatesRestorer {
     void getCoordinates(GstStructure *detection_tensor, const FrameWrapper &frame, double &x_min_real,
                         double &y_min_real, double &x_max_real, double &y_max_real, uint32_t &x_abs, uint32_t &y_abs,
                         uint32_t &w_abs, uint32_t &h_abs);
+    void restoreCoordinates(const FrameWrapper &frame, double &x_min_real, double &y_min_real, double &x_max_real,
+                            double &y_max_real, uint32_t &x_abs, uint32_t &y_abs, uint32_t &w_abs, uint32_t &h_abs);
 
   public:
     ROICoordinatesRestorer(const ModelImageInputInfo &input_info, AttachType type)
@@ -56,6 +64,7 @@ class ROICoordinatesRestorer : public CoordinatesRestorer {
     }
 
     virtual void restore(TensorsTable &tensors_batch, const FramesWrapper &frames) override;
+    virtual void restoreDetections(DetectionsTable &detections_batch, const FramesWrapper &frames) override;
 };
 
 class KeypointsCoordinatesRestorer : public CoordinatesRestorer {
@@ -42,6 +42,89 @@ MetaAttacher::Ptr MetaAttacher::create(ConverterType converter_type, AttachType
     }
 }
 
+namespace {
+// Finds class descriptor metadata matching model labels or creates a new one.
+void findOrCreateClassDescriptor(GstAnalyticsRelationMeta *relation_meta, const std::vector<GQuark> &class_quarks,
+                                 GstAnalyticsClsMtd *cls_descriptor_mtd) {
+    gsize length = class_quarks.size();
+
+    // check if class descriptor meta already exists
+    gpointer state = NULL;
+    while (gst_analytics_relation_meta_iterate(relation_meta, &state, gst_analytics_cls_mtd_get_mtd_type(),
+                                               cls_descriptor_mtd)) {
+        if (gst_analytics_cls_mtd_get_length(cls_descriptor_mtd) != length)
+            continue;
+
+        bool skip = false;
+        for (size_t k = 0; k < length; k++) {
+            if (gst_analytics_cls_mtd_get_quark(cls_descriptor_mtd, k) != class_quarks[k]) {
+                skip = true;
+                break;
+            }
+        }
+
+        if (!skip)
+            return;
+    }
+
+    // create class descriptor if one does not exists
+    std::vector<gfloat> confidence_levels(length, 0.0f);
+    std::vector<GQuark> quarks(class_quarks);
+    if (!gst_analytics_relation_meta_add_cls_mtd(relation_meta, length, confidence_levels.data(), quarks.data(),
+                                                 cls_descriptor_mtd)) {
+        throw std::runtime_error("Failed to add class descriptor to meta");
+    }
+    // Mark as class descriptor so it can be filtered out from frame-level tensors
+    gst_analytics_mtd_set_semantic_tag(reinterpret_cast<GstAnalyticsMtd *>(cls_descriptor_mtd), "class_descriptor");
+}
+
+// Links object detection metadata with the OD metadata of the region the inference ran on.
+void relateToParentRegion(GstAnalyticsRelationMeta *relation_meta, GstVideoRegionOfInterestMeta *roi_meta,
+                          const FrameWrapper &frame, const GstAnalyticsODMtd &od_mtd) {
+    if (!frame.roi)
+        return;
+
+    roi_meta->parent_id = frame.roi->id;
+    if (frame.roi->id < 0)
+        return;
+
+    GstAnalyticsODMtd parent_od_mtd;
+    if (!gst_analytics_relation_meta_get_od_mtd(relation_meta, frame.roi->id, &parent_od_mtd))
+        return;
+
+    if (!gst_analytics_relation_meta_set_relation(relation_meta, GST_ANALYTICS_REL_TYPE_IS_PART_OF, od_mtd.id,
+                                                  parent_od_mtd.id)) {
+        throw std::runtime_error("Failed to set relation between object detection metadata and parent metadata");
+    }
+
+    if (!gst_analytics_relation_meta_set_relation(relation_meta, GST_ANALYTICS_REL_TYPE_CONTAIN, parent_od_mtd.id,
+                                                  od_mtd.id)) {
+        throw std::runtime_error("Failed to set relation between object detection metadata and parent metadata");
+    }
+}
+
+// Attaches per-object tensors (keypoints, masks, ...) to the analytics relation meta of the detection.
+void attachObjectTensors(GstAnalyticsRelationMeta *relation_meta, const GstAnalyticsODMtd &od_mtd,
+                         const std::vector<GstStructure *> &object_tensors, uint32_t x_abs, uint32_t y_abs,
+                         uint32_t w_abs, uint32_t h_abs) {
+    for (GstStructure *object_tensor : object_tensors) {
+        GstAnalyticsMtd tensor_mtd;
+        GVA::Tensor gva_tensor(object_tensor);
+        if (!gva_tensor.convert_to_meta(&tensor_mtd, relation_meta, x_abs, y_abs, w_abs, h_abs))
+            continue;
+
+        if (!gst_analytics_relation_meta_set_relation(relation_meta, GST_ANALYTICS_REL_TYPE_CONTAIN, od_mtd.id,
+                                                      tensor_mtd.id)) {
+            throw std::runtime_error("Failed to set relation between object detection metadata and tensor metadata");
+        }
+        if (!gst_analytics_relation_meta_set_relation(relation_meta, GST_ANALYTICS_REL_TYPE_IS_PART_OF,
+                                                      tensor_mtd.id, od_mtd.id)) {
+            throw std::runtime_error("Failed to set relation between tensor metadata and object detection metadata");
+        }
+    }
+}
+} // namespace
+
 void ROIToFrameAttacher::attach(const TensorsTable &tensors, FramesWrapper &frames,
                                 const BlobToMetaConverter &blob_to_meta) {
     checkFramesAndTensorsTable(frames, tensors);
@@ -69,7 +152,7 @@ void ROIToFrameAttacher::attach(const TensorsTable &tensors, FramesWrapper &fram
             gva_buffer_check_and_make_writable(writable_buffer, PRETTY_FUNCTION_NAME);
 
             GMutexLockGuard guard(frame.meta_mutex);
-            GQuark gquark_label = g_quark_from_string(label);
+            GQuark gquark_label = blob_to_meta.internLabel(label);
 
             gdouble conf;
             gst_structure_get_double(detection_tensor, "confidence", &conf);
@@ -79,52 +162,9 @@ void ROIToFrameAttacher::attach(const TensorsTable &tensors, FramesWrapper &fram
             if (not relation_meta)
                 throw std::runtime_error("Failed to add GstAnalyticsRelationMeta to buffer");
 
-            const auto &labels = blob_to_meta.getLabels();
-            if (j == 0 && !labels.empty()) {
-                gsize length = labels.size();
-                std::vector<gfloat> confidence_levels(length, 0.0f);
-                std::vector<GQuark> class_quarks(length, 0);
-
-                for (size_t i = 0; i < length; i++) {
-                    class_quarks[i] = g_quark_from_string(labels[i].c_str());
-                }
-
-                // find or create class descriptor metadata
-                bool found = false;
-                gpointer state = NULL;
-
-                // check if class descriptor meta already exists
-                while (gst_analytics_relation_meta_iterate(relation_meta, &state, gst_analytics_cls_mtd_get_mtd_type(),
-                                                           &cls_descriptor_mtd)) {
-                    if (gst_analytics_cls_mtd_get_length(&cls_descriptor_mtd) == length) {
-                        bool skip = false;
-                        for (size_t k = 0; k < length; k++) {
-                            if (gst_analytics_cls_mtd_get_quark(&cls_descriptor_mtd, k) != class_quarks[k]) {
-                                skip = true;
-                                break;
-                            }
-                        }
-
-                        if (skip) {
-                            continue;
-                        }
-
-                        found = true;
-                        break;
-                    }
-                }
-
-                // create class descriptor if one does not exists
-                if (!found) {
-                    if (!gst_analytics_relation_meta_add_cls_mtd(relation_meta, length, confidence_levels.data(),
-                                                                 class_quarks.data(), &cls_descriptor_mtd)) {
-                        throw std::runtime_error("Failed to add class descriptor to meta");
-                    }
-                    // Mark as class descriptor so it can be filtered out from frame-level tensors
-                    gst_analytics_mtd_set_semantic_tag(reinterpret_cast<GstAnalyticsMtd *>(&cls_descriptor_mtd),
-                                                       "class_descriptor");
-                }
-            }
+            const auto &label_quarks = blob_to_meta.getLabelQuarks();
+            if (j == 0 && !label_quarks.empty())
+                findOrCreateClassDescriptor(relation_meta, label_quarks, &cls_descriptor_mtd);
 
             gdouble rotation = 0;
             gst_structure_get_double(detection_tensor, "rotation", &rotation);
@@ -149,50 +189,16 @@ void ROIToFrameAttacher::attach(const TensorsTable &tensors, FramesWrapper &fram
                 }
             }
 
-            for (size_t k = 0; k < tensor[j].size(); k++) {
-                GstAnalyticsMtd tensor_mtd;
-                GVA::Tensor gva_tensor(tensor[j][k]);
-                if (gva_tensor.convert_to_meta(&tensor_mtd, relation_meta, x_abs, y_abs, w_abs, h_abs)) {
-                    if (!gst_analytics_relation_meta_set_relation(relation_meta, GST_ANALYTICS_REL_TYPE_CONTAIN,
-                                                                  od_mtd.id, tensor_mtd.id)) {
-                        throw std::runtime_error(
-                            "Failed to set relation between object detection metadata and tensor metadata");
-                    }
-                    if (!gst_analytics_relation_meta_set_relation(relation_meta, GST_ANALYTICS_REL_TYPE_IS_PART_OF,
-                                                                  tensor_mtd.id, od_mtd.id)) {
-                        throw std::runtime_error(
-                            "Failed to set relation between tensor metadata and object detection metadata");
-                    }
-                }
-            }
+            attachObjectTensors(relation_meta, od_mtd, tensor[j], x_abs, y_abs, w_abs, h_abs);
 
-            GstVideoRegionOfInterestMeta *roi_meta =
-                gst_buffer_add_video_region_of_interest_meta(*writable_buffer, label, x_abs, y_abs, w_abs, h_abs);
+            GstVideoRegionOfInterestMeta *roi_meta = gst_buffer_add_video_region_of_interest_meta_id(
+                *writable_buffer, gquark_label, x_abs, y_abs, w_abs, h_abs);
 
             if (not roi_meta)
                 throw std::runtime_error("Failed to add GstVideoRegionOfInterestMeta to buffer");
 
             roi_meta->id = od_mtd.id;
-            if (frame.roi) {
-                roi_meta->parent_id = frame.roi->id;
-
-                if (frame.roi->id >= 0) {
-                    GstAnalyticsODMtd parent_od_mtd;
-                    if (gst_analytics_relation_meta_get_od_mtd(relation_meta, frame.roi->id, &parent_od_mtd)) {
-                        if (!gst_analytics_relation_meta_set_relation(relation_meta, GST_ANALYTICS_REL_TYPE_IS_PART_OF,
-                                                                      od_mtd.id, parent_od_mtd.id)) {
-                            throw std::runtime_error(
-                                "Failed to set relation between object detection metadata and parent metadata");
-                        }
-
-                        if (!gst_analytics_relation_meta_set_relation(relation_meta, GST_ANALYTICS_REL_TYPE_CONTAIN,
-                                                                      parent_od_mtd.id, od_mtd.id)) {
-                            throw std::runtime_error(
-                                "Failed to set relation between object detection metadata and parent metadata");
-                        }
-                    }
-                }
-            }
+            relateToParentRegion(relation_meta, roi_meta, frame, od_mtd);
 
             gst_structure_remove_field(detection_tensor, "label");
             gst_structure_remove_field(detection_tensor, "x_abs");
@@ -207,6 +213,83 @@ void ROIToFrameAttacher::attach(const TensorsTable &tensors, FramesWrapper &fram
     }
 }
 
+void ROIToFrameAttacher::attachDetections(DetectionsTable &detections_batch, FramesWrapper &frames,
+                                          const BlobToMetaConverter &blob_to_meta) {
+    checkFramesAndTensorsTable(frames, detections_batch);
+
+    const auto &label_quarks = blob_to_meta.getLabelQuarks();
+    const std::string &od_model_name = blob_to_meta.getModelName();
+
+    for (size_t i = 0; i < frames.size(); ++i) {
+        auto &frame = frames[i];
+        auto &detections = detections_batch[i];
+        if (detections.empty())
+            continue;
+
+        GstBuffer **writable_buffer = &frame.buffer;
+        gva_buffer_check_and_make_writable(writable_buffer, PRETTY_FUNCTION_NAME);
+
+        GMutexLockGuard guard(frame.meta_mutex);
+        GstAnalyticsRelationMeta *relation_meta = nullptr;
+        GstAnalyticsClsMtd cls_descriptor_mtd = {0, nullptr};
+
+        for (DetectionRecord &detection : detections) {
+            if (detection.w_abs == 0 || detection.h_abs == 0) {
+                for (GstStructure *object_tensor : detection.tensors)
+                    gst_structure_free(object_tensor);
+                detection.tensors.clear();
+                continue;
+            }
+
+            if (not relation_meta) {
+                relation_meta = gst_buffer_add_analytics_relation_meta(*writable_buffer);
+                if (not relation_meta)
+                    throw std::runtime_error("Failed to add GstAnalyticsRelationMeta to buffer");
+
+                if (!label_quarks.empty())
+                    findOrCreateClassDescriptor(relation_meta, label_quarks, &cls_descriptor_mtd);
+            }
+
+            GstAnalyticsODMtd od_mtd;
+            if (!gst_analytics_relation_meta_add_oriented_od_mtd(
+                    relation_meta, detection.label, detection.x_abs, detection.y_abs, detection.w_abs,
+                    detection.h_abs, detection.rotation, detection.confidence, &od_mtd)) {
+                throw std::runtime_error("Failed to add detection data to meta");
+            }
+
+            if (!od_model_name.empty()) {
+                gst_analytics_mtd_set_semantic_tag(reinterpret_cast<GstAnalyticsMtd *>(&od_mtd), od_model_name.c_str());
+            }
+
+            if (detection.label && cls_descriptor_mtd.meta == relation_meta) {
+                if (!gst_analytics_relation_meta_set_relation(relation_meta, GST_ANALYTICS_REL_TYPE_RELATE_TO,
+                                                              od_mtd.id, cls_descriptor_mtd.id)) {
+                    throw std::runtime_error(
+                        "Failed to set relation between object detection metadata and class descriptor metadata");
+                }
+            }
+
+            attachObjectTensors(relation_meta, od_mtd, detection.tensors, detection.x_abs, detection.y_abs,
+                                detection.w_abs, detection.h_abs);
+
+            GstVideoRegionOfInterestMeta *roi_meta = gst_buffer_add_video_region_of_interest_meta_id(
+                *writable_buffer, detection.label, detection.x_abs, detection.y_abs, detection.w_abs, detection.h_abs);
+
+            if (not roi_meta)
+                throw std::runtime_error("Failed to add GstVideoRegionOfInterestMeta to buffer");
+
+            roi_meta->id = od_mtd.id;
+            relateToParentRegion(relation_meta, roi_meta, frame, od_mtd);
+
+            // GstVideoRegionOfInterestMeta consumers still expect the "detection" structure as the first param
+            gst_video_region_of_interest_meta_add_param(roi_meta, blob_to_meta.createDetectionTensor(detection));
+            for (GstStructure *object_tensor : detection.tensors)
+                gst_video_region_of_interest_meta_add_param(roi_meta, object_tensor);
+            detection.tensors.clear();
+        }
+    }
+}
+
 void TensorToFrameAttacher::attach(const TensorsTable &tensors_batch, FramesWrapper &frames,
                                    const BlobToMetaConverter &blob_to_meta) {
     (void)blob_to_meta;
@@ -262,15 +345,9 @@ void TensorToROIAttacher::attach(const TensorsTable &tensors_batch, FramesWrappe
         }
 
         GstAnalyticsClsMtd cls_descriptor_mtd = {0, nullptr};
-        const auto &labels = blob_to_meta.getLabels();
-        if (!labels.empty()) {
-            gsize length = labels.size();
-            std::vector<gfloat> confidence_levels(length, 0.0f);
-            std::vector<GQuark> class_quarks(length, 0);
-
-            for (size_t k = 0; k < length; k++) {
-                class_quarks[k] = g_quark_from_string(labels[k].c_str());
-            }
+        const auto &class_quarks = blob_to_meta.getLabelQuarks();
+        if (!class_quarks.empty()) {
+            gsize length = class_quarks.size();
 
             // find or create class descriptor metadata
             bool found = false;
@@ -299,8 +376,10 @@ void TensorToROIAttacher::attach(const TensorsTable &tensors_batch, FramesWrappe
 
             // create class descriptor if one does not exist
             if (!found) {
+                std::vector<gfloat> confidence_levels(length, 0.0f);
+                std::vector<GQuark> quarks(class_quarks);
                 if (!gst_analytics_relation_meta_add_cls_mtd(od_meta.meta, length, confidence_levels.data(),
-                                                             class_quarks.data(), &cls_descriptor_mtd)) {
+                                                             quarks.data(), &cls_descriptor_mtd)) {
                     throw std::runtime_error("Failed to add class descriptor to meta");
                 }
                 // Mark as class descriptor so it can be filtered out from frame-level tensors
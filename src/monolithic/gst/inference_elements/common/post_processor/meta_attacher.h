@@ -13,6 +13,8 @@
 #include <gst/gst.h>
 #include <gst/video/gstvideometa.h>
 
+#include <stdexcept>
+
 namespace post_processing {
 
 class MetaAttacher {
@@ -21,6 +23,13 @@ class MetaAttacher {
 
     virtual void attach(const TensorsTable &tensors_batch, FramesWrapper &frames,
                         const BlobToMetaConverter &blob_to_meta) = 0;
+    virtual void attachDetections(DetectionsTable &detections_batch, FramesWrapper &frames,
+                                  const BlobToMetaConverter &blob_to_meta) {
+        (void)detections_batch;
+        (void)frames;
+        (void)blob_to_meta;
+        throw std::logic_error("Meta attacher does not support typed detection records");
+    }
 
     using Ptr = std::unique_ptr<MetaAttacher>;
     static Ptr create(ConverterType converter_type, AttachType attach_type);
@@ -34,6 +43,8 @@ class ROIToFrameAttacher : public MetaAttacher {
 
     void attach(const TensorsTable &tensors_batch, FramesWrapper &frames,
                 const BlobToMetaConverter &blob_to_meta) override;
+    void attachDetections(DetectionsTable &detections_batch, FramesWrapper &frames,
+                          const BlobToMetaConverter &blob_to_meta) override;
 };
 
 class TensorToFrameAttacher : public MetaAttacher {
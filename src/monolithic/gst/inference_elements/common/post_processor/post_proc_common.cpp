@@ -8,15 +8,25 @@
 
 namespace post_processing {
 
-void checkFramesAndTensorsTable(const FramesWrapper &frames, const TensorsTable &tensors) {
+namespace {
+void checkFramesAndMetadataSize(const FramesWrapper &frames, size_t metadata_size) {
     if (frames.empty())
         throw std::invalid_argument("There are no inference frames");
 
     // The size of the metadata array is equal to batch size, and the number of frames can be less than it,
     // but not vice versa in case of total number of frames is not divisible by batch size.
-    if (tensors.size() < frames.size())
+    if (metadata_size < frames.size())
         throw std::logic_error("The size of the metadata array is less than the size of the inference frames: " +
-                               std::to_string(tensors.size()) + " / " + std::to_string(frames.size()));
+                               std::to_string(metadata_size) + " / " + std::to_string(frames.size()));
+}
+} // namespace
+
+void checkFramesAndTensorsTable(const FramesWrapper &frames, const TensorsTable &tensors) {
+    checkFramesAndMetadataSize(frames, tensors.size());
+}
+
+void checkFramesAndTensorsTable(const FramesWrapper &frames, const DetectionsTable &detections) {
+    checkFramesAndMetadataSize(frames, detections.size());
 }
 
 } // namespace post_processing
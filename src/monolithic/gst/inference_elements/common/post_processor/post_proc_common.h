@@ -12,6 +12,7 @@
 #include <gst/video/gstvideometa.h>
 
 #include <gst/analytics/analytics.h>
+#include <cstdint>
 #include <map>
 #include <memory>
 #include <string>
@@ -26,6 +27,35 @@ using OutputBlobs = std::map<std::string, InferenceBackend::OutputBlob::Ptr>;
 // <layer_name, blob_dims>
 using ModelOutputsInfo = std::map<std::string, std::vector<size_t>>;
 
+/**
+ * Typed detection produced by to_roi converters. It travels from the converter through coordinates restoration
+ * to the meta attacher without string-keyed GstStructure lookups; the legacy "detection" GstStructure is built
+ * only when the ROI meta is attached.
+ */
+struct DetectionRecord {
+    // normalized coordinates, restored to the full frame by ROICoordinatesRestorer
+    double x_min = 0;
+    double y_min = 0;
+    double x_max = 0;
+    double y_max = 0;
+    double rotation = 0;
+    double confidence = 0;
+    int label_id = 0;
+    GQuark label = 0;
+
+    // absolute coordinates, filled by ROICoordinatesRestorer
+    uint32_t x_abs = 0;
+    uint32_t y_abs = 0;
+    uint32_t w_abs = 0;
+    uint32_t h_abs = 0;
+
+    // additional per-object tensors (keypoints, masks, ...), ownership is passed to the attached meta
+    std::vector<GstStructure *> tensors;
+};
+
+// DetectionsTable = frames<objects>
+using DetectionsTable = std::vector<std::vector<DetectionRecord>>;
+
 enum class ConverterType { TO_ROI, TO_TENSOR, RAW };
 enum class AttachType {
     TO_FRAME,
@@ -43,6 +73,7 @@ struct ModelImageInputInfo {
 };
 
 void checkFramesAndTensorsTable(const FramesWrapper &frames, const TensorsTable &tensors);
+void checkFramesAndTensorsTable(const FramesWrapper &frames, const DetectionsTable &detections);
 
 /**
  * Compares to tensors_batch of type GstVideoRegionOfInterestMeta by roi_type and coordinates.
@@ -6,7 +6,11 @@
 
 #include "latency_tracer.h"
 #include "gmutex_lock_guard.h"
+#include "latency_histogram.h"
 #include "latency_tracer_meta.h"
+#include <algorithm>
+#include <atomic>
+#include <fstream>
 #include <mutex>
 #include <string>
 #include <tuple>
@@ -22,6 +26,8 @@ static GstTracerRecord *tr_pipeline;
 static GstTracerRecord *tr_element;
 static GstTracerRecord *tr_element_interval;
 static GstTracerRecord *tr_pipeline_interval;
+static GstTracerRecord *tr_pipeline_summary;
+static GstTracerRecord *tr_element_summary;
 static guint ns_to_ms = 1000000;
 static guint ms_to_s = 1000;
 using BufferListArgs = tuple<LatencyTracer *, guint64, GstPad *>;
@@ -29,6 +35,40 @@ using BufferListArgs = tuple<LatencyTracer *, guint64, GstPad *>;
 
 static GQuark data_string = g_quark_from_static_string("latency_tracer");
 
+// Percentiles reported in interval and EOS records
+struct LatencyPercentiles {
+    gdouble p50 = 0.0;
+    gdouble p95 = 0.0;
+    gdouble p99 = 0.0;
+    gdouble p999 = 0.0;
+
+    // Bucket upper bounds are capped by the exact maximum, so that percentiles never exceed it
+    LatencyPercentiles(const latency_histogram::Snapshot &snapshot, gdouble max) {
+        p50 = std::min(snapshot.percentile(0.5), max);
+        p95 = std::min(snapshot.percentile(0.95), max);
+        p99 = std::min(snapshot.percentile(0.99), max);
+        p999 = std::min(snapshot.percentile(0.999), max);
+    }
+};
+
+// Appends non-empty buckets of the histogram to the histogram-file as CSV, so that runs can be compared
+static void dump_histogram(LatencyTracer *lt, const gchar *record, const string &name,
+                           const latency_histogram::Snapshot &snapshot) {
+    if (!lt->histogram_file)
+        return;
+    GMutexLockGuard lock(&lt->tracer_mutex);
+    ofstream file(lt->histogram_file, ios::app);
+    if (!file) {
+        GST_WARNING_OBJECT(lt, "Cannot open histogram file %s", lt->histogram_file);
+        return;
+    }
+    for (size_t i = 0; i < latency_histogram::BUCKET_COUNT; ++i) {
+        if (snapshot.counts[i] != 0)
+            file << record << ',' << name << ',' << latency_histogram::bucket_upper_us(i) / 1000.0 << ','
+                 << snapshot.counts[i] << '\n';
+    }
+}
+
 // Element type classification for caching
 enum class ElementType {
     SOURCE,    // Element with no sink pads (produces data)
@@ -52,6 +92,9 @@ struct BranchStats {
     GstClockTime interval_init_time;
     GstClockTime first_frame_init_ts;
     mutex mtx;
+    LatencyHistogram histogram;
+    latency_histogram::Snapshot interval_base; // histogram state at the start of the interval
+    atomic<bool> eos_logged{false};
 
     BranchStats() {
         total_latency = 0.0;
@@ -103,6 +146,8 @@ struct BranchStats {
             local_count = frame_count;
         } // Lock released here
 
+        histogram.record(frame_latency);
+
         // Log outside the lock to minimize lock duration
         GST_TRACE("[Latency Tracer] Pipeline: %s, Source: %s -> Sink: %s - Frame: %u, Latency: %.2f ms, Avg: %.2f ms, "
                   "Min: %.2f ms, Max: %.2f ms, Pipeline Latency: %.2f ms, FPS: %.2f",
@@ -126,16 +171,40 @@ struct BranchStats {
             gdouble pipeline_latency = ms / interval_frame_count;
             gdouble fps = ms_to_s / pipeline_latency;
             gdouble interval_avg = interval_total / interval_frame_count;
+            latency_histogram::Snapshot current = histogram.snapshot();
+            LatencyPercentiles pct(current.since(interval_base), interval_max);
+            interval_base = current;
             GST_TRACE(
                 "[Latency Tracer Interval] Pipeline: %s, Source: %s -> Sink: %s - Interval: %.2f ms, Avg: %.2f ms, "
-                "Min: %.2f ms, Max: %.2f ms",
+                "Min: %.2f ms, Max: %.2f ms, P50: %.2f ms, P95: %.2f ms, P99: %.2f ms, P99.9: %.2f ms",
                 pipeline_name.c_str(), source_name.c_str(), sink_name.c_str(), ms, interval_avg, interval_min,
-                interval_max);
+                interval_max, pct.p50, pct.p95, pct.p99, pct.p999);
             gst_tracer_record_log(tr_pipeline_interval, pipeline_name.c_str(), source_name.c_str(), sink_name.c_str(),
-                                  ms, interval_avg, interval_min, interval_max, pipeline_latency, fps);
+                                  ms, interval_avg, interval_min, interval_max, pipeline_latency, fps, pct.p50, pct.p95,
+                                  pct.p99, pct.p999);
             reset_interval(ts);
         }
     }
+
+    // Whole-run statistics, logged once when EOS reaches the sink of the branch
+    void log_summary(LatencyTracer *lt) {
+        if (eos_logged.exchange(true))
+            return;
+        gdouble avg, local_min, local_max;
+        guint local_count;
+        {
+            lock_guard<mutex> guard(mtx);
+            local_count = frame_count;
+            avg = frame_count ? total_latency / frame_count : 0.0;
+            local_min = frame_count ? min : 0.0;
+            local_max = max;
+        }
+        latency_histogram::Snapshot snapshot = histogram.snapshot();
+        LatencyPercentiles pct(snapshot, local_max);
+        gst_tracer_record_log(tr_pipeline_summary, pipeline_name.c_str(), source_name.c_str(), sink_name.c_str(), avg,
+                              local_min, local_max, pct.p50, pct.p95, pct.p99, pct.p999, local_count);
+        dump_histogram(lt, "pipeline", pipeline_name + ":" + source_name + "->" + sink_name, snapshot);
+    }
 };
 
 // Pointer-based branch key for fast lookups (optimization: ~50% faster than string-based keys)
@@ -295,6 +364,18 @@ static void latency_tracer_constructed(GObject *object) {
         }
         gst_structure_get_int(params_struct, "interval", &lt->interval);
         GST_INFO_OBJECT(lt, "interval set to %d ms", lt->interval);
+        const gchar *histogram_file = gst_structure_get_string(params_struct, "histogram-file");
+        if (histogram_file) {
+            // Start from an empty file, histograms are appended at EOS
+            ofstream file(histogram_file, ios::trunc);
+            if (file) {
+                file << "record,name,bucket_upper_ms,count\n";
+                lt->histogram_file = g_strdup(histogram_file);
+                GST_INFO_OBJECT(lt, "histograms will be written to %s", histogram_file);
+            } else {
+                GST_WARNING_OBJECT(lt, "Cannot open histogram file %s", histogram_file);
+            }
+        }
         gst_structure_free(params_struct);
     }
     g_free(params);
@@ -324,6 +405,7 @@ static void latency_tracer_finalize(GObject *object) {
         delete static_cast<unordered_map<GstElement *, GstElement *> *>(lt->topology_cache);
         lt->topology_cache = nullptr;
     }
+    g_clear_pointer(&lt->histogram_file, g_free);
     g_mutex_clear(&lt->tracer_mutex);
 
     G_OBJECT_CLASS(latency_tracer_parent_class)->finalize(object);
@@ -395,6 +477,53 @@ static void latency_tracer_class_init(LatencyTracerClass *klass) {
         "fps", GST_TYPE_STRUCTURE,
         gst_structure_new("value", "type", G_TYPE_GTYPE, G_TYPE_DOUBLE, "description", G_TYPE_STRING,
                           "pipeline fps within the interval(if frames dropped this may result in invalid value)", NULL),
+        "p50", GST_TYPE_STRUCTURE,
+        gst_structure_new("value", "type", G_TYPE_GTYPE, G_TYPE_DOUBLE, "description", G_TYPE_STRING,
+                          "Median interval frame latency in ms", NULL),
+        "p95", GST_TYPE_STRUCTURE,
+        gst_structure_new("value", "type", G_TYPE_GTYPE, G_TYPE_DOUBLE, "description", G_TYPE_STRING,
+                          "95th percentile interval frame latency in ms", NULL),
+        "p99", GST_TYPE_STRUCTURE,
+        gst_structure_new("value", "type", G_TYPE_GTYPE, G_TYPE_DOUBLE, "description", G_TYPE_STRING,
+                          "99th percentile interval frame latency in ms", NULL),
+        "p999", GST_TYPE_STRUCTURE,
+        gst_structure_new("value", "type", G_TYPE_GTYPE, G_TYPE_DOUBLE, "description", G_TYPE_STRING,
+                          "99.9th percentile interval frame latency in ms", NULL),
+        NULL);
+    tr_pipeline_summary = gst_tracer_record_new(
+        "latency_tracer_pipeline_summary.class", "pipeline_name", GST_TYPE_STRUCTURE,
+        gst_structure_new("value", "type", G_TYPE_GTYPE, G_TYPE_STRING, "description", G_TYPE_STRING, "Pipeline name",
+                          NULL),
+        "source_name", GST_TYPE_STRUCTURE,
+        gst_structure_new("value", "type", G_TYPE_GTYPE, G_TYPE_STRING, "description", G_TYPE_STRING,
+                          "Source element name", NULL),
+        "sink_name", GST_TYPE_STRUCTURE,
+        gst_structure_new("value", "type", G_TYPE_GTYPE, G_TYPE_STRING, "description", G_TYPE_STRING,
+                          "Sink element name", NULL),
+        "avg", GST_TYPE_STRUCTURE,
+        gst_structure_new("value", "type", G_TYPE_GTYPE, G_TYPE_DOUBLE, "description", G_TYPE_STRING,
+                          "Average frame latency in ms", NULL),
+        "min", GST_TYPE_STRUCTURE,
+        gst_structure_new("value", "type", G_TYPE_GTYPE, G_TYPE_DOUBLE, "description", G_TYPE_STRING,
+                          "Min Per frame latency in ms", NULL),
+        "max", GST_TYPE_STRUCTURE,
+        gst_structure_new("value", "type", G_TYPE_GTYPE, G_TYPE_DOUBLE, "description", G_TYPE_STRING,
+                          "Max Per frame latency in ms", NULL),
+        "p50", GST_TYPE_STRUCTURE,
+        gst_structure_new("value", "type", G_TYPE_GTYPE, G_TYPE_DOUBLE, "description", G_TYPE_STRING,
+                          "Median frame latency in ms", NULL),
+        "p95", GST_TYPE_STRUCTURE,
+        gst_structure_new("value", "type", G_TYPE_GTYPE, G_TYPE_DOUBLE, "description", G_TYPE_STRING,
+                          "95th percentile frame latency in ms", NULL),
+        "p99", GST_TYPE_STRUCTURE,
+        gst_structure_new("value", "type", G_TYPE_GTYPE, G_TYPE_DOUBLE, "description", G_TYPE_STRING,
+                          "99th percentile frame latency in ms", NULL),
+        "p999", GST_TYPE_STRUCTURE,
+        gst_structure_new("value", "type", G_TYPE_GTYPE, G_TYPE_DOUBLE, "description", G_TYPE_STRING,
+                          "99.9th percentile frame latency in ms", NULL),
+        "frame_num", GST_TYPE_STRUCTURE,
+        gst_structure_new("value", "type", G_TYPE_GTYPE, G_TYPE_UINT, "description", G_TYPE_STRING,
+                          "Number of frames processed", NULL),
         NULL);
     tr_element = gst_tracer_record_new("latency_tracer_element.class", "name", GST_TYPE_STRUCTURE,
                                        gst_structure_new("value", "type", G_TYPE_GTYPE, G_TYPE_STRING, "description",
@@ -434,7 +563,51 @@ static void latency_tracer_class_init(LatencyTracerClass *klass) {
                               "max", GST_TYPE_STRUCTURE,
                               gst_structure_new("value", "type", G_TYPE_GTYPE, G_TYPE_DOUBLE, "description",
                                                 G_TYPE_STRING, "Max interval frame latency in ms", NULL),
+                              "p50", GST_TYPE_STRUCTURE,
+                              gst_structure_new("value", "type", G_TYPE_GTYPE, G_TYPE_DOUBLE, "description",
+                                                G_TYPE_STRING, "Median interval frame latency in ms", NULL),
+                              "p95", GST_TYPE_STRUCTURE,
+                              gst_structure_new("value", "type", G_TYPE_GTYPE, G_TYPE_DOUBLE, "description",
+                                                G_TYPE_STRING, "95th percentile interval frame latency in ms", NULL),
+                              "p99", GST_TYPE_STRUCTURE,
+                              gst_structure_new("value", "type", G_TYPE_GTYPE, G_TYPE_DOUBLE, "description",
+                                                G_TYPE_STRING, "99th percentile interval frame latency in ms", NULL),
+                              "p999", GST_TYPE_STRUCTURE,
+                              gst_structure_new("value", "type", G_TYPE_GTYPE, G_TYPE_DOUBLE, "description",
+                                                G_TYPE_STRING, "99.9th percentile interval frame latency in ms", NULL),
                               NULL);
+    tr_element_summary = gst_tracer_record_new(
+        "latency_tracer_element_summary.class", "name", GST_TYPE_STRUCTURE,
+        gst_structure_new("value", "type", G_TYPE_GTYPE, G_TYPE_STRING, "description", G_TYPE_STRING, "Element Name",
+                          NULL),
+        "avg", GST_TYPE_STRUCTURE,
+        gst_structure_new("value", "type", G_TYPE_GTYPE, G_TYPE_DOUBLE, "description", G_TYPE_STRING,
+                          "Average frame latency in ms", NULL),
+        "min", GST_TYPE_STRUCTURE,
+        gst_structure_new("value", "type", G_TYPE_GTYPE, G_TYPE_DOUBLE, "description", G_TYPE_STRING,
+                          "Min Per frame latency in ms", NULL),
+        "max", GST_TYPE_STRUCTURE,
+        gst_structure_new("value", "type", G_TYPE_GTYPE, G_TYPE_DOUBLE, "description", G_TYPE_STRING,
+                          "Max Per frame latency in ms", NULL),
+        "p50", GST_TYPE_STRUCTURE,
+        gst_structure_new("value", "type", G_TYPE_GTYPE, G_TYPE_DOUBLE, "description", G_TYPE_STRING,
+                          "Median frame latency in ms", NULL),
+        "p95", GST_TYPE_STRUCTURE,
+        gst_structure_new("value", "type", G_TYPE_GTYPE, G_TYPE_DOUBLE, "description", G_TYPE_STRING,
+                          "95th percentile frame latency in ms", NULL),
+        "p99", GST_TYPE_STRUCTURE,
+        gst_structure_new("value", "type", G_TYPE_GTYPE, G_TYPE_DOUBLE, "description", G_TYPE_STRING,
+                          "99th percentile frame latency in ms", NULL),
+        "p999", GST_TYPE_STRUCTURE,
+        gst_structure_new("value", "type", G_TYPE_GTYPE, G_TYPE_DOUBLE, "description", G_TYPE_STRING,
+                          "99.9th percentile frame latency in ms", NULL),
+        "frame_num", GST_TYPE_STRUCTURE,
+        gst_structure_new("value", "type", G_TYPE_GTYPE, G_TYPE_UINT, "description", G_TYPE_STRING,
+                          "Number of frame processed", NULL),
+        "is_bin", GST_TYPE_STRUCTURE,
+        gst_structure_new("value", "type", G_TYPE_GTYPE, G_TYPE_BOOLEAN, "description", G_TYPE_STRING,
+                          "is element bin", NULL),
+        NULL);
     GST_DEBUG_CATEGORY_INIT(latency_tracer_debug, "latency_tracer", 0, "latency tracer");
 }
 
@@ -467,6 +640,9 @@ struct ElementStats {
     guint interval_frame_count;
     GstClockTime interval_init_time;
     mutex mtx;
+    LatencyHistogram histogram;
+    latency_histogram::Snapshot interval_base; // histogram state at the start of the interval
+    atomic<bool> eos_logged{false};
 
     static void create(GstElement *elem, guint64 ts) {
         // This won't be converted to shared ptr because g_object_set_qdata_full destructor supports gpointer only
@@ -521,6 +697,8 @@ struct ElementStats {
             local_count = frame_count;
         } // Lock released here
 
+        histogram.record(frame_latency);
+
         // Log outside the lock to minimize lock duration
         gst_tracer_record_log(tr_element, name, frame_latency, avg, local_min, local_max, local_count, is_bin);
         cal_log_interval(frame_latency, src_ts, interval);
@@ -536,10 +714,34 @@ struct ElementStats {
         gdouble ms = (gdouble)GST_CLOCK_DIFF(interval_init_time, src_ts) / ns_to_ms;
         if (ms >= interval) {
             gdouble interval_avg = interval_total / interval_frame_count;
-            gst_tracer_record_log(tr_element_interval, name, ms, interval_avg, interval_min, interval_max);
+            latency_histogram::Snapshot current = histogram.snapshot();
+            LatencyPercentiles pct(current.since(interval_base), interval_max);
+            interval_base = current;
+            gst_tracer_record_log(tr_element_interval, name, ms, interval_avg, interval_min, interval_max, pct.p50,
+                                  pct.p95, pct.p99, pct.p999);
             reset_interval(src_ts);
         }
     }
+
+    // Whole-run statistics, logged once when the element pushes EOS
+    void log_summary(LatencyTracer *lt) {
+        if (eos_logged.exchange(true))
+            return;
+        gdouble avg, local_min, local_max;
+        guint local_count;
+        {
+            lock_guard<mutex> guard(mtx);
+            local_count = frame_count;
+            avg = frame_count ? total / frame_count : 0.0;
+            local_min = frame_count ? min : 0.0;
+            local_max = max;
+        }
+        latency_histogram::Snapshot snapshot = histogram.snapshot();
+        LatencyPercentiles pct(snapshot, local_max);
+        gst_tracer_record_log(tr_element_summary, name, avg, local_min, local_max, pct.p50, pct.p95, pct.p99, pct.p999,
+                              local_count, is_bin);
+        dump_histogram(lt, "element", name, snapshot);
+    }
 };
 
 // Check if element is in any pipeline (not restricted to lt->pipeline)
@@ -879,6 +1081,41 @@ static void do_push_buffer_list_pre(LatencyTracer *lt, guint64 ts, GstPad *pad,
         &args);
 }
 
+static void do_push_event_pre(LatencyTracer *lt, guint64 ts, GstPad *pad, GstEvent *event) {
+    UNUSED(ts);
+    if (GST_EVENT_TYPE(event) != GST_EVENT_EOS)
+        return;
+
+    GstElement *elem = get_real_pad_parent(pad);
+    if (!elem)
+        return;
+    if (lt->flags & LATENCY_TRACER_FLAG_ELEMENT) {
+        ElementStats *stats = ElementStats::from_element(elem);
+        if (stats != nullptr)
+            stats->log_summary(lt);
+    }
+    gst_object_unref(elem);
+
+    GstPad *peer_pad = GST_PAD_PEER(pad);
+    GstElement *peer_element = peer_pad ? get_real_pad_parent(peer_pad) : nullptr;
+    if (!peer_element)
+        return;
+    if (lt->flags & LATENCY_TRACER_FLAG_PIPELINE && is_sink_element_cached(lt, peer_element)) {
+        // Branch stats are never erased, so the pointers stay valid after the lock is released
+        vector<BranchStats *> branches;
+        {
+            GMutexLockGuard lock(get_tracer_mutex(lt));
+            for (auto &[key, stats] : *get_branch_stats_map(lt)) {
+                if (std::get<1>(key) == peer_element)
+                    branches.push_back(&stats);
+            }
+        }
+        for (BranchStats *stats : branches)
+            stats->log_summary(lt);
+    }
+    gst_object_unref(peer_element);
+}
+
 static void on_element_change_state_post(LatencyTracer *lt, guint64 ts, GstElement *elem, GstStateChange change,
                                          GstStateChangeReturn result) {
     UNUSED(result);
@@ -946,6 +1183,7 @@ static void on_element_change_state_post(LatencyTracer *lt, guint64 ts, GstEleme
         gst_tracing_register_hook(tracer, "pad-push-pre", G_CALLBACK(do_push_buffer_pre));
         gst_tracing_register_hook(tracer, "pad-push-list-pre", G_CALLBACK(do_push_buffer_list_pre));
         gst_tracing_register_hook(tracer, "pad-pull-range-post", G_CALLBACK(do_pull_range_post));
+        gst_tracing_register_hook(tracer, "pad-push-event-pre", G_CALLBACK(do_push_event_pre));
     }
 }
 // GStreamer tracer hook for element creation
@@ -969,6 +1207,7 @@ static void latency_tracer_init(LatencyTracer *lt) {
     lt->pipeline = nullptr;
     lt->flags = static_cast<LatencyTracerFlags>(LATENCY_TRACER_FLAG_ELEMENT | LATENCY_TRACER_FLAG_PIPELINE);
     lt->interval = 1000;
+    lt->histogram_file = nullptr;
 
     lt->branch_stats = new unordered_map<BranchKey, BranchStats, BranchKeyHash>();
     lt->sources_list = new vector<GstElement *>();
@@ -38,6 +38,7 @@ struct LatencyTracer {
     gpointer element_type_cache; // Map<GstElement*, ElementType> - cache element types for O(1) lookup
     gpointer topology_cache;     // Map<GstElement*, GstElement*> - cache sink->source mappings for O(1) lookup
     GMutex tracer_mutex;         // guards all shared map writes
+    gchar *histogram_file;       // CSV file receiving the full latency histograms at EOS, NULL if disabled
 };
 
 struct LatencyTracerClass {
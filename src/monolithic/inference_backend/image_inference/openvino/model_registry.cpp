@@ -0,0 +1,177 @@
+/*******************************************************************************
+ * Copyright (C) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+#include "model_registry.h"
+
+#include "inference_backend/logger.h"
+#include "model_api_converters.h"
+
+#include <filesystem>
+#include <mutex>
+#include <optional>
+#include <set>
+#include <system_error>
+#include <tuple>
+
+namespace ModelRegistry {
+
+namespace {
+
+using ModelInfo = std::map<std::string, GstStructure *>;
+
+ModelInfo copy_model_info(const ModelInfo &info) {
+    ModelInfo copy;
+    for (const auto &item : info)
+        copy.emplace(item.first, item.second ? gst_structure_copy(item.second) : nullptr);
+    return copy;
+}
+
+void free_model_info(ModelInfo &info) {
+    for (auto &item : info) {
+        if (item.second)
+            gst_structure_free(item.second);
+    }
+    info.clear();
+}
+
+// Modification time of the model file and, for IR, of its weights. 0 if the file is missing, read_model reports it.
+int64_t model_mtime(const std::string &model_path) {
+    auto file_mtime = [](const std::filesystem::path &path) -> int64_t {
+        std::error_code ec;
+        auto time = std::filesystem::last_write_time(path, ec);
+        return ec ? 0 : static_cast<int64_t>(time.time_since_epoch().count());
+    };
+    std::filesystem::path path(model_path);
+    int64_t mtime = file_mtime(path);
+    if (path.extension() == ".xml")
+        mtime ^= file_mtime(std::filesystem::path(path).replace_extension(".bin")) * 31;
+    return mtime;
+}
+
+struct Entry {
+    std::mutex mutex; // guards parsing and derived info, so concurrent users wait for a single parse
+    // Held from parse until release_model(), so that start-up stages of an element share one parse. After that only
+    // the model info below is kept, the model itself lives as long as a user holds it.
+    std::shared_ptr<ov::Model> model;
+    std::weak_ptr<ov::Model> released;
+    std::optional<ModelInfo> postproc;
+    std::map<std::string, ModelInfo> preproc; // by pre-processing config
+
+    ~Entry() {
+        if (postproc)
+            free_model_info(*postproc);
+        for (auto &item : preproc)
+            free_model_info(item.second);
+    }
+};
+
+// path, extension library -> (modification time, entry)
+using Key = std::tuple<std::string, std::string>;
+
+struct Registry {
+    std::mutex mutex;
+    std::map<Key, std::pair<int64_t, std::shared_ptr<Entry>>> entries;
+    std::set<std::string> loaded_extensions;
+};
+
+Registry &registry() {
+    // the core is constructed first, so that cached models are released before it at exit
+    core();
+    static Registry instance;
+    return instance;
+}
+
+// Returns the entry, the entry mutex is held by the returned lock
+std::shared_ptr<Entry> get_entry(const std::string &model_path, const std::string &ov_extension_lib,
+                                 std::unique_lock<std::mutex> &entry_lock) {
+    const int64_t mtime = model_mtime(model_path);
+    std::shared_ptr<Entry> entry;
+    {
+        Registry &reg = registry();
+        std::lock_guard<std::mutex> lock(reg.mutex);
+        if (!ov_extension_lib.empty() && reg.loaded_extensions.insert(ov_extension_lib).second)
+            core().add_extension(ov_extension_lib);
+
+        auto &slot = reg.entries[Key(model_path, ov_extension_lib)];
+        if (!slot.second || slot.first != mtime) {
+            // new model or the file was replaced, users of the previous entry keep their references
+            slot = {mtime, std::make_shared<Entry>()};
+        }
+        entry = slot.second;
+    }
+
+    entry_lock = std::unique_lock<std::mutex>(entry->mutex);
+    return entry;
+}
+
+// Called with the entry mutex held, parses the model unless it's held by the entry or still used after release
+std::shared_ptr<ov::Model> get_model(Entry &entry, const std::string &model_path) {
+    if (!entry.model)
+        entry.model = entry.released.lock();
+    if (!entry.model) {
+        GVA_INFO("Reading model %s", model_path.c_str());
+        entry.model = core().read_model(model_path);
+    } else {
+        GVA_DEBUG("Model %s is already read, reusing it", model_path.c_str());
+    }
+    return entry.model;
+}
+
+} // namespace
+
+ov::Core &core() {
+    static ov::Core ovcore;
+    return ovcore;
+}
+
+std::shared_ptr<const ov::Model> read_model(const std::string &model_path, const std::string &ov_extension_lib) {
+    std::unique_lock<std::mutex> lock;
+    auto entry = get_entry(model_path, ov_extension_lib, lock);
+    return get_model(*entry, model_path);
+}
+
+void release_model(const std::string &model_path, const std::string &ov_extension_lib) {
+    std::shared_ptr<Entry> entry;
+    {
+        Registry &reg = registry();
+        std::lock_guard<std::mutex> lock(reg.mutex);
+        auto it = reg.entries.find(Key(model_path, ov_extension_lib));
+        if (it == reg.entries.end())
+            return;
+        entry = it->second.second;
+    }
+    std::lock_guard<std::mutex> lock(entry->mutex);
+    if (entry->model) {
+        entry->released = entry->model;
+        entry->model.reset();
+    }
+}
+
+std::map<std::string, GstStructure *> get_model_info_preproc(const std::string &model_path,
+                                                             const std::string &ov_extension_lib,
+                                                             const gchar *pre_proc_config) {
+    std::unique_lock<std::mutex> lock;
+    auto entry = get_entry(model_path, ov_extension_lib, lock);
+    const std::string config = pre_proc_config ? pre_proc_config : "";
+    auto it = entry->preproc.find(config);
+    if (it == entry->preproc.end()) {
+        auto info = ModelApiConverters::get_model_info_preproc(get_model(*entry, model_path), model_path,
+                                                               pre_proc_config);
+        it = entry->preproc.emplace(config, std::move(info)).first;
+    }
+    return copy_model_info(it->second);
+}
+
+std::map<std::string, GstStructure *> get_model_info_postproc(const std::string &model_path,
+                                                              const std::string &ov_extension_lib) {
+    std::unique_lock<std::mutex> lock;
+    auto entry = get_entry(model_path, ov_extension_lib, lock);
+    if (!entry->postproc)
+        entry->postproc = ModelApiConverters::get_model_info_postproc(get_model(*entry, model_path), model_path);
+    return copy_model_info(*entry->postproc);
+}
+
+} // namespace ModelRegistry
@@ -0,0 +1,40 @@
+/*******************************************************************************
+ * Copyright (C) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+#pragma once
+
+#include <gst/gst.h>
+#include <openvino/openvino.hpp>
+
+#include <map>
+#include <memory>
+#include <string>
+
+// Process-wide registry of parsed models. Start-up stages of an element share one parsed ov::Model, which is released
+// once the element has its own copy, while the pre/post-processing info derived from it is kept for other elements
+// using the same model file, modification time and OpenVINO extension library.
+namespace ModelRegistry {
+
+// OpenVINO core shared by all image inference instances
+ov::Core &core();
+
+// Parsed model shared between users. It must not be modified: clone() it before reshape or pre-processing.
+std::shared_ptr<const ov::Model> read_model(const std::string &model_path, const std::string &ov_extension_lib);
+
+// Stop holding the parsed model once the caller has its own copy. Model info stays cached, the model is parsed again
+// on next use unless another user still holds it.
+void release_model(const std::string &model_path, const std::string &ov_extension_lib);
+
+// Same as ModelApiConverters::get_model_info_preproc for the shared model, the caller owns returned structures
+std::map<std::string, GstStructure *> get_model_info_preproc(const std::string &model_path,
+                                                             const std::string &ov_extension_lib,
+                                                             const gchar *pre_proc_config);
+
+// Same as ModelApiConverters::get_model_info_postproc for the shared model, the caller owns returned structures
+std::map<std::string, GstStructure *> get_model_info_postproc(const std::string &model_path,
+                                                              const std::string &ov_extension_lib);
+
+} // namespace ModelRegistry
@@ -21,6 +21,7 @@
 #include <spdlog/fmt/bundled/ranges.h>
 
 #include "model_api_converters.h"
+#include "model_registry.h"
 #include "openvino_image_inference.h"
 
 #include "config.h"
@@ -40,6 +41,8 @@
 #endif
 #endif
 
+#include <algorithm>
+#include <cstring>
 #include <functional>
 #include <iterator>
 #include <regex>
@@ -258,6 +261,13 @@ struct ConfigHelper {
         return std::stoi(it->second);
     }
 
+    int batch_deadline() const {
+        const auto it = base_config.find(KEY_BATCH_DEADLINE);
+        if (it == base_config.end())
+            return -1;
+        return std::stoi(it->second);
+    }
+
     const std::string &image_format() const {
         return base_get_or_empty(KEY_IMAGE_FORMAT);
     }
@@ -353,7 +363,8 @@ struct ConfigHelper {
         for (auto &item : params) {
             if (item.first == ov::num_streams.name()) {
                 m.emplace(item.first, ov::streams::Num(stoi(item.second)));
-            } else if (item.first == ov::log::level.name() || item.first == ov::cache_mode.name() ||
+            } else if (item.first == ov::log::level.name() || item.first == ov::cache_dir.name() ||
+                       item.first == ov::cache_mode.name() ||
                        item.first == ov::hint::enable_cpu_pinning.name() || item.first == ov::enable_profiling.name() ||
                        item.first == ov::hint::model_priority.name() ||
                        item.first == ov::hint::performance_mode.name() ||
@@ -460,14 +471,10 @@ class OpenVinoNewApiImpl {
         _device = config.device();
         _nireq = config.nireq();
 
-        auto ov_extension_lib = config.ov_extension_lib();
-        if (!ov_extension_lib.empty()) {
-            core().add_extension(ov_extension_lib);
-        }
-
-        // read model & configure model
+        // read model & configure model, the parsed model is shared with other elements using the same file
         _model_path = config.model_path();
-        _model = core().read_model(_model_path);
+        _model = ModelRegistry::read_model(_model_path, config.ov_extension_lib())->clone();
+        ModelRegistry::release_model(_model_path, config.ov_extension_lib());
 
         {
             size_t bs;
@@ -756,8 +763,7 @@ class OpenVinoNewApiImpl {
 
     // Singleton core object
     static ov::Core &core() {
-        static ov::Core ovcore;
-        return ovcore;
+        return ModelRegistry::core();
     }
 
   protected:
@@ -1211,7 +1217,8 @@ OpenVINOImageInference::OpenVINOImageInference(const InferenceBackend::Inference
                                                dlstreamer::ContextPtr context, CallbackFunc callback,
                                                ErrorHandlingFunc error_handler, MemoryType memory_type)
     : context_(context), memory_type(memory_type), callback(callback), handleError(error_handler),
-      batch_size(std::stoi(config.at(KEY_BASE).at(KEY_BATCH_SIZE))), batch_timeout(-1), requests_processing_(0U) {
+      batch_size(std::stoi(config.at(KEY_BASE).at(KEY_BATCH_SIZE))), batch_timeout(-1), batch_deadline(-1),
+      requests_processing_(0U) {
 
     try {
         if (config.count(KEY_INFERENCE) > 0) {
@@ -1254,6 +1261,15 @@ OpenVINOImageInference::OpenVINOImageInference(const InferenceBackend::Inference
             GVA_INFO("%s", pp_type_string.c_str());
             const std::string custom_preproc_lib = cfg_helper.custom_preproc_lib();
             pre_processor.reset(InferenceBackend::ImagePreprocessor::Create(pp_type, custom_preproc_lib));
+            pre_processor_type = pp_type;
+        }
+
+        // Deadline scheduling only makes sense when frames are accumulated in BatchRequest by this class.
+        // With OpenVINO™ Automatic Batching (batch-timeout) batch size of the request is 1.
+        batch_deadline = cfg_helper.batch_deadline();
+        if (batch_deadline > -1 && batch_size > 1) {
+            GVA_INFO("Partial batch deadline: %d ms", batch_deadline);
+            deadline_thread_ = std::thread(&OpenVINOImageInference::DeadlineWorkingFunction, this);
         }
 
     } catch (const std::exception &e) {
@@ -1264,6 +1280,94 @@ OpenVINOImageInference::OpenVINOImageInference(const InferenceBackend::Inference
 OpenVINOImageInference::~OpenVINOImageInference() {
     GVA_DEBUG("Image Inference destruct");
     Close();
+    if (batch_size > 1) {
+        GVA_INFO("Batches dispatched: full=%lu, deadline=%lu, flush=%lu", static_cast<unsigned long>(full_batches_),
+                 static_cast<unsigned long>(deadline_batches_), static_cast<unsigned long>(flush_batches_));
+    }
+}
+
+void OpenVINOImageInference::PadPartialBatch(std::shared_ptr<BatchRequest> &request) {
+    ITT_TASK(__FUNCTION__);
+    assert(request);
+
+    const size_t filled = request->buffers.size();
+    const size_t full = safe_convert<size_t>(batch_size);
+    if (full <= 1 || filled == 0 || filled >= full)
+        return;
+
+    if (!DoNeedImagePreProcessing(nullptr)) {
+        // Bypass pre-processing: fill non-complete batch with the last element
+        size_t input_idx = 0;
+        for (auto &input_vec : request->in_tensors) {
+            for (size_t i = input_vec.size(); i < full; i++)
+                input_vec.push_back(input_vec.back());
+            // FIXME: move?
+            request->infer_request_new.set_input_tensors(input_idx, input_vec);
+            input_idx++;
+        }
+        return;
+    }
+
+    // Software pre-processing: frames are written directly into the infer-request-owned batched tensor, so unfilled
+    // tail slots contain data left from a previous use of the request. Replicate the last frame instead to keep
+    // results of the padded slots deterministic.
+    for (auto &input_vec : request->in_tensors) {
+        if (input_vec.empty())
+            continue;
+        ov::Tensor &tensor = input_vec.front();
+        const auto &dims = tensor.get_shape();
+        if (dims.empty() || dims[0] != full)
+            continue;
+        const size_t slot_size = tensor.get_byte_size() / full;
+        uint8_t *data = static_cast<uint8_t *>(tensor.data());
+        const uint8_t *last = data + (filled - 1) * slot_size;
+        for (size_t i = filled; i < full; i++)
+            std::memcpy(data + i * slot_size, last, slot_size);
+    }
+}
+
+void OpenVINOImageInference::DeadlineWorkingFunction() {
+    std::unique_lock<std::mutex> lk(requests_mutex_);
+
+    while (!deadline_thread_stop_) {
+        if (!partial_batch_pending_) {
+            deadline_cv_.wait(lk, [this] { return partial_batch_pending_ || deadline_thread_stop_; });
+            continue;
+        }
+        if (std::chrono::steady_clock::now() < partial_batch_deadline_) {
+            // Spurious wakeups and deadline updates are re-evaluated on the next iteration
+            deadline_cv_.wait_until(lk, partial_batch_deadline_);
+            continue;
+        }
+        partial_batch_pending_ = false;
+
+        // Partial request is returned to the front of the queue by SubmitImage. The front can only be changed while
+        // holding requests_mutex_, so checking it is not racy.
+        if (freeRequests.empty() || freeRequests.front()->buffers.empty())
+            continue;
+        auto request = freeRequests.pop();
+
+        try {
+            PadPartialBatch(request);
+            ++deadline_batches_;
+            request->start_async();
+        } catch (const std::exception &e) {
+            GVA_ERROR("Couldn't start inference on batch deadline: %s", Utils::createNestedErrorMsg(e).c_str());
+            this->handleError(request->buffers);
+            FreeRequest(request);
+        }
+    }
+}
+
+void OpenVINOImageInference::StopDeadlineThread() {
+    if (!deadline_thread_.joinable())
+        return;
+    {
+        std::lock_guard<std::mutex> lk(requests_mutex_);
+        deadline_thread_stop_ = true;
+    }
+    deadline_cv_.notify_all();
+    deadline_thread_.join();
 }
 
 void OpenVINOImageInference::FreeRequest(std::shared_ptr<BatchRequest> request) {
@@ -1403,6 +1507,7 @@ bool OpenVINOImageInference::DoNeedImagePreProcessing(const InferenceBackend::Im
             GVA_WARNING("Force OPENCV preprocessor to convert non-contiguous tensors into contigous memory location");
             pre_processor.reset(
                 InferenceBackend::ImagePreprocessor::Create(InferenceBackend::ImagePreprocessorType::OPENCV, ""));
+            pre_processor_type = InferenceBackend::ImagePreprocessorType::OPENCV;
             return true;
         }
     }
@@ -1474,17 +1579,104 @@ void OpenVINOImageInference::SubmitImage(
     }
 
     try {
-        // start inference asynchronously if enough buffers for batching
-        if (request->buffers.size() >= safe_convert<size_t>(batch_size)) {
-            request->start_async();
-        } else {
-            freeRequests.push_front(request);
-        }
+        DispatchRequest(request, 1);
     } catch (const std::exception &e) {
         std::throw_with_nested(std::runtime_error("Inference async start was failed."));
     }
 }
 
+void OpenVINOImageInference::SubmitImages(
+    const std::vector<IFrameBase::Ptr> &frames,
+    const std::vector<std::map<std::string, InferenceBackend::InputLayerDesc::Ptr>> &input_preprocessors) {
+    ITT_TASK(__FUNCTION__);
+
+    if (frames.size() != input_preprocessors.size())
+        throw std::invalid_argument("Number of frames and input pre-processors must match");
+    for (const auto &frame : frames) {
+        if (!frame || !frame->GetImage())
+            throw std::invalid_argument("Invalid frame provided");
+    }
+
+    std::unique_lock<std::mutex> lk(requests_mutex_);
+
+    // Only OpenCV pre-processing into slots of the batched tensor is safe to run concurrently. Frames share the source
+    // image, so the first one decides for all of them.
+    const size_t full = safe_convert<size_t>(batch_size);
+    if (frames.size() < 2 || full < 2 || !DoNeedImagePreProcessing(frames.front()->GetImage()) ||
+        pre_processor_type != InferenceBackend::ImagePreprocessorType::OPENCV) {
+        lk.unlock();
+        ImageInference::SubmitImages(frames, input_preprocessors);
+        return;
+    }
+
+    if (!pre_proc_workers_) {
+        const size_t cores = std::max(1u, std::thread::hardware_concurrency());
+        pre_proc_workers_ = std::make_unique<WorkerPool>(std::min(cores, full) - 1);
+        GVA_INFO("Parallel ROI pre-processing threads: %zu", pre_proc_workers_->size() + 1);
+    }
+
+    size_t next = 0;
+    while (next < frames.size()) {
+        std::shared_ptr<BatchRequest> request = freeRequests.pop();
+        const size_t first_slot = request->buffers.size();
+        const size_t count = std::min(full - first_slot, frames.size() - next);
+        requests_processing_ += count;
+
+        try {
+            // FIXME: single input
+            if (request->in_tensors.front().empty()) {
+                request->in_tensors.front().push_back(request->infer_request_new.get_tensor(image_layer));
+            }
+            ov::Tensor &tensor = request->in_tensors.front().front();
+
+            // Every frame owns a separate slot of the batched tensor, so they are converted concurrently
+            pre_proc_workers_->run(count, [&](size_t i) {
+                const IFrameBase::Ptr &frame = frames[next + i];
+                const Image &src_img = *frame->GetImage();
+                Image dst_img = map_ov_tensor_to_img(tensor, first_slot + i);
+                if (src_img.planes[0] != dst_img.planes[0]) // only convert if different buffers
+                    pre_processor->Convert(src_img, dst_img, getImagePreProcInfo(input_preprocessors[next + i]),
+                                           frame->GetImageTransformationParams());
+            });
+
+            // Other input pre-processors take the batch index from the number of frames already in the request
+            for (size_t i = 0; i < count; ++i) {
+                ApplyInputPreprocessors(request, input_preprocessors[next + i]);
+                request->buffers.push_back(frames[next + i]);
+            }
+        } catch (const std::exception &e) {
+            requests_processing_ -= count - (request->buffers.size() - first_slot);
+            freeRequests.push_front(request);
+            GVA_ERROR("Pre-processing has failed: %s", e.what());
+            std::throw_with_nested(std::runtime_error("Pre-processing was failed."));
+        }
+        next += count;
+
+        try {
+            DispatchRequest(request, count);
+        } catch (const std::exception &e) {
+            std::throw_with_nested(std::runtime_error("Inference async start was failed."));
+        }
+    }
+}
+
+void OpenVINOImageInference::DispatchRequest(std::shared_ptr<BatchRequest> &request, size_t added_frames) {
+    // start inference asynchronously if enough buffers for batching
+    if (request->buffers.size() >= safe_convert<size_t>(batch_size)) {
+        partial_batch_pending_ = false;
+        ++full_batches_;
+        request->start_async();
+    } else {
+        // arm the deadline when the first frames of a new batch arrive
+        if (request->buffers.size() == added_frames && deadline_thread_.joinable()) {
+            partial_batch_deadline_ = std::chrono::steady_clock::now() + std::chrono::milliseconds(batch_deadline);
+            partial_batch_pending_ = true;
+            deadline_cv_.notify_one();
+        }
+        freeRequests.push_front(request);
+    }
+}
+
 const std::string &OpenVINOImageInference::GetModelName() const {
     return model_name;
 }
@@ -1497,6 +1689,18 @@ int OpenVINOImageInference::GetBatchTimeout() const {
     return batch_timeout;
 }
 
+int OpenVINOImageInference::GetBatchDeadline() const {
+    return batch_deadline;
+}
+
+OpenVINOImageInference::BatchDispatchStats OpenVINOImageInference::GetBatchDispatchStats() const {
+    BatchDispatchStats stats;
+    stats.full_batches = full_batches_;
+    stats.deadline_batches = deadline_batches_;
+    stats.flush_batches = flush_batches_;
+    return stats;
+}
+
 size_t OpenVINOImageInference::GetNireq() const {
     return safe_convert<size_t>(nireq);
 }
@@ -1524,12 +1728,8 @@ std::map<std::string, GstStructure *> OpenVINOImageInference::GetModelInfoPostpr
 std::map<std::string, GstStructure *> OpenVINOImageInference::GetModelInfoPreproc(const std::string model_file,
                                                                                   const gchar *pre_proc_config,
                                                                                   const gchar *ov_extension_lib) {
-    if (ov_extension_lib && ov_extension_lib[0] != '\0') {
-        OpenVinoNewApiImpl::core().add_extension(ov_extension_lib);
-    }
-    std::shared_ptr<ov::Model> model = OpenVinoNewApiImpl::core().read_model(model_file);
-
-    auto info = ModelApiConverters::get_model_info_preproc(std::move(model), model_file, pre_proc_config);
+    auto info = ModelRegistry::get_model_info_preproc(model_file, ov_extension_lib ? ov_extension_lib : "",
+                                                      pre_proc_config);
     return info;
 }
 
@@ -1542,26 +1742,16 @@ void OpenVINOImageInference::Flush() {
 
     std::unique_lock<std::mutex> flush_lk(flush_mutex);
 
+    // partial batch (if any) is submitted below, nothing is left for the deadline scheduler
+    partial_batch_pending_ = false;
+
     while (requests_processing_ != 0) {
         auto request = freeRequests.pop();
 
         if (request->buffers.size() > 0) {
             try {
-                // WA: Fill non-complete batch with last element for bypass preprocessing only.
-                // When software preprocessing is used, frames are written directly into the infer-request-owned
-                // batched tensor, so any unfilled tail slots in the last partial batch already contain data from a
-                // previous request reuse.
-                if (batch_size > 1 && !DoNeedImagePreProcessing(nullptr)) {
-                    size_t input_idx = 0;
-                    for (auto &input_vec : request->in_tensors) {
-                        for (int i = input_vec.size(); i < batch_size; i++)
-                            input_vec.push_back(input_vec.back());
-                        // FIXME: move?
-                        request->infer_request_new.set_input_tensors(input_idx, input_vec);
-                        input_idx++;
-                    }
-                }
-
+                PadPartialBatch(request);
+                ++flush_batches_;
                 request->start_async();
             } catch (const std::exception &e) {
                 GVA_ERROR("Couldn't start inferece on flush: %s", e.what());
@@ -1579,6 +1769,7 @@ void OpenVINOImageInference::Flush() {
 }
 
 void OpenVINOImageInference::Close() {
+    StopDeadlineThread();
     Flush();
     while (!freeRequests.empty()) {
         auto req = freeRequests.pop();
@@ -13,16 +13,27 @@
 #include <openvino/openvino.hpp>
 
 #include <atomic>
+#include <chrono>
+#include <condition_variable>
 #include <gst/gst.h>
 #include <map>
 #include <string>
 #include <thread>
+#include <vector>
 
 #include "config.h"
 #include "safe_queue.h"
+#include "worker_pool.h"
 
 class OpenVINOImageInference : public InferenceBackend::ImageInference {
   public:
+    // Counters of how batches were dispatched to the device
+    struct BatchDispatchStats {
+        uint64_t full_batches = 0;     // batch-size frames collected
+        uint64_t deadline_batches = 0; // partial batch launched because batch-deadline expired
+        uint64_t flush_batches = 0;    // partial batch launched by Flush() (EOS, reconfiguration, etc.)
+    };
+
     OpenVINOImageInference(const InferenceBackend::InferenceConfig &config, InferenceBackend::Allocator *allocator,
                            dlstreamer::ContextPtr context, CallbackFunc callback, ErrorHandlingFunc error_handler,
                            InferenceBackend::MemoryType memory_type);
@@ -31,11 +42,16 @@ class OpenVINOImageInference : public InferenceBackend::ImageInference {
 
     void SubmitImage(IFrameBase::Ptr frame,
                      const std::map<std::string, InferenceBackend::InputLayerDesc::Ptr> &input_preprocessors) override;
+    void SubmitImages(const std::vector<IFrameBase::Ptr> &frames,
+                      const std::vector<std::map<std::string, InferenceBackend::InputLayerDesc::Ptr>>
+                          &input_preprocessors) override;
 
     const std::string &GetModelName() const override;
 
     size_t GetBatchSize() const override;
     int GetBatchTimeout() const;
+    int GetBatchDeadline() const;
+    BatchDispatchStats GetBatchDispatchStats() const;
     size_t GetNireq() const override;
 
     void GetModelImageInputInfo(size_t &width, size_t &height, size_t &batch_size, int &format,
@@ -79,10 +95,14 @@ class OpenVINOImageInference : public InferenceBackend::ImageInference {
 
     int batch_size;
     int batch_timeout;
+    int batch_deadline;
     int nireq;
     SafeQueue<std::shared_ptr<BatchRequest>> freeRequests;
 
     std::unique_ptr<InferenceBackend::ImagePreprocessor> pre_processor;
+    InferenceBackend::ImagePreprocessorType pre_processor_type = InferenceBackend::ImagePreprocessorType::AUTO;
+    // Runs software pre-processing of frames submitted together by SubmitImages, created on first use
+    std::unique_ptr<WorkerPool> pre_proc_workers_;
 
     // Threading
     std::mutex requests_mutex_;
@@ -90,6 +110,17 @@ class OpenVINOImageInference : public InferenceBackend::ImageInference {
     std::condition_variable request_processed_;
     std::mutex flush_mutex;
 
+    // Deadline scheduler for partial batches, all state below is guarded by requests_mutex_
+    std::thread deadline_thread_;
+    std::condition_variable deadline_cv_;
+    std::chrono::steady_clock::time_point partial_batch_deadline_;
+    bool partial_batch_pending_ = false;
+    bool deadline_thread_stop_ = false;
+
+    std::atomic<uint64_t> full_batches_{0};
+    std::atomic<uint64_t> deadline_batches_{0};
+    std::atomic<uint64_t> flush_batches_{0};
+
   private:
     void FreeRequest(std::shared_ptr<BatchRequest> request);
     bool DoNeedImagePreProcessing(const InferenceBackend::ImagePtr src_img);
@@ -100,6 +131,10 @@ class OpenVINOImageInference : public InferenceBackend::ImageInference {
     void BypassImageProcessing(const std::string &input_name, std::shared_ptr<BatchRequest> request,
                                const InferenceBackend::Image &src_img, size_t batch_size);
     void SetCompletionCallback(std::shared_ptr<BatchRequest> &batch_request);
+    void DispatchRequest(std::shared_ptr<BatchRequest> &request, size_t added_frames);
+    void PadPartialBatch(std::shared_ptr<BatchRequest> &request);
+    void DeadlineWorkingFunction();
+    void StopDeadlineThread();
     void
     ApplyInputPreprocessors(std::shared_ptr<BatchRequest> &request,
                             const std::map<std::string, InferenceBackend::InputLayerDesc::Ptr> &input_preprocessors);
@@ -0,0 +1,119 @@
+/*******************************************************************************
+ * Copyright (C) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+#pragma once
+
+#include "inference_backend/logger.h"
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+// Fixed set of threads running the indices of a task together with the calling thread. Indices are claimed from a
+// shared counter, so threads that finish early pick up the remaining work. One run() at a time.
+class WorkerPool {
+  public:
+    explicit WorkerPool(size_t threads) {
+        for (size_t i = 0; i < threads; ++i)
+            threads_.emplace_back(&WorkerPool::workerLoop, this);
+    }
+
+    ~WorkerPool() {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            stop_ = true;
+        }
+        start_.notify_all();
+        for (auto &thread : threads_)
+            thread.join();
+    }
+
+    WorkerPool(const WorkerPool &) = delete;
+    WorkerPool &operator=(const WorkerPool &) = delete;
+
+    size_t size() const {
+        return threads_.size();
+    }
+
+    // Calls task(i) for every i in [0, count) and returns once all calls are done. The first exception is rethrown.
+    void run(size_t count, const std::function<void(size_t)> &task) {
+        ITT_TASK("WorkerPool::run");
+        if (threads_.empty() || count < 2) {
+            for (size_t i = 0; i < count; ++i)
+                task(i);
+            return;
+        }
+
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            task_ = &task;
+            task_count_ = count;
+            next_index_ = 0;
+            error_ = nullptr;
+            busy_workers_ = threads_.size();
+            ++generation_;
+        }
+        start_.notify_all();
+
+        drain();
+
+        std::unique_lock<std::mutex> lock(mutex_);
+        done_.wait(lock, [this] { return busy_workers_ == 0; });
+        task_ = nullptr;
+        if (error_)
+            std::rethrow_exception(error_);
+    }
+
+  private:
+    void drain() {
+        for (size_t i = next_index_++; i < task_count_; i = next_index_++) {
+            try {
+                (*task_)(i);
+            } catch (...) {
+                std::lock_guard<std::mutex> lock(mutex_);
+                if (!error_)
+                    error_ = std::current_exception();
+            }
+        }
+    }
+
+    void workerLoop() {
+        uint64_t seen_generation = 0;
+        std::unique_lock<std::mutex> lock(mutex_);
+        while (true) {
+            start_.wait(lock, [&] { return stop_ || generation_ != seen_generation; });
+            if (stop_)
+                return;
+            seen_generation = generation_;
+
+            lock.unlock();
+            drain();
+            lock.lock();
+
+            if (--busy_workers_ == 0)
+                done_.notify_one();
+        }
+    }
+
+    std::vector<std::thread> threads_;
+    std::mutex mutex_;
+    std::condition_variable start_;
+    std::condition_variable done_;
+
+    // state of the current run(), published to the workers under mutex_
+    const std::function<void(size_t)> *task_ = nullptr;
+    size_t task_count_ = 0;
+    std::atomic<size_t> next_index_{0};
+    size_t busy_workers_ = 0;
+    uint64_t generation_ = 0;
+    bool stop_ = false;
+    std::exception_ptr error_;
+};
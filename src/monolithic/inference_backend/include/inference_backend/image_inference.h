@@ -10,6 +10,7 @@
 #include <gst/gst.h>
 #include <map>
 #include <memory>
+#include <stdexcept>
 #include <string>
 #include <vector>
 
@@ -59,6 +60,17 @@ class ImageInference {
     virtual void SubmitImage(IFrameBase::Ptr frame,
                              const std::map<std::string, std::shared_ptr<InputLayerDesc>> &input_preprocessors) = 0;
 
+    // Submits frames sharing one source image, e.g. all ROIs of a video frame, with per-frame input pre-processors.
+    // Backends may pre-process such frames in parallel, the default implementation submits them one by one.
+    virtual void
+    SubmitImages(const std::vector<IFrameBase::Ptr> &frames,
+                 const std::vector<std::map<std::string, std::shared_ptr<InputLayerDesc>>> &input_preprocessors) {
+        if (frames.size() != input_preprocessors.size())
+            throw std::invalid_argument("Number of frames and input pre-processors must match");
+        for (size_t i = 0; i < frames.size(); ++i)
+            SubmitImage(frames[i], input_preprocessors[i]);
+    }
+
     virtual const std::string &GetModelName() const = 0;
     virtual size_t GetBatchSize() const = 0;
     virtual size_t GetNireq() const = 0;
@@ -174,6 +186,7 @@ __DECLARE_CONFIG_KEY(PRE_PROCESSOR_TYPE);
 __DECLARE_CONFIG_KEY(IMAGE_FORMAT);
 __DECLARE_CONFIG_KEY(MODEL_FORMAT);
 __DECLARE_CONFIG_KEY(BATCH_SIZE);
+__DECLARE_CONFIG_KEY(BATCH_DEADLINE); // Max wait (ms) of the oldest frame in a partial batch
 __DECLARE_CONFIG_KEY(RESHAPE);
 __DECLARE_CONFIG_KEY(RESHAPE_STATIC);
 __DECLARE_CONFIG_KEY(RESHAPE_WIDTH);
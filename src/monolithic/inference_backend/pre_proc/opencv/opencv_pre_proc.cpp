@@ -267,6 +267,84 @@ cv::Mat OpenCV_VPP::CustomImageConvert(const cv::Mat &orig_image, const int src_
     return cv::Mat();
 }
 
+bool OpenCV_VPP::TryFusedConvert(const Image &src, Image &dst, const InputImageLayerDesc::Ptr &pre_proc_info,
+                                 const ImageTransformationParams::Ptr &image_transform_info) {
+    if (user_callback || !IsFusedConvertSupported(src.format, dst.format))
+        return false;
+
+    const bool is_nv12_or_i420 = src.format == FOURCC_NV12 || src.format == FOURCC_I420;
+    // Same even-size truncation as ImageToMat() applies to YUV sources
+    const cv::Size src_size(safe_convert<int>(is_nv12_or_i420 ? src.width & ~1u : src.width),
+                            safe_convert<int>(is_nv12_or_i420 ? src.height & ~1u : src.height));
+    const cv::Size dst_size(safe_convert<int>(dst.width), safe_convert<int>(dst.height));
+    const int natural_format = (src.format == FOURCC_RGBX || src.format == FOURCC_RGBA) ? FOURCC_RGB : FOURCC_BGR;
+
+    FusedConvertParams params;
+    params.scaled_size = dst_size;
+
+    if (!needCustomImageConvert(pre_proc_info)) {
+        // Plain stretch to the model input, keeping the source channel order
+        FusedConvert(src, dst, params);
+        return true;
+    }
+
+    const auto target_color_space = pre_proc_info->getTargetColorSpace();
+    if (pre_proc_info->isAspectRatioMultipleOfResize() || pre_proc_info->doNeedCrop() ||
+        (target_color_space != InputImageLayerDesc::ColorSpace::NO &&
+         target_color_space != InputImageLayerDesc::ColorSpace::BGR &&
+         target_color_space != InputImageLayerDesc::ColorSpace::RGB))
+        return false;
+
+    // Geometry below follows CustomImageConvert() exactly
+    int padding_x = 0;
+    int padding_y = 0;
+    if (pre_proc_info->doNeedPadding()) {
+        const auto &padding = pre_proc_info->getPadding();
+        if (!padding.fill_value.empty() && padding.fill_value.size() < params.fill.size())
+            return false;
+        padding_x = safe_convert<int>(padding.stride_x);
+        padding_y = safe_convert<int>(padding.stride_y);
+        std::copy_n(padding.fill_value.begin(), std::min(padding.fill_value.size(), params.fill.size()),
+                    params.fill.begin());
+    }
+    const cv::Size size_except_padding(dst_size.width - padding_x * 2, dst_size.height - padding_y * 2);
+
+    double scale_x = 1;
+    double scale_y = 1;
+    const bool resize = pre_proc_info->doNeedResize() && src_size != size_except_padding;
+    if (resize) {
+        scale_x = safe_convert<double>(size_except_padding.width) / src_size.width;
+        scale_y = safe_convert<double>(size_except_padding.height) / src_size.height;
+        if (pre_proc_info->getResizeType() == InputImageLayerDesc::Resize::ASPECT_RATIO ||
+            pre_proc_info->getResizeType() == InputImageLayerDesc::Resize::ASPECT_RATIO_PAD)
+            scale_x = scale_y = std::min(scale_x, scale_y);
+        params.scaled_size = cv::Size(src_size.width * scale_x, src_size.height * scale_y);
+    } else {
+        params.scaled_size = src_size;
+    }
+
+    if (pre_proc_info->getResizeType() != InputImageLayerDesc::Resize::ASPECT_RATIO_PAD)
+        params.offset = cv::Point((dst_size.width - params.scaled_size.width) / 2,
+                                  (dst_size.height - params.scaled_size.height) / 2);
+    if (params.scaled_size.width <= 0 || params.scaled_size.height <= 0 || params.offset.x < 0 ||
+        params.offset.y < 0 || params.offset.x + params.scaled_size.width > dst_size.width ||
+        params.offset.y + params.scaled_size.height > dst_size.height)
+        return false;
+
+    params.swap_rb = (target_color_space == InputImageLayerDesc::ColorSpace::RGB && natural_format != FOURCC_RGB) ||
+                     (target_color_space == InputImageLayerDesc::ColorSpace::BGR && natural_format != FOURCC_BGR);
+
+    FusedConvert(src, dst, params);
+
+    if (image_transform_info) {
+        if (resize)
+            image_transform_info->ResizeHasDone(scale_x, scale_y);
+        image_transform_info->PaddingHasDone(safe_convert<size_t>(params.offset.x),
+                                             safe_convert<size_t>(params.offset.y));
+    }
+    return true;
+}
+
 void OpenCV_VPP::Convert(const Image &raw_src, Image &dst, const InputImageLayerDesc::Ptr &pre_proc_info,
                          const ImageTransformationParams::Ptr &image_transform_info, bool make_planar,
                          bool allocate_destination) {
@@ -282,6 +360,9 @@ void OpenCV_VPP::Convert(const Image &raw_src, Image &dst, const InputImageLayer
             CopyImage(raw_src, dst);
         }
 
+        if (make_planar && TryFusedConvert(src, dst, pre_proc_info, image_transform_info))
+            return;
+
         cv::Mat src_mat_image;
         cv::Mat dst_mat_image;
 
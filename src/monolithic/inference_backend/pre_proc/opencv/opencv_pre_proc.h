@@ -1,5 +1,5 @@
 /*******************************************************************************
- * Copyright (C) 2018-2025 Intel Corporation
+ * Copyright (C) 2018-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  ******************************************************************************/
@@ -39,6 +39,10 @@ class OpenCV_VPP : public ImagePreprocessor {
                                const InputImageLayerDesc::Ptr &pre_proc_info,
                                const ImageTransformationParams::Ptr &image_transform_info);
 
+    // Single-pass path for model_proc chains made of resize, padding and RGB/BGR conversion only
+    bool TryFusedConvert(const Image &src, Image &dst, const InputImageLayerDesc::Ptr &pre_proc_info,
+                         const ImageTransformationParams::Ptr &image_transform_info);
+
     cv::Rect centralCropROI(const cv::Mat &image);
     void CopyImage(const Image &src, Image &dst);
 
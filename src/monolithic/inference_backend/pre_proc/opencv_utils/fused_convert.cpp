@@ -0,0 +1,284 @@
+/*******************************************************************************
+ * Copyright (C) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+#include "inference_backend/logger.h"
+#include "opencv_utils.h"
+#include "safe_arithmetic.hpp"
+
+#include <opencv2/core.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+namespace InferenceBackend {
+
+namespace Utils {
+
+namespace {
+
+// BT.601 limited range coefficients, same as cv::COLOR_YUV2BGR_NV12/I420
+constexpr float YUV_CY = 1.164383f;
+constexpr float YUV_CUB = 2.017232f;
+constexpr float YUV_CUG = -0.391762f;
+constexpr float YUV_CVG = -0.812968f;
+constexpr float YUV_CVR = 1.596027f;
+
+// Source pixel taps of one destination coordinate, matching cv::INTER_LINEAR sampling
+struct Taps {
+    int i0;
+    int i1;
+    float weight;
+};
+
+Taps computeTaps(int dst_index, double scale, int src_size) {
+    const double position = (dst_index + 0.5) * scale - 0.5;
+    int i0 = static_cast<int>(std::floor(position));
+    float weight = static_cast<float>(position - i0);
+    if (i0 < 0) {
+        i0 = 0;
+        weight = 0.f;
+    }
+    if (i0 >= src_size - 1) {
+        i0 = src_size - 1;
+        weight = 0.f;
+    }
+    return {i0, std::min(i0 + 1, src_size - 1), weight};
+}
+
+enum class SourceLayout { PACKED, NV12, I420 };
+
+// Describes the source so that every layout is read as three channels in "natural" order:
+// B,G,R or R,G,B for packed formats, B,G,R for YUV formats
+struct SourceView {
+    SourceLayout layout;
+    const uint8_t *planes[3];
+    size_t strides[3];
+    int pixel_size; // bytes per pixel of packed formats
+    int width;
+    int height;
+};
+
+SourceView makeSourceView(const Image &src) {
+    SourceView view{};
+    view.width = safe_convert<int>(src.width);
+    view.height = safe_convert<int>(src.height);
+    for (int i = 0; i < 3; ++i) {
+        view.planes[i] = src.planes[i];
+        view.strides[i] = src.stride[i];
+    }
+
+    switch (src.format) {
+    case FOURCC_BGRX:
+    case FOURCC_BGRA:
+    case FOURCC_RGBX:
+    case FOURCC_RGBA:
+        view.layout = SourceLayout::PACKED;
+        view.pixel_size = 4;
+        break;
+    case FOURCC_BGR:
+        view.layout = SourceLayout::PACKED;
+        view.pixel_size = 3;
+        break;
+    case FOURCC_NV12:
+    case FOURCC_I420:
+        view.layout = src.format == FOURCC_NV12 ? SourceLayout::NV12 : SourceLayout::I420;
+        // Same even-size truncation as CreateMat()
+        view.width &= ~1;
+        view.height &= ~1;
+        break;
+    default:
+        throw std::invalid_argument("Fused pre-processing: unsupported source format");
+    }
+    return view;
+}
+
+// Horizontal pass over one source row into three float channel rows
+void interpolateRow(const SourceView &src, int row, const std::vector<Taps> &columns, float *c0, float *c1,
+                    float *c2) {
+    const size_t count = columns.size();
+    if (src.layout == SourceLayout::PACKED) {
+        const uint8_t *line = src.planes[0] + row * src.strides[0];
+        const int pixel_size = src.pixel_size;
+        for (size_t x = 0; x < count; ++x) {
+            const uint8_t *p0 = line + columns[x].i0 * pixel_size;
+            const uint8_t *p1 = line + columns[x].i1 * pixel_size;
+            const float w = columns[x].weight;
+            c0[x] = p0[0] + (p1[0] - p0[0]) * w;
+            c1[x] = p0[1] + (p1[1] - p0[1]) * w;
+            c2[x] = p0[2] + (p1[2] - p0[2]) * w;
+        }
+        return;
+    }
+
+    // Every tap is converted to BGR before interpolation, exactly like full-frame cvtColor followed by cv::resize,
+    // but only for the source pixels that are actually sampled
+    const uint8_t *y_line = src.planes[0] + row * src.strides[0];
+    const bool interleaved = src.layout == SourceLayout::NV12;
+    const uint8_t *u_line = src.planes[1] + (row / 2) * src.strides[1];
+    const uint8_t *v_line = interleaved ? nullptr : src.planes[2] + (row / 2) * src.strides[2];
+    const auto toBgr = [&](int i, float &b, float &g, float &r) {
+        float u, v;
+        if (interleaved) {
+            u = u_line[(i / 2) * 2];
+            v = u_line[(i / 2) * 2 + 1];
+        } else {
+            u = u_line[i / 2];
+            v = v_line[i / 2];
+        }
+        u -= 128.f;
+        v -= 128.f;
+        const float luma = YUV_CY * std::max(0, y_line[i] - 16);
+        b = std::clamp(luma + YUV_CUB * u, 0.f, 255.f);
+        g = std::clamp(luma + YUV_CUG * u + YUV_CVG * v, 0.f, 255.f);
+        r = std::clamp(luma + YUV_CVR * v, 0.f, 255.f);
+    };
+    for (size_t x = 0; x < count; ++x) {
+        float b0, g0, r0, b1, g1, r1;
+        toBgr(columns[x].i0, b0, g0, r0);
+        toBgr(columns[x].i1, b1, g1, r1);
+        const float w = columns[x].weight;
+        c0[x] = b0 + (b1 - b0) * w;
+        c1[x] = g0 + (g1 - g0) * w;
+        c2[x] = r0 + (r1 - r0) * w;
+    }
+}
+
+template <typename T>
+inline T storeValue(float value) {
+    return cv::saturate_cast<T>(value);
+}
+
+template <>
+inline float storeValue<float>(float value) {
+    return value;
+}
+
+template <typename T>
+class FusedConvertBody : public cv::ParallelLoopBody {
+  public:
+    FusedConvertBody(const SourceView &src, const Image &dst, const FusedConvertParams &params,
+                     const std::vector<Taps> &columns)
+        : src(src), params(params), columns(columns), dst_width(safe_convert<int>(dst.width)) {
+        for (int c = 0; c < 3; ++c)
+            planes[c] = reinterpret_cast<T *>(dst.planes[c]);
+        // Output channel c is taken from natural source channel order[c]
+        for (int c = 0; c < 3; ++c)
+            order[c] = params.swap_rb ? 2 - c : c;
+        for (int c = 0; c < 3; ++c)
+            fill[c] = storeValue<T>(static_cast<float>(params.fill[c]));
+    }
+
+    void operator()(const cv::Range &rows) const override {
+        // Two interpolated source rows with three channels each, reused across calls on the same thread
+        thread_local std::vector<float> row_cache;
+        const size_t width = columns.size();
+        row_cache.resize(width * 6);
+        float *top[3] = {row_cache.data(), row_cache.data() + width, row_cache.data() + 2 * width};
+        float *bottom[3] = {top[2] + width, top[2] + 2 * width, top[2] + 3 * width};
+        int top_row = -1, bottom_row = -1;
+
+        const double scale_y = static_cast<double>(src.height) / params.scaled_size.height;
+        const int x_begin = params.offset.x, x_end = params.offset.x + params.scaled_size.width;
+
+        for (int y = rows.start; y < rows.end; ++y) {
+            T *out[3];
+            for (int c = 0; c < 3; ++c)
+                out[c] = planes[c] + static_cast<size_t>(y) * dst_width;
+
+            const int scaled_y = y - params.offset.y;
+            if (scaled_y < 0 || scaled_y >= params.scaled_size.height) {
+                for (int c = 0; c < 3; ++c)
+                    std::fill(out[c], out[c] + dst_width, fill[c]);
+                continue;
+            }
+            for (int c = 0; c < 3; ++c) {
+                std::fill(out[c], out[c] + x_begin, fill[c]);
+                std::fill(out[c] + x_end, out[c] + dst_width, fill[c]);
+            }
+
+            const Taps taps = computeTaps(scaled_y, scale_y, src.height);
+            if (taps.i0 != top_row) {
+                if (taps.i0 == bottom_row) {
+                    std::swap(top, bottom);
+                    std::swap(top_row, bottom_row);
+                } else {
+                    interpolateRow(src, taps.i0, columns, top[0], top[1], top[2]);
+                    top_row = taps.i0;
+                }
+            }
+            if (taps.i1 != bottom_row) {
+                interpolateRow(src, taps.i1, columns, bottom[0], bottom[1], bottom[2]);
+                bottom_row = taps.i1;
+            }
+
+            const float w = taps.weight;
+            for (int c = 0; c < 3; ++c) {
+                const float *a = top[order[c]];
+                const float *b = bottom[order[c]];
+                T *dst_row = out[c] + x_begin;
+                for (size_t x = 0; x < width; ++x)
+                    dst_row[x] = storeValue<T>(a[x] + (b[x] - a[x]) * w);
+            }
+        }
+    }
+
+  private:
+    const SourceView &src;
+    const FusedConvertParams &params;
+    const std::vector<Taps> &columns;
+    const int dst_width;
+    T *planes[3];
+    int order[3];
+    T fill[3];
+};
+
+} // namespace
+
+bool IsFusedConvertSupported(int src_format, int dst_format) {
+    switch (src_format) {
+    case FOURCC_BGRX:
+    case FOURCC_BGRA:
+    case FOURCC_RGBX:
+    case FOURCC_RGBA:
+    case FOURCC_BGR:
+    case FOURCC_NV12:
+    case FOURCC_I420:
+        break;
+    default:
+        return false;
+    }
+    return dst_format == FOURCC_RGBP || dst_format == FOURCC_RGBP_F32;
+}
+
+void FusedConvert(const Image &src, Image &dst, const FusedConvertParams &params) {
+    ITT_TASK(__FUNCTION__);
+    if (!IsFusedConvertSupported(src.format, dst.format))
+        throw std::invalid_argument("Fused pre-processing: unsupported source or destination format");
+
+    const SourceView view = makeSourceView(src);
+    const cv::Rect dst_rect(0, 0, safe_convert<int>(dst.width), safe_convert<int>(dst.height));
+    const cv::Rect scaled_rect(params.offset, params.scaled_size);
+    if (view.width <= 0 || view.height <= 0 || scaled_rect.empty() || (scaled_rect & dst_rect) != scaled_rect)
+        throw std::invalid_argument("Fused pre-processing: invalid source or destination geometry");
+
+    // Column taps are shared by all rows and threads
+    thread_local std::vector<Taps> columns;
+    columns.resize(params.scaled_size.width);
+    const double scale_x = static_cast<double>(view.width) / params.scaled_size.width;
+    for (int x = 0; x < params.scaled_size.width; ++x)
+        columns[x] = computeTaps(x, scale_x, view.width);
+
+    const cv::Range rows(0, dst_rect.height);
+    if (dst.format == FOURCC_RGBP_F32)
+        cv::parallel_for_(rows, FusedConvertBody<float>(view, dst, params, columns));
+    else
+        cv::parallel_for_(rows, FusedConvertBody<uint8_t>(view, dst, params, columns));
+}
+
+} // namespace Utils
+
+} // namespace InferenceBackend
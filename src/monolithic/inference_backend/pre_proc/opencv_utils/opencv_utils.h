@@ -1,5 +1,5 @@
 /*******************************************************************************
- * Copyright (C) 2018-2021 Intel Corporation
+ * Copyright (C) 2018-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  ******************************************************************************/
@@ -11,6 +11,8 @@
 
 #include <opencv2/imgproc.hpp>
 
+#include <array>
+
 namespace InferenceBackend {
 
 namespace Utils {
@@ -48,6 +50,22 @@ void ColorSpaceConvert(const cv::Mat &orig_image, cv::Mat &result_img, const int
 void Normalization(cv::Mat &image, double alpha, double beta);
 void Normalization(cv::Mat &image, const std::vector<double> &alpha, const std::vector<double> &beta);
 
+struct FusedConvertParams {
+    cv::Size scaled_size;            // size of the resized source inside the destination
+    cv::Point offset;                // top-left corner of the resized source inside the destination
+    std::array<double, 3> fill = {}; // value of pixels outside the resized source, in destination channel order
+    bool swap_rb = false;            // destination channel order is the reverse of the source one
+};
+
+bool IsFusedConvertSupported(int src_format, int dst_format);
+
+/**
+ * @brief Bilinear resize, letterbox padding, color conversion and planar split in a single pass.
+ * Writes straight into dst planes without intermediate images. Supports BGRX/BGRA/RGBX/RGBA/BGR/NV12/I420
+ * sources and RGBP/RGBP_F32 destinations, see IsFusedConvertSupported().
+ */
+void FusedConvert(const Image &src, Image &dst, const FusedConvertParams &params);
+
 } // namespace Utils
 
 } // namespace InferenceBackend
@@ -0,0 +1,109 @@
+/*******************************************************************************
+ * Copyright (C) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <bit>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+
+// Log-linear (HDR-style) latency histogram with fixed memory.
+// Values are recorded in microseconds: exact below 64 us, then 32 buckets per power of two, which bounds the relative
+// error of reported percentiles by 1/32. Values from 2^40 us (~12 days) on go to the last bucket.
+namespace latency_histogram {
+
+constexpr unsigned SUB_BUCKET_BITS = 6;
+constexpr uint64_t SUB_BUCKET_COUNT = uint64_t(1) << SUB_BUCKET_BITS; // 64 exact buckets
+constexpr uint64_t HALF_SUB_BUCKET_COUNT = SUB_BUCKET_COUNT / 2;      // buckets per power of two above them
+constexpr unsigned MAX_MAGNITUDE = 40;                                // log2 of the largest tracked value in us
+constexpr size_t BUCKET_COUNT = SUB_BUCKET_COUNT + (MAX_MAGNITUDE - SUB_BUCKET_BITS + 1) * HALF_SUB_BUCKET_COUNT;
+
+inline size_t bucket_index(uint64_t us) {
+    if (us < SUB_BUCKET_COUNT)
+        return static_cast<size_t>(us);
+    const unsigned msb = static_cast<unsigned>(std::bit_width(us)) - 1;
+    if (msb > MAX_MAGNITUDE)
+        return BUCKET_COUNT - 1;
+    const unsigned shift = msb - (SUB_BUCKET_BITS - 1);
+    const uint64_t mantissa = us >> shift; // [HALF_SUB_BUCKET_COUNT, SUB_BUCKET_COUNT)
+    return static_cast<size_t>(SUB_BUCKET_COUNT + (shift - 1) * HALF_SUB_BUCKET_COUNT +
+                               (mantissa - HALF_SUB_BUCKET_COUNT));
+}
+
+// Largest value in microseconds that falls into the bucket
+inline uint64_t bucket_upper_us(size_t index) {
+    if (index < SUB_BUCKET_COUNT)
+        return index;
+    const size_t offset = index - SUB_BUCKET_COUNT;
+    const unsigned shift = static_cast<unsigned>(offset / HALF_SUB_BUCKET_COUNT) + 1;
+    const uint64_t mantissa = HALF_SUB_BUCKET_COUNT + offset % HALF_SUB_BUCKET_COUNT;
+    return ((mantissa + 1) << shift) - 1;
+}
+
+// Plain copy of histogram counts, used for percentile queries and interval deltas
+struct Snapshot {
+    std::array<uint64_t, BUCKET_COUNT> counts{};
+    uint64_t total = 0;
+
+    // Value in ms at quantile q (0..1): upper bound of the bucket holding the q-th recorded value, 0 if empty
+    double percentile(double q) const {
+        if (total == 0)
+            return 0.0;
+        uint64_t rank = static_cast<uint64_t>(std::ceil(q * static_cast<double>(total)));
+        if (rank == 0)
+            rank = 1;
+        uint64_t seen = 0;
+        for (size_t i = 0; i < BUCKET_COUNT; ++i) {
+            seen += counts[i];
+            if (seen >= rank)
+                return static_cast<double>(bucket_upper_us(i)) / 1000.0;
+        }
+        return static_cast<double>(bucket_upper_us(BUCKET_COUNT - 1)) / 1000.0;
+    }
+
+    // Counts recorded after `base` was taken
+    Snapshot since(const Snapshot &base) const {
+        Snapshot delta;
+        for (size_t i = 0; i < BUCKET_COUNT; ++i)
+            delta.counts[i] = counts[i] - base.counts[i];
+        delta.total = total - base.total;
+        return delta;
+    }
+};
+
+} // namespace latency_histogram
+
+// Recording is lock-free and can be called from any streaming thread
+class LatencyHistogram {
+  public:
+    void record(double ms) {
+        const double us = ms * 1000.0;
+        const uint64_t value = us > 0.0 ? static_cast<uint64_t>(std::llround(us)) : 0;
+        counts_[latency_histogram::bucket_index(value)].fetch_add(1, std::memory_order_relaxed);
+        total_.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    // Concurrent records may or may not be included, the total always matches the copied counts
+    latency_histogram::Snapshot snapshot() const {
+        latency_histogram::Snapshot result;
+        for (size_t i = 0; i < latency_histogram::BUCKET_COUNT; ++i) {
+            result.counts[i] = counts_[i].load(std::memory_order_relaxed);
+            result.total += result.counts[i];
+        }
+        return result;
+    }
+
+    uint64_t count() const {
+        return total_.load(std::memory_order_relaxed);
+    }
+
+  private:
+    std::array<std::atomic<uint64_t>, latency_histogram::BUCKET_COUNT> counts_{};
+    std::atomic<uint64_t> total_{0};
+};
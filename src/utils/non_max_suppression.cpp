@@ -0,0 +1,301 @@
+/*******************************************************************************
+ * Copyright (C) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+#include "non_max_suppression.h"
+
+#include <algorithm>
+#include <cmath>
+#include <numeric>
+
+namespace Utils {
+
+namespace {
+
+// Grid bucketing gives up and falls back to the linear scan when large boxes get registered in too many cells
+constexpr size_t MAX_CELL_ITEMS_PER_BOX = 8;
+constexpr size_t MAX_GRID_SIZE = 256;
+
+struct SortedBoxes {
+    const float *x_min;
+    const float *y_min;
+    const float *x_max;
+    const float *y_max;
+    const float *area;
+    const int *label;
+};
+
+inline float intersection(const SortedBoxes &b, size_t i, size_t j) {
+    const float w = std::max(0.f, std::min(b.x_max[i], b.x_max[j]) - std::max(b.x_min[i], b.x_min[j]));
+    const float h = std::max(0.f, std::min(b.y_max[i], b.y_max[j]) - std::max(b.y_min[i], b.y_min[j]));
+    return w * h;
+}
+
+inline float overlapRatio(const SortedBoxes &b, size_t i, size_t j, NmsOverlap overlap) {
+    const float inter = intersection(b, i, j);
+    const float denom =
+        overlap == NmsOverlap::MIN_AREA ? std::min(b.area[i], b.area[j]) : b.area[i] + b.area[j] - inter;
+    return denom > 0.f ? inter / denom : 0.f;
+}
+
+// Marks boxes [first, last) overlapping the pivot. Branch-free body without division so the loop vectorizes.
+template <bool MinArea, bool ClassAware>
+void suppressLinear(const SortedBoxes &b, size_t pivot, size_t first, size_t last, float threshold,
+                    uint8_t *suppressed) {
+    const float px_min = b.x_min[pivot];
+    const float py_min = b.y_min[pivot];
+    const float px_max = b.x_max[pivot];
+    const float py_max = b.y_max[pivot];
+    const float parea = b.area[pivot];
+    const int plabel = b.label[pivot];
+
+    for (size_t j = first; j < last; ++j) {
+        const float w = std::max(0.f, std::min(px_max, b.x_max[j]) - std::max(px_min, b.x_min[j]));
+        const float h = std::max(0.f, std::min(py_max, b.y_max[j]) - std::max(py_min, b.y_min[j]));
+        const float inter = w * h;
+        const float denom = MinArea ? std::min(parea, b.area[j]) : parea + b.area[j] - inter;
+        uint8_t hit = inter > threshold * denom;
+        if (ClassAware)
+            hit &= b.label[j] == plabel;
+        suppressed[j] |= hit;
+    }
+}
+
+} // namespace
+
+void NmsBoxes::clear() {
+    x_min.clear();
+    y_min.clear();
+    x_max.clear();
+    y_max.clear();
+    score.clear();
+    label.clear();
+}
+
+void NmsBoxes::reserve(size_t count) {
+    x_min.reserve(count);
+    y_min.reserve(count);
+    x_max.reserve(count);
+    y_max.reserve(count);
+    score.reserve(count);
+    label.reserve(count);
+}
+
+void NmsBoxes::add(float x_min_, float y_min_, float x_max_, float y_max_, float score_, int label_) {
+    x_min.push_back(x_min_);
+    y_min.push_back(y_min_);
+    x_max.push_back(x_max_);
+    y_max.push_back(y_max_);
+    score.push_back(score_);
+    label.push_back(label_);
+}
+
+const std::vector<size_t> &NmsEngine::run(NmsBoxes &boxes) {
+    kept.clear();
+    if (boxes.size() == 0)
+        return kept;
+
+    sortByScore(boxes);
+
+    if (options.method != NmsMethod::HARD)
+        runSoft(boxes);
+    else if (options.grid_min_boxes != 0 && order.size() >= options.grid_min_boxes)
+        runHardGrid();
+    else
+        runHard();
+
+    return kept;
+}
+
+void NmsEngine::sortByScore(const NmsBoxes &boxes) {
+    const size_t count = boxes.size();
+    order.resize(count);
+    std::iota(order.begin(), order.end(), 0);
+    // Index tie-break keeps the result deterministic without the temporary buffer of std::stable_sort
+    std::sort(order.begin(), order.end(), [&boxes](size_t a, size_t b) {
+        return boxes.score[a] > boxes.score[b] || (boxes.score[a] == boxes.score[b] && a < b);
+    });
+
+    x_min.resize(count);
+    y_min.resize(count);
+    x_max.resize(count);
+    y_max.resize(count);
+    area.resize(count);
+    score.resize(count);
+    label.resize(count);
+    const bool has_labels = boxes.label.size() == count;
+    for (size_t i = 0; i < count; ++i) {
+        const size_t src = order[i];
+        x_min[i] = boxes.x_min[src];
+        y_min[i] = boxes.y_min[src];
+        x_max[i] = boxes.x_max[src];
+        y_max[i] = boxes.y_max[src];
+        area[i] = std::max(0.f, x_max[i] - x_min[i]) * std::max(0.f, y_max[i] - y_min[i]);
+        score[i] = boxes.score[src];
+        label[i] = has_labels ? boxes.label[src] : 0;
+    }
+    suppressed.assign(count, 0);
+}
+
+void NmsEngine::suppressRange(size_t pivot, size_t first, size_t last) {
+    const SortedBoxes b{x_min.data(), y_min.data(), x_max.data(), y_max.data(), area.data(), label.data()};
+    const float threshold = options.overlap_threshold;
+    uint8_t *mask = suppressed.data();
+
+    if (options.overlap == NmsOverlap::MIN_AREA) {
+        if (options.class_aware)
+            suppressLinear<true, true>(b, pivot, first, last, threshold, mask);
+        else
+            suppressLinear<true, false>(b, pivot, first, last, threshold, mask);
+    } else {
+        if (options.class_aware)
+            suppressLinear<false, true>(b, pivot, first, last, threshold, mask);
+        else
+            suppressLinear<false, false>(b, pivot, first, last, threshold, mask);
+    }
+}
+
+void NmsEngine::runHard() {
+    const size_t count = order.size();
+    for (size_t i = 0; i < count; ++i) {
+        if (suppressed[i])
+            continue;
+        kept.push_back(order[i]);
+        suppressRange(i, i + 1, count);
+    }
+}
+
+void NmsEngine::runHardGrid() {
+    const size_t count = order.size();
+
+    float left = x_min[0], top = y_min[0], right = x_max[0], bottom = y_max[0];
+    double width_sum = 0, height_sum = 0;
+    for (size_t i = 0; i < count; ++i) {
+        left = std::min(left, x_min[i]);
+        top = std::min(top, y_min[i]);
+        right = std::max(right, x_max[i]);
+        bottom = std::max(bottom, y_max[i]);
+        width_sum += std::max(0.f, x_max[i] - x_min[i]);
+        height_sum += std::max(0.f, y_max[i] - y_min[i]);
+    }
+    if (!(right > left) || !(bottom > top) || !(width_sum > 0) || !(height_sum > 0)) {
+        runHard();
+        return;
+    }
+
+    // Cells of about the mean box size keep a typical box within 2x2 cells
+    const auto cellsAlong = [count](double extent, double mean_size) {
+        return std::clamp<size_t>(static_cast<size_t>(extent / mean_size), 1, std::min(count, MAX_GRID_SIZE));
+    };
+    const size_t grid_width = cellsAlong(right - left, width_sum / count);
+    const size_t grid_height = cellsAlong(bottom - top, height_sum / count);
+    const float cells_per_x = grid_width / (right - left);
+    const float cells_per_y = grid_height / (bottom - top);
+    const auto cell = [](float pos, float origin, float scale, size_t cells) {
+        return std::min(static_cast<size_t>(std::max(0.f, (pos - origin) * scale)), cells - 1);
+    };
+    const auto cellRange = [&](size_t i, size_t &cx0, size_t &cx1, size_t &cy0, size_t &cy1) {
+        cx0 = cell(x_min[i], left, cells_per_x, grid_width);
+        cx1 = cell(x_max[i], left, cells_per_x, grid_width);
+        cy0 = cell(y_min[i], top, cells_per_y, grid_height);
+        cy1 = cell(y_max[i], top, cells_per_y, grid_height);
+    };
+
+    // Counting pass: every box is registered in all cells it covers
+    cell_offsets.assign(grid_width * grid_height + 1, 0);
+    size_t total_items = 0;
+    for (size_t i = 0; i < count; ++i) {
+        size_t cx0, cx1, cy0, cy1;
+        cellRange(i, cx0, cx1, cy0, cy1);
+        for (size_t cy = cy0; cy <= cy1; ++cy)
+            for (size_t cx = cx0; cx <= cx1; ++cx)
+                ++cell_offsets[cy * grid_width + cx + 1];
+        total_items += (cx1 - cx0 + 1) * (cy1 - cy0 + 1);
+    }
+    if (total_items > count * MAX_CELL_ITEMS_PER_BOX) {
+        runHard();
+        return;
+    }
+    std::partial_sum(cell_offsets.begin(), cell_offsets.end(), cell_offsets.begin());
+
+    // Filling pass in score order, so every cell lists its boxes by ascending rank
+    cell_items.resize(total_items);
+    cell_fill.assign(cell_offsets.begin(), cell_offsets.end() - 1);
+    for (size_t i = 0; i < count; ++i) {
+        size_t cx0, cx1, cy0, cy1;
+        cellRange(i, cx0, cx1, cy0, cy1);
+        for (size_t cy = cy0; cy <= cy1; ++cy)
+            for (size_t cx = cx0; cx <= cx1; ++cx)
+                cell_items[cell_fill[cy * grid_width + cx]++] = static_cast<uint32_t>(i);
+    }
+
+    const SortedBoxes b{x_min.data(), y_min.data(), x_max.data(), y_max.data(), area.data(), label.data()};
+    for (size_t i = 0; i < count; ++i) {
+        if (suppressed[i])
+            continue;
+        kept.push_back(order[i]);
+
+        size_t cx0, cx1, cy0, cy1;
+        cellRange(i, cx0, cx1, cy0, cy1);
+        for (size_t cy = cy0; cy <= cy1; ++cy) {
+            for (size_t cx = cx0; cx <= cx1; ++cx) {
+                const size_t cell_index = cy * grid_width + cx;
+                const auto items_end = cell_items.begin() + cell_offsets[cell_index + 1];
+                // only lower-ranked boxes can be suppressed by box i
+                auto it = std::upper_bound(cell_items.begin() + cell_offsets[cell_index], items_end,
+                                           static_cast<uint32_t>(i));
+                for (; it != items_end; ++it) {
+                    const size_t j = *it;
+                    if (suppressed[j] || (options.class_aware && label[j] != label[i]))
+                        continue;
+                    if (overlapRatio(b, i, j, options.overlap) > options.overlap_threshold)
+                        suppressed[j] = 1;
+                }
+            }
+        }
+    }
+}
+
+void NmsEngine::runSoft(NmsBoxes &boxes) {
+    const size_t count = order.size();
+    const SortedBoxes b{x_min.data(), y_min.data(), x_max.data(), y_max.data(), area.data(), label.data()};
+
+    active.resize(count);
+    std::iota(active.begin(), active.end(), 0);
+
+    while (!active.empty()) {
+        // Decayed scores are no longer sorted, pick the best remaining box explicitly
+        size_t best = 0;
+        for (size_t k = 1; k < active.size(); ++k) {
+            const size_t candidate = active[k], current = active[best];
+            if (score[candidate] > score[current] || (score[candidate] == score[current] && candidate < current))
+                best = k;
+        }
+        const size_t pivot = active[best];
+        kept.push_back(order[pivot]);
+        active[best] = active.back();
+        active.pop_back();
+
+        size_t remaining = 0;
+        for (size_t k = 0; k < active.size(); ++k) {
+            const size_t j = active[k];
+            if (!options.class_aware || label[j] == label[pivot]) {
+                const float overlap = overlapRatio(b, pivot, j, options.overlap);
+                if (options.method == NmsMethod::SOFT_GAUSSIAN)
+                    score[j] *= std::exp(-(overlap * overlap) / options.soft_sigma);
+                else if (overlap > options.overlap_threshold)
+                    score[j] *= 1.f - overlap;
+            }
+            if (score[j] >= options.soft_score_threshold)
+                active[remaining++] = j;
+        }
+        active.resize(remaining);
+    }
+
+    for (size_t i = 0; i < count; ++i)
+        boxes.score[order[i]] = score[i];
+}
+
+} // namespace Utils
@@ -0,0 +1,101 @@
+/*******************************************************************************
+ * Copyright (C) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace Utils {
+
+// Denominator of the overlap ratio: union of both boxes (IoU) or the smaller of the two areas.
+enum class NmsOverlap { UNION, MIN_AREA };
+
+// HARD removes overlapping boxes, SOFT_LINEAR and SOFT_GAUSSIAN decay their scores instead (Soft-NMS).
+enum class NmsMethod { HARD, SOFT_LINEAR, SOFT_GAUSSIAN };
+
+struct NmsOptions {
+    float overlap_threshold = 0.5f;
+    NmsOverlap overlap = NmsOverlap::UNION;
+    // Only boxes with equal labels suppress each other. All classes are still processed in a single pass.
+    bool class_aware = false;
+    NmsMethod method = NmsMethod::HARD;
+    // Gaussian Soft-NMS decay: score *= exp(-overlap^2 / soft_sigma)
+    float soft_sigma = 0.5f;
+    // Soft-NMS drops boxes whose decayed score falls below this value
+    float soft_score_threshold = 0.001f;
+    // Hard NMS switches to spatial grid bucketing from this many boxes on. 0 disables bucketing.
+    size_t grid_min_boxes = 2000;
+};
+
+// Boxes in structure-of-arrays layout, corner coordinates.
+struct NmsBoxes {
+    std::vector<float> x_min;
+    std::vector<float> y_min;
+    std::vector<float> x_max;
+    std::vector<float> y_max;
+    std::vector<float> score;
+    std::vector<int> label;
+
+    size_t size() const {
+        return score.size();
+    }
+    void clear();
+    void reserve(size_t count);
+    void add(float x_min, float y_min, float x_max, float y_max, float score, int label = 0);
+};
+
+/**
+ * Non-maximum suppression over NmsBoxes.
+ * All intermediate buffers are owned by the engine and reused between calls, so keeping an engine per thread makes
+ * steady-state calls allocation-free. Not thread-safe.
+ */
+class NmsEngine {
+  public:
+    NmsEngine() = default;
+    explicit NmsEngine(const NmsOptions &options) : options(options) {
+    }
+
+    void setOptions(const NmsOptions &new_options) {
+        options = new_options;
+    }
+    const NmsOptions &getOptions() const {
+        return options;
+    }
+
+    /**
+     * Returns indices of kept boxes in the order they were selected, i.e. by descending score. Equal scores keep the
+     * input order. Soft-NMS writes decayed scores back to boxes.score. The returned reference is valid until the
+     * next call.
+     */
+    const std::vector<size_t> &run(NmsBoxes &boxes);
+
+  private:
+    void sortByScore(const NmsBoxes &boxes);
+    void suppressRange(size_t pivot, size_t first, size_t last);
+    void runHard();
+    void runHardGrid();
+    void runSoft(NmsBoxes &boxes);
+
+    NmsOptions options;
+
+    // boxes gathered in descending score order
+    std::vector<size_t> order;
+    std::vector<float> x_min, y_min, x_max, y_max, area, score;
+    std::vector<int> label;
+    std::vector<uint8_t> suppressed;
+
+    // grid bucketing: boxes of every cell are stored contiguously in cell_items
+    std::vector<uint32_t> cell_offsets;
+    std::vector<uint32_t> cell_items;
+    std::vector<uint32_t> cell_fill;
+
+    std::vector<size_t> active;
+    std::vector<size_t> kept;
+};
+
+} // namespace Utils
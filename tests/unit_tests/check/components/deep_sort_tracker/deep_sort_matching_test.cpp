@@ -0,0 +1,252 @@
+/*******************************************************************************
+ * Copyright (C) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+/**
+ * @file deep_sort_matching_test.cpp
+ * @brief Randomized comparison of Deep SORT matching primitives against straightforward references.
+ *
+ * Coverage:
+ *   - hungarian_assignment() finds an assignment as cheap as exhaustive search, for square and rectangular
+ *     matrices, with many tied costs and with gated (INFTY_COST) entries.
+ *   - FeatureBank::min_cosine_distances() (one gemm for all queries) matches per-pair dot products in double
+ *     precision, including the budget ring, duplicated features and the scalar min_cosine_distance().
+ */
+
+#include "deep_sort_tracker.h"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <numeric>
+#include <random>
+#include <set>
+#include <vector>
+
+using DeepSortWrapper::CostMatrix;
+using DeepSortWrapper::FeatureBank;
+using DeepSortWrapper::INFTY_COST;
+
+namespace {
+
+// Minimum total cost over all assignments of min(rows, cols) pairs, by trying every permutation
+double reference_assignment_cost(const CostMatrix &cost) {
+    const size_t n = std::max(cost.rows, cost.cols);
+    std::vector<size_t> perm(n);
+    std::iota(perm.begin(), perm.end(), 0);
+
+    double best = std::numeric_limits<double>::max();
+    do {
+        double total = 0.0;
+        for (size_t r = 0; r < cost.rows; ++r)
+            if (perm[r] < cost.cols)
+                total += cost.at(r, perm[r]);
+        best = std::min(best, total);
+    } while (std::next_permutation(perm.begin(), perm.end()));
+    return best;
+}
+
+// Checks that assignments pair distinct rows with distinct columns and returns their total cost
+double checked_assignment_cost(const CostMatrix &cost, const std::vector<std::pair<int, int>> &assignments) {
+    EXPECT_EQ(assignments.size(), std::min(cost.rows, cost.cols));
+    std::set<int> rows, cols;
+    double total = 0.0;
+    for (const auto &pair : assignments) {
+        EXPECT_GE(pair.first, 0);
+        EXPECT_LT(static_cast<size_t>(pair.first), cost.rows);
+        EXPECT_GE(pair.second, 0);
+        EXPECT_LT(static_cast<size_t>(pair.second), cost.cols);
+        EXPECT_TRUE(rows.insert(pair.first).second) << "row " << pair.first << " assigned twice";
+        EXPECT_TRUE(cols.insert(pair.second).second) << "column " << pair.second << " assigned twice";
+        total += cost.at(pair.first, pair.second);
+    }
+    return total;
+}
+
+void expect_optimal(const CostMatrix &cost) {
+    std::vector<std::pair<int, int>> assignments;
+    DeepSortWrapper::hungarian_assignment(cost, assignments);
+    const double expected = reference_assignment_cost(cost);
+    const double actual = checked_assignment_cost(cost, assignments);
+    EXPECT_NEAR(actual, expected, 1e-4 * std::max(1.0, expected)) << cost.rows << "x" << cost.cols << " matrix";
+}
+
+// Random feature, not normalized
+std::vector<float> random_feature(std::mt19937 &rng, int dim) {
+    std::normal_distribution<float> dist;
+    std::vector<float> feature(dim);
+    for (auto &value : feature)
+        value = dist(rng);
+    return feature;
+}
+
+std::vector<float> normalized(const std::vector<float> &feature) {
+    double norm = 0.0;
+    for (float value : feature)
+        norm += double(value) * value;
+    norm = std::sqrt(norm);
+    std::vector<float> out(feature.size());
+    for (size_t i = 0; i < feature.size(); ++i)
+        out[i] = norm > 0.0 ? float(feature[i] / norm) : 0.0f;
+    return out;
+}
+
+// Nearest-neighbor cosine distance computed pair by pair in double precision
+float reference_min_cosine_distance(const std::vector<std::vector<float>> &stored, const std::vector<float> &query) {
+    if (stored.empty())
+        return 1.0f;
+    const auto q = normalized(query);
+    double best = -1.0;
+    for (const auto &feature : stored) {
+        const auto s = normalized(feature);
+        double dot = 0.0;
+        for (size_t i = 0; i < s.size(); ++i)
+            dot += double(s[i]) * q[i];
+        best = std::max(best, dot);
+    }
+    return float(std::min(1.0, 1.0 - best));
+}
+
+cv::Mat query_matrix(const std::vector<std::vector<float>> &queries, int dim) {
+    cv::Mat mat(static_cast<int>(queries.size()), dim, CV_32F);
+    for (size_t q = 0; q < queries.size(); ++q) {
+        const auto unit = normalized(queries[q]);
+        std::copy(unit.begin(), unit.end(), mat.ptr<float>(static_cast<int>(q)));
+    }
+    return mat;
+}
+
+} // namespace
+
+TEST(DeepSortHungarian, MatchesExhaustiveSearchOnRandomCosts) {
+    std::mt19937 rng(20260401);
+    std::uniform_int_distribution<size_t> size_dist(1, 6);
+    std::uniform_real_distribution<float> cost_dist(0.0f, 1.0f);
+
+    for (int iteration = 0; iteration < 500; ++iteration) {
+        CostMatrix cost;
+        cost.assign(size_dist(rng), size_dist(rng));
+        for (auto &value : cost.data)
+            value = cost_dist(rng);
+        expect_optimal(cost);
+    }
+}
+
+TEST(DeepSortHungarian, MatchesExhaustiveSearchWithTies) {
+    std::mt19937 rng(7);
+    std::uniform_int_distribution<size_t> size_dist(1, 6);
+    std::uniform_int_distribution<int> cost_dist(0, 3);
+
+    for (int iteration = 0; iteration < 500; ++iteration) {
+        CostMatrix cost;
+        cost.assign(size_dist(rng), size_dist(rng));
+        for (auto &value : cost.data)
+            value = static_cast<float>(cost_dist(rng)) * 0.25f;
+        expect_optimal(cost);
+    }
+}
+
+TEST(DeepSortHungarian, MatchesExhaustiveSearchWithGatedEntries) {
+    std::mt19937 rng(42);
+    std::uniform_int_distribution<size_t> size_dist(1, 6);
+    std::uniform_real_distribution<float> cost_dist(0.0f, 1.0f);
+    std::bernoulli_distribution gated(0.4);
+
+    for (int iteration = 0; iteration < 500; ++iteration) {
+        CostMatrix cost;
+        cost.assign(size_dist(rng), size_dist(rng));
+        for (auto &value : cost.data)
+            value = gated(rng) ? INFTY_COST : cost_dist(rng);
+        expect_optimal(cost);
+    }
+}
+
+TEST(DeepSortHungarian, HandlesDegenerateMatrices) {
+    std::vector<std::pair<int, int>> assignments = {{0, 0}};
+    DeepSortWrapper::hungarian_assignment(CostMatrix(), assignments);
+    EXPECT_TRUE(assignments.empty());
+
+    CostMatrix uniform;
+    uniform.assign(4, 4, 0.5f);
+    expect_optimal(uniform);
+
+    CostMatrix row;
+    row.assign(1, 5);
+    row.data = {0.9f, 0.3f, 0.7f, 0.3f, 0.8f};
+    expect_optimal(row);
+
+    CostMatrix column;
+    column.assign(5, 1);
+    column.data = {0.9f, 0.3f, 0.7f, 0.1f, 0.8f};
+    DeepSortWrapper::hungarian_assignment(column, assignments);
+    ASSERT_EQ(assignments.size(), 1u);
+    EXPECT_EQ(assignments[0], std::make_pair(3, 0));
+}
+
+TEST(DeepSortFeatureBank, MinCosineDistancesMatchReference) {
+    constexpr int dim = DeepSortWrapper::DEFAULT_FEATURES_VECTOR_SIZE_128;
+    std::mt19937 rng(1234);
+    std::uniform_int_distribution<int> count_dist(1, 12);
+    cv::Mat dots; // scratch reused across calls of different shapes, as in the tracker
+
+    for (int iteration = 0; iteration < 200; ++iteration) {
+        const int budget = count_dist(rng);
+        FeatureBank bank(budget, dim);
+        std::vector<std::vector<float>> added;
+        const int num_added = count_dist(rng) + budget / 2;
+        for (int i = 0; i < num_added; ++i) {
+            added.push_back(random_feature(rng, dim));
+            bank.add(added.back());
+        }
+        // only the last 'budget' features are kept
+        const std::vector<std::vector<float>> kept(added.end() - std::min<int>(budget, num_added), added.end());
+        ASSERT_EQ(bank.size(), kept.size());
+
+        std::vector<std::vector<float>> queries;
+        for (int q = count_dist(rng); q > 0; --q)
+            queries.push_back(random_feature(rng, dim));
+        // exact duplicate of a stored feature and a scaled copy of another tie at distance 0
+        queries.push_back(kept.front());
+        std::vector<float> scaled = kept.back();
+        for (auto &value : scaled)
+            value *= 3.0f;
+        queries.push_back(scaled);
+
+        std::vector<float> distances(queries.size());
+        bank.min_cosine_distances(query_matrix(queries, dim), dots, distances.data());
+        for (size_t q = 0; q < queries.size(); ++q) {
+            const float expected = reference_min_cosine_distance(kept, queries[q]);
+            EXPECT_NEAR(distances[q], expected, 1e-5f) << "query " << q << " of iteration " << iteration;
+            EXPECT_NEAR(bank.min_cosine_distance(normalized(queries[q])), expected, 1e-5f);
+        }
+        EXPECT_NEAR(distances[queries.size() - 2], 0.0f, 1e-5f);
+        EXPECT_NEAR(distances[queries.size() - 1], 0.0f, 1e-5f);
+    }
+}
+
+TEST(DeepSortFeatureBank, EmptyOrMismatchedBankIsAtMaximumDistance) {
+    constexpr int dim = 8;
+    std::mt19937 rng(99);
+    cv::Mat dots;
+    const std::vector<std::vector<float>> queries = {random_feature(rng, dim), random_feature(rng, dim)};
+    std::vector<float> distances(queries.size(), 0.0f);
+
+    FeatureBank empty(4, dim);
+    empty.min_cosine_distances(query_matrix(queries, dim), dots, distances.data());
+    EXPECT_EQ(distances, std::vector<float>(queries.size(), 1.0f));
+    EXPECT_EQ(empty.min_cosine_distance(queries[0]), 1.0f);
+
+    // features of another size are not stored, queries of another size never match
+    FeatureBank bank(4, dim);
+    bank.add(random_feature(rng, dim + 1));
+    EXPECT_TRUE(bank.empty());
+    bank.add(queries[0]);
+    std::fill(distances.begin(), distances.end(), 0.0f);
+    bank.min_cosine_distances(query_matrix({random_feature(rng, dim * 2)}, dim * 2), dots, distances.data());
+    EXPECT_EQ(distances[0], 1.0f);
+    EXPECT_EQ(bank.min_cosine_distance(random_feature(rng, dim * 2)), 1.0f);
+}
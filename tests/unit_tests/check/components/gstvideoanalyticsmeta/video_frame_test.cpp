@@ -373,3 +373,87 @@ TEST_F(VideoFrameTest, VideoFrameTestAnalyticsOnlyFallbackRelateToRelation) {
     ASSERT_TRUE(found_contain) << "CONTAIN classification not found in ROI params";
     ASSERT_TRUE(found_relate) << "RELATE_TO classification not found in ROI params";
 }
+
+TEST_F(VideoFrameTest, VideoFrameTestAnalyticsIndex) {
+    const GVA::AnalyticsIndex &empty_index = frame->analytics_index();
+    ASSERT_EQ(empty_index.relation_meta(), nullptr);
+    ASSERT_TRUE(empty_index.objects().empty());
+
+    GstAnalyticsRelationMeta *relation_meta = gst_buffer_add_analytics_relation_meta(buffer);
+    ASSERT_NE(relation_meta, nullptr);
+
+    GstAnalyticsODMtd od_first, od_second;
+    ASSERT_TRUE(gst_analytics_relation_meta_add_od_mtd(relation_meta, g_quark_from_string("person"), 10, 10, 100, 200,
+                                                       0.9f, &od_first));
+    ASSERT_TRUE(gst_analytics_relation_meta_add_od_mtd(relation_meta, g_quark_from_string("car"), 300, 10, 100, 50,
+                                                       0.8f, &od_second));
+
+    // classification related to the first detection
+    GQuark child_quark = g_quark_from_string("happy");
+    gfloat child_conf = 0.7f;
+    GstAnalyticsClsMtd cls_child;
+    ASSERT_TRUE(gst_analytics_relation_meta_add_cls_mtd(relation_meta, 1, &child_conf, &child_quark, &cls_child));
+    ASSERT_TRUE(gst_analytics_relation_meta_set_relation(relation_meta, GST_ANALYTICS_REL_TYPE_CONTAIN, od_first.id,
+                                                         cls_child.id));
+
+    // classification attached to the second detection only from the child side
+    GstAnalyticsClsMtd cls_part;
+    ASSERT_TRUE(gst_analytics_relation_meta_add_cls_mtd(relation_meta, 1, &child_conf, &child_quark, &cls_part));
+    ASSERT_TRUE(gst_analytics_relation_meta_set_relation(relation_meta, GST_ANALYTICS_REL_TYPE_IS_PART_OF, cls_part.id,
+                                                         od_second.id));
+
+    // frame-level classification and class descriptor
+    GQuark frame_quark = g_quark_from_string("indoor");
+    gfloat frame_conf = 0.6f;
+    GstAnalyticsClsMtd cls_frame;
+    ASSERT_TRUE(gst_analytics_relation_meta_add_cls_mtd(relation_meta, 1, &frame_conf, &frame_quark, &cls_frame));
+    GstAnalyticsClsMtd cls_descriptor;
+    ASSERT_TRUE(gst_analytics_relation_meta_add_cls_mtd(relation_meta, 1, &frame_conf, &frame_quark, &cls_descriptor));
+    gst_analytics_mtd_set_semantic_tag(reinterpret_cast<GstAnalyticsMtd *>(&cls_descriptor), "class_descriptor");
+
+    const GVA::AnalyticsIndex &index = frame->analytics_index();
+    ASSERT_EQ(index.relation_meta(), relation_meta);
+    ASSERT_EQ(std::vector<guint>(index.objects().begin(), index.objects().end()),
+              (std::vector<guint>{od_first.id, od_second.id}));
+    ASSERT_EQ(std::vector<guint>(index.children(od_first.id).begin(), index.children(od_first.id).end()),
+              std::vector<guint>{cls_child.id});
+    ASSERT_TRUE(index.children(od_second.id).empty());
+    ASSERT_TRUE(index.children(cls_frame.id).empty());
+    ASSERT_EQ(std::vector<guint>(index.frame_entries().begin(), index.frame_entries().end()),
+              std::vector<guint>{cls_frame.id});
+    ASSERT_EQ(std::vector<guint>(index.class_descriptors().begin(), index.class_descriptors().end()),
+              std::vector<guint>{cls_descriptor.id});
+    ASSERT_EQ(frame->tensors().size(), 1);
+    ASSERT_EQ(frame->regions().size(), 2);
+
+    // adding metadata rebuilds the index
+    frame->add_region(0, 0, 10, 10, "face", 0.5);
+    ASSERT_EQ(frame->analytics_index().objects().size(), 3);
+    ASSERT_EQ(frame->regions().size(), 3);
+}
+
+TEST_F(VideoFrameTest, VideoFrameTestAnalyticsIndexFollowsRegionRelations) {
+    frame->add_region(10, 10, 100, 200, "person", 0.9);
+    const guint od_id = frame->regions()[0].region_id();
+    ASSERT_TRUE(frame->analytics_index().children(od_id).empty());
+
+    // relations set through a region are visible in the index of its frame
+    std::vector<GVA::RegionOfInterest> regions = frame->regions();
+    regions[0].set_object_id(7);
+    GstAnalyticsRelationMeta *relation_meta = frame->analytics_index().relation_meta();
+    GVA::AnalyticsIndex::IdRange children = frame->analytics_index().children(od_id);
+    ASSERT_EQ(children.size(), 1);
+    GstAnalyticsTrackingMtd trk_mtd;
+    ASSERT_TRUE(gst_analytics_relation_meta_get_tracking_mtd(relation_meta, *children.begin(), &trk_mtd));
+
+    // replacing the object id detaches the previous tracking entry
+    regions[0].set_object_id(8);
+    ASSERT_EQ(frame->analytics_index().children(od_id).size(), 1);
+    ASSERT_NE(*frame->analytics_index().children(od_id).begin(), trk_mtd.id);
+
+    // regions don't keep the index of a destroyed frame alive
+    delete frame;
+    frame = nullptr;
+    regions[0].set_object_id(9);
+    ASSERT_EQ(regions[0].object_id(), 9);
+}
@@ -0,0 +1,102 @@
+/*******************************************************************************
+ * Copyright (C) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+#include "label_interner.h"
+
+#include <gtest/gtest.h>
+
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace {
+
+// Strings no other test or library has turned into quarks
+std::string unique_label(const std::string &name) {
+    static int counter = 0;
+    return "label_interner_test/" + name + "/" + std::to_string(counter++);
+}
+
+} // namespace
+
+TEST(LabelInternerTest, PreInternsModelLabels) {
+    const std::vector<std::string> labels = {"person", "car", "bicycle"};
+    LabelInterner interner(labels, 4);
+
+    ASSERT_EQ(interner.label_quarks().size(), labels.size());
+    for (size_t i = 0; i < labels.size(); ++i) {
+        EXPECT_EQ(interner.label_quarks()[i], g_quark_try_string(labels[i].c_str()));
+        EXPECT_EQ(interner.intern(labels[i]), interner.label_quarks()[i]);
+    }
+    EXPECT_EQ(interner.created(), 0u);
+}
+
+TEST(LabelInternerTest, EmptyLabelHasNoQuark) {
+    LabelInterner interner;
+    EXPECT_EQ(interner.intern(""), 0u);
+    EXPECT_EQ(interner.intern(static_cast<const char *>(nullptr)), 0u);
+}
+
+TEST(LabelInternerTest, InternsOtherLabelsOnce) {
+    LabelInterner interner({}, 4);
+    const std::string label = unique_label("dynamic");
+
+    const GQuark quark = interner.intern(label);
+    EXPECT_NE(quark, 0u);
+    EXPECT_STREQ(g_quark_to_string(quark), label.c_str());
+    EXPECT_EQ(interner.intern(label.c_str()), quark);
+    EXPECT_EQ(interner.created(), 1u);
+}
+
+TEST(LabelInternerTest, ReusesExistingQuarksBeyondCapacity) {
+    const std::string existing = unique_label("existing");
+    const GQuark existing_quark = g_quark_from_string(existing.c_str());
+
+    LabelInterner interner({}, 0);
+    EXPECT_EQ(interner.intern(existing), existing_quark);
+    EXPECT_EQ(interner.created(), 0u);
+}
+
+TEST(LabelInternerTest, StopsCreatingQuarksAtCapacity) {
+    LabelInterner interner({"person"}, 2);
+    const std::string first = unique_label("first");
+    const std::string second = unique_label("second");
+    const std::string third = unique_label("third");
+
+    const GQuark first_quark = interner.intern(first);
+    EXPECT_NE(first_quark, 0u);
+    EXPECT_NE(interner.intern(second), 0u);
+    EXPECT_EQ(interner.intern(third), 0u);
+    EXPECT_EQ(g_quark_try_string(third.c_str()), 0u);
+    EXPECT_EQ(interner.created(), 2u);
+
+    // known labels still resolve
+    EXPECT_EQ(interner.intern(first), first_quark);
+    EXPECT_EQ(interner.intern("person"), interner.label_quarks()[0]);
+}
+
+TEST(LabelInternerTest, IsThreadSafe) {
+    LabelInterner interner({}, 64);
+    std::vector<std::string> labels;
+    for (int i = 0; i < 16; ++i)
+        labels.push_back(unique_label("threaded"));
+
+    std::vector<std::vector<GQuark>> quarks(4, std::vector<GQuark>(labels.size()));
+    std::vector<std::thread> threads;
+    for (size_t t = 0; t < quarks.size(); ++t) {
+        threads.emplace_back([&, t] {
+            for (int round = 0; round < 100; ++round)
+                for (size_t i = 0; i < labels.size(); ++i)
+                    quarks[t][i] = interner.intern(labels[i]);
+        });
+    }
+    for (auto &thread : threads)
+        thread.join();
+
+    for (size_t t = 1; t < quarks.size(); ++t)
+        EXPECT_EQ(quarks[t], quarks[0]);
+    EXPECT_EQ(interner.created(), labels.size());
+}
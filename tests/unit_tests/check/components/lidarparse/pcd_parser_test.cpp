@@ -0,0 +1,227 @@
+/*******************************************************************************
+ * Copyright (C) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+#include "pcd_parser.h"
+
+#include <gtest/gtest.h>
+
+#include <cstring>
+
+namespace {
+
+std::vector<uint8_t> makeFile(const std::string &header, const std::vector<uint8_t> &payload = {}) {
+    std::vector<uint8_t> file(header.begin(), header.end());
+    file.insert(file.end(), payload.begin(), payload.end());
+    return file;
+}
+
+template <typename T>
+void append(std::vector<uint8_t> &bytes, T value) {
+    const auto *p = reinterpret_cast<const uint8_t *>(&value);
+    bytes.insert(bytes.end(), p, p + sizeof(T));
+}
+
+// LZF stream made of literal runs only, which is a valid encoding of any input
+std::vector<uint8_t> lzfLiterals(const std::vector<uint8_t> &data) {
+    std::vector<uint8_t> out;
+    for (size_t pos = 0; pos < data.size(); pos += 32) {
+        const size_t len = std::min<size_t>(32, data.size() - pos);
+        out.push_back(static_cast<uint8_t>(len - 1));
+        out.insert(out.end(), data.begin() + pos, data.begin() + pos + len);
+    }
+    return out;
+}
+
+struct Parsed {
+    pcd::Header header;
+    std::vector<float> xyzi;
+};
+
+Parsed parse(const std::vector<uint8_t> &file) {
+    Parsed parsed;
+    std::string error;
+    EXPECT_TRUE(pcd::parse_header(reinterpret_cast<const char *>(file.data()), file.size(), parsed.header, error))
+        << error;
+    parsed.xyzi.resize(pcd::max_points(file.data(), file.size(), parsed.header) * pcd::XYZI_FLOATS);
+    size_t points = 0;
+    EXPECT_TRUE(pcd::read_points(file.data(), file.size(), parsed.header, parsed.xyzi.data(), points, error)) << error;
+    parsed.xyzi.resize(points * pcd::XYZI_FLOATS);
+    return parsed;
+}
+
+const std::string XYZI_FIELDS = "VERSION 0.7\n"
+                                "FIELDS x y z intensity\n"
+                                "SIZE 4 4 4 4\n"
+                                "TYPE F F F F\n"
+                                "COUNT 1 1 1 1\n";
+
+} // namespace
+
+TEST(PcdParserTest, ParsesAsciiPoints) {
+    const auto parsed = parse(makeFile(XYZI_FIELDS + "WIDTH 3\nHEIGHT 1\nPOINTS 3\nDATA ascii\n"
+                                                     "1.5 -2 3e2 0.25\r\n"
+                                                     "\n"
+                                                     "4 5 6\n"
+                                                     "+7 8.125 -9 10\n"));
+    EXPECT_EQ(parsed.header.data, pcd::DataFormat::ASCII);
+    // the line with a missing value is skipped
+    const std::vector<float> expected = {1.5f, -2.0f, 300.0f, 0.25f, 7.0f, 8.125f, -9.0f, 10.0f};
+    EXPECT_EQ(parsed.xyzi, expected);
+}
+
+TEST(PcdParserTest, SelectsFieldsByNameInAscii) {
+    const auto parsed = parse(makeFile("FIELDS rgb normal x y z\n"
+                                       "SIZE 4 4 4 4 4\n"
+                                       "TYPE U F F F F\n"
+                                       "COUNT 1 3 1 1 1\n"
+                                       "WIDTH 2\nPOINTS 2\nDATA ascii\n"
+                                       "255 0.1 0.2 0.3 1 2 3\n"
+                                       "128 0.4 0.5 0.6 4 5 6\n"));
+    const std::vector<float> expected = {1, 2, 3, 0, 4, 5, 6, 0};
+    EXPECT_EQ(parsed.xyzi, expected);
+}
+
+TEST(PcdParserTest, DetectsXyziFloatBinaryLayout) {
+    std::vector<uint8_t> payload;
+    for (float v : {1.0f, 2.0f, 3.0f, 4.0f, 5.0f, 6.0f, 7.0f, 8.0f})
+        append(payload, v);
+    const auto parsed = parse(makeFile(XYZI_FIELDS + "WIDTH 2\nHEIGHT 1\nVIEWPOINT 0 0 0 1 0 0 0\nDATA binary\n",
+                                       payload));
+    EXPECT_TRUE(pcd::is_xyzi_float32(parsed.header));
+    EXPECT_EQ(parsed.header.points, 2u);
+    EXPECT_EQ(parsed.header.point_size, pcd::XYZI_POINT_SIZE);
+    const std::vector<float> expected = {1, 2, 3, 4, 5, 6, 7, 8};
+    EXPECT_EQ(parsed.xyzi, expected);
+}
+
+TEST(PcdParserTest, ConvertsMixedBinaryLayout) {
+    const std::string header = "FIELDS x y z _ intensity t\n"
+                               "SIZE 4 4 8 1 2 8\n"
+                               "TYPE F F F U U F\n"
+                               "COUNT 1 1 1 2 1 1\n"
+                               "WIDTH 2\nHEIGHT 1\nPOINTS 2\nDATA binary\n";
+    std::vector<uint8_t> payload;
+    for (int i = 0; i < 2; ++i) {
+        append(payload, 1.0f + i);
+        append(payload, -2.0f - i);
+        append(payload, 3.5 + i);
+        append(payload, uint8_t(0xAA));
+        append(payload, uint8_t(0xBB));
+        append(payload, uint16_t(1000 + i));
+        append(payload, 0.0);
+    }
+    const auto parsed = parse(makeFile(header, payload));
+    EXPECT_FALSE(pcd::is_xyzi_float32(parsed.header));
+    EXPECT_EQ(parsed.header.point_size, 4u + 4u + 8u + 2u + 2u + 8u);
+    const std::vector<float> expected = {1.0f, -2.0f, 3.5f, 1000.0f, 2.0f, -3.0f, 4.5f, 1001.0f};
+    EXPECT_EQ(parsed.xyzi, expected);
+}
+
+TEST(PcdParserTest, ClampsTruncatedBinaryPayload) {
+    std::vector<uint8_t> payload;
+    for (float v : {1.0f, 2.0f, 3.0f, 4.0f, 5.0f, 6.0f})
+        append(payload, v);
+    const auto parsed = parse(makeFile(XYZI_FIELDS + "WIDTH 4\nPOINTS 4\nDATA binary\n", payload));
+    const std::vector<float> expected = {1, 2, 3, 4};
+    EXPECT_EQ(parsed.xyzi, expected);
+}
+
+TEST(PcdParserTest, DecompressesBinaryCompressedColumns) {
+    const std::string header = "FIELDS x y z intensity\n"
+                               "SIZE 4 4 4 1\n"
+                               "TYPE F F F U\n"
+                               "WIDTH 3\nHEIGHT 1\nPOINTS 3\nDATA binary_compressed\n";
+    // fields are stored as columns: all x, all y, all z, all intensity
+    std::vector<uint8_t> columns;
+    for (float v : {1.0f, 2.0f, 3.0f, 10.0f, 20.0f, 30.0f, 100.0f, 200.0f, 300.0f})
+        append(columns, v);
+    for (uint8_t v : {7, 8, 9})
+        append(columns, v);
+    const auto compressed = lzfLiterals(columns);
+
+    std::vector<uint8_t> payload;
+    append(payload, static_cast<uint32_t>(compressed.size()));
+    append(payload, static_cast<uint32_t>(columns.size()));
+    payload.insert(payload.end(), compressed.begin(), compressed.end());
+
+    const auto parsed = parse(makeFile(header, payload));
+    const std::vector<float> expected = {1, 10, 100, 7, 2, 20, 200, 8, 3, 30, 300, 9};
+    EXPECT_EQ(parsed.xyzi, expected);
+}
+
+TEST(PcdParserTest, DecompressesLzfBackReferences) {
+    const std::string header = "FIELDS intensity\nSIZE 1\nTYPE U\nWIDTH 12\nPOINTS 12\nDATA binary_compressed\n";
+    // literal "1 2 3 4", then a back reference of 8 bytes at distance 4 repeating it twice
+    const std::vector<uint8_t> compressed = {3, 1, 2, 3, 4, (8 - 2) << 5, 4 - 1};
+
+    std::vector<uint8_t> payload;
+    append(payload, static_cast<uint32_t>(compressed.size()));
+    append(payload, static_cast<uint32_t>(12));
+    payload.insert(payload.end(), compressed.begin(), compressed.end());
+
+    const auto parsed = parse(makeFile(header, payload));
+    ASSERT_EQ(parsed.xyzi.size(), 12 * pcd::XYZI_FLOATS);
+    for (size_t i = 0; i < 12; ++i) {
+        EXPECT_EQ(parsed.xyzi[i * pcd::XYZI_FLOATS], 0.0f);
+        EXPECT_EQ(parsed.xyzi[i * pcd::XYZI_FLOATS + 3], static_cast<float>(i % 4 + 1));
+    }
+}
+
+TEST(PcdParserTest, RejectsCorruptedCompressedPayload) {
+    const std::string header = "FIELDS x\nSIZE 4\nTYPE F\nWIDTH 2\nPOINTS 2\nDATA binary_compressed\n";
+    // back reference before the start of the output
+    const std::vector<uint8_t> compressed = {(8 - 2) << 5, 0};
+    std::vector<uint8_t> payload;
+    append(payload, static_cast<uint32_t>(compressed.size()));
+    append(payload, static_cast<uint32_t>(8));
+    payload.insert(payload.end(), compressed.begin(), compressed.end());
+    const auto file = makeFile(header, payload);
+
+    pcd::Header parsed;
+    std::string error;
+    ASSERT_TRUE(pcd::parse_header(reinterpret_cast<const char *>(file.data()), file.size(), parsed, error));
+    std::vector<float> xyzi(pcd::max_points(file.data(), file.size(), parsed) * pcd::XYZI_FLOATS);
+    size_t points = 0;
+    EXPECT_FALSE(pcd::read_points(file.data(), file.size(), parsed, xyzi.data(), points, error));
+    EXPECT_FALSE(error.empty());
+}
+
+TEST(PcdParserTest, RejectsCompressedPointsBeyondPayload) {
+    // POINTS and uncompressed size agree on 800 MB, which two compressed bytes cannot decompress to
+    const std::string header = "FIELDS x\nSIZE 4\nTYPE F\nWIDTH 200000000\nPOINTS 200000000\nDATA binary_compressed\n";
+    const std::vector<uint8_t> compressed = {0, 0};
+    std::vector<uint8_t> payload;
+    append(payload, static_cast<uint32_t>(compressed.size()));
+    append(payload, static_cast<uint32_t>(200000000u * 4));
+    payload.insert(payload.end(), compressed.begin(), compressed.end());
+    const auto file = makeFile(header, payload);
+
+    pcd::Header parsed;
+    std::string error;
+    ASSERT_TRUE(pcd::parse_header(reinterpret_cast<const char *>(file.data()), file.size(), parsed, error));
+    EXPECT_EQ(pcd::max_points(file.data(), file.size(), parsed), 0u);
+    float xyzi[pcd::XYZI_FLOATS];
+    size_t points = 0;
+    EXPECT_FALSE(pcd::read_points(file.data(), file.size(), parsed, xyzi, points, error));
+    EXPECT_FALSE(error.empty());
+}
+
+TEST(PcdParserTest, RejectsMalformedHeaders) {
+    const char *headers[] = {
+        "FIELDS x y z\nSIZE 4 4 4\nTYPE F F F\nWIDTH 1\n",                    // no DATA
+        "FIELDS x y z\nSIZE 4 4\nTYPE F F F\nWIDTH 1\nDATA ascii\n",          // SIZE count mismatch
+        "FIELDS x y z\nSIZE 4 4 3\nTYPE F F F\nWIDTH 1\nDATA ascii\n",        // unsupported float size
+        "FIELDS x y z\nSIZE 4 4 4\nTYPE F F F\nWIDTH 1\nDATA binary_lz4\n",   // unknown DATA
+        "FIELDS x y z\nSIZE 4 4 4\nTYPE F F F\nDATA ascii\n",                 // no WIDTH nor POINTS
+        "1.0 2.0 3.0 4.0\n",                                                  // no header at all
+    };
+    for (const char *text : headers) {
+        pcd::Header header;
+        std::string error;
+        EXPECT_FALSE(pcd::parse_header(text, strlen(text), header, error)) << text;
+        EXPECT_FALSE(error.empty());
+    }
+}
@@ -0,0 +1,106 @@
+/*******************************************************************************
+ * Copyright (C) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+#include "point_cloud_filter.h"
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <limits>
+#include <random>
+
+namespace {
+
+std::vector<float> filter(const PointCloudFilterParams &params, const std::vector<float> &points) {
+    PointCloudFilter point_filter(params);
+    std::vector<float> out(points.size());
+    out.resize(point_filter.apply(points.data(), points.size() / 4, out.data()) * 4);
+    return out;
+}
+
+} // namespace
+
+TEST(PointCloudFilterTest, IsDisabledByDefault) {
+    EXPECT_FALSE(PointCloudFilter(PointCloudFilterParams()).enabled());
+    PointCloudFilterParams params;
+    params.voxel_size = 0.2f;
+    EXPECT_TRUE(PointCloudFilter(params).enabled());
+}
+
+TEST(PointCloudFilterTest, CropsToBox) {
+    PointCloudFilterParams params;
+    params.crop = true;
+    const float roi[6] = {-1, -1, -1, 1, 1, 1};
+    std::copy(roi, roi + 6, params.roi);
+    const float nan = std::numeric_limits<float>::quiet_NaN();
+    const std::vector<float> points = {0, 0, 0, 1, 2, 0, 0, 2, 1, 1, 1, 3, -1, 0, 1.5f, 4, nan, 0, 0, 5};
+    const std::vector<float> expected = {0, 0, 0, 1, 1, 1, 1, 3};
+    EXPECT_EQ(filter(params, points), expected);
+}
+
+TEST(PointCloudFilterTest, FiltersInPlace) {
+    PointCloudFilterParams params;
+    params.crop = true;
+    const float roi[6] = {0, 0, 0, 10, 10, 10};
+    std::copy(roi, roi + 6, params.roi);
+    std::vector<float> points = {-1, 0, 0, 1, 1, 1, 1, 2, 2, 2, 2, 3, 20, 0, 0, 4};
+    PointCloudFilter point_filter(params);
+    const size_t kept = point_filter.apply(points.data(), 4, points.data());
+    ASSERT_EQ(kept, 2u);
+    const std::vector<float> expected = {1, 1, 1, 2, 2, 2, 2, 3};
+    EXPECT_EQ(std::vector<float>(points.begin(), points.begin() + 8), expected);
+}
+
+TEST(PointCloudFilterTest, ReplacesVoxelPointsByCentroid) {
+    PointCloudFilterParams params;
+    params.voxel_size = 1.0f;
+    // two points in voxel (0,0,0), one in voxel (-1,0,0), one more in voxel (0,0,0)
+    const std::vector<float> points = {0.2f, 0.2f, 0.2f, 10, -0.5f, 0.5f, 0.5f, 7, 0.6f, 0.4f, 0.8f, 20,
+                                       0.1f, 0.3f, 0.5f, 30};
+    const auto out = filter(params, points);
+    ASSERT_EQ(out.size(), 8u);
+    EXPECT_NEAR(out[0], 0.3f, 1e-6f);
+    EXPECT_NEAR(out[1], 0.3f, 1e-6f);
+    EXPECT_NEAR(out[2], 0.5f, 1e-6f);
+    EXPECT_NEAR(out[3], 20.0f, 1e-5f);
+    EXPECT_EQ(std::vector<float>(out.begin() + 4, out.end()), std::vector<float>({-0.5f, 0.5f, 0.5f, 7}));
+}
+
+TEST(PointCloudFilterTest, DownsamplesDenseCloud) {
+    PointCloudFilterParams params;
+    params.voxel_size = 0.5f;
+    std::mt19937 gen(3);
+    std::uniform_real_distribution<float> coord(0.0f, 4.0f);
+    std::vector<float> points;
+    for (int i = 0; i < 20000; ++i)
+        points.insert(points.end(), {coord(gen), coord(gen), coord(gen), 1.0f});
+    const auto out = filter(params, points);
+    // 8 x 8 x 8 voxels, all occupied
+    EXPECT_EQ(out.size() / 4, 512u);
+}
+
+TEST(PointCloudFilterTest, RemovesGroundPlane) {
+    PointCloudFilterParams params;
+    params.ground_threshold = 0.05f;
+    std::mt19937 gen(5);
+    std::uniform_real_distribution<float> coord(-20.0f, 20.0f);
+    std::uniform_real_distribution<float> noise(-0.02f, 0.02f);
+    std::uniform_real_distribution<float> height(0.5f, 2.0f);
+    std::vector<float> points;
+    // tilted ground z = 0.05 * x - 1.7, and objects above it
+    for (int i = 0; i < 5000; ++i) {
+        const float x = coord(gen), y = coord(gen);
+        points.insert(points.end(), {x, y, 0.05f * x - 1.7f + noise(gen), 0.0f});
+    }
+    for (int i = 0; i < 500; ++i) {
+        const float x = coord(gen), y = coord(gen);
+        points.insert(points.end(), {x, y, 0.05f * x - 1.7f + height(gen), 1.0f});
+    }
+    const auto out = filter(params, points);
+    ASSERT_EQ(out.size() / 4, 500u);
+    for (size_t i = 0; i < out.size(); i += 4)
+        EXPECT_EQ(out[i + 3], 1.0f);
+}
@@ -0,0 +1,197 @@
+/*******************************************************************************
+ * Copyright (C) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+#include "json_writer.h"
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <functional>
+#include <limits>
+
+using json = nlohmann::json;
+
+namespace {
+
+// Writer output must match dump() of the equivalent tree for compact and pretty forms
+void expect_same_as_dump(const json &expected, const std::function<void(JsonWriter &)> &write) {
+    JsonWriter writer;
+    for (int indent : {-1, 0, 4}) {
+        writer.reset(indent);
+        write(writer);
+        EXPECT_EQ(writer.str(), expected.dump(indent)) << "indent " << indent;
+    }
+}
+
+} // namespace
+
+TEST(JsonWriterTest, WritesScalars) {
+    expect_same_as_dump(json(nullptr), [](JsonWriter &w) { w.null(); });
+    expect_same_as_dump(json(true), [](JsonWriter &w) { w.value(true); });
+    expect_same_as_dump(json(-42), [](JsonWriter &w) { w.value(-42); });
+    expect_same_as_dump(json(std::numeric_limits<int64_t>::min()),
+                        [](JsonWriter &w) { w.value(std::numeric_limits<int64_t>::min()); });
+    expect_same_as_dump(json(std::numeric_limits<uint64_t>::max()),
+                        [](JsonWriter &w) { w.value(std::numeric_limits<uint64_t>::max()); });
+    expect_same_as_dump(json(uint8_t(255)), [](JsonWriter &w) { w.value(uint8_t(255)); });
+    expect_same_as_dump(json("text"), [](JsonWriter &w) { w.value("text"); });
+}
+
+TEST(JsonWriterTest, FormatsFloatingPointAsNlohmann) {
+    for (double number : {0.0, -0.0, 1.0, 2.5, 0.1, 1e-7, 123456789.125, 1e21, 5e-324, -1.7976931348623157e308}) {
+        expect_same_as_dump(json(number), [&](JsonWriter &w) { w.value(number); });
+    }
+    for (float number : {0.1f, 0.3f, 1e-3f, 3.4e38f, 16777217.0f}) {
+        expect_same_as_dump(json(number), [&](JsonWriter &w) { w.value(number); });
+    }
+    expect_same_as_dump(json(std::numeric_limits<double>::quiet_NaN()),
+                        [](JsonWriter &w) { w.value(std::numeric_limits<double>::quiet_NaN()); });
+    expect_same_as_dump(json(-std::numeric_limits<float>::infinity()),
+                        [](JsonWriter &w) { w.value(-std::numeric_limits<float>::infinity()); });
+}
+
+TEST(JsonWriterTest, EscapesStrings) {
+    const std::string text = std::string("quote\" backslash\\ /\b\f\n\r\t \x01\x1f\x7f ") + "\xc3\xa9 \xe2\x82\xac " +
+                             "\xf0\x9f\x98\x80" + std::string(1, '\0') + "end";
+    expect_same_as_dump(json(text), [&](JsonWriter &w) { w.value(text); });
+    expect_same_as_dump(json::object({{text, 1}}), [&](JsonWriter &w) {
+        w.begin_object();
+        w.member(text, 1);
+        w.end_object();
+    });
+}
+
+TEST(JsonWriterTest, RejectsInvalidUtf8) {
+    for (const std::string text : {"\xff", "a\xc3", "\xc0\xaf", "\xed\xa0\x80", "\xe2\x82"}) {
+        EXPECT_THROW(json(text).dump(), json::type_error);
+        JsonWriter writer;
+        EXPECT_THROW(writer.value(text), std::invalid_argument);
+    }
+}
+
+TEST(JsonWriterTest, WritesEmptyContainers) {
+    expect_same_as_dump(json::object(), [](JsonWriter &w) {
+        w.begin_object();
+        w.end_object();
+    });
+    expect_same_as_dump(json::object({{"a", json::array()}, {"b", json::object()}}), [](JsonWriter &w) {
+        w.begin_object();
+        w.key("a");
+        w.begin_array();
+        EXPECT_EQ(w.end_array(), 0u);
+        w.key("b");
+        w.begin_object();
+        EXPECT_EQ(w.end_object(), 0u);
+        w.end_object();
+    });
+}
+
+TEST(JsonWriterTest, SortsMembersOfNestedObjects) {
+    json expected = json::object();
+    expected["z"] = 1;
+    expected["objects"] = json::array({json::object({{"y", 2}, {"x", 1}, {"w", {{"b", 1}, {"a", 2}}}}), "str"});
+    expected["a"] = json::array({json::array({1, 2}), json::array()});
+
+    expect_same_as_dump(expected, [](JsonWriter &w) {
+        w.begin_object();
+        w.member("z", 1);
+        w.key("objects");
+        w.begin_array();
+        w.begin_object();
+        w.member("y", 2);
+        w.member("x", 1);
+        w.key("w");
+        w.begin_object();
+        w.member("b", 1);
+        w.member("a", 2);
+        w.end_object();
+        w.end_object();
+        w.value("str");
+        w.end_array();
+        w.key("a");
+        w.begin_array();
+        w.begin_array();
+        w.value(1);
+        w.value(2);
+        w.end_array();
+        w.begin_array();
+        w.end_array();
+        w.end_array();
+        w.end_object();
+    });
+}
+
+TEST(JsonWriterTest, ResolvesRepeatedKeysAsTree) {
+    // push_back keeps the first member, operator[] replaces it
+    json expected = json::object();
+    expected["tensors"] = json::array({1});
+    expected.push_back({"x", 1});
+    expected.push_back({"tensors", "ignored"});
+    expected.push_back({"label", "first"});
+    expected.push_back({"label", "second"});
+    expected["zone"] = "replaced";
+    expected.push_back({"b", 2});
+    expected["zone"] = "last";
+    expected.push_back({"zone", "ignored"});
+
+    expect_same_as_dump(expected, [](JsonWriter &w) {
+        w.begin_object();
+        w.key("tensors");
+        w.begin_array();
+        w.value(1);
+        w.end_array();
+        w.member("x", 1);
+        w.member("tensors", "ignored");
+        w.member("label", "first");
+        w.member("label", "second");
+        w.key("zone", true);
+        w.value("replaced");
+        w.member("b", 2);
+        w.key("zone", true);
+        w.value("last");
+        w.member("zone", "ignored");
+        EXPECT_EQ(w.end_object(), 5u);
+    });
+}
+
+TEST(JsonWriterTest, PopsEmptyMember) {
+    expect_same_as_dump(json::object({{"a", 1}, {"c", 3}}), [](JsonWriter &w) {
+        w.begin_object();
+        w.member("c", 3);
+        w.key("b");
+        w.begin_array();
+        if (w.end_array() == 0)
+            w.pop_member();
+        w.member("a", 1);
+        w.end_object();
+    });
+}
+
+TEST(JsonWriterTest, WritesTree) {
+    const json tree = json::parse(R"({"name": "cam", "list": [1, -2, 3.5, true, null, "s"], "nested": {"k": {}}})");
+    expect_same_as_dump(json::object({{"id", 7}, {"tree", tree}}), [&](JsonWriter &w) {
+        w.begin_object();
+        w.member("tree", tree);
+        w.member("id", 7);
+        w.end_object();
+    });
+}
+
+TEST(JsonWriterTest, InsertsSerializedValue) {
+    const json tags = json::parse(R"({"camera": {"location": "gate", "id": 3}})");
+    for (int indent : {-1, 4}) {
+        JsonWriter tags_writer(indent, 1);
+        tags_writer.value(tags);
+
+        JsonWriter writer(indent);
+        writer.begin_object();
+        writer.member("timestamp", 1);
+        writer.key("tags");
+        writer.raw(tags_writer.str());
+        writer.end_object();
+        EXPECT_EQ(writer.str(), json::object({{"timestamp", 1}, {"tags", tags}}).dump(indent));
+    }
+}
@@ -0,0 +1,14 @@
+/*******************************************************************************
+ * Copyright (C) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+#include <gtest/gtest.h>
+
+GTEST_API_ int main(int argc, char **argv) {
+    std::cout << "Running Components::metapublish_batcher Test from " << __FILE__ << std::endl;
+    testing::InitGoogleTest(&argc, argv);
+
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,342 @@
+/*******************************************************************************
+ * Copyright (C) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+#include "message_batcher.hpp"
+
+#include <gtest/gtest.h>
+
+#include <zlib.h>
+
+#include <atomic>
+#include <filesystem>
+#include <functional>
+#include <map>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace fs = std::filesystem;
+
+namespace {
+
+// In-process broker which takes envelopes while available and reports their delivery on request or right away
+class FakeBroker : public EnvelopeSink {
+  public:
+    bool send(uint64_t id, const std::string &payload) override {
+        std::lock_guard<std::mutex> lock(_mutex);
+        if (!_available)
+            return false;
+        _pending.push_back(id);
+        _payloads.emplace(id, payload);
+        if (_auto_ack)
+            report(1, true);
+        return true;
+    }
+
+    void poll() override {
+        _polls++;
+    }
+
+    void attach(MessageBatcher *batcher) {
+        _batcher = batcher;
+    }
+
+    void set_available(bool available, bool auto_ack) {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _available = available;
+        _auto_ack = auto_ack;
+    }
+
+    // Reports delivery of the oldest envelopes without report
+    void ack(size_t count, bool success) {
+        std::lock_guard<std::mutex> lock(_mutex);
+        report(count, success);
+    }
+
+    size_t pending() const {
+        std::lock_guard<std::mutex> lock(_mutex);
+        return _pending.size();
+    }
+
+    std::vector<std::string> received() const {
+        std::lock_guard<std::mutex> lock(_mutex);
+        return _received;
+    }
+
+    size_t polls() const {
+        return _polls;
+    }
+
+  private:
+    void report(size_t count, bool success) {
+        for (; count && !_pending.empty(); --count) {
+            const uint64_t id = _pending.front();
+            _pending.erase(_pending.begin());
+            if (success)
+                _received.push_back(_payloads[id]);
+            _payloads.erase(id);
+            _batcher->delivered(id, success);
+        }
+    }
+
+    mutable std::mutex _mutex;
+    MessageBatcher *_batcher = nullptr;
+    bool _available = true;
+    bool _auto_ack = true;
+    std::vector<uint64_t> _pending;
+    std::map<uint64_t, std::string> _payloads;
+    std::vector<std::string> _received;
+    std::atomic<size_t> _polls{0};
+};
+
+bool wait_for(const std::function<bool()> &condition) {
+    for (int i = 0; i < 2000; ++i) {
+        if (condition())
+            return true;
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    return condition();
+}
+
+std::string gunzip(const std::string &input) {
+    z_stream stream = {};
+    inflateInit2(&stream, 15 + 16);
+    stream.next_in = reinterpret_cast<Bytef *>(const_cast<char *>(input.data()));
+    stream.avail_in = static_cast<uInt>(input.size());
+    std::string output;
+    char chunk[4096];
+    int result;
+    do {
+        stream.next_out = reinterpret_cast<Bytef *>(chunk);
+        stream.avail_out = sizeof(chunk);
+        result = inflate(&stream, Z_NO_FLUSH);
+        output.append(chunk, sizeof(chunk) - stream.avail_out);
+    } while (result == Z_OK);
+    inflateEnd(&stream);
+    return result == Z_STREAM_END ? output : "<invalid gzip stream>";
+}
+
+size_t count_files(const fs::path &dir) {
+    size_t count = 0;
+    for (const auto &entry : fs::directory_iterator(dir)) {
+        (void)entry;
+        count++;
+    }
+    return count;
+}
+
+// Spool directory under TMPDIR, so the tests can be pointed to tmpfs
+class MessageBatcherTest : public ::testing::Test {
+  protected:
+    void SetUp() override {
+        const auto *test = ::testing::UnitTest::GetInstance()->current_test_info();
+        _dir = fs::temp_directory_path() / (std::string("dls_message_batcher_") + test->name());
+        fs::remove_all(_dir);
+    }
+
+    void TearDown() override {
+        fs::remove_all(_dir);
+    }
+
+    MessageBatcherConfig config(bool spool = false) const {
+        MessageBatcherConfig config;
+        config.linger = std::chrono::milliseconds(0);
+        config.retry_interval = std::chrono::milliseconds(5);
+        config.max_retry_interval = std::chrono::milliseconds(20);
+        if (spool)
+            config.spool_dir = (_dir / "spool").string();
+        return config;
+    }
+
+    fs::path _dir;
+    FakeBroker _broker;
+};
+
+} // namespace
+
+TEST_F(MessageBatcherTest, SendsEveryMessageWithBatchSizeOne) {
+    MessageBatcher batcher(config(), _broker);
+    _broker.attach(&batcher);
+    ASSERT_TRUE(batcher.start());
+    EXPECT_TRUE(batcher.add("{\"a\":1}"));
+    EXPECT_TRUE(batcher.add("{\"b\":2}"));
+    EXPECT_TRUE(batcher.stop());
+    EXPECT_EQ(_broker.received(), (std::vector<std::string>{"{\"a\":1}", "{\"b\":2}"}));
+    EXPECT_EQ(batcher.stats().sent, 2u);
+    EXPECT_EQ(batcher.stats().delivered, 2u);
+}
+
+TEST_F(MessageBatcherTest, GroupsMessagesByCount) {
+    auto cfg = config();
+    cfg.batch_size = 3;
+    MessageBatcher batcher(cfg, _broker);
+    _broker.attach(&batcher);
+    ASSERT_TRUE(batcher.start());
+    for (int i = 0; i < 4; ++i)
+        EXPECT_TRUE(batcher.add("{\"i\":" + std::to_string(i) + "}"));
+    EXPECT_EQ(_broker.received(), (std::vector<std::string>{"[{\"i\":0},{\"i\":1},{\"i\":2}]"}));
+    EXPECT_TRUE(batcher.stop());
+    EXPECT_EQ(_broker.received(), (std::vector<std::string>{"[{\"i\":0},{\"i\":1},{\"i\":2}]", "[{\"i\":3}]"}));
+}
+
+TEST_F(MessageBatcherTest, GroupsMessagesBySize) {
+    auto cfg = config();
+    cfg.batch_size = 100;
+    cfg.batch_bytes = 12;
+    MessageBatcher batcher(cfg, _broker);
+    _broker.attach(&batcher);
+    ASSERT_TRUE(batcher.start());
+    EXPECT_TRUE(batcher.add("\"abc\""));
+    EXPECT_TRUE(_broker.received().empty());
+    EXPECT_TRUE(batcher.add("\"def\""));
+    EXPECT_EQ(_broker.received(), (std::vector<std::string>{"[\"abc\",\"def\"]"}));
+    EXPECT_TRUE(batcher.stop());
+}
+
+TEST_F(MessageBatcherTest, SendsLingeringEnvelope) {
+    auto cfg = config();
+    cfg.batch_size = 100;
+    cfg.linger = std::chrono::milliseconds(10);
+    MessageBatcher batcher(cfg, _broker);
+    _broker.attach(&batcher);
+    ASSERT_TRUE(batcher.start());
+    EXPECT_TRUE(batcher.add("1"));
+    EXPECT_TRUE(batcher.add("2"));
+    EXPECT_TRUE(wait_for([&] { return !_broker.received().empty(); }));
+    EXPECT_EQ(_broker.received(), (std::vector<std::string>{"[1,2]"}));
+    EXPECT_TRUE(batcher.stop());
+}
+
+TEST_F(MessageBatcherTest, CompressesEnvelope) {
+    auto cfg = config();
+    cfg.batch_size = 2;
+    cfg.compression = EnvelopeCompression::Gzip;
+    MessageBatcher batcher(cfg, _broker);
+    _broker.attach(&batcher);
+    ASSERT_TRUE(batcher.start());
+    const std::string message = "{\"objects\":[" + std::string(1000, ' ') + "]}";
+    EXPECT_TRUE(batcher.add(message));
+    EXPECT_TRUE(batcher.add(message));
+    EXPECT_TRUE(batcher.stop());
+    const auto received = _broker.received();
+    ASSERT_EQ(received.size(), 1u);
+    EXPECT_LT(received[0].size(), message.size());
+    EXPECT_EQ(gunzip(received[0]), "[" + message + "," + message + "]");
+}
+
+TEST_F(MessageBatcherTest, LimitsEnvelopesInFlight) {
+    auto cfg = config();
+    cfg.max_in_flight = 2;
+    _broker.set_available(true, false);
+    MessageBatcher batcher(cfg, _broker);
+    _broker.attach(&batcher);
+    ASSERT_TRUE(batcher.start());
+    EXPECT_TRUE(batcher.add("1"));
+    EXPECT_TRUE(batcher.add("2"));
+
+    std::atomic<bool> added{false};
+    std::thread producer([&] {
+        EXPECT_TRUE(batcher.add("3"));
+        added = true;
+    });
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    EXPECT_FALSE(added);
+    EXPECT_EQ(_broker.pending(), 2u);
+    // delivery reports are served by the background thread while envelopes are in flight
+    EXPECT_TRUE(wait_for([&] { return _broker.polls() > 0; }));
+
+    _broker.ack(1, true);
+    producer.join();
+    EXPECT_EQ(_broker.pending(), 2u);
+    _broker.ack(2, true);
+    EXPECT_TRUE(batcher.stop());
+    EXPECT_EQ(_broker.received(), (std::vector<std::string>{"1", "2", "3"}));
+}
+
+TEST_F(MessageBatcherTest, ReportsRejectedEnvelopeWithoutSpool) {
+    _broker.set_available(false, true);
+    MessageBatcher batcher(config(), _broker);
+    _broker.attach(&batcher);
+    ASSERT_TRUE(batcher.start());
+    EXPECT_FALSE(batcher.add("1"));
+    _broker.set_available(true, true);
+    EXPECT_TRUE(batcher.add("2"));
+    EXPECT_TRUE(batcher.stop());
+    EXPECT_EQ(_broker.received(), (std::vector<std::string>{"2"}));
+    EXPECT_EQ(batcher.stats().failed, 1u);
+}
+
+TEST_F(MessageBatcherTest, SpoolsWhileBrokerIsUnavailable) {
+    _broker.set_available(false, true);
+    MessageBatcher batcher(config(true), _broker);
+    _broker.attach(&batcher);
+    ASSERT_TRUE(batcher.start());
+    for (int i = 0; i < 5; ++i)
+        EXPECT_TRUE(batcher.add(std::to_string(i)));
+    EXPECT_EQ(count_files(_dir / "spool"), 5u);
+    EXPECT_EQ(batcher.stats().spooled, 5u);
+
+    // spooled envelopes are resent in order once the broker is back
+    _broker.set_available(true, true);
+    EXPECT_TRUE(wait_for([&] { return _broker.received().size() == 5; }));
+    EXPECT_TRUE(batcher.add("5"));
+    EXPECT_TRUE(batcher.stop());
+    EXPECT_EQ(_broker.received(), (std::vector<std::string>{"0", "1", "2", "3", "4", "5"}));
+    EXPECT_EQ(count_files(_dir / "spool"), 0u);
+}
+
+TEST_F(MessageBatcherTest, SpoolsFailedDelivery) {
+    _broker.set_available(true, false);
+    MessageBatcher batcher(config(true), _broker);
+    _broker.attach(&batcher);
+    ASSERT_TRUE(batcher.start());
+    EXPECT_TRUE(batcher.add("1"));
+    _broker.set_available(true, true);
+    _broker.ack(1, false);
+    EXPECT_TRUE(wait_for([&] { return !_broker.received().empty(); }));
+    EXPECT_TRUE(batcher.stop());
+    EXPECT_EQ(_broker.received(), (std::vector<std::string>{"1"}));
+    EXPECT_EQ(batcher.stats().sent, 2u);
+    EXPECT_EQ(count_files(_dir / "spool"), 0u);
+}
+
+TEST_F(MessageBatcherTest, DropsEnvelopesBeyondSpoolSize) {
+    auto cfg = config(true);
+    cfg.max_spool_size = 10;
+    _broker.set_available(false, true);
+    MessageBatcher batcher(cfg, _broker);
+    _broker.attach(&batcher);
+    ASSERT_TRUE(batcher.start());
+    EXPECT_TRUE(batcher.add("\"first\""));
+    EXPECT_TRUE(batcher.add("\"second\""));
+    EXPECT_TRUE(batcher.stop());
+    EXPECT_EQ(batcher.stats().spooled, 1u);
+    EXPECT_EQ(batcher.stats().dropped, 1u);
+    EXPECT_EQ(count_files(_dir / "spool"), 1u);
+}
+
+TEST_F(MessageBatcherTest, KeepsEnvelopesWithoutReportInSpool) {
+    _broker.set_available(true, false);
+    {
+        MessageBatcher batcher(config(true), _broker);
+        _broker.attach(&batcher);
+        ASSERT_TRUE(batcher.start());
+        EXPECT_TRUE(batcher.add("1"));
+        EXPECT_TRUE(batcher.add("2"));
+        EXPECT_TRUE(batcher.stop());
+        EXPECT_EQ(count_files(_dir / "spool"), 2u);
+    }
+
+    // next run resends spool of the previous one
+    FakeBroker broker;
+    MessageBatcher batcher(config(true), broker);
+    broker.attach(&batcher);
+    ASSERT_TRUE(batcher.start());
+    EXPECT_TRUE(wait_for([&] { return broker.received().size() == 2; }));
+    EXPECT_TRUE(batcher.stop());
+    EXPECT_EQ(broker.received(), (std::vector<std::string>{"1", "2"}));
+    EXPECT_EQ(count_files(_dir / "spool"), 0u);
+}
@@ -0,0 +1,216 @@
+/*******************************************************************************
+ * Copyright (C) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+#include "file_writer.hpp"
+
+#include <gtest/gtest.h>
+
+#include <zlib.h>
+
+#include <algorithm>
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+
+namespace fs = std::filesystem;
+
+namespace {
+
+std::string read_file(const fs::path &path) {
+    std::ifstream file(path, std::ios::binary);
+    std::stringstream content;
+    content << file.rdbuf();
+    return content.str();
+}
+
+std::string read_gzip_file(const fs::path &path) {
+    gzFile file = gzopen(path.string().c_str(), "rb");
+    std::string content;
+    char chunk[4096];
+    int size;
+    while (file && (size = gzread(file, chunk, sizeof(chunk))) > 0)
+        content.append(chunk, size);
+    if (file)
+        gzclose(file);
+    return content;
+}
+
+size_t count_lines(const std::string &content) {
+    return std::count(content.begin(), content.end(), '\n');
+}
+
+// Output directory under TMPDIR, so the tests can be pointed to tmpfs
+class FileWriterTest : public ::testing::Test {
+  protected:
+    void SetUp() override {
+        const auto *test = ::testing::UnitTest::GetInstance()->current_test_info();
+        _dir = fs::temp_directory_path() / (std::string("dls_file_writer_") + test->name());
+        fs::remove_all(_dir);
+        fs::create_directories(_dir);
+    }
+
+    void TearDown() override {
+        fs::remove_all(_dir);
+    }
+
+    FileWriterConfig config(bool json_array = true) const {
+        FileWriterConfig config;
+        config.path = (_dir / "out.json").string();
+        config.json_array = json_array;
+        return config;
+    }
+
+    fs::path _dir;
+};
+
+} // namespace
+
+TEST_F(FileWriterTest, WritesJsonArray) {
+    FileWriter writer(config());
+    ASSERT_TRUE(writer.open());
+    EXPECT_TRUE(writer.write("{\"a\":1}"));
+    EXPECT_TRUE(writer.write("{\"b\":2}"));
+    EXPECT_TRUE(writer.write("{\"c\":3}"));
+    ASSERT_TRUE(writer.close());
+    EXPECT_EQ(read_file(_dir / "out.json"), "[{\"a\":1},\n{\"b\":2},\n{\"c\":3}]\n");
+}
+
+TEST_F(FileWriterTest, WritesEmptyJsonArray) {
+    FileWriter writer(config());
+    ASSERT_TRUE(writer.open());
+    ASSERT_TRUE(writer.close());
+    EXPECT_EQ(read_file(_dir / "out.json"), "[]\n");
+}
+
+TEST_F(FileWriterTest, AppendsJsonLines) {
+    std::ofstream(_dir / "out.json") << "{\"old\":0}\n";
+    FileWriter writer(config(false));
+    ASSERT_TRUE(writer.open());
+    EXPECT_TRUE(writer.write("{\"a\":1}"));
+    EXPECT_TRUE(writer.write("{\"b\":2}"));
+    ASSERT_TRUE(writer.close());
+    EXPECT_EQ(read_file(_dir / "out.json"), "{\"old\":0}\n{\"a\":1}\n{\"b\":2}\n");
+}
+
+TEST_F(FileWriterTest, ReportsOpenError) {
+    auto cfg = config();
+    cfg.path = (_dir / "missing" / "out.json").string();
+    FileWriter writer(cfg);
+    EXPECT_FALSE(writer.open());
+    EXPECT_FALSE(writer.error().empty());
+    EXPECT_FALSE(writer.write("{}"));
+}
+
+TEST_F(FileWriterTest, WritesWhenQueueIsDrained) {
+    FileWriter writer(config(false));
+    ASSERT_TRUE(writer.open());
+    EXPECT_TRUE(writer.write("{\"a\":1}"));
+    std::string content;
+    for (int i = 0; i < 1000 && content.empty(); ++i) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        content = read_file(_dir / "out.json");
+    }
+    EXPECT_EQ(content, "{\"a\":1}\n");
+    ASSERT_TRUE(writer.close());
+}
+
+TEST_F(FileWriterTest, BuffersUntilFlushInterval) {
+    auto cfg = config(false);
+    cfg.flush_interval = std::chrono::minutes(10);
+    FileWriter writer(cfg);
+    ASSERT_TRUE(writer.open());
+    EXPECT_TRUE(writer.write("{\"a\":1}"));
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    EXPECT_EQ(read_file(_dir / "out.json"), "");
+    ASSERT_TRUE(writer.close());
+    EXPECT_EQ(read_file(_dir / "out.json"), "{\"a\":1}\n");
+}
+
+TEST_F(FileWriterTest, RotatesBySize) {
+    auto cfg = config();
+    cfg.max_file_size = 64;
+    FileWriter writer(cfg);
+    ASSERT_TRUE(writer.open());
+    for (int i = 0; i < 20; ++i)
+        EXPECT_TRUE(writer.write("{\"index\":" + std::to_string(i) + "}"));
+    ASSERT_TRUE(writer.close());
+
+    // every segment is a JSON array within size limit, records keep their order across segments
+    std::string records;
+    size_t segments = 0;
+    for (unsigned n = 1; fs::exists(_dir / ("out.json." + std::to_string(n))); ++n, ++segments) {
+        const auto content = read_file(_dir / ("out.json." + std::to_string(n)));
+        EXPECT_LE(content.size(), cfg.max_file_size);
+        ASSERT_EQ(content.front(), '[');
+        ASSERT_EQ(content.substr(content.size() - 2), "]\n");
+        records += content.substr(1, content.size() - 3) + ",\n";
+    }
+    const auto last = read_file(_dir / "out.json");
+    records += last.substr(1, last.size() - 3);
+    EXPECT_GT(segments, 1u);
+
+    std::string expected;
+    for (int i = 0; i < 20; ++i)
+        expected += (i ? ",\n" : "") + std::string("{\"index\":") + std::to_string(i) + "}";
+    EXPECT_EQ(records, expected);
+}
+
+TEST_F(FileWriterTest, CompressesRotatedSegments) {
+    std::ofstream(_dir / "out.json.1") << "segment of previous run\n";
+    auto cfg = config(false);
+    cfg.max_file_size = 32;
+    cfg.compress_rotated = true;
+    FileWriter writer(cfg);
+    ASSERT_TRUE(writer.open());
+    for (int i = 0; i < 4; ++i)
+        EXPECT_TRUE(writer.write("{\"index\":" + std::to_string(i) + "}"));
+    ASSERT_TRUE(writer.close());
+
+    EXPECT_EQ(read_file(_dir / "out.json.1"), "segment of previous run\n");
+    EXPECT_EQ(read_gzip_file(_dir / "out.json.2.gz"), "{\"index\":0}\n{\"index\":1}\n");
+    EXPECT_FALSE(fs::exists(_dir / "out.json.2"));
+    EXPECT_EQ(read_file(_dir / "out.json"), "{\"index\":2}\n{\"index\":3}\n");
+}
+
+TEST_F(FileWriterTest, RotatesByTime) {
+    auto cfg = config(false);
+    cfg.rotation_interval = std::chrono::seconds(1);
+    FileWriter writer(cfg);
+    ASSERT_TRUE(writer.open());
+    EXPECT_TRUE(writer.write("{\"a\":1}"));
+    for (int i = 0; i < 300 && !fs::exists(_dir / "out.json.1"); ++i)
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    EXPECT_TRUE(writer.write("{\"b\":2}"));
+    ASSERT_TRUE(writer.close());
+    EXPECT_EQ(read_file(_dir / "out.json.1"), "{\"a\":1}\n");
+    EXPECT_EQ(read_file(_dir / "out.json"), "{\"b\":2}\n");
+}
+
+TEST_F(FileWriterTest, DropsWhenQueueIsFull) {
+    auto cfg = config(false);
+    cfg.max_queue_size = 1;
+    cfg.overflow_policy = FileWriterOverflowPolicy::Drop;
+    FileWriter writer(cfg);
+    ASSERT_TRUE(writer.open());
+    const size_t messages = 10000;
+    for (size_t i = 0; i < messages; ++i)
+        EXPECT_TRUE(writer.write("{}"));
+    ASSERT_TRUE(writer.close());
+    EXPECT_EQ(count_lines(read_file(_dir / "out.json")) + writer.dropped(), messages);
+}
+
+TEST_F(FileWriterTest, BlocksWhenQueueIsFull) {
+    auto cfg = config(false);
+    cfg.max_queue_size = 1;
+    FileWriter writer(cfg);
+    ASSERT_TRUE(writer.open());
+    const size_t messages = 10000;
+    for (size_t i = 0; i < messages; ++i)
+        EXPECT_TRUE(writer.write("{}"));
+    ASSERT_TRUE(writer.close());
+    EXPECT_EQ(writer.dropped(), 0u);
+    EXPECT_EQ(count_lines(read_file(_dir / "out.json")), messages);
+}
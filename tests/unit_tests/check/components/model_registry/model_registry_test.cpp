@@ -0,0 +1,104 @@
+/*******************************************************************************
+ * Copyright (C) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+#include "model_registry.h"
+
+#include <gtest/gtest.h>
+#include <openvino/op/parameter.hpp>
+#include <openvino/op/relu.hpp>
+#include <openvino/op/result.hpp>
+#include <openvino/pass/serialize.hpp>
+
+#include <filesystem>
+
+namespace fs = std::filesystem;
+
+namespace {
+
+std::shared_ptr<ov::Model> make_model(size_t channels) {
+    auto input = std::make_shared<ov::op::v0::Parameter>(ov::element::f32, ov::Shape{1, channels, 8, 8});
+    auto relu = std::make_shared<ov::op::v0::Relu>(input);
+    auto result = std::make_shared<ov::op::v0::Result>(relu);
+    return std::make_shared<ov::Model>(ov::ResultVector{result}, ov::ParameterVector{input}, "model_registry_test");
+}
+
+size_t channels(const std::shared_ptr<const ov::Model> &model) {
+    return model->input().get_shape()[1];
+}
+
+} // namespace
+
+class ModelRegistryTest : public ::testing::Test {
+  protected:
+    void SetUp() override {
+        // registry is process-wide, every test uses a model file of its own
+        _dir = fs::temp_directory_path() /
+               (std::string("model_registry_test_") + ::testing::UnitTest::GetInstance()->current_test_info()->name());
+        fs::remove_all(_dir);
+        fs::create_directories(_dir);
+        _model_path = (_dir / "model.xml").string();
+        save_model(3);
+    }
+
+    void TearDown() override {
+        fs::remove_all(_dir);
+    }
+
+    void save_model(size_t channels) {
+        const auto bin_path = fs::path(_model_path).replace_extension(".bin");
+        ov::pass::Serialize(_model_path, bin_path.string()).run_on_model(make_model(channels));
+    }
+
+    fs::path _dir;
+    std::string _model_path;
+};
+
+TEST_F(ModelRegistryTest, ReadModel_ReusesParsedModel) {
+    auto first = ModelRegistry::read_model(_model_path, "");
+    auto second = ModelRegistry::read_model(_model_path, "");
+    ASSERT_NE(first, nullptr);
+    EXPECT_EQ(first, second);
+    EXPECT_EQ(channels(first), 3u);
+}
+
+TEST_F(ModelRegistryTest, ReleaseModel_RegistryDropsModel) {
+    std::weak_ptr<const ov::Model> released = ModelRegistry::read_model(_model_path, "");
+    EXPECT_FALSE(released.expired());
+
+    ModelRegistry::release_model(_model_path, "");
+    EXPECT_TRUE(released.expired());
+
+    // parsed again on next use
+    auto model = ModelRegistry::read_model(_model_path, "");
+    ASSERT_NE(model, nullptr);
+    EXPECT_EQ(channels(model), 3u);
+}
+
+TEST_F(ModelRegistryTest, ReleaseModel_ReusesModelStillInUse) {
+    auto first = ModelRegistry::read_model(_model_path, "");
+    ModelRegistry::release_model(_model_path, "");
+
+    auto second = ModelRegistry::read_model(_model_path, "");
+    EXPECT_EQ(first, second);
+}
+
+TEST_F(ModelRegistryTest, ReleaseModel_UnknownModelIsIgnored) {
+    EXPECT_NO_THROW(ModelRegistry::release_model((_dir / "missing.xml").string(), ""));
+}
+
+TEST_F(ModelRegistryTest, ReadModel_RereadsReplacedFile) {
+    auto first = ModelRegistry::read_model(_model_path, "");
+    const auto mtime = fs::last_write_time(_model_path);
+
+    save_model(5);
+    // file system time resolution may be too coarse to tell both writes apart
+    fs::last_write_time(_model_path, mtime + std::chrono::seconds(2));
+
+    auto second = ModelRegistry::read_model(_model_path, "");
+    EXPECT_NE(first, second);
+    EXPECT_EQ(channels(first), 3u);
+    EXPECT_EQ(channels(second), 5u);
+}
@@ -0,0 +1,90 @@
+/*******************************************************************************
+ * Copyright (C) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+#include "dlstreamer/base/pool.h"
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <thread>
+
+using namespace dlstreamer;
+
+namespace {
+
+using IntPtr = std::shared_ptr<int>;
+
+bool is_unique(IntPtr &object) {
+    return object.use_count() == 1;
+}
+
+} // namespace
+
+TEST(PoolTest, ReusesReleasedObject) {
+    int allocated = 0;
+    Pool<IntPtr> pool([&] { return std::make_shared<int>(allocated++); }, is_unique, 2);
+
+    int *first = pool.get_or_create().get();
+    IntPtr second = pool.get_or_create();
+    EXPECT_EQ(second.get(), first);
+    EXPECT_EQ(pool.size(), 1u);
+
+    IntPtr third = pool.get_or_create();
+    EXPECT_NE(third.get(), second.get());
+    EXPECT_EQ(pool.size(), 2u);
+
+    PoolStats stats = pool.stats();
+    EXPECT_EQ(stats.allocations, 2u);
+    EXPECT_EQ(stats.hits, 1u);
+    EXPECT_EQ(stats.waits, 0u);
+}
+
+TEST(PoolTest, ReleaseWakesUpWaiter) {
+    Pool<IntPtr> pool([] { return std::make_shared<int>(0); }, is_unique, 1);
+
+    IntPtr held = pool.get_or_create();
+    int *held_ptr = held.get();
+    std::atomic<bool> done{false};
+    std::thread waiter([&] {
+        IntPtr object = pool.get_or_create();
+        EXPECT_EQ(object.get(), held_ptr);
+        done = true;
+    });
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    EXPECT_FALSE(done);
+    held.reset();
+    waiter.join();
+
+    PoolStats stats = pool.stats();
+    EXPECT_EQ(stats.allocations, 1u);
+    EXPECT_EQ(stats.waits, 1u);
+    EXPECT_GT(stats.wait_time.count(), 0);
+}
+
+TEST(PoolTest, SkipsObjectsNotAvailable) {
+    bool available = false;
+    Pool<IntPtr> pool([] { return std::make_shared<int>(0); }, [&](IntPtr &) { return available; }, 2);
+
+    int *first = pool.get_or_create().get();
+    IntPtr second = pool.get_or_create(); // first is released, but not available
+    EXPECT_NE(second.get(), first);
+    second.reset();
+
+    available = true;
+    EXPECT_EQ(pool.get_or_create().get(), first); // oldest released object is reused first
+    EXPECT_EQ(pool.size(), 2u);
+}
+
+TEST(PoolTest, HandleOutlivesPool) {
+    IntPtr handle;
+    {
+        Pool<IntPtr> pool([] { return std::make_shared<int>(42); }, is_unique);
+        handle = pool.get_or_create();
+    }
+    EXPECT_EQ(*handle, 42);
+    handle.reset();
+}
@@ -135,3 +135,32 @@ TEST_F(HeatMapBoxesConverterTest, CanCovert) {
         ASSERT_NEAR(confidence, 0.88393, 0.0001);
     }
 }
+
+TEST_F(HeatMapBoxesConverterTest, CanConvertToDetectionRecords) {
+    HeatMapBoxesConverter post_proc(CreateInitializer(), _confidence_threshold);
+    auto blob = GetTestBlob();
+    blob->SetDims(_output_dims);
+
+    OutputBlobs blobs_map{{"output_layer_name", blob}};
+    DetectionsTable detections;
+    ASSERT_TRUE(post_proc.convertDetections(blobs_map, detections));
+
+    // Test binary file contains single batch
+    ASSERT_EQ(detections.size(), 1u);
+    ASSERT_FALSE(detections[0].empty());
+    const DetectionRecord &detection = detections[0][0];
+    ASSERT_NEAR(detection.x_min, 0.05427, 0.0001);
+    ASSERT_NEAR(detection.x_max, 0.08552, 0.0001);
+    ASSERT_NEAR(detection.y_min, 0.37890, 0.0001);
+    ASSERT_NEAR(detection.y_max, 0.39843, 0.0001);
+    ASSERT_NEAR(detection.confidence, 0.88393, 0.0001);
+    EXPECT_TRUE(detection.tensors.empty());
+
+    GstStructure *detection_tensor = post_proc.createDetectionTensor(detection);
+    EXPECT_TRUE(gst_structure_has_name(detection_tensor, "detection"));
+    double x_min = 0;
+    gst_structure_get_double(detection_tensor, "x_min", &x_min);
+    ASSERT_NEAR(x_min, detection.x_min, 1e-9);
+    EXPECT_FALSE(gst_structure_has_field(detection_tensor, "x_abs"));
+    gst_structure_free(detection_tensor);
+}
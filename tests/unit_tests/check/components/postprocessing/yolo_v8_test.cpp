@@ -0,0 +1,132 @@
+/*******************************************************************************
+ * Copyright (C) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+#include "common/post_processor/converters/to_roi/yolo_v8.h"
+#include <dlstreamer/gst/dictionary.h>
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+using namespace InferenceBackend;
+using namespace post_processing;
+
+class MemoryOutputBlob : public OutputBlob {
+    std::vector<float> _data;
+    std::vector<size_t> _dims;
+
+  public:
+    MemoryOutputBlob(std::vector<float> data, std::vector<size_t> dims) : _data(std::move(data)), _dims(dims) {
+    }
+
+    const std::vector<size_t> &GetDims() const override {
+        return _dims;
+    }
+
+    const void *GetData() const override {
+        return _data.data();
+    }
+
+    Layout GetLayout() const override {
+        return Layout::ANY;
+    }
+
+    Precision GetPrecision() const override {
+        return Precision::FP32;
+    }
+};
+
+struct YOLOv8ConverterTest : public testing::Test {
+  protected:
+    static constexpr size_t _input_size = 640;
+    // Enough proposals to exercise full blocks and a scalar tail
+    static constexpr size_t _proposal_count = 1000;
+    static constexpr size_t _class_count = 3;
+
+    GstStructure *_gst_structure{nullptr};
+
+    BlobToMetaConverter::Initializer CreateInitializer(size_t object_size) {
+        BlobToMetaConverter::Initializer initializer;
+        initializer.model_name = "yolo_v8_test";
+        initializer.outputs_info = {{"output", {1, object_size, _proposal_count}}};
+        initializer.input_image_info.batch_size = 1;
+        initializer.input_image_info.width = _input_size;
+        initializer.input_image_info.height = _input_size;
+        initializer.labels = {"a", "b", "c"};
+        // This structure gets freed only at TearDown!
+        initializer.model_proc_output_info = GstStructureUniquePtr(_gst_structure, [](auto) {});
+        return initializer;
+    }
+
+    // Channel-major output [object_size, proposal_count] with two confident, non-overlapping proposals
+    std::vector<float> CreateOutput(size_t object_size) {
+        std::vector<float> data(object_size * _proposal_count, 0.01f);
+        auto set = [&](size_t field, size_t proposal, float value) { data[field * _proposal_count + proposal] = value; };
+
+        set(YOLOV8_OFFSET_X, 3, 100.f);
+        set(YOLOV8_OFFSET_Y, 3, 100.f);
+        set(YOLOV8_OFFSET_W, 3, 40.f);
+        set(YOLOV8_OFFSET_H, 3, 20.f);
+        set(YOLOV8_OFFSET_CS + 2, 3, 0.9f);
+
+        set(YOLOV8_OFFSET_X, 997, 400.f);
+        set(YOLOV8_OFFSET_Y, 997, 300.f);
+        set(YOLOV8_OFFSET_W, 997, 64.f);
+        set(YOLOV8_OFFSET_H, 997, 32.f);
+        set(YOLOV8_OFFSET_CS + 0, 997, 0.8f);
+        set(YOLOV8_OFFSET_CS + 1, 997, 0.8f);
+        return data;
+    }
+
+    void SetUp() override {
+        _gst_structure = gst_structure_new_empty("detection");
+    }
+
+    void TearDown() override {
+        if (_gst_structure)
+            gst_structure_free(_gst_structure);
+        _gst_structure = nullptr;
+    }
+};
+
+TEST_F(YOLOv8ConverterTest, DecodesChannelMajorOutput) {
+    const size_t object_size = YOLOV8_OFFSET_CS + _class_count;
+    YOLOv8Converter post_proc(CreateInitializer(object_size), 0.5, 0.5);
+
+    OutputBlobs blobs_map{
+        {"output", std::make_shared<MemoryOutputBlob>(CreateOutput(object_size),
+                                                      std::vector<size_t>{1, object_size, _proposal_count})}};
+    DetectionsTable detections;
+    ASSERT_TRUE(post_proc.convertDetections(blobs_map, detections));
+    ASSERT_EQ(detections.size(), 1u);
+    ASSERT_EQ(detections[0].size(), 2u);
+
+    // sorted by confidence after NMS
+    const DetectionRecord &first = detections[0][0];
+    EXPECT_EQ(first.label_id, 2);
+    EXPECT_NEAR(first.confidence, 0.9, 1e-6);
+    EXPECT_NEAR(first.x_min, 80.0 / _input_size, 1e-6);
+    EXPECT_NEAR(first.y_max, 110.0 / _input_size, 1e-6);
+
+    // equal scores resolve to the lowest class id
+    const DetectionRecord &second = detections[0][1];
+    EXPECT_EQ(second.label_id, 0);
+    EXPECT_NEAR(second.confidence, 0.8, 1e-6);
+    EXPECT_NEAR(second.x_min, 368.0 / _input_size, 1e-6);
+}
+
+TEST_F(YOLOv8ConverterTest, DecodesObbRotation) {
+    const size_t object_size = YOLOV8_OFFSET_CS + _class_count + 1;
+    YOLOv8ObbConverter post_proc(CreateInitializer(object_size), 0.5, 0.5);
+
+    std::vector<float> data = CreateOutput(object_size);
+    data[(object_size - 1) * _proposal_count + 3] = 0.5f;
+    OutputBlobs blobs_map{{"output", std::make_shared<MemoryOutputBlob>(
+                                         std::move(data), std::vector<size_t>{1, object_size, _proposal_count})}};
+    DetectionsTable detections;
+    ASSERT_TRUE(post_proc.convertDetections(blobs_map, detections));
+    ASSERT_EQ(detections[0].size(), 2u);
+    EXPECT_NEAR(detections[0][0].rotation, 0.5, 1e-6);
+    EXPECT_EQ(detections[0][0].label_id, 2);
+}
@@ -0,0 +1,140 @@
+/*******************************************************************************
+ * Copyright (C) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+#include "opencv_utils.h"
+
+#include <gtest/gtest.h>
+#include <opencv2/imgproc.hpp>
+
+#include <vector>
+
+using namespace InferenceBackend;
+
+namespace {
+
+// Reference chain of the legacy pre-processing path: cvtColor, resize, border and planar split
+std::vector<cv::Mat> referenceConvert(const cv::Mat &bgr, const Utils::FusedConvertParams &params,
+                                      const cv::Size &dst_size) {
+    cv::Mat resized;
+    cv::resize(bgr, resized, params.scaled_size, 0, 0, cv::INTER_LINEAR);
+    if (params.swap_rb)
+        cv::cvtColor(resized, resized, cv::COLOR_BGR2RGB);
+    cv::Mat padded;
+    cv::copyMakeBorder(resized, padded, params.offset.y, dst_size.height - params.scaled_size.height - params.offset.y,
+                       params.offset.x, dst_size.width - params.scaled_size.width - params.offset.x,
+                       cv::BORDER_CONSTANT, cv::Scalar(params.fill[0], params.fill[1], params.fill[2]));
+    std::vector<cv::Mat> planes;
+    cv::split(padded, planes);
+    return planes;
+}
+
+Image wrapPlanar(cv::Mat &planes, int format, const cv::Size &size) {
+    Image image;
+    image.type = MemoryType::SYSTEM;
+    image.format = format;
+    image.width = size.width;
+    image.height = size.height;
+    const size_t plane_size = planes.step[0] * size.height;
+    for (int c = 0; c < 3; ++c) {
+        image.planes[c] = planes.data + c * plane_size;
+        image.stride[c] = static_cast<uint32_t>(planes.step[0]);
+    }
+    return image;
+}
+
+struct FusedConvertTest : public testing::Test {
+    const cv::Size src_size{97, 61};
+    const cv::Size dst_size{64, 64};
+    cv::Mat bgr;
+
+    void SetUp() override {
+        bgr.create(src_size, CV_8UC3);
+        cv::randu(bgr, cv::Scalar::all(0), cv::Scalar::all(256));
+    }
+
+    Utils::FusedConvertParams letterbox(bool swap_rb) const {
+        Utils::FusedConvertParams params;
+        params.scaled_size = cv::Size(64, 40);
+        params.offset = cv::Point(0, 12);
+        params.fill = {10, 20, 30};
+        params.swap_rb = swap_rb;
+        return params;
+    }
+
+    void expectNear(const cv::Mat &dst_planes, const std::vector<cv::Mat> &expected, double tolerance) {
+        for (int c = 0; c < 3; ++c) {
+            cv::Mat plane = dst_planes.rowRange(c * dst_size.height, (c + 1) * dst_size.height);
+            cv::Mat expected_plane;
+            expected[c].convertTo(expected_plane, plane.type());
+            EXPECT_LE(cv::norm(plane, expected_plane, cv::NORM_INF), tolerance) << "channel " << c;
+        }
+    }
+};
+
+TEST_F(FusedConvertTest, SupportedFormats) {
+    EXPECT_TRUE(Utils::IsFusedConvertSupported(FOURCC_BGRX, FOURCC_RGBP));
+    EXPECT_TRUE(Utils::IsFusedConvertSupported(FOURCC_NV12, FOURCC_RGBP_F32));
+    EXPECT_FALSE(Utils::IsFusedConvertSupported(FOURCC_BGRX, FOURCC_BGR));
+    EXPECT_FALSE(Utils::IsFusedConvertSupported(FOURCC_RGBP, FOURCC_RGBP));
+}
+
+TEST_F(FusedConvertTest, BgrxLetterboxMatchesReference) {
+    cv::Mat bgrx;
+    cv::cvtColor(bgr, bgrx, cv::COLOR_BGR2BGRA);
+    Image src;
+    src.type = MemoryType::SYSTEM;
+    src.format = FOURCC_BGRX;
+    src.width = src_size.width;
+    src.height = src_size.height;
+    src.planes[0] = bgrx.data;
+    src.stride[0] = static_cast<uint32_t>(bgrx.step[0]);
+
+    for (bool swap_rb : {false, true}) {
+        const auto params = letterbox(swap_rb);
+        cv::Mat dst_planes(dst_size.height * 3, dst_size.width, CV_8UC1);
+        Image dst = wrapPlanar(dst_planes, FOURCC_RGBP, dst_size);
+        Utils::FusedConvert(src, dst, params);
+        // cv::resize uses fixed-point arithmetic for 8-bit images
+        expectNear(dst_planes, referenceConvert(bgr, params, dst_size), 1);
+    }
+}
+
+TEST_F(FusedConvertTest, FloatOutputMatchesReference) {
+    Image src;
+    src.type = MemoryType::SYSTEM;
+    src.format = FOURCC_BGR;
+    src.width = src_size.width;
+    src.height = src_size.height;
+    src.planes[0] = bgr.data;
+    src.stride[0] = static_cast<uint32_t>(bgr.step[0]);
+
+    const auto params = letterbox(true);
+    cv::Mat dst_planes(dst_size.height * 3, dst_size.width, CV_32FC1);
+    Image dst = wrapPlanar(dst_planes, FOURCC_RGBP_F32, dst_size);
+    Utils::FusedConvert(src, dst, params);
+
+    cv::Mat bgr_float;
+    bgr.convertTo(bgr_float, CV_32FC3);
+    expectNear(dst_planes, referenceConvert(bgr_float, params, dst_size), 1e-3);
+}
+
+TEST_F(FusedConvertTest, RejectsOutOfBoundsGeometry) {
+    Image src;
+    src.type = MemoryType::SYSTEM;
+    src.format = FOURCC_BGR;
+    src.width = src_size.width;
+    src.height = src_size.height;
+    src.planes[0] = bgr.data;
+    src.stride[0] = static_cast<uint32_t>(bgr.step[0]);
+
+    auto params = letterbox(false);
+    params.offset.y = 30;
+    cv::Mat dst_planes(dst_size.height * 3, dst_size.width, CV_8UC1);
+    Image dst = wrapPlanar(dst_planes, FOURCC_RGBP, dst_size);
+    EXPECT_THROW(Utils::FusedConvert(src, dst, params), std::invalid_argument);
+}
+
+} // namespace
@@ -0,0 +1,64 @@
+/*******************************************************************************
+ * Copyright (C) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+// Compares radar_cube::reorder_dc_removal against the three-pass reorder g3dradarprocess used before.
+// Usage: benchmark_radar_cube [iterations]
+
+#include "radar_cube_reference.h"
+#include "radar_cube_reorder.h"
+
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+template <typename Func>
+double measureUs(size_t iterations, Func &&func) {
+    const auto start = Clock::now();
+    for (size_t i = 0; i < iterations; ++i)
+        func();
+    return std::chrono::duration<double, std::micro>(Clock::now() - start).count() / iterations;
+}
+
+} // namespace
+
+int main(int argc, char **argv) {
+    const size_t iterations = argc > 1 ? std::strtoul(argv[1], nullptr, 10) : 200;
+
+    struct Shape {
+        size_t trn, num_chirps, adc_samples;
+    };
+    // 12 = 3 TX x 4 RX virtual channels with typical chirp counts, and a long-chirp variant
+    const Shape shapes[] = {{12, 64, 256}, {12, 128, 256}, {12, 256, 256}, {16, 128, 512}};
+
+    std::cout << std::setw(6) << "trn" << std::setw(8) << "chirps" << std::setw(9) << "samples" << std::setw(14)
+              << "legacy, us" << std::setw(14) << "fused, us" << std::setw(10) << "speedup" << std::endl;
+
+    for (const Shape &shape : shapes) {
+        const auto input = generateRadarCube(shape.trn, shape.num_chirps, shape.adc_samples, 42);
+        std::vector<std::complex<float>> input_copy(input.size());
+        std::vector<std::complex<float>> output(input.size());
+
+        const double legacy_us = measureUs(iterations, [&] {
+            referenceReorderDcRemoval(input.data(), input_copy, output, shape.trn, shape.num_chirps,
+                                      shape.adc_samples);
+        });
+        const double fused_us = measureUs(iterations, [&] {
+            radar_cube::reorder_dc_removal(input.data(), output.data(), shape.trn, shape.num_chirps,
+                                           shape.adc_samples);
+        });
+
+        std::cout << std::setw(6) << shape.trn << std::setw(8) << shape.num_chirps << std::setw(9) << shape.adc_samples
+                  << std::setw(14) << std::fixed << std::setprecision(1) << legacy_us << std::setw(14) << fused_us
+                  << std::setw(9) << std::setprecision(2) << legacy_us / fused_us << "x" << std::endl;
+    }
+
+    return 0;
+}
@@ -0,0 +1,59 @@
+/*******************************************************************************
+ * Copyright (C) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+#pragma once
+
+#include <algorithm>
+#include <complex>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+// Three-pass reorder of the radar cube g3dradarprocess used before radar_cube::reorder_dc_removal: copy of the mapped
+// input, per-row gather into a scratch row with scalar DC removal, scatter to the output. The scratch row is sized at
+// run time here, the element used a fixed 256-sample stack array.
+inline void referenceReorderDcRemoval(const std::complex<float> *input, std::vector<std::complex<float>> &input_copy,
+                                      std::vector<std::complex<float>> &output, size_t trn, size_t num_chirps,
+                                      size_t adc_samples) {
+    std::copy(input, input + input_copy.size(), input_copy.begin());
+    std::vector<std::complex<float>> temp_samples(adc_samples);
+    for (size_t c = 0; c < num_chirps; c++) {
+        for (size_t t = 0; t < trn; t++) {
+            for (size_t s = 0; s < adc_samples; s++)
+                temp_samples[s] = input_copy[c * trn * adc_samples + t * adc_samples + s];
+
+            float real_sum = 0.0f;
+            float imag_sum = 0.0f;
+            for (size_t i = 0; i < adc_samples; i++) {
+                real_sum += temp_samples[i].real();
+                imag_sum += temp_samples[i].imag();
+            }
+            float real_avg = real_sum / adc_samples;
+            float imag_avg = imag_sum / adc_samples;
+            for (size_t i = 0; i < adc_samples; i++)
+                temp_samples[i] =
+                    std::complex<float>(temp_samples[i].real() - real_avg, temp_samples[i].imag() - imag_avg);
+
+            for (size_t s = 0; s < adc_samples; s++)
+                output[t * num_chirps * adc_samples + c * adc_samples + s] = temp_samples[s];
+        }
+    }
+}
+
+// Radar cube of ADC-like samples with a per-row DC offset
+inline std::vector<std::complex<float>> generateRadarCube(size_t trn, size_t num_chirps, size_t adc_samples,
+                                                          uint32_t seed) {
+    std::mt19937 gen(seed);
+    std::uniform_real_distribution<float> sample(-512.0f, 512.0f);
+    std::uniform_real_distribution<float> offset(-64.0f, 64.0f);
+    std::vector<std::complex<float>> cube(trn * num_chirps * adc_samples);
+    for (size_t row = 0; row < trn * num_chirps; ++row) {
+        const std::complex<float> dc(offset(gen), offset(gen));
+        for (size_t s = 0; s < adc_samples; ++s)
+            cube[row * adc_samples + s] = std::complex<float>(sample(gen), sample(gen)) + dc;
+    }
+    return cube;
+}
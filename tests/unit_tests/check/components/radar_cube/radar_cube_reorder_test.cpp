@@ -0,0 +1,79 @@
+/*******************************************************************************
+ * Copyright (C) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+#include "radar_cube_reference.h"
+#include "radar_cube_reorder.h"
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+
+namespace {
+
+struct CubeShape {
+    size_t trn, num_chirps, adc_samples;
+};
+
+void expectMatchesReference(const CubeShape &shape) {
+    const auto input = generateRadarCube(shape.trn, shape.num_chirps, shape.adc_samples, 7);
+    std::vector<std::complex<float>> input_copy(input.size());
+    std::vector<std::complex<float>> expected(input.size());
+    std::vector<std::complex<float>> actual(input.size());
+
+    referenceReorderDcRemoval(input.data(), input_copy, expected, shape.trn, shape.num_chirps, shape.adc_samples);
+    radar_cube::reorder_dc_removal(input.data(), actual.data(), shape.trn, shape.num_chirps, shape.adc_samples);
+
+    // summation order differs from the scalar reference, so means are compared with a tolerance
+    for (size_t i = 0; i < input.size(); ++i) {
+        ASSERT_NEAR(actual[i].real(), expected[i].real(), 1e-2f) << "index " << i;
+        ASSERT_NEAR(actual[i].imag(), expected[i].imag(), 1e-2f) << "index " << i;
+    }
+}
+
+} // namespace
+
+TEST(RadarCubeReorderTest, MatchesReferenceForTypicalCube) {
+    expectMatchesReference({12, 128, 256});
+}
+
+TEST(RadarCubeReorderTest, MatchesReferenceForOddSizes) {
+    expectMatchesReference({3, 5, 1});
+    expectMatchesReference({4, 7, 13});
+    expectMatchesReference({1, 1, 9});
+}
+
+TEST(RadarCubeReorderTest, SupportsMoreThan256Samples) {
+    expectMatchesReference({2, 16, 1024});
+}
+
+TEST(RadarCubeReorderTest, RowsHaveZeroMeanInOutputLayout) {
+    const size_t trn = 3, num_chirps = 4, adc_samples = 64;
+    const auto input = generateRadarCube(trn, num_chirps, adc_samples, 11);
+    std::vector<std::complex<float>> output(input.size());
+    radar_cube::reorder_dc_removal(input.data(), output.data(), trn, num_chirps, adc_samples);
+
+    for (size_t t = 0; t < trn; ++t) {
+        for (size_t c = 0; c < num_chirps; ++c) {
+            const std::complex<float> *in_row = input.data() + (c * trn + t) * adc_samples;
+            const std::complex<float> *out_row = output.data() + (t * num_chirps + c) * adc_samples;
+            std::complex<double> sum = 0.0;
+            for (size_t s = 0; s < adc_samples; ++s) {
+                sum += std::complex<double>(out_row[s]);
+                // every output sample is its input sample shifted by the same offset
+                EXPECT_NEAR(std::real(in_row[s] - out_row[s]), std::real(in_row[0] - out_row[0]), 1e-3f);
+                EXPECT_NEAR(std::imag(in_row[s] - out_row[s]), std::imag(in_row[0] - out_row[0]), 1e-3f);
+            }
+            EXPECT_NEAR(sum.real() / adc_samples, 0.0, 1e-3);
+            EXPECT_NEAR(sum.imag() / adc_samples, 0.0, 1e-3);
+        }
+    }
+}
+
+TEST(RadarCubeReorderTest, EmptyCubeIsNoop) {
+    std::complex<float> output(1.0f, 2.0f);
+    radar_cube::reorder_dc_removal(nullptr, &output, 4, 4, 0);
+    EXPECT_EQ(output, std::complex<float>(1.0f, 2.0f));
+}
@@ -0,0 +1,16 @@
+/*******************************************************************************
+ * Copyright (C) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+#include <gst/gst.h>
+#include <gtest/gtest.h>
+
+GTEST_API_ int main(int argc, char **argv) {
+    std::cout << "Running Components::streammux_pad_queue Test from " << __FILE__ << std::endl;
+    testing::InitGoogleTest(&argc, argv);
+    gst_init(&argc, &argv);
+
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,193 @@
+/*******************************************************************************
+ * Copyright (C) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+#include "gva_streammux_pad_queue.h"
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <chrono>
+#include <thread>
+
+namespace {
+
+GstBuffer *buffer_with_pts(GstClockTime pts) {
+    GstBuffer *buf = gst_buffer_new();
+    GST_BUFFER_PTS(buf) = pts;
+    return buf;
+}
+
+// Runs pad_queue_push_wait() on a producer thread
+class BlockedProducer {
+  public:
+    BlockedProducer(GvaStreammuxPadQueue *queue, GstBuffer *buf, gint *flushing)
+        : thread_([=] {
+              pushed_ = pad_queue_push_wait(queue, buf, flushing);
+              if (!pushed_)
+                  gst_buffer_unref(buf);
+              done_ = true;
+          }) {
+    }
+
+    ~BlockedProducer() {
+        if (thread_.joinable())
+            thread_.join();
+    }
+
+    // Gives the producer time to block, returns TRUE if it is still blocked
+    bool blocked() {
+        std::this_thread::sleep_for(std::chrono::milliseconds(50));
+        return !done_;
+    }
+
+    bool join() {
+        thread_.join();
+        return pushed_;
+    }
+
+  private:
+    std::atomic<bool> done_{false};
+    std::atomic<bool> pushed_{false};
+    std::thread thread_;
+};
+
+} // namespace
+
+TEST(StreammuxPadQueue, PopsInPushOrder) {
+    GvaStreammuxPadQueue queue(3);
+    for (guint64 i = 0; i < 3; i++)
+        ASSERT_TRUE(pad_queue_push(&queue, buffer_with_pts(i)));
+    EXPECT_EQ(pad_queue_length(&queue), 3u);
+
+    for (guint64 i = 0; i < 3; i++) {
+        GstBuffer *buf = pad_queue_pop(&queue);
+        ASSERT_NE(buf, nullptr);
+        EXPECT_EQ(GST_BUFFER_PTS(buf), i);
+        gst_buffer_unref(buf);
+    }
+    EXPECT_EQ(pad_queue_pop(&queue), nullptr);
+    EXPECT_EQ(pad_queue_length(&queue), 0u);
+}
+
+TEST(StreammuxPadQueue, PeekKeepsBuffer) {
+    GvaStreammuxPadQueue queue(2);
+    EXPECT_EQ(pad_queue_peek(&queue), nullptr);
+    GstBuffer *buf = buffer_with_pts(7);
+    ASSERT_TRUE(pad_queue_push(&queue, buf));
+    EXPECT_EQ(pad_queue_peek(&queue), buf);
+    EXPECT_EQ(pad_queue_length(&queue), 1u);
+    gst_buffer_unref(pad_queue_pop(&queue));
+}
+
+TEST(StreammuxPadQueue, PushFailsWhenFull) {
+    GvaStreammuxPadQueue queue(2);
+    ASSERT_TRUE(pad_queue_push(&queue, buffer_with_pts(0)));
+    ASSERT_TRUE(pad_queue_push(&queue, buffer_with_pts(1)));
+
+    GstBuffer *buf = buffer_with_pts(2);
+    EXPECT_FALSE(pad_queue_push(&queue, buf));
+    gst_buffer_unref(pad_queue_pop(&queue));
+    EXPECT_TRUE(pad_queue_push(&queue, buf));
+    EXPECT_EQ(pad_queue_length(&queue), 2u);
+}
+
+TEST(StreammuxPadQueue, WrapsAround) {
+    GvaStreammuxPadQueue queue(2);
+    for (guint64 i = 0; i < 10; i++) {
+        ASSERT_TRUE(pad_queue_push(&queue, buffer_with_pts(i)));
+        GstBuffer *buf = pad_queue_pop(&queue);
+        ASSERT_NE(buf, nullptr);
+        EXPECT_EQ(GST_BUFFER_PTS(buf), i);
+        gst_buffer_unref(buf);
+    }
+}
+
+TEST(StreammuxPadQueue, ClearAndDestructorReleaseBuffers) {
+    GstBuffer *buf = buffer_with_pts(0);
+    {
+        GvaStreammuxPadQueue queue(2);
+        ASSERT_TRUE(pad_queue_push(&queue, gst_buffer_ref(buf)));
+        pad_queue_clear(&queue);
+        EXPECT_EQ(GST_MINI_OBJECT_REFCOUNT_VALUE(buf), 1);
+        ASSERT_TRUE(pad_queue_push(&queue, gst_buffer_ref(buf)));
+    }
+    EXPECT_EQ(GST_MINI_OBJECT_REFCOUNT_VALUE(buf), 1);
+    gst_buffer_unref(buf);
+}
+
+TEST(StreammuxPadQueue, PushWaitBlocksUntilPop) {
+    GvaStreammuxPadQueue queue(1);
+    gint flushing = FALSE;
+    ASSERT_TRUE(pad_queue_push(&queue, buffer_with_pts(0)));
+
+    BlockedProducer producer(&queue, buffer_with_pts(1), &flushing);
+    EXPECT_TRUE(producer.blocked());
+
+    gst_buffer_unref(pad_queue_pop(&queue));
+    EXPECT_TRUE(producer.join());
+    EXPECT_GT(queue.wait_time.load(), 0u);
+
+    GstBuffer *buf = pad_queue_pop(&queue);
+    ASSERT_NE(buf, nullptr);
+    EXPECT_EQ(GST_BUFFER_PTS(buf), 1u);
+    gst_buffer_unref(buf);
+}
+
+TEST(StreammuxPadQueue, PushWaitReturnsOnFlushing) {
+    GvaStreammuxPadQueue queue(1);
+    gint flushing = FALSE;
+    ASSERT_TRUE(pad_queue_push(&queue, buffer_with_pts(0)));
+
+    BlockedProducer producer(&queue, buffer_with_pts(1), &flushing);
+    EXPECT_TRUE(producer.blocked());
+
+    g_atomic_int_set(&flushing, TRUE);
+    pad_queue_wake(&queue);
+    EXPECT_FALSE(producer.join());
+    EXPECT_EQ(pad_queue_length(&queue), 1u);
+}
+
+TEST(StreammuxPadQueue, PushWaitReturnsOnClose) {
+    GvaStreammuxPadQueue queue(1);
+    gint flushing = FALSE;
+    ASSERT_TRUE(pad_queue_push(&queue, buffer_with_pts(0)));
+
+    BlockedProducer producer(&queue, buffer_with_pts(1), &flushing);
+    EXPECT_TRUE(producer.blocked());
+
+    pad_queue_close(&queue);
+    EXPECT_FALSE(producer.join());
+
+    // a closed ring doesn't block later producers either
+    GstBuffer *buf = buffer_with_pts(2);
+    EXPECT_FALSE(pad_queue_push_wait(&queue, buf, &flushing));
+    gst_buffer_unref(buf);
+}
+
+TEST(StreammuxPadQueue, ProducerAndConsumerThreads) {
+    constexpr guint64 count = 10000;
+    GvaStreammuxPadQueue queue(4);
+    gint flushing = FALSE;
+
+    std::thread producer([&] {
+        for (guint64 i = 0; i < count; i++)
+            ASSERT_TRUE(pad_queue_push_wait(&queue, buffer_with_pts(i), &flushing));
+    });
+
+    guint64 expected = 0;
+    while (expected < count) {
+        GstBuffer *buf = pad_queue_pop(&queue);
+        if (!buf) {
+            std::this_thread::yield();
+            continue;
+        }
+        EXPECT_EQ(GST_BUFFER_PTS(buf), expected);
+        expected++;
+        gst_buffer_unref(buf);
+    }
+    producer.join();
+    EXPECT_EQ(pad_queue_length(&queue), 0u);
+}
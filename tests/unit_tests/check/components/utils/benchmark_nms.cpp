@@ -0,0 +1,78 @@
+/*******************************************************************************
+ * Copyright (C) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+// Compares Utils::NmsEngine against the quadratic vector-erase NMS it replaced.
+// Usage: benchmark_nms [iterations]
+
+#include "nms_reference.h"
+#include "non_max_suppression.h"
+
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+template <typename Func>
+double measureUs(size_t iterations, Func &&func) {
+    const auto start = Clock::now();
+    for (size_t i = 0; i < iterations; ++i)
+        func();
+    return std::chrono::duration<double, std::micro>(Clock::now() - start).count() / iterations;
+}
+
+} // namespace
+
+int main(int argc, char **argv) {
+    const size_t iterations = argc > 1 ? std::strtoul(argv[1], nullptr, 10) : 20;
+    const double iou_threshold = 0.5;
+
+    struct Scene {
+        const char *name;
+        double image_size, min_size, max_size;
+    };
+    // "crowded": 640x640 input covered by many mid-sized objects, "sparse": small objects over a 4K frame
+    const Scene scenes[] = {{"crowded", 640.0, 16.0, 64.0}, {"sparse", 3840.0, 8.0, 32.0}};
+
+    std::cout << std::setw(10) << "scene" << std::setw(8) << "boxes" << std::setw(14) << "legacy, us" << std::setw(14)
+              << "linear, us" << std::setw(14) << "grid, us" << std::setw(10) << "kept" << std::endl;
+
+    for (const Scene &scene : scenes) {
+        for (size_t count : {100, 1000, 5000, 20000}) {
+            const auto proposals = generateProposals(count, 42, scene.image_size, scene.min_size, scene.max_size);
+
+            Utils::NmsBoxes boxes;
+            for (const auto &p : proposals)
+                boxes.add(static_cast<float>(p.x), static_cast<float>(p.y), static_cast<float>(p.x + p.w),
+                          static_cast<float>(p.y + p.h), static_cast<float>(p.confidence));
+
+            Utils::NmsOptions options;
+            options.overlap_threshold = static_cast<float>(iou_threshold);
+            options.grid_min_boxes = 0;
+            Utils::NmsEngine linear(options);
+            options.grid_min_boxes = 1;
+            Utils::NmsEngine grid(options);
+
+            size_t kept = 0;
+            const double legacy_us = measureUs(iterations, [&] {
+                auto candidates = proposals;
+                referenceNms(candidates, iou_threshold);
+                kept = candidates.size();
+            });
+            const double linear_us = measureUs(iterations, [&] { linear.run(boxes); });
+            const double grid_us = measureUs(iterations, [&] { grid.run(boxes); });
+
+            std::cout << std::setw(10) << scene.name << std::setw(8) << count << std::setw(14) << std::fixed
+                      << std::setprecision(1) << legacy_us << std::setw(14) << linear_us << std::setw(14) << grid_us
+                      << std::setw(10) << kept << std::endl;
+        }
+    }
+
+    return 0;
+}
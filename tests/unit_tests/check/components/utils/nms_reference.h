@@ -0,0 +1,78 @@
+/*******************************************************************************
+ * Copyright (C) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <random>
+#include <vector>
+
+// The quadratic NMS previously used by BlobToROIConverter::runNms, kept as a reference for tests and benchmarks
+struct ReferenceBox {
+    double x, y, w, h;
+    double confidence;
+    size_t index;
+
+    bool operator<(const ReferenceBox &other) const {
+        return confidence < other.confidence;
+    }
+};
+
+inline void referenceNms(std::vector<ReferenceBox> &candidates, double iou_threshold) {
+    std::sort(candidates.rbegin(), candidates.rend());
+
+    for (auto p_first = candidates.begin(); p_first != candidates.end(); ++p_first) {
+        const auto &first = *p_first;
+        const double first_area = first.w * first.h;
+
+        for (auto p_candidate = p_first + 1; p_candidate != candidates.end();) {
+            const auto &candidate = *p_candidate;
+            const double inter_width =
+                std::min(first.x + first.w, candidate.x + candidate.w) - std::max(first.x, candidate.x);
+            const double inter_height =
+                std::min(first.y + first.h, candidate.y + candidate.h) - std::max(first.y, candidate.y);
+            if (inter_width <= 0.0 || inter_height <= 0.0) {
+                ++p_candidate;
+                continue;
+            }
+
+            const double inter_area = inter_width * inter_height;
+            const double union_area = candidate.w * candidate.h + first_area - inter_area;
+            if (inter_area / union_area > iou_threshold)
+                p_candidate = candidates.erase(p_candidate);
+            else
+                ++p_candidate;
+        }
+    }
+}
+
+// Clusters of proposals around objects, similar to raw detector output at a low confidence threshold.
+// The default scene is a 640x640 model input crowded with 16-64 px objects.
+inline std::vector<ReferenceBox> generateProposals(size_t count, unsigned seed, double image_size = 640.0,
+                                                   double min_size = 16.0, double max_size = 64.0) {
+    std::mt19937 generator(seed);
+    std::uniform_real_distribution<double> position(0.0, image_size - max_size);
+    std::uniform_real_distribution<double> jitter(-min_size / 2, min_size / 2);
+    std::uniform_real_distribution<double> size(min_size, max_size);
+    std::uniform_real_distribution<double> score(0.0, 1.0);
+
+    const size_t cluster_size = 16;
+    std::vector<ReferenceBox> boxes;
+    boxes.reserve(count);
+    double cx = 0, cy = 0, w = 0, h = 0;
+    for (size_t i = 0; i < count; ++i) {
+        if (i % cluster_size == 0) {
+            cx = position(generator);
+            cy = position(generator);
+            w = size(generator);
+            h = size(generator);
+        }
+        boxes.push_back({cx + jitter(generator), cy + jitter(generator), w + jitter(generator), h + jitter(generator),
+                         score(generator), i});
+    }
+    return boxes;
+}
@@ -0,0 +1,117 @@
+/*******************************************************************************
+ * Copyright (C) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+#include "nms_reference.h"
+#include "non_max_suppression.h"
+
+#include <gtest/gtest.h>
+
+using namespace Utils;
+
+namespace {
+
+NmsBoxes toNmsBoxes(const std::vector<ReferenceBox> &proposals) {
+    NmsBoxes boxes;
+    for (const auto &p : proposals)
+        boxes.add(static_cast<float>(p.x), static_cast<float>(p.y), static_cast<float>(p.x + p.w),
+                  static_cast<float>(p.y + p.h), static_cast<float>(p.confidence));
+    return boxes;
+}
+
+std::vector<size_t> referenceKept(std::vector<ReferenceBox> proposals, double iou_threshold) {
+    referenceNms(proposals, iou_threshold);
+    std::vector<size_t> kept;
+    for (const auto &p : proposals)
+        kept.push_back(p.index);
+    return kept;
+}
+
+} // namespace
+
+TEST(NonMaxSuppressionTest, EmptyInput) {
+    NmsEngine engine;
+    NmsBoxes boxes;
+    EXPECT_TRUE(engine.run(boxes).empty());
+}
+
+TEST(NonMaxSuppressionTest, HardMatchesReference) {
+    const auto proposals = generateProposals(300, 1);
+    NmsOptions options;
+    options.overlap_threshold = 0.45f;
+    options.grid_min_boxes = 0;
+    NmsEngine engine(options);
+
+    NmsBoxes boxes = toNmsBoxes(proposals);
+    EXPECT_EQ(engine.run(boxes), referenceKept(proposals, 0.45));
+}
+
+TEST(NonMaxSuppressionTest, GridMatchesReference) {
+    const auto proposals = generateProposals(4000, 2);
+    NmsOptions options;
+    options.overlap_threshold = 0.5f;
+    options.grid_min_boxes = 1;
+    NmsEngine engine(options);
+
+    NmsBoxes boxes = toNmsBoxes(proposals);
+    EXPECT_EQ(engine.run(boxes), referenceKept(proposals, 0.5));
+    // engine is reusable
+    EXPECT_EQ(engine.run(boxes), referenceKept(proposals, 0.5));
+}
+
+TEST(NonMaxSuppressionTest, ClassAwareKeepsOtherLabels) {
+    NmsBoxes boxes;
+    boxes.add(0, 0, 10, 10, 0.9f, 0);
+    boxes.add(1, 1, 11, 11, 0.8f, 1);
+    boxes.add(1, 0, 11, 10, 0.7f, 0);
+
+    NmsOptions options;
+    NmsEngine engine(options);
+    EXPECT_EQ(engine.run(boxes), std::vector<size_t>({0}));
+
+    options.class_aware = true;
+    engine.setOptions(options);
+    EXPECT_EQ(engine.run(boxes), std::vector<size_t>({0, 1}));
+}
+
+TEST(NonMaxSuppressionTest, MinAreaOverlap) {
+    NmsBoxes boxes;
+    boxes.add(0, 0, 100, 100, 0.9f);
+    boxes.add(10, 10, 30, 30, 0.8f); // fully inside, IoU is only 0.04
+
+    NmsOptions options;
+    options.overlap_threshold = 0.7f;
+    NmsEngine engine(options);
+    EXPECT_EQ(engine.run(boxes).size(), 2u);
+
+    options.overlap = NmsOverlap::MIN_AREA;
+    engine.setOptions(options);
+    EXPECT_EQ(engine.run(boxes), std::vector<size_t>({0}));
+}
+
+TEST(NonMaxSuppressionTest, SoftNmsDecaysScores) {
+    NmsBoxes boxes;
+    boxes.add(0, 0, 10, 10, 0.9f);
+    boxes.add(0, 0, 10, 5, 0.8f); // IoU 0.5
+    boxes.add(20, 20, 30, 30, 0.5f);
+
+    NmsOptions options;
+    options.overlap_threshold = 0.3f;
+    options.method = NmsMethod::SOFT_LINEAR;
+    NmsEngine engine(options);
+
+    EXPECT_EQ(engine.run(boxes), std::vector<size_t>({0, 2, 1}));
+    EXPECT_FLOAT_EQ(boxes.score[0], 0.9f);
+    EXPECT_FLOAT_EQ(boxes.score[1], 0.4f);
+    EXPECT_FLOAT_EQ(boxes.score[2], 0.5f);
+
+    boxes.score = {0.9f, 0.8f, 0.5f};
+    options.method = NmsMethod::SOFT_GAUSSIAN;
+    options.soft_score_threshold = 0.45f;
+    engine.setOptions(options);
+    // 0.8 * exp(-0.25 / 0.5) ~ 0.485
+    EXPECT_EQ(engine.run(boxes), std::vector<size_t>({0, 2, 1}));
+    EXPECT_NEAR(boxes.score[1], 0.485f, 1e-3);
+}
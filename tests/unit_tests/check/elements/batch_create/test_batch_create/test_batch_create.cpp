@@ -0,0 +1,193 @@
+/*******************************************************************************
+ * Copyright (C) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+#include <gst/check/gstcheck.h>
+#include <gst/check/gsttestclock.h>
+
+#include "batch_create.h"
+#include "batch_split.h"
+#include "dlstreamer/image_metadata.h"
+
+// All tests use the same properties: elements started one after another reuse the same shared instance
+constexpr gint BATCH_SIZE = 4;
+constexpr GstClockTime MAX_LATENCY = 100 * GST_MSECOND;
+
+static GstPad *srcpad, *sinkpad;
+static GAsyncQueue *batches;
+static guint batches_before_eos;
+static gboolean got_eos;
+
+static GstStaticPadTemplate srctemplate =
+    GST_STATIC_PAD_TEMPLATE("src", GST_PAD_SRC, GST_PAD_ALWAYS, GST_STATIC_CAPS_ANY);
+static GstStaticPadTemplate sinktemplate =
+    GST_STATIC_PAD_TEMPLATE("sink", GST_PAD_SINK, GST_PAD_ALWAYS, GST_STATIC_CAPS_ANY);
+
+// BatchMetadata is qdata of the buffer list, so batches are received as lists
+static GstFlowReturn sink_chain_list(GstPad *, GstObject *, GstBufferList *list) {
+    g_async_queue_push(batches, list);
+    return GST_FLOW_OK;
+}
+
+static gboolean sink_event(GstPad *, GstObject *, GstEvent *event) {
+    if (GST_EVENT_TYPE(event) == GST_EVENT_EOS) {
+        batches_before_eos = g_async_queue_length(batches);
+        got_eos = TRUE;
+    }
+    gst_event_unref(event);
+    return TRUE;
+}
+
+// batch_create gets its stream id from downstream, batch_split answers it in a pipeline
+static gboolean sink_query(GstPad *pad, GstObject *parent, GstQuery *query) {
+    const gchar *context_type;
+    if (GST_QUERY_TYPE(query) == GST_QUERY_CONTEXT && gst_query_parse_context_type(query, &context_type) &&
+        g_strcmp0(context_type, STREAMID_CONTEXT_NAME) == 0) {
+        GstContext *context = gst_context_new(context_type, FALSE);
+        gst_structure_set(gst_context_writable_structure(context), STREAMID_CONTEXT_FIELD_NAME, G_TYPE_POINTER, pad,
+                          NULL);
+        gst_query_set_context(query, context);
+        gst_context_unref(context);
+        return TRUE;
+    }
+    return gst_pad_query_default(pad, parent, query);
+}
+
+static GstElement *setup_batch_create(GstClock *clock) {
+    batches = g_async_queue_new_full((GDestroyNotify)gst_buffer_list_unref);
+    batches_before_eos = 0;
+    got_eos = FALSE;
+
+    GstElement *element = gst_check_setup_element("batch_create");
+    g_object_set(element, "batch-size", BATCH_SIZE, "max-latency", MAX_LATENCY, NULL);
+    srcpad = gst_check_setup_src_pad(element, &srctemplate);
+    sinkpad = gst_check_setup_sink_pad(element, &sinktemplate);
+    gst_pad_set_chain_list_function(sinkpad, sink_chain_list);
+    gst_pad_set_event_function(sinkpad, sink_event);
+    gst_pad_set_query_function(sinkpad, sink_query);
+    gst_pad_set_active(srcpad, TRUE);
+    gst_pad_set_active(sinkpad, TRUE);
+
+    gst_element_set_clock(element, clock);
+    fail_unless_equals_int(gst_element_set_state(element, GST_STATE_PLAYING), GST_STATE_CHANGE_SUCCESS);
+    GstCaps *caps = gst_caps_from_string("video/x-raw,format=BGR,width=8,height=8,framerate=30/1");
+    gst_check_setup_events(srcpad, element, caps, GST_FORMAT_TIME);
+    gst_caps_unref(caps);
+    return element;
+}
+
+static void cleanup_batch_create(GstElement *element) {
+    fail_unless_equals_int(gst_element_set_state(element, GST_STATE_NULL), GST_STATE_CHANGE_SUCCESS);
+    gst_check_teardown_src_pad(element);
+    gst_check_teardown_sink_pad(element);
+    gst_check_teardown_element(element);
+    g_async_queue_unref(batches);
+}
+
+static void push_frames(guint count) {
+    for (guint i = 0; i < count; i++)
+        fail_unless_equals_int(gst_pad_push(srcpad, gst_buffer_new_allocate(NULL, 8 * 8 * 3, NULL)), GST_FLOW_OK);
+}
+
+static GstBufferList *pop_batch() {
+    return (GstBufferList *)g_async_queue_timeout_pop(batches, 5 * G_USEC_PER_SEC);
+}
+
+static void check_batch_meta(GstBufferList *list, gint size, GstClockTime wait_time) {
+    auto meta = (const GstStructure *)gst_mini_object_get_qdata(&list->mini_object,
+                                                                g_quark_from_string(dlstreamer::BatchMetadata::name));
+    fail_unless(meta != NULL);
+    gint meta_size = 0, meta_batch_size = 0;
+    gpointer meta_wait_time = NULL;
+    fail_unless(gst_structure_get(meta, dlstreamer::BatchMetadata::key::size, G_TYPE_INT, &meta_size,
+                                  dlstreamer::BatchMetadata::key::batch_size, G_TYPE_INT, &meta_batch_size,
+                                  dlstreamer::BatchMetadata::key::wait_time, G_TYPE_POINTER, &meta_wait_time, NULL));
+    fail_unless_equals_int(meta_size, size);
+    fail_unless_equals_int(gst_buffer_list_length(list), size);
+    fail_unless_equals_int(meta_batch_size, BATCH_SIZE);
+    fail_unless_equals_uint64((intptr_t)meta_wait_time, wait_time);
+}
+
+GST_START_TEST(test_complete_batch) {
+    GstClock *clock = gst_test_clock_new();
+    GstElement *element = setup_batch_create(clock);
+
+    push_frames(BATCH_SIZE);
+    GstBufferList *list = pop_batch();
+    fail_unless(list != NULL);
+    check_batch_meta(list, BATCH_SIZE, 0);
+    gst_buffer_list_unref(list);
+
+    cleanup_batch_create(element);
+    gst_object_unref(clock);
+}
+GST_END_TEST;
+
+GST_START_TEST(test_partial_batch_on_deadline) {
+    GstClock *clock = gst_test_clock_new();
+    GstTestClock *test_clock = GST_TEST_CLOCK(clock);
+    GstElement *element = setup_batch_create(clock);
+
+    push_frames(2);
+    GstClockID id;
+    gst_test_clock_wait_for_next_pending_id(test_clock, &id);
+    fail_unless_equals_uint64(gst_clock_id_get_time(id), MAX_LATENCY);
+    gst_clock_id_unref(id);
+
+    // nothing is pushed before the deadline
+    gst_test_clock_set_time(test_clock, MAX_LATENCY - GST_MSECOND);
+    fail_unless(gst_test_clock_peek_next_pending_id(test_clock, NULL));
+    fail_unless_equals_int(g_async_queue_length(batches), 0);
+
+    fail_unless(gst_test_clock_crank(test_clock));
+    GstBufferList *list = pop_batch();
+    fail_unless(list != NULL);
+    check_batch_meta(list, 2, MAX_LATENCY);
+    gst_buffer_list_unref(list);
+
+    cleanup_batch_create(element);
+    gst_object_unref(clock);
+}
+GST_END_TEST;
+
+GST_START_TEST(test_partial_batch_on_eos) {
+    GstClock *clock = gst_test_clock_new();
+    GstTestClock *test_clock = GST_TEST_CLOCK(clock);
+    GstElement *element = setup_batch_create(clock);
+
+    push_frames(3);
+    gst_test_clock_wait_for_next_pending_id(test_clock, NULL);
+    gst_test_clock_set_time(test_clock, 30 * GST_MSECOND);
+    fail_unless(gst_pad_push_event(srcpad, gst_event_new_eos()));
+
+    // partial batch is pushed before EOS, and its deadline is cancelled
+    fail_unless(got_eos);
+    fail_unless_equals_int(batches_before_eos, 1);
+    GstBufferList *list = pop_batch();
+    fail_unless(list != NULL);
+    check_batch_meta(list, 3, 30 * GST_MSECOND);
+    gst_buffer_list_unref(list);
+    fail_if(gst_test_clock_peek_next_pending_id(test_clock, NULL));
+
+    cleanup_batch_create(element);
+    gst_object_unref(clock);
+}
+GST_END_TEST;
+
+static Suite *batch_create_suite(void) {
+    Suite *s = suite_create("batch_create");
+    TCase *tc_chain = tcase_create("general");
+
+    gst_element_register(NULL, "batch_create", GST_RANK_NONE, batch_create_get_type());
+
+    suite_add_tcase(s, tc_chain);
+    tcase_add_test(tc_chain, test_complete_batch);
+    tcase_add_test(tc_chain, test_partial_batch_on_deadline);
+    tcase_add_test(tc_chain, test_partial_batch_on_eos);
+
+    return s;
+}
+
+GST_CHECK_MAIN(batch_create);
@@ -7,10 +7,12 @@
 #include "fpscounter.h"
 #include "fpscounter_c.h"
 #include "gva_utils.h"
+#include <cmath>
 #include <fstream>
 #include <gmock/gmock.h>
 #include <gst/gstmeta.h>
 #include <gtest/gtest.h>
+#include <numeric>
 #include <test_common.h>
 #include <test_utils.h>
 
@@ -97,6 +99,29 @@ TEST_F(FpsCounterTest, FpsCounters_C_interface_positive) {
     fps_counter_set_output(stdout);
 }
 
+TEST_F(FpsCounterTest, RunningStats_merge_matches_single_pass) {
+    const std::vector<double> values = {33.1, 34.0, 32.7, 40.2, 33.3, 29.8, 35.5};
+    RunningStats all, first, second;
+    for (size_t i = 0; i < values.size(); i++) {
+        all.add(values[i]);
+        (i < 3 ? first : second).add(values[i]);
+    }
+    first.merge(second);
+
+    double mean = std::accumulate(values.begin(), values.end(), 0.0) / values.size();
+    double sq_sum = 0.0;
+    for (double value : values)
+        sq_sum += (value - mean) * (value - mean);
+    double std_dev = std::sqrt(sq_sum / (values.size() - 1));
+
+    EXPECT_EQ(first.count, values.size());
+    EXPECT_NEAR(all.mean, mean, 1e-9);
+    EXPECT_NEAR(first.mean, mean, 1e-9);
+    EXPECT_NEAR(all.std_dev(), std_dev, 1e-9);
+    EXPECT_NEAR(first.std_dev(), std_dev, 1e-9);
+    EXPECT_EQ(RunningStats().std_dev(), 0.0);
+}
+
 GTEST_API_ int main(int argc, char **argv) {
     std::cout << "Running Components::FpsCounterTest from " << __FILE__ << std::endl;
     testing::InitGoogleTest(&argc, argv);
@@ -0,0 +1,22 @@
+/*******************************************************************************
+ * Copyright (C) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+#include <gtest/gtest.h>
+
+#include <gst/check/gstcheck.h>
+
+#include "gva_json_meta.h"
+
+GTEST_API_ int main(int argc, char **argv) {
+    testing::InitGoogleTest(&argc, argv);
+    gst_check_init(&argc, &argv);
+
+    // register metadata
+    gst_gva_json_meta_get_info();
+    gst_gva_json_meta_api_get_type();
+
+    return RUN_ALL_TESTS();
+}
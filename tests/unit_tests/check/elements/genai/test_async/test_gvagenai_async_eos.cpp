@@ -0,0 +1,171 @@
+/*******************************************************************************
+ * Copyright (C) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+/**
+ * @file test_gvagenai_async_eos.cpp
+ * @brief Checks that async gvagenai delivers results of requests still pending at EOS.
+ *
+ * A minimal HTTP server on 127.0.0.1 answers every request after a delay, so all chunks are
+ * still in flight when EOS reaches the element.
+ */
+
+#ifdef GVAGENAI_HAVE_HTTP_BACKEND
+
+#include "gstgvagenai.h"
+#include "gva_json_meta.h"
+
+#include <gst/check/gstharness.h>
+#include <gtest/gtest.h>
+
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include <chrono>
+#include <stdexcept>
+#include <string>
+#include <thread>
+
+namespace {
+
+class SlowServer {
+  public:
+    explicit SlowServer(std::chrono::milliseconds delay) : delay_(delay) {
+        listen_fd_ = socket(AF_INET, SOCK_STREAM, 0);
+        sockaddr_in addr = {};
+        addr.sin_family = AF_INET;
+        addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+        addr.sin_port = 0;
+        socklen_t len = sizeof(addr);
+        if (listen_fd_ < 0 || bind(listen_fd_, reinterpret_cast<sockaddr *>(&addr), len) != 0 ||
+            listen(listen_fd_, 8) != 0 || getsockname(listen_fd_, reinterpret_cast<sockaddr *>(&addr), &len) != 0)
+            throw std::runtime_error("Failed to start test HTTP server");
+        port_ = ntohs(addr.sin_port);
+        thread_ = std::thread(&SlowServer::run, this);
+    }
+
+    ~SlowServer() {
+        shutdown(listen_fd_, SHUT_RDWR);
+        close(listen_fd_);
+        thread_.join();
+    }
+
+    std::string url() const {
+        return "http://127.0.0.1:" + std::to_string(port_) + "/v1";
+    }
+
+  private:
+    void run() {
+        while (true) {
+            const int fd = accept(listen_fd_, nullptr, nullptr);
+            if (fd < 0)
+                return;
+            serve(fd);
+            close(fd);
+        }
+    }
+
+    // Answers requests on one connection, each after the delay, until the client closes it
+    void serve(int fd) {
+        static const std::string body = R"({"choices":[{"message":{"content":"ok"}}]})";
+        static const std::string response = "HTTP/1.1 200 OK\r\nContent-Type: application/json\r\nContent-Length: " +
+                                            std::to_string(body.size()) + "\r\n\r\n" + body;
+        std::string data;
+        char chunk[4096];
+        while (true) {
+            const size_t header_end = data.find("\r\n\r\n");
+            if (header_end != std::string::npos) {
+                size_t content_length = 0;
+                const size_t pos = data.find("Content-Length:");
+                if (pos != std::string::npos && pos < header_end)
+                    content_length = std::stoul(data.substr(pos + 15));
+                if (data.size() >= header_end + 4 + content_length) {
+                    data.erase(0, header_end + 4 + content_length);
+                    std::this_thread::sleep_for(delay_);
+                    if (send(fd, response.data(), response.size(), MSG_NOSIGNAL) < 0)
+                        return;
+                    continue;
+                }
+            }
+            const ssize_t received = recv(fd, chunk, sizeof(chunk), 0);
+            if (received <= 0)
+                return;
+            data.append(chunk, received);
+        }
+    }
+
+    std::chrono::milliseconds delay_;
+    int listen_fd_ = -1;
+    int port_ = 0;
+    std::thread thread_;
+};
+
+GstBuffer *rgb_frame(guint index) {
+    constexpr gsize size = 8 * 8 * 3;
+    GstBuffer *buffer = gst_buffer_new_allocate(nullptr, size, nullptr);
+    gst_buffer_memset(buffer, 0, 128, size);
+    GST_BUFFER_PTS(buffer) = index * GST_SECOND / 30;
+    GST_BUFFER_DURATION(buffer) = GST_SECOND / 30;
+    return buffer;
+}
+
+} // namespace
+
+TEST(GvaGenAIAsync, PostsPendingResultsOnEos) {
+    constexpr guint num_frames = 3;
+    SlowServer server(std::chrono::milliseconds(300));
+    ASSERT_TRUE(gst_element_register(nullptr, "gvagenai", GST_RANK_NONE, GST_TYPE_GVAGENAI));
+
+    const std::string launch = "gvagenai backend=openai-http model-path=test-model http-server-url=" + server.url() +
+                               " prompt=Describe chunk-size=1 async=true max-pending=4";
+    GstHarness *h = gst_harness_new_parse(launch.c_str());
+    GstBus *bus = gst_bus_new();
+    gst_element_set_bus(h->element, bus);
+    gst_harness_set_src_caps_str(h, "video/x-raw,format=RGB,width=8,height=8,framerate=30/1");
+
+    for (guint i = 0; i < num_frames; ++i)
+        ASSERT_EQ(gst_harness_push(h, rgb_frame(i)), GST_FLOW_OK);
+    ASSERT_TRUE(gst_harness_push_event(h, gst_event_new_eos()));
+
+    guint results = 0;
+    for (guint i = 0; i < num_frames; ++i) {
+        GstBuffer *buffer = gst_harness_pull(h);
+        ASSERT_NE(buffer, nullptr);
+        gpointer state = nullptr;
+        while (GST_GVA_JSON_META_ITERATE(buffer, &state))
+            ++results;
+        gst_buffer_unref(buffer);
+    }
+
+    GstMessage *message;
+    while ((message = gst_bus_pop_filtered(bus, GST_MESSAGE_ELEMENT))) {
+        const GstStructure *structure = gst_message_get_structure(message);
+        if (gst_structure_has_name(structure, "gvagenai-result")) {
+            EXPECT_NE(gst_structure_get_string(structure, "message"), nullptr);
+            EXPECT_TRUE(gst_structure_has_field(structure, "pts-start"));
+            EXPECT_TRUE(gst_structure_has_field(structure, "pts-end"));
+            ++results;
+        }
+        gst_message_unref(message);
+    }
+    EXPECT_EQ(results, num_frames);
+
+    // EOS is forwarded only after the pending results were delivered
+    bool eos = false;
+    GstEvent *event;
+    while (!eos && (event = gst_harness_try_pull_event(h))) {
+        eos = GST_EVENT_TYPE(event) == GST_EVENT_EOS;
+        gst_event_unref(event);
+    }
+    EXPECT_TRUE(eos);
+
+    gst_element_set_bus(h->element, nullptr);
+    gst_object_unref(bus);
+    gst_harness_teardown(h);
+}
+
+#endif // GVAGENAI_HAVE_HTTP_BACKEND
@@ -0,0 +1,206 @@
+/*******************************************************************************
+ * Copyright (C) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+/**
+ * @file test_gvagenai_async_submitter.cpp
+ * @brief Unit tests for gvagenai's AsyncSubmitter.
+ *
+ * A fake backend, blocked until the test releases it, stands in for a slow model.
+ *
+ * Coverage:
+ *   - submit() returns while the backend is still generating.
+ *   - skip-if-busy and drop-oldest overflow policies.
+ *   - completions carry the PTS range of their request, errors are reported per request.
+ *   - discard() returns while the backend is generating and drops the results in flight.
+ */
+
+#include "backends/async_submitter.hpp"
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+using genai::AsyncCompletion;
+using genai::AsyncSubmitter;
+using genai::GenAIResult;
+using genai::GenRequest;
+using genai::OverflowPolicy;
+
+namespace {
+
+// Answers with the request prompt, after the test opens the gate. Prompt "fail" makes the request fail.
+class GatedBackend : public genai::IGenAIBackend {
+  public:
+    std::future<GenAIResult> submit(GenRequest req) override {
+        std::promise<GenAIResult> promise;
+        {
+            std::unique_lock<std::mutex> lock(mutex_);
+            ++started_;
+            started_cv_.notify_all();
+            gate_cv_.wait(lock, [this] { return open_; });
+        }
+        if (req.prompt == "fail") {
+            promise.set_exception(std::make_exception_ptr(std::runtime_error("generation failed")));
+        } else {
+            GenAIResult result;
+            result.text = req.prompt;
+            result.confidence = 0.5f;
+            result.raw_json = "{\"result\":\"" + req.prompt + "\"}";
+            promise.set_value(result);
+        }
+        return promise.get_future();
+    }
+
+    void set_generation_config(const std::string &) override {
+    }
+
+    std::string describe() const override {
+        return "gated";
+    }
+
+    void open() {
+        std::lock_guard<std::mutex> lock(mutex_);
+        open_ = true;
+        gate_cv_.notify_all();
+    }
+
+    void wait_started(int count) {
+        std::unique_lock<std::mutex> lock(mutex_);
+        ASSERT_TRUE(started_cv_.wait_for(lock, std::chrono::seconds(10), [&] { return started_ >= count; }));
+    }
+
+  private:
+    std::mutex mutex_;
+    std::condition_variable gate_cv_;
+    std::condition_variable started_cv_;
+    bool open_ = false;
+    int started_ = 0;
+};
+
+GenRequest request(const std::string &prompt) {
+    GenRequest req;
+    req.prompt = prompt;
+    return req;
+}
+
+std::vector<std::string> texts(const std::vector<AsyncCompletion> &completions) {
+    std::vector<std::string> out;
+    for (const auto &completion : completions)
+        out.push_back(completion.result.text);
+    return out;
+}
+
+} // namespace
+
+TEST(AsyncSubmitter, SubmitDoesNotWaitForBackend) {
+    auto backend = std::make_shared<GatedBackend>();
+    AsyncSubmitter submitter(backend, 1, OverflowPolicy::SkipIfBusy);
+
+    EXPECT_TRUE(submitter.submit(request("a"), 0, 10));
+    backend->wait_started(1);
+    EXPECT_TRUE(submitter.take_completed().empty());
+
+    backend->open();
+    submitter.drain();
+    const auto completed = submitter.take_completed();
+    ASSERT_EQ(completed.size(), 1u);
+    EXPECT_TRUE(completed[0].ok);
+    EXPECT_EQ(completed[0].result.text, "a");
+    EXPECT_FLOAT_EQ(completed[0].result.confidence, 0.5f);
+    EXPECT_TRUE(submitter.take_completed().empty());
+}
+
+TEST(AsyncSubmitter, CompletionsCarryPtsRange) {
+    auto backend = std::make_shared<GatedBackend>();
+    backend->open();
+    AsyncSubmitter submitter(backend, 4, OverflowPolicy::SkipIfBusy);
+
+    submitter.submit(request("a"), 100, 400);
+    submitter.submit(request("b"), 500, GST_CLOCK_TIME_NONE);
+    submitter.drain();
+
+    const auto completed = submitter.take_completed();
+    ASSERT_EQ(completed.size(), 2u);
+    EXPECT_EQ(completed[0].pts_start, 100u);
+    EXPECT_EQ(completed[0].pts_end, 400u);
+    EXPECT_EQ(completed[1].pts_start, 500u);
+    EXPECT_EQ(completed[1].pts_end, GST_CLOCK_TIME_NONE);
+}
+
+TEST(AsyncSubmitter, SkipIfBusyDiscardsNewRequests) {
+    auto backend = std::make_shared<GatedBackend>();
+    AsyncSubmitter submitter(backend, 1, OverflowPolicy::SkipIfBusy);
+
+    EXPECT_TRUE(submitter.submit(request("running"), 0, 0));
+    backend->wait_started(1);
+    EXPECT_TRUE(submitter.submit(request("waiting"), 1, 1));
+    EXPECT_FALSE(submitter.submit(request("skipped"), 2, 2));
+    EXPECT_EQ(submitter.dropped(), 1u);
+
+    backend->open();
+    submitter.drain();
+    EXPECT_EQ(texts(submitter.take_completed()), (std::vector<std::string>{"running", "waiting"}));
+}
+
+TEST(AsyncSubmitter, DropOldestKeepsLatestRequests) {
+    auto backend = std::make_shared<GatedBackend>();
+    AsyncSubmitter submitter(backend, 2, OverflowPolicy::DropOldest);
+
+    EXPECT_TRUE(submitter.submit(request("running"), 0, 0));
+    backend->wait_started(1);
+    for (const char *prompt : {"1", "2", "3", "4"})
+        EXPECT_TRUE(submitter.submit(request(prompt), 1, 1));
+    EXPECT_EQ(submitter.dropped(), 2u);
+
+    backend->open();
+    submitter.drain();
+    EXPECT_EQ(texts(submitter.take_completed()), (std::vector<std::string>{"running", "3", "4"}));
+}
+
+TEST(AsyncSubmitter, ErrorsAreReportedPerRequest) {
+    auto backend = std::make_shared<GatedBackend>();
+    backend->open();
+    AsyncSubmitter submitter(backend, 4, OverflowPolicy::SkipIfBusy);
+
+    submitter.submit(request("fail"), 0, 0);
+    submitter.submit(request("ok"), 1, 1);
+    submitter.drain();
+
+    const auto completed = submitter.take_completed();
+    ASSERT_EQ(completed.size(), 2u);
+    EXPECT_FALSE(completed[0].ok);
+    EXPECT_EQ(completed[0].error, "generation failed");
+    EXPECT_TRUE(completed[1].ok);
+    EXPECT_EQ(completed[1].result.text, "ok");
+}
+
+TEST(AsyncSubmitter, DiscardDoesNotWaitForBackend) {
+    auto backend = std::make_shared<GatedBackend>();
+    AsyncSubmitter submitter(backend, 4, OverflowPolicy::SkipIfBusy);
+
+    EXPECT_TRUE(submitter.submit(request("running"), 0, 0));
+    backend->wait_started(1);
+    EXPECT_TRUE(submitter.submit(request("waiting"), 1, 1));
+
+    submitter.discard(); // backend still blocked
+    backend->open();
+    submitter.drain();
+    EXPECT_TRUE(submitter.take_completed().empty());
+
+    // requests submitted after the discard complete as usual
+    EXPECT_TRUE(submitter.submit(request("after"), 2, 2));
+    submitter.drain();
+    EXPECT_EQ(texts(submitter.take_completed()), (std::vector<std::string>{"after"}));
+}
+
+TEST(AsyncSubmitter, RejectsNullBackend) {
+    EXPECT_THROW(AsyncSubmitter(nullptr, 1, OverflowPolicy::SkipIfBusy), std::invalid_argument);
+}
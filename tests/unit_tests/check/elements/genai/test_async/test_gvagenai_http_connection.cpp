@@ -0,0 +1,144 @@
+/*******************************************************************************
+ * Copyright (C) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+/**
+ * @file test_gvagenai_http_connection.cpp
+ * @brief Checks that the openai-http backend reuses its connection between requests.
+ *
+ * A minimal keep-alive HTTP server on 127.0.0.1 answers every request with a fixed Chat
+ * Completions response and counts accepted connections.
+ */
+
+#ifdef GVAGENAI_HAVE_HTTP_BACKEND
+
+#include "backends/openai-http/openai_http_backend.hpp"
+
+#include <gtest/gtest.h>
+
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <atomic>
+#include <stdexcept>
+#include <string>
+#include <thread>
+
+namespace {
+
+class KeepAliveServer {
+  public:
+    KeepAliveServer() {
+        listen_fd_ = socket(AF_INET, SOCK_STREAM, 0);
+        sockaddr_in addr = {};
+        addr.sin_family = AF_INET;
+        addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+        addr.sin_port = 0;
+        socklen_t len = sizeof(addr);
+        if (listen_fd_ < 0 || bind(listen_fd_, reinterpret_cast<sockaddr *>(&addr), len) != 0 ||
+            listen(listen_fd_, 8) != 0 || getsockname(listen_fd_, reinterpret_cast<sockaddr *>(&addr), &len) != 0)
+            throw std::runtime_error("Failed to start test HTTP server");
+        port_ = ntohs(addr.sin_port);
+        thread_ = std::thread(&KeepAliveServer::run, this);
+    }
+
+    ~KeepAliveServer() {
+        shutdown(listen_fd_, SHUT_RDWR);
+        close(listen_fd_);
+        thread_.join();
+    }
+
+    std::string url() const {
+        return "http://127.0.0.1:" + std::to_string(port_) + "/v1";
+    }
+
+    int connections() const {
+        return connections_;
+    }
+
+    int requests() const {
+        return requests_;
+    }
+
+  private:
+    void run() {
+        while (true) {
+            const int fd = accept(listen_fd_, nullptr, nullptr);
+            if (fd < 0)
+                return;
+            ++connections_;
+            serve(fd);
+            close(fd);
+        }
+    }
+
+    // Answers requests on one connection until the client closes it
+    void serve(int fd) {
+        static const std::string body = R"({"choices":[{"message":{"content":"ok"}}]})";
+        static const std::string response = "HTTP/1.1 200 OK\r\nContent-Type: application/json\r\nContent-Length: " +
+                                            std::to_string(body.size()) + "\r\n\r\n" + body;
+        std::string data;
+        char chunk[4096];
+        while (true) {
+            const size_t header_end = data.find("\r\n\r\n");
+            if (header_end != std::string::npos) {
+                size_t content_length = 0;
+                const size_t pos = data.find("Content-Length:");
+                if (pos != std::string::npos && pos < header_end)
+                    content_length = std::stoul(data.substr(pos + 15));
+                if (data.size() >= header_end + 4 + content_length) {
+                    data.erase(0, header_end + 4 + content_length);
+                    ++requests_;
+                    if (send(fd, response.data(), response.size(), MSG_NOSIGNAL) < 0)
+                        return;
+                    continue;
+                }
+            }
+            const ssize_t received = recv(fd, chunk, sizeof(chunk), 0);
+            if (received <= 0)
+                return;
+            data.append(chunk, received);
+        }
+    }
+
+    int listen_fd_ = -1;
+    int port_ = 0;
+    std::atomic<int> connections_{0};
+    std::atomic<int> requests_{0};
+    std::thread thread_;
+};
+
+genai::GenRequest frame_request() {
+    genai::GenRequest req;
+    req.prompt = "Describe the frame.";
+    ov::Tensor frame(ov::element::u8, {1, 8, 8, 3});
+    std::fill_n(frame.data<uint8_t>(), frame.get_size(), uint8_t(128));
+    req.frames.push_back(frame);
+    return req;
+}
+
+} // namespace
+
+TEST(OpenAIHttpBackend, ReusesConnectionBetweenRequests) {
+    KeepAliveServer server;
+
+    genai::HttpBackendParams params;
+    params.server_url = server.url();
+    params.model_name = "test-model";
+    params.timeout_ms = "5000";
+    genai::OpenAIHttpBackend backend(params);
+
+    for (int i = 0; i < 3; ++i) {
+        const auto result = backend.submit(frame_request()).get();
+        EXPECT_EQ(result.text, "ok");
+    }
+    EXPECT_EQ(server.requests(), 3);
+    EXPECT_EQ(server.connections(), 1);
+}
+
+#endif // GVAGENAI_HAVE_HTTP_BACKEND
@@ -105,6 +105,21 @@ GST_START_TEST(test_obj_detection_inference_gpu) {
 
 GST_END_TEST;
 
+GST_START_TEST(test_obj_detection_partial_batch_deadline_cpu) {
+    g_print("Starting test: test_obj_detection_partial_batch_deadline_cpu\n");
+    char model_path[MAX_STR_PATH_SIZE];
+    ExitStatus status = get_model_path(model_path, MAX_STR_PATH_SIZE, cpu_test_data[0].model_name.c_str(), "FP32");
+    ck_assert(status == EXIT_STATUS_SUCCESS);
+
+    // Only one frame is pushed into a batch of 4, so it comes out with detections only if the partial batch is
+    // submitted once batch-deadline expires
+    run_test("gvadetect", VIDEO_CAPS_TEMPLATE_STRING, cpu_test_data[0].resolution, &srctemplate, &sinktemplate,
+             setup_inbuffer, check_outbuffer, &cpu_test_data[0], "model", model_path, "batch-size", 4, "batch-deadline",
+             50, NULL);
+}
+
+GST_END_TEST;
+
 static Suite *inference_suite(void) {
     Suite *s = suite_create("inference");
     TCase *tc_chain = tcase_create("general");
@@ -112,6 +127,7 @@ static Suite *inference_suite(void) {
     suite_add_tcase(s, tc_chain);
     tcase_add_test(tc_chain, test_obj_detection_inference_cpu);
     tcase_add_test(tc_chain, test_obj_detection_inference_gpu);
+    tcase_add_test(tc_chain, test_obj_detection_partial_batch_deadline_cpu);
 
     return s;
 }
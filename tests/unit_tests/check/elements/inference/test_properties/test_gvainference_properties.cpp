@@ -52,6 +52,17 @@ GST_START_TEST(test_batch_size_property_less_zero) {
 
 GST_END_TEST;
 
+GST_START_TEST(test_batch_deadline_property_less_minus_one) {
+    g_print("Starting test: test_batch_deadline_property_less_minus_one\n");
+    GValue prop_value = G_VALUE_INIT;
+    g_value_init(&prop_value, G_TYPE_INT);
+    g_value_set_int(&prop_value, -2);
+
+    check_property_default_if_invalid_value(plugin_name, "batch-deadline", prop_value);
+}
+
+GST_END_TEST;
+
 GST_START_TEST(test_nireq_property_less_zero) {
     g_print("Starting test: test_nireq_property_less_zero\n");
     GValue prop_value = G_VALUE_INIT;
@@ -82,6 +93,7 @@ static Suite *inference_properties_testing_suite(void) {
     // tcase_add_test(tc_chain, test_model_property_invalid_path);
     // tcase_add_test(tc_chain, test_model_proc_property_invalid_path);
     tcase_add_test(tc_chain, test_batch_size_property_less_zero);
+    tcase_add_test(tc_chain, test_batch_deadline_property_less_minus_one);
     tcase_add_test(tc_chain, test_nireq_property_less_zero);
     tcase_add_test(tc_chain, test_qos_property_str_trash);
 
@@ -0,0 +1,257 @@
+/*******************************************************************************
+ * Copyright (C) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+#include <gst/analytics/gstanalyticsbatchmeta.h>
+#include <gst/check/gstcheck.h>
+#include <gst/check/gsttestclock.h>
+
+#include "gstgvastreammux.h"
+
+constexpr guint NUM_PADS = 2;
+constexpr GstClockTime MAX_WAIT_TIME = 40 * GST_MSECOND;
+constexpr GstClockTime FRAME_DURATION = 33 * GST_MSECOND;
+#define TEST_CAPS "video/x-raw,format=BGR,width=8,height=8,framerate=30/1"
+
+static GstElement *mux;
+static GstClock *test_clock;
+static GstPad *mux_sinkpads[NUM_PADS]; /* requested from the mux */
+static GstPad *srcpads[NUM_PADS];      /* feed mux_sinkpads */
+static GstPad *sinkpad;                /* receives the output of the mux */
+static GAsyncQueue *outputs;
+static GAsyncQueue *flush_events;
+
+static GstStaticPadTemplate srctemplate =
+    GST_STATIC_PAD_TEMPLATE("src", GST_PAD_SRC, GST_PAD_ALWAYS, GST_STATIC_CAPS_ANY);
+static GstStaticPadTemplate sinktemplate =
+    GST_STATIC_PAD_TEMPLATE("sink", GST_PAD_SINK, GST_PAD_ALWAYS, GST_STATIC_CAPS_ANY);
+
+static GstFlowReturn sink_chain(GstPad *, GstObject *, GstBuffer *buf) {
+    g_async_queue_push(outputs, buf);
+    return GST_FLOW_OK;
+}
+
+static gboolean sink_event(GstPad *, GstObject *, GstEvent *event) {
+    if (GST_EVENT_TYPE(event) == GST_EVENT_FLUSH_START || GST_EVENT_TYPE(event) == GST_EVENT_FLUSH_STOP)
+        g_async_queue_push(flush_events, GUINT_TO_POINTER(GST_EVENT_TYPE(event)));
+    gst_event_unref(event);
+    return TRUE;
+}
+
+static void send_stream_events(guint index) {
+    gchar *stream_id = g_strdup_printf("test/%u", index);
+    fail_unless(gst_pad_push_event(srcpads[index], gst_event_new_stream_start(stream_id)));
+    g_free(stream_id);
+    GstCaps *caps = gst_caps_from_string(TEST_CAPS);
+    fail_unless(gst_pad_push_event(srcpads[index], gst_event_new_caps(caps)));
+    gst_caps_unref(caps);
+    GstSegment segment;
+    gst_segment_init(&segment, GST_FORMAT_TIME);
+    fail_unless(gst_pad_push_event(srcpads[index], gst_event_new_segment(&segment)));
+}
+
+/* Sets up the mux with NUM_PADS linked sink pads, stream events are sent to
+ * the first num_started pads only. */
+static void setup_streammux(guint max_queue_size, guint num_started) {
+    outputs = g_async_queue_new_full((GDestroyNotify)gst_buffer_unref);
+    flush_events = g_async_queue_new();
+    test_clock = gst_test_clock_new();
+
+    mux = gst_element_factory_make("gvastreammux", NULL);
+    fail_unless(mux != NULL);
+    g_object_set(mux, "max-wait-time", MAX_WAIT_TIME, "pts-tolerance", 20 * GST_MSECOND, "max-queue-size",
+                 max_queue_size, NULL);
+
+    for (guint i = 0; i < NUM_PADS; i++) {
+        mux_sinkpads[i] = gst_element_request_pad_simple(mux, "sink_%u");
+        fail_unless(mux_sinkpads[i] != NULL);
+        srcpads[i] = gst_pad_new_from_static_template(&srctemplate, "src");
+        gst_pad_set_active(srcpads[i], TRUE);
+        fail_unless_equals_int(gst_pad_link(srcpads[i], mux_sinkpads[i]), GST_PAD_LINK_OK);
+    }
+
+    sinkpad = gst_pad_new_from_static_template(&sinktemplate, "sink");
+    gst_pad_set_chain_function(sinkpad, sink_chain);
+    gst_pad_set_event_function(sinkpad, sink_event);
+    gst_pad_set_active(sinkpad, TRUE);
+    GstPad *mux_srcpad = gst_element_get_static_pad(mux, "src");
+    fail_unless_equals_int(gst_pad_link(mux_srcpad, sinkpad), GST_PAD_LINK_OK);
+    gst_object_unref(mux_srcpad);
+
+    gst_element_set_clock(mux, test_clock);
+    fail_unless(gst_element_set_state(mux, GST_STATE_PLAYING) != GST_STATE_CHANGE_FAILURE);
+    for (guint i = 0; i < num_started; i++)
+        send_stream_events(i);
+}
+
+static void cleanup_streammux() {
+    fail_unless_equals_int(gst_element_set_state(mux, GST_STATE_NULL), GST_STATE_CHANGE_SUCCESS);
+    for (guint i = 0; i < NUM_PADS; i++) {
+        if (mux_sinkpads[i]) {
+            gst_element_release_request_pad(mux, mux_sinkpads[i]);
+            gst_object_unref(mux_sinkpads[i]);
+        }
+        gst_pad_set_active(srcpads[i], FALSE);
+        gst_object_unref(srcpads[i]);
+    }
+    gst_object_unref(mux);
+    gst_pad_set_active(sinkpad, FALSE);
+    gst_object_unref(sinkpad);
+    gst_object_unref(test_clock);
+    g_async_queue_unref(outputs);
+    g_async_queue_unref(flush_events);
+}
+
+static void push_frame(guint index, GstClockTime pts) {
+    GstBuffer *buf = gst_buffer_new_allocate(NULL, 8 * 8 * 3, NULL);
+    GST_BUFFER_PTS(buf) = pts;
+    GST_BUFFER_DURATION(buf) = FRAME_DURATION;
+    fail_unless_equals_int(gst_pad_push(srcpads[index], buf), GST_FLOW_OK);
+}
+
+/* Pops one output buffer and checks it belongs to a batch of batch_size streams */
+static guint pop_output(GstClockTime pts, guint batch_size) {
+    GstBuffer *buf = (GstBuffer *)g_async_queue_timeout_pop(outputs, 5 * G_USEC_PER_SEC);
+    fail_unless(buf != NULL);
+    fail_unless_equals_uint64(GST_BUFFER_PTS(buf), pts);
+    GstAnalyticsBatchMeta *meta = gst_buffer_get_analytics_batch_meta(buf);
+    fail_unless(meta != NULL);
+    fail_unless_equals_int(meta->n_streams, batch_size);
+    guint index = meta->streams[0].index;
+    gst_buffer_unref(buf);
+    return index;
+}
+
+static void check_complete_batch(GstClockTime pts) {
+    guint indices = 0;
+    for (guint i = 0; i < NUM_PADS; i++)
+        indices |= 1u << pop_output(pts, NUM_PADS);
+    fail_unless_equals_int(indices, (1u << NUM_PADS) - 1);
+}
+
+GST_START_TEST(test_complete_batch_without_deadline) {
+    setup_streammux(2, NUM_PADS);
+
+    for (guint i = 0; i < NUM_PADS; i++)
+        push_frame(i, 0);
+    check_complete_batch(0);
+
+    cleanup_streammux();
+}
+GST_END_TEST;
+
+GST_START_TEST(test_partial_batch_on_deadline) {
+    setup_streammux(2, NUM_PADS);
+
+    /* only sink_0 delivers: the batch waits for sink_1 until max-wait-time */
+    push_frame(0, 0);
+    GstClockID id;
+    gst_test_clock_wait_for_next_pending_id(GST_TEST_CLOCK(test_clock), &id);
+    fail_unless_equals_uint64(gst_clock_id_get_time(id), MAX_WAIT_TIME);
+    gst_clock_id_unref(id);
+    fail_unless_equals_int(g_async_queue_length(outputs), 0);
+
+    fail_unless(gst_test_clock_crank(GST_TEST_CLOCK(test_clock)));
+    fail_unless_equals_int(pop_output(0, 1), 0);
+
+    /* a frame on the missing pad completes the next batch before its deadline */
+    push_frame(0, FRAME_DURATION);
+    push_frame(1, FRAME_DURATION);
+    check_complete_batch(FRAME_DURATION);
+
+    cleanup_streammux();
+}
+GST_END_TEST;
+
+GST_START_TEST(test_flush_drops_queued_frames) {
+    setup_streammux(2, NUM_PADS);
+
+    push_frame(0, 0);
+    gst_test_clock_wait_for_next_pending_id(GST_TEST_CLOCK(test_clock), NULL);
+
+    /* flush while the batch waits for its deadline */
+    fail_unless(gst_pad_push_event(srcpads[0], gst_event_new_flush_start()));
+    fail_unless(gst_pad_push_event(srcpads[0], gst_event_new_flush_stop(TRUE)));
+    fail_unless_equals_int(GPOINTER_TO_UINT(g_async_queue_timeout_pop(flush_events, 5 * G_USEC_PER_SEC)),
+                           GST_EVENT_FLUSH_START);
+    fail_unless_equals_int(GPOINTER_TO_UINT(g_async_queue_timeout_pop(flush_events, 5 * G_USEC_PER_SEC)),
+                           GST_EVENT_FLUSH_STOP);
+    fail_unless_equals_int(g_async_queue_length(outputs), 0);
+
+    /* streaming restarts from the beginning, the flushed frame is not pushed */
+    GstSegment segment;
+    gst_segment_init(&segment, GST_FORMAT_TIME);
+    fail_unless(gst_pad_push_event(srcpads[0], gst_event_new_segment(&segment)));
+    for (guint i = 0; i < NUM_PADS; i++)
+        push_frame(i, 0);
+    check_complete_batch(0);
+    fail_unless_equals_int(g_async_queue_length(outputs), 0);
+
+    cleanup_streammux();
+}
+GST_END_TEST;
+
+static gpointer push_blocked_frame(gpointer) {
+    GstBuffer *buf = gst_buffer_new_allocate(NULL, 8 * 8 * 3, NULL);
+    return GINT_TO_POINTER(gst_pad_push(srcpads[0], buf));
+}
+
+GST_START_TEST(test_release_pad_with_blocked_chain) {
+    /* sink_1 never gets caps, so the output task doesn't consume anything */
+    setup_streammux(1, 1);
+
+    push_frame(0, 0);
+    GThread *thread = g_thread_new("blocked-push", push_blocked_frame, NULL);
+    /* chain() holds the stream lock while it waits for space in the queue */
+    while (GST_PAD_STREAM_TRYLOCK(mux_sinkpads[0])) {
+        GST_PAD_STREAM_UNLOCK(mux_sinkpads[0]);
+        g_usleep(1000);
+    }
+
+    /* releasing the pad wakes chain() blocked on the full queue before freeing it */
+    gst_element_release_request_pad(mux, mux_sinkpads[0]);
+    fail_unless_equals_int(GPOINTER_TO_INT(g_thread_join(thread)), GST_FLOW_FLUSHING);
+    gst_object_unref(mux_sinkpads[0]);
+    mux_sinkpads[0] = NULL;
+
+    cleanup_streammux();
+}
+GST_END_TEST;
+
+GST_START_TEST(test_max_queue_size_is_bounded) {
+    /* pad queues are allocated up front, so the property must not accept sizes that can't be allocated */
+    GstElement *element = gst_element_factory_make("gvastreammux", NULL);
+    GParamSpecUInt *pspec =
+        G_PARAM_SPEC_UINT(g_object_class_find_property(G_OBJECT_GET_CLASS(element), "max-queue-size"));
+    fail_unless_equals_int(pspec->maximum, GST_GVA_STREAMMUX_MAX_QUEUE_SIZE);
+
+    g_object_set(element, "max-queue-size", GST_GVA_STREAMMUX_MAX_QUEUE_SIZE, NULL);
+    GstPad *pad = gst_element_request_pad_simple(element, "sink_%u");
+    fail_unless(pad != NULL);
+    fail_unless(gst_element_set_state(element, GST_STATE_PAUSED) != GST_STATE_CHANGE_FAILURE);
+    fail_unless_equals_int(gst_element_set_state(element, GST_STATE_NULL), GST_STATE_CHANGE_SUCCESS);
+    gst_element_release_request_pad(element, pad);
+    gst_object_unref(pad);
+    gst_object_unref(element);
+}
+GST_END_TEST;
+
+static Suite *streammux_suite(void) {
+    Suite *s = suite_create("gvastreammux");
+    TCase *tc_chain = tcase_create("general");
+
+    gst_element_register(NULL, "gvastreammux", GST_RANK_NONE, GST_TYPE_GVA_STREAMMUX);
+
+    suite_add_tcase(s, tc_chain);
+    tcase_add_test(tc_chain, test_complete_batch_without_deadline);
+    tcase_add_test(tc_chain, test_partial_batch_on_deadline);
+    tcase_add_test(tc_chain, test_flush_drops_queued_frames);
+    tcase_add_test(tc_chain, test_release_pad_with_blocked_chain);
+    tcase_add_test(tc_chain, test_max_queue_size_is_bounded);
+
+    return s;
+}
+
+GST_CHECK_MAIN(streammux);